@@ -71,6 +71,12 @@ newoption
     description = "Use OpenGL ES instead of OpenGL (Linux only)"
 }
 
+newoption
+{
+    trigger = "headless",
+    description = "Use the Null display and the Dummy input & sound plugins instead of GLFW & MiniAudio (Linux only)"
+}
+
 if os.is ("macosx") then
     osname = "mac"
 else
@@ -371,6 +377,79 @@ project "orx"
         }
 
 
+--
+-- Project: orxBenchmark
+--
+
+project "orxBenchmark"
+
+    files {"../src/main/orxBenchmark.c"}
+
+    targetdir ("../bin")
+    if _OPTIONS["split-platforms"] then
+        configuration {"x32"}
+            targetdir ("../bin/x32")
+
+        configuration {"x64"}
+            targetdir ("../bin/x64")
+
+        configuration {}
+    end
+
+    kind ("ConsoleApp")
+
+    links {"orxLIB"}
+
+    configuration {"not xcode*", "*Core*"}
+        defines {"__orxSTATIC__"}
+
+
+-- Linux
+
+    configuration {"linux"}
+        linkoptions {"-Wl,-rpath ./"}
+        links
+        {
+            "dl",
+            "m",
+            "rt"
+        }
+
+    configuration {"linux", "*Core*"}
+        linkoptions {"-Wl,--no-whole-archive"}
+        links {"pthread"}
+
+    -- This prevents an optimization bug from happening with some versions of gcc on linux
+    configuration {"linux", "not *Debug*"}
+        buildoptions {"-fschedule-insns"}
+
+
+-- Mac OS X
+
+    configuration {"macosx", "gmake", "*Core*"}
+        links
+        {
+            "Foundation.framework",
+            "IOKit.framework"
+        }
+
+    configuration {"macosx", "codelite or codeblocks", "*Core*"}
+        linkoptions
+        {
+            "-framework Foundation",
+            "-framework IOKit"
+        }
+
+
+-- Windows
+
+    configuration {"windows", "*Core*"}
+        links
+        {
+            "winmm"
+        }
+
+
 --
 -- Project: orxLIB
 --
@@ -397,6 +476,7 @@ project "orxLIB"
     excludes
     {
         "../src/main/orxMain.c",
+        "../src/main/orxBenchmark.c",
         "../build/template/**.c",
         "../build/template/**.cpp",
         "../build/template/**.h",
@@ -475,22 +555,34 @@ project "orxLIB"
         defines {"_GNU_SOURCE"}
 
     configuration {"linux", "not *Core*"}
-        links
-        {
-            "glfw3",
-            "X11",
-            "Xrandr",
-            "dl",
-            "m",
-            "rt",
-            "pthread",
-            "gcc"
-        }
-        if _OPTIONS["gles"] then
-            defines {"__orxDISPLAY_OPENGL_ES__"}
-            links {"GLESv3"}
+        if _OPTIONS["headless"] then
+            defines {"__orxDISPLAY_NULL__"}
+            links
+            {
+                "dl",
+                "m",
+                "rt",
+                "pthread",
+                "gcc"
+            }
         else
-            links {"GL"}
+            links
+            {
+                "glfw3",
+                "X11",
+                "Xrandr",
+                "dl",
+                "m",
+                "rt",
+                "pthread",
+                "gcc"
+            }
+            if _OPTIONS["gles"] then
+                defines {"__orxDISPLAY_OPENGL_ES__"}
+                links {"GLESv3"}
+            else
+                links {"GL"}
+            end
         end
 
     configuration {"linux", "*Core*"}
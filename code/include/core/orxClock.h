@@ -106,6 +106,20 @@ typedef struct __orxCLOCK_INFO_t
 } orxCLOCK_INFO;
 
 
+/** Clock pacing stats structure
+ */
+typedef struct __orxCLOCK_PACING_STATS_t
+{
+  orxDOUBLE         dLastJitter;                                  /**< Lateness of the last paced update, compared to its scheduled time (in seconds) */
+  orxDOUBLE         dAverageJitter;                               /**< Average lateness of paced updates (in seconds) */
+  orxDOUBLE         dMaxJitter;                                   /**< Max lateness of paced updates (in seconds) */
+  orxDOUBLE         dSleepTime;                                   /**< Total time spent sleeping (in seconds) */
+  orxDOUBLE         dSpinTime;                                    /**< Total time spent actively waiting (in seconds) */
+  orxU32            u32UpdateCount;                               /**< Number of paced updates */
+
+} orxCLOCK_PACING_STATS;
+
+
 /** Event enum
  */
 typedef enum __orxCLOCK_EVENT_t
@@ -288,6 +302,14 @@ extern orxDLLAPI orxCLOCK *orxFASTCALL                orxClock_Get(const orxSTRI
 extern orxDLLAPI const orxSTRING orxFASTCALL          orxClock_GetName(const orxCLOCK *_pstClock);
 
 
+/** Gets frame pacing stats, accumulated since the last reset
+ * @param[out]  _pstStats                             Stats to fill
+ * @param[in]   _bReset                               Reset stats once retrieved
+ * @return      orxCLOCK_PACING_STATS
+ */
+extern orxDLLAPI orxCLOCK_PACING_STATS *orxFASTCALL   orxClock_GetPacingStats(orxCLOCK_PACING_STATS *_pstStats, orxBOOL _bReset);
+
+
 /** Adds a timer function to a clock
  * @param[in]   _pstClock                             Concerned clock
  * @param[in]   _pfnCallback                          Concerned timer callback
@@ -307,6 +329,22 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_AddTimer(orxCLOCK
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, void *_pContext);
 
+/** Adds a timer function to a clock and gets its handle
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pfnCallback                          Concerned timer callback
+ * @param[in]   _fDelay                               Timer's delay between 2 calls, must be strictly positive
+ * @param[in]   _s32Repetition                        Number of times this timer should be called before removed, -1 for infinite
+ * @param[in]   _pContext                             Context that will be transmitted to the callback when called
+ * @return      Timer handle / orxU64_UNDEFINED
+ */
+extern orxDLLAPI orxU64 orxFASTCALL                   orxClock_AddTimerWithHandle(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, orxS32 _s32Repetition, void *_pContext);
+
+/** Removes a timer function using its handle, without having to search the clock's timers
+ * @param[in]   _u64Handle                            Handle of the timer to remove, as returned by orxClock_AddTimerWithHandle
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxClock_RemoveTimerFromHandle(orxU64 _u64Handle);
+
 /** Adds a global timer function (ie. using the main core clock)
  * @param[in]   _pfnCallback                          Concerned timer callback
  * @param[in]   _fDelay                               Timer's delay between 2 calls, must be strictly positive
@@ -235,6 +235,20 @@ extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_Evaluate(const
 */
 extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_EvaluateWithGUID(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult);
 
+/** Compiles a command line: resolves its commands & aliases and pre-parses its constant arguments, the result is cached until commands or aliases change
+* @param[in]   _zCommandLine  Command name + arguments
+* @return      Compiled command line ID if successful, orxSTRINGID_UNDEFINED otherwise
+*/
+extern orxDLLAPI orxSTRINGID orxFASTCALL              orxCommand_Compile(const orxSTRING _zCommandLine);
+
+/** Runs a compiled command line
+* @param[in]   _stCompiledID  Compiled command line ID, as returned by orxCommand_Compile
+* @param[in]   _u64GUID       GUID to use in place of the GUID markers in the command, orxU64_UNDEFINED for none
+* @param[out]  _pstResult     Variable that will contain the result
+* @return      Command result if found, orxNULL otherwise
+*/
+extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_Run(orxSTRINGID _stCompiledID, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult);
+
 /** Executes a command
 * @param[in]   _zCommand      Command name
 * @param[in]   _u32ArgNumber  Number of arguments sent to the command
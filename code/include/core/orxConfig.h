@@ -214,6 +214,12 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SetDefaultParent(const o
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL  orxConfig_GetDefaultParent();
 
+/** Gets config revision, incremented whenever a value, a section or a parent is added, modified or removed. Can be used to
+ * validate data derived from config without having to re-read it.
+ * @return Current revision
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxConfig_GetRevision();
+
 /** Gets current working section
  * @return Current selected section
  */
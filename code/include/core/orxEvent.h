@@ -138,14 +138,14 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Init();
  */
 extern orxDLLAPI void orxFASTCALL       orxEvent_Exit();
 
-/** Adds an event handler
+/** Adds an event handler, a handler added while an event of the same type is being sent won't be called for that event
  * @param[in] _eEventType           Concerned type of event
  * @param[in] _pfnEventHandler      Event handler to add
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_AddHandler(orxEVENT_TYPE _eEventType, orxEVENT_HANDLER _pfnEventHandler);
 
-/** Adds an event handler with user-defined context
+/** Adds an event handler with user-defined context, a handler added while an event of the same type is being sent won't be called for that event
  * @param[in] _eEventType           Concerned type of event
  * @param[in] _pfnEventHandler      Event handler to add
  * @param[in] _pContext             Context that will be stored in events sent to this handler
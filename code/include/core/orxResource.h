@@ -50,6 +50,20 @@
 
 #define orxRESOURCE_KZ_DEFAULT_STORAGE                    "."
 #define orxRESOURCE_KZ_TYPE_TAG_FILE                      "file"
+#define orxRESOURCE_KZ_TYPE_TAG_ARCHIVE                   "archive"
+
+/** Archive format (little endian), used by storages such as "archive:path/to/file.orxa":
+ * - header: tag (4 bytes), entry count (u32), uncompressed block size (u32), name table size (u32)
+ * - entry index, sorted by name ID (orxString_Hash of the entry name):
+ *   name ID (u64), block table offset (u64), uncompressed size (u64), name offset (u32), block count (u32)
+ * - name table: NUL-terminated entry names
+ * - entry data: block table (packed size of each block, u32), followed by the blocks themselves,
+ *   LZ4-compressed (raw block format) or stored as is when their packed size equals their uncompressed size
+ */
+#define orxRESOURCE_KZ_ARCHIVE_BINARY_TAG                 "OXA1"
+#define orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE              (4 + 4 + 4 + 4)
+#define orxRESOURCE_KU32_ARCHIVE_ENTRY_SIZE               (8 + 8 + 8 + 4 + 4)
+#define orxRESOURCE_KU32_ARCHIVE_DEFAULT_BLOCK_SIZE       65536
 
 
 /** Resource asynchronous operation callback function
@@ -69,6 +83,8 @@ typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_TELL)(orxHANDLE _hRes
 typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_READ)(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer);
 typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_WRITE)(orxHANDLE _hResource, orxS64 _s64Size, const void *_pBuffer);
 typedef orxSTATUS       (orxFASTCALL *orxRESOURCE_FUNCTION_DELETE)(const orxSTRING _zLocation);
+typedef const void *    (orxFASTCALL *orxRESOURCE_FUNCTION_MAP)(orxHANDLE _hResource, orxS64 *_ps64Size);
+typedef void            (orxFASTCALL *orxRESOURCE_FUNCTION_UNMAP)(orxHANDLE _hResource, const void *_pMap, orxS64 _s64Size);
 
 /** Resource type info
  */
@@ -85,6 +101,8 @@ typedef struct __orxRESOURCE_TYPE_INFO_t
   orxRESOURCE_FUNCTION_READ     pfnRead;                  /**< Read function, mandatory */
   orxRESOURCE_FUNCTION_WRITE    pfnWrite;                 /**< Write function, optional, for write support */
   orxRESOURCE_FUNCTION_DELETE   pfnDelete;                /**< Delete function, optional, for deletion support */
+  orxRESOURCE_FUNCTION_MAP      pfnMap;                   /**< Map function, optional, for zero-copy read support */
+  orxRESOURCE_FUNCTION_UNMAP    pfnUnmap;                 /**< Unmap function, optional, mandatory if Map is provided */
 
 } orxRESOURCE_TYPE_INFO;
 
@@ -234,6 +252,19 @@ extern orxDLLAPI const orxSTRING orxFASTCALL              orxResource_GetLocatio
  */
 extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_GetSize(orxHANDLE _hResource);
 
+/** Maps the whole content of a resource in memory, read-only, without copying it; the mapping stays valid until orxResource_Unmap or orxResource_Close is called
+ * If the resource type doesn't support mapping, orxNULL is returned and the content should be retrieved with orxResource_Read instead
+ * @param[in] _hResource        Concerned resource
+ * @param[out] _ps64Size        Size of the mapped content, in bytes
+ * @return Read-only address of the resource's content if successful, orxNULL otherwise
+ */
+extern orxDLLAPI const void *orxFASTCALL                  orxResource_Map(orxHANDLE _hResource, orxS64 *_ps64Size);
+
+/** Unmaps the content of a resource previously mapped with orxResource_Map
+ * @param[in] _hResource        Concerned resource
+ */
+extern orxDLLAPI void orxFASTCALL                         orxResource_Unmap(orxHANDLE _hResource);
+
 /** Seeks a position in a given resource (moves cursor)
  * @param[in] _hResource        Concerned resource
  * @param[in] _s64Offset        Number of bytes to offset from 'origin'
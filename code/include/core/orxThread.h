@@ -63,10 +63,16 @@
 /** Semaphore structure */
 typedef struct __orxTHREAD_SEMAPHORE_t                orxTHREAD_SEMAPHORE;
 
+/** Job structure */
+typedef struct __orxTHREAD_JOB_t                      orxTHREAD_JOB;
+
 
 /** Thread run function type */
 typedef orxSTATUS (orxFASTCALL *orxTHREAD_FUNCTION)(void *_pContext);
 
+/** Range function type, used by orxThread_ParallelFor, processes indices [_u32Start, _u32End[ */
+typedef orxSTATUS (orxFASTCALL *orxTHREAD_RANGE_FUNCTION)(orxU32 _u32Start, orxU32 _u32End, void *_pContext);
+
 
 /** Thread module setup
  */
@@ -149,8 +155,8 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_WaitSemaphore(or
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_SignalSemaphore(orxTHREAD_SEMAPHORE *_pstSemaphore);
 
 
-/** Runs an asynchronous task and optional follow-ups
- * @param[in]   _pfnRun                               Asynchronous task to run, executed on a different thread dedicated to tasks, if orxNULL defaults to an empty task that always succeed
+/** Runs an asynchronous task and optional follow-ups, serialized with all the other non-parallel tasks
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on one of the task worker threads once all previously submitted non-parallel tasks have completed, if orxNULL defaults to an empty task that always succeed
  * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pContext                             Context that will be transmitted to all the task functions
@@ -158,11 +164,77 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_SignalSemaphore(
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext);
 
+/** Runs an asynchronous task and optional follow-ups, concurrently with any other tasks (opt-in, no ordering guarantee)
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on one of the task worker threads concurrently with other tasks, if orxNULL defaults to an empty task that always succeed
+ * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL, might be called before the follow-ups of previously submitted tasks
+ * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL, might be called before the follow-ups of previously submitted tasks
+ * @param[in]   _pContext                             Context that will be transmitted to all the task functions
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunParallelTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext);
+
 /** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
  * @return      Number of pending asynchronous tasks
  */
 extern orxDLLAPI orxU32 orxFASTCALL                   orxThread_GetTaskCount();
 
+/** Gets number of task worker threads
+ * @return      Number of task worker threads, 0 if they haven't been started yet
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxThread_GetWorkerCount();
+
+/** Gets number of asynchronous tasks queued and not yet picked up by a worker
+ * @return      Number of queued asynchronous tasks
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxThread_GetQueuedTaskCount();
+
+/** Gets number of asynchronous tasks that have been stolen by a worker from another worker's queue, since the module was initialized
+ * @return      Number of stolen tasks
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxThread_GetTaskStealCount();
+
+
+/** Creates a job, to be submitted with orxThread_SubmitJob once all its dependencies have been added
+ * @param[in]   _pfnRun                               Function to run, on any worker thread or on a thread waiting for a job, if orxNULL defaults to an empty job that always succeeds
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxTHREAD_JOB / orxNULL
+ */
+extern orxDLLAPI orxTHREAD_JOB *orxFASTCALL           orxThread_CreateJob(const orxTHREAD_FUNCTION _pfnRun, void *_pContext);
+
+/** Deletes a job, which should either be done or have never been submitted nor used as a dependency
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_DeleteJob(orxTHREAD_JOB *_pstJob);
+
+/** Adds a dependency to a job: it will only run once the dependency is done
+ * @param[in]   _pstJob                               Concerned job, must not have been submitted yet
+ * @param[in]   _pstDependency                        Job to wait for
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_AddJobDependency(orxTHREAD_JOB *_pstJob, orxTHREAD_JOB *_pstDependency);
+
+/** Submits a job: it will run as soon as all its dependencies are done
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_SubmitJob(orxTHREAD_JOB *_pstJob);
+
+/** Waits for a job to be done, running ready jobs on the calling thread in the meantime
+ * @param[in]   _pstJob                               Concerned job, must have been submitted
+ * @return      Job's result: orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_WaitJob(orxTHREAD_JOB *_pstJob);
+
+/** Runs a function over a range of indices, split in chunks processed in parallel by the worker threads and the calling thread, and waits for completion
+ * @param[in]   _u32Count                             Number of indices, [0, _u32Count[
+ * @param[in]   _u32Grain                             Max number of indices per chunk, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run for each chunk, can be called concurrently from different threads
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxSTATUS_SUCCESS if all chunks succeeded, orxSTATUS_FAILURE otherwise
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_RANGE_FUNCTION _pfnRun, void *_pContext);
+
 /** Sets callbacks to run when starting and stopping new threads
  * @param[in]   _pfnStart                             Function to run whenever a new thread is started
  * @param[in]   _pfnStop                              Function to run whenever a thread is stopped
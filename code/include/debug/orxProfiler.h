@@ -241,6 +241,23 @@ extern orxDLLAPI orxDOUBLE orxFASTCALL            orxProfiler_GetUniqueMarkerSta
 extern orxDLLAPI orxU32 orxFASTCALL               orxProfiler_GetUniqueMarkerDepth(orxS32 _s32MarkerID);
 
 
+/** Enables/disables event tracing: when enabled, every marker push/pop is recorded, with its time stamp, in a per-thread ring buffer
+ * @param[in] _bEnable          Enable
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_EnableTrace(orxBOOL _bEnable);
+
+/** Is event tracing enabled?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsTraceEnabled();
+
+/** Exports all the recorded trace events to a file, using the Chrome Trace Event JSON format (can be opened with chrome://tracing or Perfetto)
+ * @param[in] _zFileName        Name of the file to write
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_ExportTrace(const orxSTRING _zFileName);
+
+
 #endif /* _orxPROFILER_H_ */
 
 /** @} */
@@ -155,13 +155,27 @@ typedef struct __orxCHARACTER_GLYPH_t
  */
 typedef struct __orxCHARACTER_MAP_t
 {
-  orxFLOAT      fCharacterHeight;
+  orxFLOAT              fCharacterHeight;
 
-  orxBANK      *pstCharacterBank;
-  orxHASHTABLE *pstCharacterTable;
+  orxBANK              *pstCharacterBank;
+  orxHASHTABLE         *pstCharacterTable;
+
+  orxCHARACTER_GLYPH  **apstGlyphList;        /**< Direct-index glyph list, covering [u32GlyphListBase, u32GlyphListBase + u32GlyphListSize[ */
+  orxU32                u32GlyphListBase;
+  orxU32                u32GlyphListSize;
+  orxU32                u32Revision;          /**< Incremented every time the map's content changes */
 
 } orxCHARACTER_MAP;
 
+/** Character quad structure: a glyph placed at a position relative to the text's top left corner
+ */
+typedef struct __orxCHARACTER_QUAD_t
+{
+  orxCHARACTER_GLYPH    stGlyph;
+  orxFLOAT              fX, fY;
+
+} orxCHARACTER_QUAD;
+
 /** Bitmap smoothing enum
  */
 typedef enum __orxDISPLAY_SMOOTHING_t
@@ -857,6 +871,38 @@ static orxCOLOR *orxFASTCALL      orxColor_FromHSVToRGB(orxCOLOR *_pstDst, const
   return pstResult;
 }
 
+/** Gets a glyph from a character map
+ * @param[in]   _pstMap         Concerned character map
+ * @param[in]   _u32CodePoint   Character code point
+ * @return      orxCHARACTER_GLYPH / orxNULL
+ */
+static orxINLINE const orxCHARACTER_GLYPH *orxCharacterMap_GetGlyph(const orxCHARACTER_MAP *_pstMap, orxU32 _u32CodePoint)
+{
+  orxU32                    u32Index;
+  const orxCHARACTER_GLYPH *pstResult;
+
+  /* Checks */
+  orxASSERT(_pstMap != orxNULL);
+
+  /* Gets index in direct list */
+  u32Index = _u32CodePoint - _pstMap->u32GlyphListBase;
+
+  /* Inside direct list? */
+  if(u32Index < _pstMap->u32GlyphListSize)
+  {
+    /* Updates result */
+    pstResult = _pstMap->apstGlyphList[u32Index];
+  }
+  else
+  {
+    /* Updates result */
+    pstResult = (const orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, _u32CodePoint);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Gets blend mode from a string
  * @param[in]    _zBlendMode                          String to evaluate
  * @return orxDISPLAY_BLEND_MODE
@@ -1030,6 +1076,19 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_TransformBitmap
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode);
 
+/** Transforms a list of pre-placed character quads (onto a bitmap), skipping any string decoding / glyph lookup
+ * @param[in]   _astQuadList                          List of character quads to display
+ * @param[in]   _u32QuadNumber                        Number of character quads
+ * @param[in]   _pstFont                              Font bitmap
+ * @param[in]   _pstMap                               Character map
+ * @param[in]   _pstTransform                         Transformation info (position, scale, rotation, ...)
+ * @param[in]   _stColor                              Color
+ * @param[in]   _eSmoothing                           Bitmap smoothing type
+ * @param[in]   _eBlendMode                           Blend mode
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_TransformCharacterList(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadNumber, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode);
+
 
 /** Draws a line
  * @param[in]   _pvStart                              Start point
@@ -1146,6 +1205,16 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetShaderFloat(
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue);
 
+/** Sets a block of shader parameters (float / orxVECTOR) at once
+ * @param[in]   _hShader                              Concerned shader
+ * @param[in]   _u32ParamNumber                       Number of parameters in the block
+ * @param[in]   _as32IDList                           List of parameter IDs
+ * @param[in]   _au32SizeList                         List of parameter sizes, in floats (1 for float, 3 for orxVECTOR)
+ * @param[in]   _afValueList                          Contiguous list of values, in the same order as the IDs
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetShaderParamBlock(orxHANDLE _hShader, orxU32 _u32ParamNumber, const orxS32 *_as32IDList, const orxU32 *_au32SizeList, const orxFLOAT *_afValueList);
+
 /** Gets a shader (internal) ID
  * @param[in]   _hShader                              Concerned bitmap
  * @return orxU32
@@ -137,6 +137,13 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxText_GetString(const orxTEXT *_p
  */
 extern orxDLLAPI orxFONT *orxFASTCALL     orxText_GetFont(const orxTEXT *_pstText);
 
+/** Gets text's cached character quad list, rebuilt if its font's character map has changed since last update
+ * @param[in]   _pstText      Concerned text
+ * @param[out]  _pu32Count    Number of character quads
+ * @return      Character quad list / orxNULL if not available (render from string instead)
+ */
+extern orxDLLAPI const orxCHARACTER_QUAD *orxFASTCALL orxText_GetCharacterList(const orxTEXT *_pstText, orxU32 *_pu32Count);
+
 
 /** Sets text's size, will lead to reformatting if text doesn't fit (pass width = -1.0f to restore text's original size, ie. unconstrained)
  * @param[in]   _pstText      Concerned text
@@ -201,6 +201,20 @@ extern orxDLLAPI orxS64 orxFASTCALL         orxFile_GetSize(const orxFILE *_pstF
  */
 extern orxDLLAPI orxS64 orxFASTCALL         orxFile_GetTime(const orxFILE *_pstFile);
 
+/** Maps a file's content in memory, read-only, without copying it (not available on all platforms)
+ * @param[in] _pstFile              Concerned file
+ * @param[out] _ps64Size            Size of the mapped content
+ * @return Address of the mapped content if successful, orxNULL otherwise
+ */
+extern orxDLLAPI const void *orxFASTCALL    orxFile_Map(orxFILE *_pstFile, orxS64 *_ps64Size);
+
+/** Unmaps a file's content previously mapped with orxFile_Map
+ * @param[in] _pMap                 Address of the mapped content
+ * @param[in] _s64Size              Size of the mapped content
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxFile_Unmap(const void *_pMap, orxS64 _s64Size);
+
 /** Prints a formatted string to a file
  * @param[in] _pstFile             Pointer to the file descriptor
  * @param[in] _zString             Formatted string
@@ -253,6 +253,12 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_GetUsage(orx
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_Track(orxMEMORY_TYPE _eMemType, orxU32 _u32Size, orxBOOL _bAllocate);
 
+/** Resets peak memory usage for a given type to its current usage
+ * @param[in] _eMemType               Concerned memory type
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_ResetPeakUsage(orxMEMORY_TYPE _eMemType);
+
 #endif /* __orxPROFILER__  */
 
 #endif /* _orxMEMORY_H_ */
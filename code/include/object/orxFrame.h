@@ -88,7 +88,9 @@
 #define orxFRAME_KU32_MASK_IGNORE_POSITION            0x0007F000  /**< Position is unaffected by parent */
 #define orxFRAME_KU32_MASK_IGNORE_ALL                 0x0007FF00  /**< Rotation, scale and position are unaffected by parent */
 
-#define orxFRAME_KU32_MASK_USER_ALL                   0x0007FFFF  /**< User all ID mask */
+#define orxFRAME_KU32_FLAG_TRACK_CHANGES              0x00100000  /**< Global data changes are tracked, see orxFrame_PopChanged() */
+
+#define orxFRAME_KU32_MASK_USER_ALL                   0x0017FFFF  /**< User all ID mask */
 
 
 /** Frame space enum
@@ -180,6 +182,25 @@ extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_GetSibling(const orxFRAME
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsRootChild(const orxFRAME *_pstFrame);
 
+/** Enables / disables lazy update: when enabled, setters only mark frames as dirty and global data gets updated on demand (or by orxFrame_UpdateAll)
+ * @param[in]   _bEnable        Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             orxFrame_EnableLazyUpdate(orxBOOL _bEnable);
+
+/** Is lazy update enabled?
+ * @return orxTRUE if enabled, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsLazyUpdateEnabled();
+
+/** Updates global data of all dirty frames (only needed when lazy update is enabled)
+ */
+extern orxDLLAPI void orxFASTCALL             orxFrame_UpdateAll();
+
+/** Pops the next changed frame: only frames flagged with orxFRAME_KU32_FLAG_TRACK_CHANGES are considered, each of them being reported once after its global data changed, until popped
+ * @return orxFRAME / orxNULL if no tracked frame changed since last call
+ */
+extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_PopChanged();
+
 
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
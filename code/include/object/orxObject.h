@@ -86,6 +86,27 @@ typedef enum __orxOBJECT_EVENT_t
 /** Internal object structure */
 typedef struct __orxOBJECT_t                orxOBJECT;
 
+/** Group spatial grid stats */
+typedef struct __orxOBJECT_GRID_STATS_t
+{
+  orxU32  u32CellCount;                     /**< Number of used cells */
+  orxU32  u32BoundCount;                    /**< Number of objects binned in cells */
+  orxU32  u32UnboundCount;                  /**< Number of objects without a cell (no size or position) */
+  orxU32  u32MoveCount;                     /**< Number of cell changes since last reset */
+  orxU32  u32QueryCount;                    /**< Number of grid queries since last reset */
+
+} orxOBJECT_GRID_STATS;
+
+/** Box query (caller-owned storage & cursor of orxObject_GetNextEnabledInBox(), needs to be zeroed before its first use) */
+typedef struct __orxOBJECT_BOX_QUERY_t
+{
+  orxOBJECT **apstObjectList;               /**< Gathered objects */
+  orxU32      u32Count;                     /**< Number of gathered objects */
+  orxU32      u32Size;                      /**< Size of the gathered object list */
+  orxU32      u32Index;                     /**< Index of the next object to return */
+
+} orxOBJECT_BOX_QUERY;
+
 
 /** @name Internal module function
  * @{ */
@@ -1140,6 +1161,7 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxObject_GetName(const orxOBJECT *
  *     orxObject_DeleteNeighborList(pstBank);
  * }
  * @endcode
+ * Groups with a grid (see orxObject_SetGroupIDCellSize()) only test the objects binned around the box.
  * @param[in]   _pstCheckBox    Box to check intersection with
  * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
  * @return      orxBANK / orxNULL
@@ -1375,6 +1397,45 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_GetNext(const orxOBJECT *_
  * @return      orxOBJECT / orxNULL
  */
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_GetNextEnabled(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+
+/** Sets a group's spatial grid cell size. Objects of a group with a grid are binned in cells of that size, based on their
+ * world position and graphic size, which allows orxObject_GetNextEnabledInBox() to skip objects that are far from the queried box.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[in]   _fCellSize      Cell size, orxFLOAT_0 to remove the grid
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_SetGroupIDCellSize(orxSTRINGID _stGroupID, orxFLOAT _fCellSize);
+
+/** Gets a group's spatial grid cell size.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @return      Cell size / orxFLOAT_0 if the group doesn't have a grid
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL       orxObject_GetGroupIDCellSize(orxSTRINGID _stGroupID);
+
+/** Gets a group's spatial grid stats.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[out]  _pstStats       Grid stats
+ * @param[in]   _bReset         Resets move & query counts after retrieving them
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the group doesn't have a grid
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxObject_GetGroupIDGridStats(orxSTRINGID _stGroupID, orxOBJECT_GRID_STATS *_pstStats, orxBOOL _bReset);
+
+/** Gets next enabled object that potentially intersects a box. Results are a superset of the enabled objects whose graphic
+ * intersects the box and are gathered when _pstObject is orxNULL: objects shouldn't be deleted until the end of the iteration.
+ * They're returned in the same order as orxObject_GetNextEnabled() would. Groups without a grid (see orxObject_SetGroupIDCellSize())
+ * will return all their enabled objects. Results and cursor are kept in the given query: iterations using different queries can be nested.
+ * @param[in]   _pstObject      Concerned object, orxNULL to get the first one
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[in]   _pstBox         Box to consider, in world space (Z is ignored)
+ * @param[in,out] _pstQuery     Query used to store results and cursor, see orxObject_ClearBoxQuery()
+ * @return      orxOBJECT / orxNULL
+ */
+extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_GetNextEnabledInBox(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID, const orxAABOX *_pstBox, orxOBJECT_BOX_QUERY *_pstQuery);
+
+/** Clears a box query, freeing its storage.
+ * @param[in]   _pstQuery       Concerned query
+ */
+extern orxDLLAPI void orxFASTCALL           orxObject_ClearBoxQuery(orxOBJECT_BOX_QUERY *_pstQuery);
 /** @} */
 
 
@@ -1382,7 +1443,7 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_GetNextEnabled(const orxOB
  * @{ */
 /** Picks the first active object with size "under" the given position, within a given group. See
  * orxObject_BoxPick(), orxObject_CreateNeighborList() and orxObject_Raycast for other ways of picking
- * objects.
+ * objects. Groups with a grid (see orxObject_SetGroupIDCellSize()) only test the objects binned around the position.
  * @param[in]   _pvPosition     Position to pick from
  * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
  * @return      orxOBJECT / orxNULL
@@ -1390,12 +1451,33 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_GetNextEnabled(const orxOB
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID _stGroupID);
 
 /** Picks the first active object with size in contact with the given box, withing a given group. Use
- * orxObject_CreateNeighborList() to get all the objects in the box.
+ * orxObject_CreateNeighborList() to get all the objects in the box. Groups with a grid (see orxObject_SetGroupIDCellSize())
+ * only test the objects binned around the box.
  * @param[in]   _pstBox         Box to use for picking
  * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
  * @return      orxOBJECT / orxNULL
  */
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _stGroupID);
+
+/** Picks, for each box of a list, the first active object with size in contact with it, within a given group (same as calling
+ * orxObject_BoxPick() for each box). Groups without a grid are walked only once for the whole list.
+ * @param[in]   _astBoxList     Boxes to use for picking
+ * @param[in]   _u32Number      Number of boxes
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[out]  _apstObjectList Picked object for each box, orxNULL if none
+ * @return      Number of boxes for which an object has been picked
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxObject_BoxPickBatch(const orxOBOX *_astBoxList, orxU32 _u32Number, orxSTRINGID _stGroupID, orxOBJECT **_apstObjectList);
+
+/** Gets the enabled objects nearest to a position, within a given group. Distances are computed in 2D, to the center of the
+ * objects' bounding boxes. Groups with a grid (see orxObject_SetGroupIDCellSize()) only visit the cells around the position.
+ * @param[in]   _pvPosition     Position to consider (Z is ignored)
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[in]   _u32Number      Maximum number of objects to retrieve
+ * @param[out]  _apstObjectList Nearest objects, sorted by increasing distance
+ * @return      Number of objects retrieved
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxObject_GetNearestList(const orxVECTOR *_pvPosition, orxSTRINGID _stGroupID, orxU32 _u32Number, orxOBJECT **_apstObjectList);
 /** @} */
 
 #endif /* _orxOBJECT_H_ */
@@ -299,6 +299,54 @@ typedef struct __orxPHYSICS_EVENT_PAYLOAD_t
 
 } orxPHYSICS_EVENT_PAYLOAD;
 
+/** Contact record, used for batched contact delivery
+ */
+typedef struct __orxPHYSICS_CONTACT_t
+{
+  orxPHYSICS_EVENT_PAYLOAD  stPayload;                /**< Contact payload : 32 */
+  orxHANDLE                 hSender;                  /**< Sender (owner of the sender part) : 36 */
+  orxHANDLE                 hRecipient;               /**< Recipient (owner of the recipient part) : 40 */
+  orxPHYSICS_EVENT          eID;                      /**< Contact event ID : 44 */
+
+} orxPHYSICS_CONTACT;
+
+/** Raycast query, used for batched raycasts
+ */
+typedef struct __orxPHYSICS_RAYCAST_t
+{
+  orxVECTOR                 vBegin;                   /**< Beginning of raycast : 12 */
+  orxVECTOR                 vEnd;                     /**< End of raycast : 24 */
+  orxU16                    u16SelfFlags;             /**< Self flags used for filtering (0xFFFF for no filtering) : 26 */
+  orxU16                    u16CheckMask;             /**< Check mask used for filtering (0xFFFF for no filtering) : 28 */
+  orxBOOL                   bEarlyExit;               /**< Should stop as soon as a body has been hit (which might not be the closest) : 32 */
+
+} orxPHYSICS_RAYCAST;
+
+/** Raycast result, used for batched raycasts
+ */
+typedef struct __orxPHYSICS_RAYCAST_RESULT_t
+{
+  orxVECTOR                 vContact;                 /**< Contact position : 12 */
+  orxVECTOR                 vNormal;                  /**< Contact normal : 24 */
+  orxHANDLE                 hUserData;                /**< Colliding body's user data / orxHANDLE_UNDEFINED : 28 */
+
+} orxPHYSICS_RAYCAST_RESULT;
+
+/** Box pick query, used for batched box picks
+ */
+typedef struct __orxPHYSICS_BOX_PICK_t
+{
+  orxAABOX                  stBox;                    /**< Box used for picking : 24 */
+  orxU16                    u16SelfFlags;             /**< Self flags used for filtering (0xFFFF for no filtering) : 26 */
+  orxU16                    u16CheckMask;             /**< Check mask used for filtering (0xFFFF for no filtering) : 28 */
+
+} orxPHYSICS_BOX_PICK;
+
+/** Contact batch callback, receives all the filtered contacts of a simulation update, in order
+ * Contacts whose bodies get deleted during the callback will have their sender, recipient and parts set to orxNULL, and should be skipped
+ */
+typedef void (orxFASTCALL *orxPHYSICS_CONTACT_FUNCTION)(const orxPHYSICS_CONTACT *_astContactList, orxU32 _u32Count, void *_pContext);
+
 /** Internal physics body structure
  */
 typedef struct __orxPHYSICS_BODY_t                    orxPHYSICS_BODY;
@@ -323,6 +371,7 @@ typedef struct __orxPHYSICS_BODY_JOINT_t              orxPHYSICS_BODY_JOINT;
 #define orxPHYSICS_KZ_CONFIG_SHOW_DEBUG               "ShowDebug"
 #define orxPHYSICS_KZ_CONFIG_COLLISION_FLAG_LIST      "CollisionFlagList"
 #define orxPHYSICS_KZ_CONFIG_INTERPOLATE              "Interpolate"
+#define orxPHYSICS_KZ_CONFIG_THREADED                 "Threaded"
 
 
 /***************************************************************************
@@ -728,12 +777,44 @@ extern orxDLLAPI orxHANDLE orxFASTCALL                orxPhysics_Raycast(const o
  */
 extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_BoxPick(const orxAABOX *_pstBox, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxHANDLE _ahUserDataList[], orxU32 _u32Number);
 
+/** Issues a batch of raycasts, queries are read-only and can be spread over worker threads
+ * @param[in]   _astRaycastList                       List of raycast queries
+ * @param[in]   _u32Number                            Number of queries
+ * @param[out]  _astResultList                        List of results, one per query, hUserData will be orxHANDLE_UNDEFINED if nothing was hit
+ * @param[in]   _bParallel                            Should queries be spread over worker threads
+ * @return      Number of queries that hit a body
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_RaycastBatch(const orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number, orxPHYSICS_RAYCAST_RESULT *_astResultList, orxBOOL _bParallel);
+
+/** Issues a batch of box picks, queries are read-only and can be spread over worker threads
+ * @param[in]   _astBoxPickList                       List of box pick queries
+ * @param[in]   _u32Number                            Number of queries
+ * @param[out]  _ahUserDataList                       List of user data to fill, query #i will use the slice [i * _u32UserDataNumber, (i + 1) * _u32UserDataNumber[, can be orxNULL for count only
+ * @param[in]   _u32UserDataNumber                    Number of user data per query
+ * @param[out]  _au32CountList                        List of counts, one per query. A count might be larger than _u32UserDataNumber, in which case you'd need to pass a larger array to retrieve them all
+ * @param[in]   _bParallel                            Should queries be spread over worker threads
+ * @return      Total count of found bodies
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                   orxPhysics_BoxPickBatch(const orxPHYSICS_BOX_PICK *_astBoxPickList, orxU32 _u32Number, orxHANDLE _ahUserDataList[], orxU32 _u32UserDataNumber, orxU32 _au32CountList[], orxBOOL _bParallel);
+
 
 /** Enables/disables physics simulation
  * @param[in]   _bEnable                              Enable / disable
  */
 extern orxDLLAPI void orxFASTCALL                     orxPhysics_EnableSimulation(orxBOOL _bEnable);
 
+
+/** Sets the contact batch callback: contacts matching the filter will be delivered as a single contiguous array, once per simulation update,
+ * instead of being sent as individual orxEVENT_TYPE_PHYSICS events. Contacts that don't match the filter are still sent as events.
+ * A contact matches if any of its two parts would collide with a part defined by the given flags/mask.
+ * @param[in]   _pfnCallback                          Callback to use, orxNULL to revert to single event dispatch for all contacts
+ * @param[in]   _u16SelfFlags                         Selfs flags used for filtering (0xFFFF for no filtering)
+ * @param[in]   _u16CheckMask                         Check mask used for filtering (0xFFFF for no filtering)
+ * @param[in]   _pContext                             Context that will be given to the callback
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxPhysics_SetContactCallback(const orxPHYSICS_CONTACT_FUNCTION _pfnCallback, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, void *_pContext);
+
 #endif /* _orxPHYSICS_H_ */
 
 /** @} */
@@ -122,6 +122,11 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_t
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_ENABLE_SIMULATION,
 
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_SET_CONTACT_CALLBACK,
+
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_RAYCAST_BATCH,
+  orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_BOX_PICK_BATCH,
+
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_NUMBER,
 
   orxPLUGIN_FUNCTION_BASE_ID_PHYSICS_NONE = orxENUM_NONE
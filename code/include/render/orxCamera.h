@@ -179,6 +179,19 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                  orxCamera_SetRotation(or
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                  orxCamera_SetZoom(orxCAMERA *_pstCamera, orxFLOAT _fZoom);
 
+/** Sets camera culling cell size: when non-null, the groups rendered by this camera will be spatially indexed with a grid of that cell size (see orxObject_SetGroupIDCellSize())
+ * @param[in]   _pstCamera      Concerned camera
+ * @param[in]   _fCellSize      Cell size, orxFLOAT_0 for none
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxCamera_SetCullingCellSize(orxCAMERA *_pstCamera, orxFLOAT _fCellSize);
+
+/** Gets camera culling cell size
+ * @param[in]   _pstCamera      Concerned camera
+ * @return      Cell size / orxFLOAT_0 if none
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL                   orxCamera_GetCullingCellSize(const orxCAMERA *_pstCamera);
+
 /** Gets camera frustum (3D box for 2D camera)
  * @param[in]   _pstCamera      Concerned camera
  * @param[out]  _pstFrustum    Frustum box
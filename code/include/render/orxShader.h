@@ -116,6 +116,21 @@ typedef struct __orxSHADER_EVENT_PAYLOAD_t
 
 } orxSHADER_EVENT_PAYLOAD;
 
+/** Shader parameter block, filled with the default values before being handed to the shader's param function
+ */
+typedef struct __orxSHADER_PARAM_BLOCK_t
+{
+  orxFLOAT             *afValueList;            /**< Float, vector & time values, in declaration order, vectors use 3 consecutive floats : 4 */
+  const orxTEXTURE    **apstTextureList;        /**< Texture values, in declaration order : 8 */
+  orxU32                u32ValueNumber;         /**< Number of floats in the value list : 12 */
+  orxU32                u32TextureNumber;       /**< Number of textures in the texture list : 16 */
+
+} orxSHADER_PARAM_BLOCK;
+
+/** Shader param function, called once per start instead of sending orxSHADER_EVENT_SET_PARAM events; returning orxSTATUS_FAILURE skips the update
+ */
+typedef orxSTATUS (orxFASTCALL *orxSHADER_PARAM_FUNCTION)(const orxSHADER *_pstShader, const orxSTRUCTURE *_pstOwner, orxSHADER_PARAM_BLOCK *_pstParamBlock, void *_pContext);
+
 
 /** Shader module setup
  */
@@ -235,6 +250,22 @@ extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_SetVectorParam(const o
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_CompileCode(orxSHADER *_pstShader, const orxSTRING *_azCodeList, orxU32 _u32Size);
 
+/** Sets a shader's param function: when set, all the parameters are provided through a single param block per start, without sending any event
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _pfnParamFunction       Param function, orxNULL to go back to default values / events
+ * @param[in] _pContext               Context that will be transmitted to the param function
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL          orxShader_SetParamFunction(orxSHADER *_pstShader, orxSHADER_PARAM_FUNCTION _pfnParamFunction, void *_pContext);
+
+/** Gets the index of a parameter in a shader's param block (in its value list for float / vector / time parameters, in its texture list for textures)
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _zName                  Parameter's literal name
+ * @param[in] _u32Index               Index in the parameter's array, 0 for simple variable
+ * @return Index in the param block / orxU32_UNDEFINED
+ */
+extern orxDLLAPI orxU32 orxFASTCALL             orxShader_GetParamBlockIndex(const orxSHADER *_pstShader, const orxSTRING _zName, orxU32 _u32Index);
+
 /** Enables/disables a shader
  * @param[in]   _pstShader            Concerned Shader
  * @param[in]   _bEnable              Enable / disable
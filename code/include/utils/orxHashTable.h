@@ -53,6 +53,7 @@ typedef struct __orxHASHTABLE_t orxHASHTABLE;
 /* Define flags */
 #define orxHASHTABLE_KU32_FLAG_NONE             0x00000000  /**< No flags (default behaviour) */
 #define orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE   0x00000001  /**< The Hash table will not be expandable */
+#define orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING  0x00000002  /**< The Hash table stores its items in flat arrays and grows with its load factor: buckets returned by orxHashTable_Retrieve are only valid until the next insertion */
 
 
 /** @name HashTable creation/destruction.
@@ -94,6 +95,7 @@ extern orxDLLAPI orxU32 orxFASTCALL             orxHashTable_GetCount(const orxH
 extern orxDLLAPI void *orxFASTCALL              orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key);
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
+ * With orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, the bucket is only valid until the next insertion in the same hash table.
  * @param[in] _pstHashTable   Concerned hashtable
  * @param[in] _u64Key         Key to find
  * @return The bucket associated to the given key if success, orxNULL otherwise
@@ -365,12 +365,14 @@ typedef struct __orxDISPLAY_LOAD_INFO_t
   orxU8      *pu8ImageSource;
   orxS64      s64Size;
   orxBITMAP  *pstBitmap;
+  orxHANDLE   hResource;
   orxU32      u32DataSize;
   GLuint      uiWidth;
   GLuint      uiHeight;
   GLuint      uiRealWidth;
   GLuint      uiRealHeight;
   orxBOOL     bIsBasisU;
+  orxBOOL     bIsMapped;
 
 } orxDISPLAY_LOAD_INFO;
 
@@ -403,9 +405,12 @@ typedef struct __orxDISPLAY_SHADER_t
   orxS32                    s32ParamCount;
   orxBOOL                   bPending;
   orxBOOL                   bUseCustomParam;
+  orxBOOL                   bUseParamBlock;
   orxSTRING                 zCode;
   orxDISPLAY_TEXTURE_INFO  *astTextureInfoList;
   orxDISPLAY_PARAM_INFO    *astParamInfoList;
+  orxFLOAT                 *afParamBlock;
+  orxU32                    u32ParamBlockSize;
 
 } orxDISPLAY_SHADER;
 
@@ -1591,6 +1596,47 @@ static int orxDisplay_GLFW_EOFSTBICallback(void *_hResource)
   return (orxResource_Tell((orxHANDLE)_hResource) == orxResource_GetSize(_hResource)) ? 1 : 0;
 }
 
+static orxINLINE void orxDisplay_GLFW_FreeImageSource(orxDISPLAY_LOAD_INFO *_pstInfo)
+{
+  /* Not mapped? */
+  if((_pstInfo->pu8ImageSource != orxNULL) && (_pstInfo->bIsMapped == orxFALSE))
+  {
+    /* Frees it */
+    orxMemory_Free(_pstInfo->pu8ImageSource);
+  }
+
+  /* Clears source */
+  _pstInfo->pu8ImageSource  = orxNULL;
+  _pstInfo->bIsMapped       = orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapFailureCallback(void *_pContext)
+{
+  orxDISPLAY_LOAD_INFO *pstInfo;
+
+  /* Gets load info */
+  pstInfo = (orxDISPLAY_LOAD_INFO *)_pContext;
+
+  /* Frees original source from resource */
+  orxDisplay_GLFW_FreeImageSource(pstInfo);
+
+  /* Has mapped resource? */
+  if(pstInfo->hResource != orxNULL)
+  {
+    /* Closes it (releases its mapping) */
+    orxResource_Close(pstInfo->hResource);
+  }
+
+  /* Frees load info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pContext)
 {
   orxDISPLAY_LOAD_INFO *pstInfo;
@@ -1813,11 +1859,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
       pstInfo->pu8ImageBuffer = orxNULL;
 
       /* Frees source */
-      if(pstInfo->pu8ImageSource != orxNULL)
-      {
-        orxMemory_Free(pstInfo->pu8ImageSource);
-        pstInfo->pu8ImageSource = orxNULL;
-      }
+      orxDisplay_GLFW_FreeImageSource(pstInfo);
 
       /* Clears loading flag */
       orxFLAG_SET(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING);
@@ -1844,11 +1886,14 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
     pstInfo->pu8ImageBuffer = orxNULL;
 
     /* Frees source */
-    if(pstInfo->pu8ImageSource != orxNULL)
-    {
-      orxMemory_Free(pstInfo->pu8ImageSource);
-      pstInfo->pu8ImageSource = orxNULL;
-    }
+    orxDisplay_GLFW_FreeImageSource(pstInfo);
+  }
+
+  /* Has mapped resource? */
+  if(pstInfo->hResource != orxNULL)
+  {
+    /* Closes it (releases its mapping) */
+    orxResource_Close(pstInfo->hResource);
   }
 
   /* Frees load info */
@@ -1985,7 +2030,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
       }
 
       /* Frees original source from resource */
-      orxMemory_Free(pstInfo->pu8ImageSource);
+      orxDisplay_GLFW_FreeImageSource(pstInfo);
 
       /* Stores uncompressed data as new source */
       pstInfo->pu8ImageSource = pu8ImageData;
@@ -1999,8 +2044,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
       pstInfo->uiRealHeight = 1;
 
       /* Frees original source from resource */
-      orxMemory_Free(pstInfo->pu8ImageSource);
-      pstInfo->pu8ImageSource = orxNULL;
+      orxDisplay_GLFW_FreeImageSource(pstInfo);
     }
 
     /* Updates result */
@@ -2008,14 +2052,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
   }
   else
   {
-    /* Frees original source from resource */
-    orxMemory_Free(pstInfo->pu8ImageSource);
-    pstInfo->pu8ImageSource = orxNULL;
-
-    /* Frees load info */
-    orxMemory_Free(pstInfo);
-
-    /* Updates result */
+    /* Updates result (load info will be released by the failure callback) */
     eResult = orxSTATUS_FAILURE;
   }
 
@@ -2026,7 +2063,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
   return eResult;
 }
 
-static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+static void orxFASTCALL orxDisplay_GLFW_ProcessImageSource(orxHANDLE _hResource, orxS64 _s64Size, orxU8 *_pu8Source, orxBITMAP *_pstBitmap, orxBOOL _bIsMapped)
 {
   orxDISPLAY_LOAD_INFO *pstInfo;
 
@@ -2038,18 +2075,30 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
 
   /* Inits it */
   orxMemory_Zero(pstInfo, sizeof(orxDISPLAY_LOAD_INFO));
-  pstInfo->pu8ImageSource = (orxU8 *)_pBuffer;
+  pstInfo->pu8ImageSource = _pu8Source;
   pstInfo->s64Size        = _s64Size;
-  pstInfo->pstBitmap      = (orxBITMAP *)_pContext;
+  pstInfo->pstBitmap      = _pstBitmap;
+  pstInfo->bIsMapped      = _bIsMapped;
+  pstInfo->hResource      = (_bIsMapped != orxFALSE) ? _hResource : orxNULL;
 
   /* Asynchronous? */
   if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
   {
     /* Runs asynchronous task */
-    if(orxThread_RunTask(&orxDisplay_GLFW_DecompressBitmap, orxDisplay_GLFW_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
+    if(orxThread_RunTask(&orxDisplay_GLFW_DecompressBitmap, orxDisplay_GLFW_DecompressBitmapCallback, orxDisplay_GLFW_DecompressBitmapFailureCallback, (void *)pstInfo) == orxSTATUS_FAILURE)
     {
+      /* Frees source */
+      orxDisplay_GLFW_FreeImageSource(pstInfo);
+
       /* Frees load info */
       orxMemory_Free(pstInfo);
+
+      /* Was mapped? */
+      if(_bIsMapped != orxFALSE)
+      {
+        /* Closes resource */
+        orxResource_Close(_hResource);
+      }
     }
   }
   else
@@ -2060,10 +2109,25 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
       /* Upload texture */
       orxDisplay_GLFW_DecompressBitmapCallback(pstInfo);
     }
+    else
+    {
+      /* Releases load info */
+      orxDisplay_GLFW_DecompressBitmapFailureCallback(pstInfo);
+    }
   }
 
-  /* Closes resource */
-  orxResource_Close(_hResource);
+  /* Not mapped? */
+  if(_bIsMapped == orxFALSE)
+  {
+    /* Closes resource */
+    orxResource_Close(_hResource);
+  }
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+{
+  /* Processes read data */
+  orxDisplay_GLFW_ProcessImageSource(_hResource, _s64Size, (orxU8 *)_pBuffer, (orxBITMAP *)_pContext, orxFALSE);
 }
 
 static void orxDisplay_GLFW_WriteResourceCallback(void *_pContext, void *_pData, int _iSize)
@@ -2155,6 +2219,78 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
 }
 
 
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadMappedBitmapData(orxBITMAP *_pstBitmap, orxHANDLE _hResource, orxU8 *_pu8Map, orxS64 _s64Size)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Asynchronous? */
+  if(sstDisplay.pstTempBitmap != orxNULL)
+  {
+    orxU8        *pu8Header;
+    unsigned int  uiHeaderSize;
+    int           iWidth, iHeight, iDummy = 0;
+
+    /* Retrieves header for Basis Universal & QOI (padded copy, as content might be smaller than the header) */
+    uiHeaderSize  = orxMAX(BasisU_GetHeaderSize(), QOI_HEADER_SIZE);
+    pu8Header     = (orxU8 *)alloca(uiHeaderSize);
+    orxMemory_Zero(pu8Header, uiHeaderSize);
+    orxMemory_Copy(pu8Header, _pu8Map, (orxU32)orxMIN((orxS64)uiHeaderSize, _s64Size));
+
+    /* Gets its info */
+    if(((qoi_read_32(pu8Header, &iDummy) == QOI_MAGIC)
+     && (iWidth   = qoi_read_32(pu8Header, &iDummy),
+         iHeight  = qoi_read_32(pu8Header, &iDummy),
+         iDummy   = (int)pu8Header[iDummy],
+         (iDummy == 3)
+      || (iDummy == 4)))
+    || (BasisU_GetInfo(pu8Header, uiHeaderSize, sstDisplay.eBasisUFormat, (unsigned int *)&iWidth, (unsigned int*)&iHeight, (unsigned int*)&iDummy) != 0)
+    || (stbi_info_from_memory(_pu8Map, (int)_s64Size, &iWidth, &iHeight, &iDummy) != 0))
+    {
+      /* Updates asynchronous loading flag */
+      orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+
+      /* Not a cursor nor an icon? */
+      if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_CURSOR | orxDISPLAY_KU32_BITMAP_FLAG_ICON))
+      {
+        /* Inits bitmap info using temp */
+        _pstBitmap->uiTexture       = sstDisplay.pstTempBitmap->uiTexture;
+        _pstBitmap->fWidth          = orxS2F(iWidth);
+        _pstBitmap->fHeight         = orxS2F(iHeight);
+        _pstBitmap->u32RealWidth    = sstDisplay.pstTempBitmap->u32RealWidth;
+        _pstBitmap->u32RealHeight   = sstDisplay.pstTempBitmap->u32RealHeight;
+        _pstBitmap->u32Depth        = sstDisplay.pstTempBitmap->u32Depth;
+        _pstBitmap->fRecRealWidth   = sstDisplay.pstTempBitmap->fRecRealWidth;
+        _pstBitmap->fRecRealHeight  = sstDisplay.pstTempBitmap->fRecRealHeight;
+        _pstBitmap->u32DataSize     = sstDisplay.pstTempBitmap->u32DataSize;
+        orxVector_Copy(&(_pstBitmap->stClip.vTL), &(sstDisplay.pstTempBitmap->stClip.vTL));
+        orxVector_Copy(&(_pstBitmap->stClip.vBR), &(sstDisplay.pstTempBitmap->stClip.vBR));
+      }
+
+      /* Decompresses mapped content on a task thread, no intermediate copy */
+      orxDisplay_GLFW_ProcessImageSource(_hResource, _s64Size, _pu8Map, _pstBitmap, orxTRUE);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Closes resource */
+      orxResource_Close(_hResource);
+    }
+  }
+  else
+  {
+    /* Decompresses mapped content, no intermediate copy */
+    orxDisplay_GLFW_ProcessImageSource(_hResource, _s64Size, _pu8Map, _pstBitmap, orxTRUE);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitmap)
 {
   orxHANDLE hResource;
@@ -2166,7 +2302,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
   /* Success? */
   if(hResource != orxHANDLE_UNDEFINED)
   {
-    orxS64  s64Size;
+    orxS64  s64Size, s64MapSize;
     orxU8  *pu8Buffer;
 
     /* Gets its size */
@@ -2175,11 +2311,17 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
     /* Checks */
     orxASSERT((s64Size > 0) && (s64Size < 0xFFFFFFFF));
 
-    /* Allocates buffer */
-    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+    /* Maps its content */
+    pu8Buffer = (orxU8 *)orxResource_Map(hResource, &s64MapSize);
 
     /* Success? */
     if(pu8Buffer != orxNULL)
+    {
+      /* Loads from mapped content */
+      eResult = orxDisplay_GLFW_LoadMappedBitmapData(_pstBitmap, hResource, pu8Buffer, s64MapSize);
+    }
+    /* Allocates buffer */
+    else if((pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP)) != orxNULL)
     {
       /* Asynchronous? */
       if(sstDisplay.pstTempBitmap != orxNULL)
@@ -3239,6 +3381,56 @@ static void orxFASTCALL orxDisplay_GLFW_VSyncFix(const orxCLOCK_INFO *_pstInfo,
   return;
 }
 
+static orxINLINE void orxDisplay_GLFW_OutputCharacter(const orxDISPLAY_MATRIX *_pmTransform, const orxBITMAP *_pstFont, const orxCHARACTER_GLYPH *_pstGlyph, GLfloat _fX, GLfloat _fY, GLfloat _fHeight, orxRGBA _stColor)
+{
+  GLfloat fX, fY, fWidth, fHeight;
+
+  /* Gets position & size */
+  fX      = _fX;
+  fY      = _fY;
+  fWidth  = _pstGlyph->fWidth;
+  fHeight = _fHeight;
+
+  /* End of buffer? */
+  if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+  {
+    /* Draws arrays */
+    orxDisplay_GLFW_DrawArrays();
+  }
+
+  /* Outputs vertices and texture coordinates */
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fX      = (_pmTransform->vX.fX * fX) + (_pmTransform->vX.fY * (fY + fHeight)) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fY      = (_pmTransform->vY.fX * fX) + (_pmTransform->vY.fY * (fY + fHeight)) + _pmTransform->vY.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fX  = (_pmTransform->vX.fX * fX) + (_pmTransform->vX.fY * fY) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fY  = (_pmTransform->vY.fX * fX) + (_pmTransform->vY.fY * fY) + _pmTransform->vY.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fX  = (_pmTransform->vX.fX * (fX + fWidth)) + (_pmTransform->vX.fY * (fY + fHeight)) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fY  = (_pmTransform->vY.fX * (fX + fWidth)) + (_pmTransform->vY.fY * (fY + fHeight)) + _pmTransform->vY.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fX  = (_pmTransform->vX.fX * (fX + fWidth)) + (_pmTransform->vX.fY * fY) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fY  = (_pmTransform->vY.fX * (fX + fWidth)) + (_pmTransform->vY.fY * fY) + _pmTransform->vY.fZ;
+
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fU      =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fU  = (GLfloat)(_pstFont->fRecRealWidth * (_pstGlyph->fX + orxDISPLAY_KF_BORDER_FIX));
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fU  =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fU  = (GLfloat)(_pstFont->fRecRealWidth * (_pstGlyph->fX + fWidth - orxDISPLAY_KF_BORDER_FIX));
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fV  =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fV  = (GLfloat)(_pstFont->fRecRealHeight * (_pstGlyph->fY + orxDISPLAY_KF_BORDER_FIX));
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fV      =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fV  = (GLfloat)(_pstFont->fRecRealHeight * (_pstGlyph->fY + fHeight - orxDISPLAY_KF_BORDER_FIX));
+
+  /* Fills the color list */
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].stRGBA      =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].stRGBA  =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].stRGBA  =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].stRGBA  = _stColor;
+
+  /* Updates index & element number */
+  sstDisplay.s32BufferIndex   += 4;
+  sstDisplay.s32ElementNumber += 6;
+
+  /* Done! */
+  return;
+}
+
 orxBITMAP *orxFASTCALL orxDisplay_GLFW_GetScreenBitmap()
 {
   /* Checks */
@@ -3308,8 +3500,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
         const orxCHARACTER_GLYPH *pstGlyph;
         orxFLOAT                  fWidth;
 
-        /* Gets glyph from UTF-8 table */
-        pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+        /* Gets glyph */
+        pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
 
         /* Valid? */
         if(pstGlyph != orxNULL)
@@ -3317,41 +3509,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
           /* Gets character width */
           fWidth = pstGlyph->fWidth;
 
-          /* End of buffer? */
-          if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
-          {
-            /* Draws arrays */
-            orxDisplay_GLFW_DrawArrays();
-          }
-
-          /* Outputs vertices and texture coordinates */
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fX      = (mTransform.vX.fX * fX) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fY      = (mTransform.vY.fX * fX) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fX  = (mTransform.vX.fX * fX) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fY  = (mTransform.vY.fX * fX) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fX  = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fY  = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fX  = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fY  = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
-
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fU      =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fU  = (GLfloat)(_pstFont->fRecRealWidth * (pstGlyph->fX + orxDISPLAY_KF_BORDER_FIX));
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fU  =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fU  = (GLfloat)(_pstFont->fRecRealWidth * (pstGlyph->fX + fWidth - orxDISPLAY_KF_BORDER_FIX));
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fV  =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fV  = (GLfloat)(_pstFont->fRecRealHeight * (pstGlyph->fY + orxDISPLAY_KF_BORDER_FIX));
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fV      =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fV  = (GLfloat)(_pstFont->fRecRealHeight * (pstGlyph->fY + fHeight - orxDISPLAY_KF_BORDER_FIX));
-
-          /* Fills the color list */
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].stRGBA      =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].stRGBA  =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].stRGBA  =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].stRGBA  = _stColor;
-
-          /* Updates index & element number */
-          sstDisplay.s32BufferIndex   += 4;
-          sstDisplay.s32ElementNumber += 6;
+          /* Outputs it */
+          orxDisplay_GLFW_OutputCharacter(&mTransform, _pstFont, pstGlyph, fX, fY, fHeight, _stColor);
         }
         else
         {
@@ -3371,6 +3530,44 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformCharacterList(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadNumber, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX mTransform;
+  orxU32            i;
+  GLfloat           fHeight;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQuadList != orxNULL) || (_u32QuadNumber == 0));
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Has quads? */
+  if(_u32QuadNumber != 0)
+  {
+    /* Inits matrix */
+    orxDisplay_GLFW_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+    /* Gets character's height */
+    fHeight = _pstMap->fCharacterHeight;
+
+    /* Prepares font for drawing */
+    orxDisplay_GLFW_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode, orxDISPLAY_BUFFER_MODE_INDIRECT);
+
+    /* For all quads */
+    for(i = 0; i < _u32QuadNumber; i++)
+    {
+      /* Outputs it */
+      orxDisplay_GLFW_OutputCharacter(&mTransform, _pstFont, &(_astQuadList[i].stGlyph), _astQuadList[i].fX, _astQuadList[i].fY, fHeight, _stColor);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -6508,6 +6705,9 @@ orxHANDLE orxFASTCALL orxDisplay_GLFW_CreateShader(const orxSTRING *_azCodeList,
         pstShader->s32ParamCount          = 0;
         pstShader->bPending               = orxFALSE;
         pstShader->bUseCustomParam        = _bUseCustomParam;
+        pstShader->bUseParamBlock         = orxFALSE;
+        pstShader->afParamBlock           = orxNULL;
+        pstShader->u32ParamBlockSize      = 0;
         pstShader->zCode                  = orxString_Duplicate(sstDisplay.acShaderCodeBuffer);
         pstShader->astTextureInfoList     = (orxDISPLAY_TEXTURE_INFO *)orxMemory_Allocate(sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_TEXTURE_INFO), orxMEMORY_TYPE_MAIN);
         pstShader->astParamInfoList       = (orxDISPLAY_PARAM_INFO *)orxMemory_Allocate(sstDisplay.iTextureUnitNumber * sizeof(orxDISPLAY_PARAM_INFO), orxMEMORY_TYPE_MAIN);
@@ -6566,6 +6766,13 @@ void orxFASTCALL orxDisplay_GLFW_DeleteShader(orxHANDLE _hShader)
   /* Deletes its param info list */
   orxMemory_Free(pstShader->astParamInfoList);
 
+  /* Has param block? */
+  if(pstShader->afParamBlock != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(pstShader->afParamBlock);
+  }
+
   /* Frees it */
   orxBank_Free(sstDisplay.pstShaderBank, pstShader);
 
@@ -6584,8 +6791,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StartShader(orxHANDLE _hShader)
   /* Gets shader */
   pstShader = (orxDISPLAY_SHADER *)_hShader;
 
-  /* Not pending or use custom param? */
-  if((pstShader->bPending == orxFALSE) || (pstShader->bUseCustomParam != orxFALSE))
+  /* Not pending or use custom param without param block? */
+  if((pstShader->bPending == orxFALSE) || ((pstShader->bUseCustomParam != orxFALSE) && (pstShader->bUseParamBlock == orxFALSE)))
   {
     /* Draw remaining items */
     orxDisplay_GLFW_DrawArrays();
@@ -6675,8 +6882,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StopShader(orxHANDLE _hShader)
         /* Removes it from active list */
         orxLinkList_Remove(&(pstShader->stNode));
       }
-      /* Using custom param? */
-      else if(pstShader->bUseCustomParam != orxFALSE)
+      /* Using custom param without param block? */
+      else if((pstShader->bUseCustomParam != orxFALSE) && (pstShader->bUseParamBlock == orxFALSE))
       {
         /* Has something to display? */
         if(sstDisplay.s32BufferIndex > 0)
@@ -6895,6 +7102,10 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32
         /* Draws remaining items */
         orxDisplay_GLFW_DrawArrays();
 
+        /* Uses its program again, as drawing resets it */
+        glUseProgramObjectARB(pstShader->hProgram);
+        glASSERT();
+
         /* Updates texture info */
         pstShader->astTextureInfoList[i].pstBitmap = _pstValue;
 
@@ -6956,12 +7167,30 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderFloat(orxHANDLE _hShader, orxS32 _s32ID, orxFLOAT _fValue)
 {
-  orxSTATUS eResult;
+  orxDISPLAY_SHADER  *pstShader;
+  orxSTATUS           eResult;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
   orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
 
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Was using a param block? */
+  if(pstShader->bUseParamBlock != orxFALSE)
+  {
+    /* Draws remaining items */
+    orxDisplay_GLFW_DrawArrays();
+
+    /* Uses its program */
+    glUseProgramObjectARB(pstShader->hProgram);
+    glASSERT();
+
+    /* Updates status */
+    pstShader->bUseParamBlock = orxFALSE;
+  }
+
   /* Valid? */
   if(_s32ID >= 0)
   {
@@ -6983,13 +7212,31 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderFloat(orxHANDLE _hShader, orxS32
 
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue)
 {
-  orxSTATUS eResult;
+  orxDISPLAY_SHADER  *pstShader;
+  orxSTATUS           eResult;
 
   /* Checks */
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
   orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
   orxASSERT(_pvValue != orxNULL);
 
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Was using a param block? */
+  if(pstShader->bUseParamBlock != orxFALSE)
+  {
+    /* Draws remaining items */
+    orxDisplay_GLFW_DrawArrays();
+
+    /* Uses its program */
+    glUseProgramObjectARB(pstShader->hProgram);
+    glASSERT();
+
+    /* Updates status */
+    pstShader->bUseParamBlock = orxFALSE;
+  }
+
   /* Valid? */
   if(_s32ID >= 0)
   {
@@ -7009,6 +7256,97 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderVector(orxHANDLE _hShader, orxS32
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderParamBlock(orxHANDLE _hShader, orxU32 _u32ParamNumber, const orxS32 *_as32IDList, const orxU32 *_au32SizeList, const orxFLOAT *_afValueList)
+{
+  orxDISPLAY_SHADER  *pstShader;
+  orxU32              i, u32Size;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+  orxASSERT((_u32ParamNumber == 0) || ((_as32IDList != orxNULL) && (_au32SizeList != orxNULL) && (_afValueList != orxNULL)));
+
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Gets block size */
+  for(i = 0, u32Size = 0; i < _u32ParamNumber; i++)
+  {
+    u32Size += _au32SizeList[i];
+  }
+
+  /* Not using a param block yet or different values? */
+  if((pstShader->bUseParamBlock == orxFALSE)
+  || (pstShader->u32ParamBlockSize != u32Size)
+  || (orxMemory_Compare(pstShader->afParamBlock, _afValueList, u32Size * sizeof(orxFLOAT)) != 0))
+  {
+    const orxFLOAT *pfValue;
+
+    /* Draws remaining items, they were batched with the previous values */
+    orxDisplay_GLFW_DrawArrays();
+
+    /* Uses its program again, as drawing resets it */
+    glUseProgramObjectARB(pstShader->hProgram);
+    glASSERT();
+
+    /* For all parameters */
+    for(i = 0, pfValue = _afValueList; i < _u32ParamNumber; pfValue += _au32SizeList[i], i++)
+    {
+      /* Valid? */
+      if(_as32IDList[i] >= 0)
+      {
+        /* Vector? */
+        if(_au32SizeList[i] == 3)
+        {
+          /* Updates its value */
+          glUNIFORM_NO_ASSERT(3fARB, (GLint)_as32IDList[i], (GLfloat)pfValue[0], (GLfloat)pfValue[1], (GLfloat)pfValue[2]);
+        }
+        else
+        {
+          /* Updates its value */
+          glUNIFORM_NO_ASSERT(1fARB, (GLint)_as32IDList[i], (GLfloat)pfValue[0]);
+        }
+      }
+    }
+
+    /* Needs a new cache? */
+    if(pstShader->u32ParamBlockSize != u32Size)
+    {
+      /* Deletes previous one */
+      if(pstShader->afParamBlock != orxNULL)
+      {
+        orxMemory_Free(pstShader->afParamBlock);
+      }
+
+      /* Allocates new one */
+      pstShader->afParamBlock       = (u32Size > 0) ? (orxFLOAT *)orxMemory_Allocate(u32Size * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN) : orxNULL;
+      pstShader->u32ParamBlockSize  = (pstShader->afParamBlock != orxNULL) ? u32Size : 0;
+    }
+
+    /* Valid cache? */
+    if(pstShader->u32ParamBlockSize == u32Size)
+    {
+      /* Stores values */
+      orxMemory_Copy(pstShader->afParamBlock, _afValueList, u32Size * sizeof(orxFLOAT));
+
+      /* Updates status, batches won't be broken as long as values don't change */
+      pstShader->bUseParamBlock = orxTRUE;
+    }
+    else
+    {
+      /* Updates status */
+      pstShader->bUseParamBlock = orxFALSE;
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxU32 orxFASTCALL orxDisplay_GLFW_GetShaderID(const orxHANDLE _hShader)
 {
   orxDISPLAY_SHADER  *pstShader;
@@ -7080,6 +7418,8 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetVideoModeCount, DISPLAY, GET
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_TransformCharacterList, DISPLAY, TRANSFORM_CHARACTER_LIST);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetShaderParamBlock, DISPLAY, SET_SHADER_PARAM_BLOCK);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
 #ifdef __orxGCC__
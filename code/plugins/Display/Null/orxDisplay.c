@@ -0,0 +1,2641 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2022 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxDisplay.c
+ *
+ * Null (headless) display plugin implementation
+ *
+ * Bitmaps live in CPU memory, no window nor graphics context is ever created.
+ * Batches, vertices, state changes and texture binds are counted the same way the GLFW plugin issues them,
+ * and published in the Display config section upon every swap.
+ * When Display.Rasterize is set, all textured geometry gets rasterized into the destination bitmap's memory (nearest sampling).
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+#ifdef __orxGCC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wpragmas"
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #pragma GCC diagnostic ignored "-Wmisleading-indentation"
+#endif /* __orxGCC__ */
+
+#ifdef __orxMSVC__
+  #pragma warning(disable : 4312)
+#endif /* __orxMSVC__ */
+#define STBI_NO_STDIO
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_NO_PSD
+#define STBI_NO_GIF
+#define STBI_NO_HDR
+#define STBI_NO_PIC
+#define STBI_NO_PNM
+#define STBI_MALLOC(sz)         orxMemory_Allocate((orxU32)sz, orxMEMORY_TYPE_VIDEO)
+#define STBI_REALLOC(p, newsz)  orxMemory_Reallocate(p, newsz, orxMEMORY_TYPE_VIDEO)
+#define STBI_FREE(p)            orxMemory_Free(p)
+#include "stb_image.h"
+#undef STBI_FREE
+#undef STBI_REALLOC
+#undef STBI_MALLOC
+#undef STBI_NO_PNM
+#undef STBI_NO_PIC
+#undef STBI_NO_HDR
+#undef STBI_NO_GIF
+#undef STBI_NO_PSD
+#undef STB_IMAGE_IMPLEMENTATION
+#undef STBI_NO_STDIO
+#ifdef __orxMSVC__
+  #pragma warning(default : 4312)
+#endif /* __orxMSVC__ */
+
+#define STBI_WRITE_NO_STDIO
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBIW_MALLOC(sz)        orxMemory_Allocate(sz, orxMEMORY_TYPE_VIDEO)
+#define STBIW_REALLOC(p, newsz) orxMemory_Reallocate(p, newsz, orxMEMORY_TYPE_VIDEO)
+#define STBIW_FREE(p)           orxMemory_Free(p)
+#define STBIW_MEMMOVE(a, b, sz) orxMemory_Move(a, b, sz)
+#define STBIW_ASSERT(x)         orxASSERT(x)
+#include "stb_image_write.h"
+#undef STBIW_ASSERT
+#undef STBIW_MEMMOVE
+#undef STBIW_FREE
+#undef STBIW_REALLOC
+#undef STBIW_MALLOC
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+#undef STBI_WRITE_NO_STDIO
+
+#define QOI_NO_STDIO
+#define QOI_IMPLEMENTATION
+#define QOI_MALLOC(sz)          orxMemory_Allocate(sz, orxMEMORY_TYPE_VIDEO)
+#define QOI_FREE(p)             orxMemory_Free(p)
+#define QOI_ZEROARR(a)          orxMemory_Zero(a, sizeof(a))
+#include "qoi.h"
+#undef QOI_ZEROARR
+#undef QOI_FREE
+#undef QOI_MALLOC
+#undef QOI_IMPLEMENTATION
+#undef QOI_NO_STDIO
+
+
+/** Module flags
+ */
+#define orxDISPLAY_KU32_STATIC_FLAG_NONE        0x00000000  /**< No flags */
+
+#define orxDISPLAY_KU32_STATIC_FLAG_READY       0x00000001  /**< Ready flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_VSYNC       0x00000002  /**< VSync flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00000004  /**< Full screen flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_RASTERIZE   0x00000008  /**< Rasterize flag */
+
+#define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_BITMAP_FLAG_NONE        0x00000000  /** No flags */
+
+#define orxDISPLAY_KU32_BITMAP_FLAG_LOADING     0x00000001  /**< Loading flag */
+#define orxDISPLAY_KU32_BITMAP_FLAG_DELETE      0x00000002  /**< Delete flag */
+
+#define orxDISPLAY_KU32_BITMAP_MASK_ALL         0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_BITMAP_BANK_SIZE        256
+#define orxDISPLAY_KU32_SHADER_BANK_SIZE        64
+
+#define orxDISPLAY_KU32_VERTEX_BUFFER_SIZE      (4 * 2048)  /**< 2048 items batch capacity, same as GLFW's */
+
+#define orxDISPLAY_KU32_CIRCLE_LINE_NUMBER      32
+
+#define orxDISPLAY_KU32_MAX_DESTINATION_NUMBER  8
+
+#define orxDISPLAY_KU32_DEFAULT_WIDTH           1920
+#define orxDISPLAY_KU32_DEFAULT_HEIGHT          1080
+#define orxDISPLAY_KU32_DEFAULT_DEPTH           32
+#define orxDISPLAY_KU32_DEFAULT_REFRESH_RATE    60
+
+#define orxDISPLAY_KZ_CONFIG_RASTERIZE          "Rasterize"
+#define orxDISPLAY_KZ_CONFIG_BATCH_COUNT        "BatchCount"
+#define orxDISPLAY_KZ_CONFIG_VERTEX_COUNT       "VertexCount"
+#define orxDISPLAY_KZ_CONFIG_STATE_CHANGE_COUNT "StateChangeCount"
+#define orxDISPLAY_KZ_CONFIG_TEXTURE_BIND_COUNT "TextureBindCount"
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Internal matrix structure
+ */
+typedef struct __orxDISPLAY_MATRIX_t
+{
+  orxVECTOR vX;
+  orxVECTOR vY;
+
+} orxDISPLAY_MATRIX;
+
+/** Internal bitmap structure
+ */
+struct __orxBITMAP_t
+{
+  orxRGBA                  *astData;
+  orxFLOAT                  fWidth, fHeight;
+  orxU32                    u32Width, u32Height;
+  orxU32                    u32Depth;
+  orxU32                    u32ID;
+  orxBOOL                   bSmoothing;
+  orxAABOX                  stClip;
+  const orxSTRING           zLocation;
+  orxSTRINGID               stFilenameID;
+  orxU32                    u32Flags;
+};
+
+/** Internal shader structure
+ */
+typedef struct __orxDISPLAY_SHADER_t
+{
+  orxU32                    u32ID;
+  orxS32                    s32ParamCount;
+  orxBOOL                   bActive;
+
+} orxDISPLAY_SHADER;
+
+/** Internal counters structure
+ */
+typedef struct __orxDISPLAY_COUNTERS_t
+{
+  orxU32                    u32BatchCount;
+  orxU32                    u32VertexCount;
+  orxU32                    u32StateChangeCount;
+  orxU32                    u32TextureBindCount;
+
+} orxDISPLAY_COUNTERS;
+
+/** Static structure
+ */
+typedef struct __orxDISPLAY_STATIC_t
+{
+  orxBANK                  *pstBitmapBank;
+  orxBANK                  *pstShaderBank;
+  orxBITMAP                *pstScreen;
+  const orxBITMAP          *pstTempBitmap;
+  const orxBITMAP          *pstBoundBitmap;
+  orxDISPLAY_SHADER        *pstActiveShader;
+  orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_DESTINATION_NUMBER];
+  orxU32                    u32DestinationBitmapCount;
+  orxDISPLAY_BLEND_MODE     eLastBlendMode;
+  orxU32                    u32PendingVertexCount;
+  orxU32                    u32BitmapCounter;
+  orxU32                    u32ShaderCounter;
+  orxU32                    u32RefreshRate;
+  orxBOOL                   bDefaultSmoothing;
+  orxDISPLAY_COUNTERS       stCounters;
+  orxU32                    u32Flags;
+
+} orxDISPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxDISPLAY_STATIC sstDisplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxINLINE orxDISPLAY_MATRIX *orxDisplay_Null_InitMatrix(orxDISPLAY_MATRIX *_pmMatrix, orxFLOAT _fPosX, orxFLOAT _fPosY, orxFLOAT _fScaleX, orxFLOAT _fScaleY, orxFLOAT _fRotation, orxFLOAT _fPivotX, orxFLOAT _fPivotY)
+{
+  orxFLOAT fCos, fSin, fSCosX, fSCosY, fSSinX, fSSinY, fTX, fTY;
+
+  /* Has rotation? */
+  if(_fRotation != orxFLOAT_0)
+  {
+    /* Gets its cos/sin */
+    fCos = orxMath_Cos(_fRotation);
+    fSin = orxMath_Sin(_fRotation);
+  }
+  else
+  {
+    /* Inits cos/sin */
+    fCos = orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+
+  /* Computes values */
+  fSCosX  = _fScaleX * fCos;
+  fSCosY  = _fScaleY * fCos;
+  fSSinX  = _fScaleX * fSin;
+  fSSinY  = _fScaleY * fSin;
+  fTX     = _fPosX - (_fPivotX * fSCosX) + (_fPivotY * fSSinY);
+  fTY     = _fPosY - (_fPivotX * fSSinX) - (_fPivotY * fSCosY);
+
+  /* Updates matrix */
+  orxVector_Set(&(_pmMatrix->vX), fSCosX, -fSSinY, fTX);
+  orxVector_Set(&(_pmMatrix->vY), fSSinX, fSCosY, fTY);
+
+  /* Done! */
+  return _pmMatrix;
+}
+
+static orxINLINE orxBOOL orxDisplay_Null_IsRasterizing()
+{
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_RASTERIZE);
+}
+
+static orxRGBA *orxFASTCALL orxDisplay_Null_GetBitmapPixels(orxBITMAP *_pstBitmap)
+{
+  /* No data yet? */
+  if((_pstBitmap->astData == orxNULL) && (_pstBitmap->u32Width * _pstBitmap->u32Height != 0))
+  {
+    orxU32 u32Size;
+
+    /* Gets its size */
+    u32Size = _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA);
+
+    /* Allocates it */
+    _pstBitmap->astData = (orxRGBA *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_VIDEO);
+
+    /* Success? */
+    if(_pstBitmap->astData != orxNULL)
+    {
+      /* Clears it */
+      orxMemory_Zero(_pstBitmap->astData, u32Size);
+    }
+  }
+
+  /* Done! */
+  return _pstBitmap->astData;
+}
+
+static void orxFASTCALL orxDisplay_Null_DeleteBitmapData(orxBITMAP *_pstBitmap)
+{
+  /* Has data? */
+  if(_pstBitmap->astData != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstBitmap->astData);
+    _pstBitmap->astData = orxNULL;
+  }
+
+  /* Was bound? */
+  if(_pstBitmap == sstDisplay.pstBoundBitmap)
+  {
+    /* Unbinds it */
+    sstDisplay.pstBoundBitmap = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Null_InitBitmap(orxBITMAP *_pstBitmap, orxU32 _u32Width, orxU32 _u32Height)
+{
+  /* Inits it */
+  _pstBitmap->fWidth    = orxU2F(_u32Width);
+  _pstBitmap->fHeight   = orxU2F(_u32Height);
+  _pstBitmap->u32Width  = _u32Width;
+  _pstBitmap->u32Height = _u32Height;
+  _pstBitmap->u32Depth  = 32;
+  orxVector_Copy(&(_pstBitmap->stClip.vTL), &orxVECTOR_0);
+  orxVector_Set(&(_pstBitmap->stClip.vBR), _pstBitmap->fWidth, _pstBitmap->fHeight, orxFLOAT_0);
+
+  /* Done! */
+  return;
+}
+
+/** Counts a draw call for the pending vertices, if any
+ */
+static orxINLINE void orxDisplay_Null_Flush()
+{
+  /* Has pending vertices? */
+  if(sstDisplay.u32PendingVertexCount != 0)
+  {
+    /* Updates counters */
+    sstDisplay.stCounters.u32BatchCount++;
+
+    /* Clears pending vertices */
+    sstDisplay.u32PendingVertexCount = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Adds vertices to the current batch
+ */
+static orxINLINE void orxDisplay_Null_AddVertices(orxU32 _u32VertexNumber)
+{
+  /* End of buffer? */
+  if(sstDisplay.u32PendingVertexCount + _u32VertexNumber > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE)
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+  }
+
+  /* Updates counters */
+  sstDisplay.u32PendingVertexCount        += _u32VertexNumber;
+  sstDisplay.stCounters.u32VertexCount    += _u32VertexNumber;
+
+  /* Done! */
+  return;
+}
+
+/** Counts a standalone draw call (primitives & meshes)
+ */
+static orxINLINE void orxDisplay_Null_AddDrawCall(orxU32 _u32VertexNumber)
+{
+  /* Flushes current batch */
+  orxDisplay_Null_Flush();
+
+  /* Updates counters */
+  sstDisplay.stCounters.u32BatchCount++;
+  sstDisplay.stCounters.u32VertexCount += _u32VertexNumber;
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Null_PrepareBitmap(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxBOOL bSmoothing;
+
+  /* New bitmap? */
+  if(_pstBitmap != sstDisplay.pstBoundBitmap)
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+
+    /* Binds it */
+    sstDisplay.pstBoundBitmap = _pstBitmap;
+
+    /* Updates counters */
+    sstDisplay.stCounters.u32TextureBindCount++;
+  }
+
+  /* Gets smoothing */
+  bSmoothing = (_eSmoothing == orxDISPLAY_SMOOTHING_ON) ? orxTRUE : (_eSmoothing == orxDISPLAY_SMOOTHING_OFF) ? orxFALSE : sstDisplay.bDefaultSmoothing;
+
+  /* Should update smoothing? */
+  if((_pstBitmap != orxNULL) && (bSmoothing != _pstBitmap->bSmoothing))
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+
+    /* Updates it */
+    ((orxBITMAP *)_pstBitmap)->bSmoothing = bSmoothing;
+
+    /* Updates counters */
+    sstDisplay.stCounters.u32StateChangeCount++;
+  }
+
+  /* New blend mode? */
+  if(_eBlendMode != sstDisplay.eLastBlendMode)
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+
+    /* Stores it */
+    sstDisplay.eLastBlendMode = _eBlendMode;
+
+    /* Updates counters */
+    sstDisplay.stCounters.u32StateChangeCount++;
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxU8 orxDisplay_Null_Modulate(orxU32 _u32A, orxU32 _u32B)
+{
+  orxU32 u32Value;
+
+  /* Computes rounded (A * B) / 255 */
+  u32Value = (_u32A * _u32B) + 128;
+
+  /* Done! */
+  return (orxU8)((u32Value + (u32Value >> 8)) >> 8);
+}
+
+static orxINLINE void orxDisplay_Null_BlendPixel(orxRGBA *_pstDst, orxRGBA _stSrc, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxU32 u32Alpha, u32InvAlpha;
+
+  /* Gets alpha */
+  u32Alpha    = (orxU32)orxRGBA_A(_stSrc);
+  u32InvAlpha = 0xFF - u32Alpha;
+
+  /* Depending on blend mode */
+  switch(_eBlendMode)
+  {
+    case orxDISPLAY_BLEND_MODE_ALPHA:
+    {
+      /* SRC_ALPHA, ONE_MINUS_SRC_ALPHA */
+      _pstDst->u8R = (orxU8)(orxDisplay_Null_Modulate(_stSrc.u8R, u32Alpha) + orxDisplay_Null_Modulate(_pstDst->u8R, u32InvAlpha));
+      _pstDst->u8G = (orxU8)(orxDisplay_Null_Modulate(_stSrc.u8G, u32Alpha) + orxDisplay_Null_Modulate(_pstDst->u8G, u32InvAlpha));
+      _pstDst->u8B = (orxU8)(orxDisplay_Null_Modulate(_stSrc.u8B, u32Alpha) + orxDisplay_Null_Modulate(_pstDst->u8B, u32InvAlpha));
+      _pstDst->u8A = (orxU8)(orxDisplay_Null_Modulate(_stSrc.u8A, u32Alpha) + orxDisplay_Null_Modulate(_pstDst->u8A, u32InvAlpha));
+
+      break;
+    }
+
+    case orxDISPLAY_BLEND_MODE_MULTIPLY:
+    {
+      /* DST_COLOR, ZERO */
+      _pstDst->u8R = orxDisplay_Null_Modulate(_stSrc.u8R, _pstDst->u8R);
+      _pstDst->u8G = orxDisplay_Null_Modulate(_stSrc.u8G, _pstDst->u8G);
+      _pstDst->u8B = orxDisplay_Null_Modulate(_stSrc.u8B, _pstDst->u8B);
+      _pstDst->u8A = orxDisplay_Null_Modulate(_stSrc.u8A, _pstDst->u8A);
+
+      break;
+    }
+
+    case orxDISPLAY_BLEND_MODE_ADD:
+    {
+      /* SRC_ALPHA, ONE */
+      _pstDst->u8R = (orxU8)orxMIN(0xFF, (orxU32)_pstDst->u8R + (orxU32)orxDisplay_Null_Modulate(_stSrc.u8R, u32Alpha));
+      _pstDst->u8G = (orxU8)orxMIN(0xFF, (orxU32)_pstDst->u8G + (orxU32)orxDisplay_Null_Modulate(_stSrc.u8G, u32Alpha));
+      _pstDst->u8B = (orxU8)orxMIN(0xFF, (orxU32)_pstDst->u8B + (orxU32)orxDisplay_Null_Modulate(_stSrc.u8B, u32Alpha));
+      _pstDst->u8A = (orxU8)orxMIN(0xFF, (orxU32)_pstDst->u8A + (orxU32)orxDisplay_Null_Modulate(_stSrc.u8A, u32Alpha));
+
+      break;
+    }
+
+    case orxDISPLAY_BLEND_MODE_PREMUL:
+    {
+      /* ONE, ONE_MINUS_SRC_ALPHA */
+      _pstDst->u8R = (orxU8)orxMIN(0xFF, (orxU32)_stSrc.u8R + (orxU32)orxDisplay_Null_Modulate(_pstDst->u8R, u32InvAlpha));
+      _pstDst->u8G = (orxU8)orxMIN(0xFF, (orxU32)_stSrc.u8G + (orxU32)orxDisplay_Null_Modulate(_pstDst->u8G, u32InvAlpha));
+      _pstDst->u8B = (orxU8)orxMIN(0xFF, (orxU32)_stSrc.u8B + (orxU32)orxDisplay_Null_Modulate(_pstDst->u8B, u32InvAlpha));
+      _pstDst->u8A = (orxU8)orxMIN(0xFF, (orxU32)_stSrc.u8A + (orxU32)orxDisplay_Null_Modulate(_pstDst->u8A, u32InvAlpha));
+
+      break;
+    }
+
+    default:
+    {
+      /* No blending */
+      *_pstDst = _stSrc;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxFLOAT orxDisplay_Null_GetEdge(const orxDISPLAY_VERTEX *_pstA, const orxDISPLAY_VERTEX *_pstB, orxFLOAT _fX, orxFLOAT _fY)
+{
+  /* Done! */
+  return ((_pstB->fX - _pstA->fX) * (_fY - _pstA->fY)) - ((_pstB->fY - _pstA->fY) * (_fX - _pstA->fX));
+}
+
+static orxINLINE orxBOOL orxDisplay_Null_IsTopLeftEdge(const orxDISPLAY_VERTEX *_pstA, const orxDISPLAY_VERTEX *_pstB)
+{
+  /* Done! */
+  return ((_pstB->fY < _pstA->fY) || ((_pstB->fY == _pstA->fY) && (_pstB->fX > _pstA->fX))) ? orxTRUE : orxFALSE;
+}
+
+/** Rasterizes a triangle into the first destination bitmap, UVs are normalized, texture can be orxNULL
+ */
+static void orxFASTCALL orxDisplay_Null_RasterizeTriangle(const orxDISPLAY_VERTEX *_pstV0, const orxDISPLAY_VERTEX *_pstV1, const orxDISPLAY_VERTEX *_pstV2, const orxBITMAP *_pstTexture, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxBITMAP *pstDestination;
+  orxRGBA   *astPixelList;
+  orxFLOAT   fArea;
+
+  /* Gets destination */
+  pstDestination = sstDisplay.apstDestinationBitmapList[0];
+
+  /* Gets its pixels */
+  astPixelList = (pstDestination != orxNULL) ? orxDisplay_Null_GetBitmapPixels(pstDestination) : orxNULL;
+
+  /* Gets signed area */
+  fArea = orxDisplay_Null_GetEdge(_pstV0, _pstV1, _pstV2->fX, _pstV2->fY);
+
+  /* Valid? */
+  if((astPixelList != orxNULL) && (fArea != orxFLOAT_0))
+  {
+    const orxRGBA  *astTexelList;
+    orxFLOAT        fRecArea, fMinX, fMinY, fMaxX, fMaxY;
+    orxS32          s32MinX, s32MinY, s32MaxX, s32MaxY, s32X, s32Y;
+    orxBOOL         bTopLeft0, bTopLeft1, bTopLeft2;
+
+    /* Clockwise? */
+    if(fArea < orxFLOAT_0)
+    {
+      const orxDISPLAY_VERTEX *pstTemp;
+
+      /* Swaps winding */
+      pstTemp = _pstV1;
+      _pstV1  = _pstV2;
+      _pstV2  = pstTemp;
+      fArea   = -fArea;
+    }
+
+    /* Gets reciprocal area */
+    fRecArea = orxFLOAT_1 / fArea;
+
+    /* Gets fill rule edges */
+    bTopLeft0 = orxDisplay_Null_IsTopLeftEdge(_pstV1, _pstV2);
+    bTopLeft1 = orxDisplay_Null_IsTopLeftEdge(_pstV2, _pstV0);
+    bTopLeft2 = orxDisplay_Null_IsTopLeftEdge(_pstV0, _pstV1);
+
+    /* Gets bounds, clipped */
+    fMinX   = orxMAX(pstDestination->stClip.vTL.fX, orxMIN(_pstV0->fX, orxMIN(_pstV1->fX, _pstV2->fX)));
+    fMinY   = orxMAX(pstDestination->stClip.vTL.fY, orxMIN(_pstV0->fY, orxMIN(_pstV1->fY, _pstV2->fY)));
+    fMaxX   = orxMIN(pstDestination->stClip.vBR.fX, orxMAX(_pstV0->fX, orxMAX(_pstV1->fX, _pstV2->fX)));
+    fMaxY   = orxMIN(pstDestination->stClip.vBR.fY, orxMAX(_pstV0->fY, orxMAX(_pstV1->fY, _pstV2->fY)));
+    s32MinX = (orxS32)orxMath_Floor(fMinX);
+    s32MinY = (orxS32)orxMath_Floor(fMinY);
+    s32MaxX = (orxS32)orxMath_Ceil(fMaxX);
+    s32MaxY = (orxS32)orxMath_Ceil(fMaxY);
+
+    /* Gets texels */
+    astTexelList = (_pstTexture != orxNULL) ? _pstTexture->astData : orxNULL;
+
+    /* For all lines */
+    for(s32Y = s32MinY; s32Y < s32MaxY; s32Y++)
+    {
+      orxRGBA  *pstPixel;
+      orxFLOAT  fY;
+
+      /* Gets pixel center */
+      fY = orxS2F(s32Y) + orx2F(0.5f);
+
+      /* Gets first pixel */
+      pstPixel = astPixelList + (s32Y * (orxS32)pstDestination->u32Width) + s32MinX;
+
+      /* For all columns */
+      for(s32X = s32MinX; s32X < s32MaxX; s32X++, pstPixel++)
+      {
+        orxFLOAT fX, fW0, fW1, fW2;
+
+        /* Gets pixel center */
+        fX = orxS2F(s32X) + orx2F(0.5f);
+
+        /* Gets edge values */
+        fW0 = orxDisplay_Null_GetEdge(_pstV1, _pstV2, fX, fY);
+        fW1 = orxDisplay_Null_GetEdge(_pstV2, _pstV0, fX, fY);
+        fW2 = orxDisplay_Null_GetEdge(_pstV0, _pstV1, fX, fY);
+
+        /* Inside? */
+        if(((fW0 > orxFLOAT_0) || ((fW0 == orxFLOAT_0) && (bTopLeft0 != orxFALSE)))
+        && ((fW1 > orxFLOAT_0) || ((fW1 == orxFLOAT_0) && (bTopLeft1 != orxFALSE)))
+        && ((fW2 > orxFLOAT_0) || ((fW2 == orxFLOAT_0) && (bTopLeft2 != orxFALSE))))
+        {
+          orxRGBA stColor;
+
+          /* Gets barycentric coordinates */
+          fW0 *= fRecArea;
+          fW1 *= fRecArea;
+          fW2 *= fRecArea;
+
+          /* Gets interpolated color */
+          stColor.u8R = (orxU8)orxF2U(orx2F(0.5f) + (fW0 * orxU2F(_pstV0->stRGBA.u8R)) + (fW1 * orxU2F(_pstV1->stRGBA.u8R)) + (fW2 * orxU2F(_pstV2->stRGBA.u8R)));
+          stColor.u8G = (orxU8)orxF2U(orx2F(0.5f) + (fW0 * orxU2F(_pstV0->stRGBA.u8G)) + (fW1 * orxU2F(_pstV1->stRGBA.u8G)) + (fW2 * orxU2F(_pstV2->stRGBA.u8G)));
+          stColor.u8B = (orxU8)orxF2U(orx2F(0.5f) + (fW0 * orxU2F(_pstV0->stRGBA.u8B)) + (fW1 * orxU2F(_pstV1->stRGBA.u8B)) + (fW2 * orxU2F(_pstV2->stRGBA.u8B)));
+          stColor.u8A = (orxU8)orxF2U(orx2F(0.5f) + (fW0 * orxU2F(_pstV0->stRGBA.u8A)) + (fW1 * orxU2F(_pstV1->stRGBA.u8A)) + (fW2 * orxU2F(_pstV2->stRGBA.u8A)));
+
+          /* Is textured? */
+          if(_pstTexture != orxNULL)
+          {
+            /* Has texels? */
+            if(astTexelList != orxNULL)
+            {
+              orxFLOAT  fU, fV;
+              orxS32    s32U, s32V;
+              orxRGBA   stTexel;
+
+              /* Gets texture coordinates */
+              fU    = (fW0 * _pstV0->fU) + (fW1 * _pstV1->fU) + (fW2 * _pstV2->fU);
+              fV    = (fW0 * _pstV0->fV) + (fW1 * _pstV1->fV) + (fW2 * _pstV2->fV);
+              s32U  = (orxS32)orxMath_Floor(fU * _pstTexture->fWidth);
+              s32V  = (orxS32)orxMath_Floor(fV * _pstTexture->fHeight);
+              s32U  = orxCLAMP(s32U, 0, (orxS32)_pstTexture->u32Width - 1);
+              s32V  = orxCLAMP(s32V, 0, (orxS32)_pstTexture->u32Height - 1);
+
+              /* Gets texel (nearest) */
+              stTexel = astTexelList[(s32V * (orxS32)_pstTexture->u32Width) + s32U];
+
+              /* Modulates color */
+              stColor.u8R = orxDisplay_Null_Modulate(stColor.u8R, stTexel.u8R);
+              stColor.u8G = orxDisplay_Null_Modulate(stColor.u8G, stTexel.u8G);
+              stColor.u8B = orxDisplay_Null_Modulate(stColor.u8B, stTexel.u8B);
+              stColor.u8A = orxDisplay_Null_Modulate(stColor.u8A, stTexel.u8A);
+            }
+            else
+            {
+              /* Uses transparent black, like an uninitialized texture */
+              stColor.u32RGBA = 0;
+            }
+          }
+
+          /* Blends it */
+          orxDisplay_Null_BlendPixel(pstPixel, stColor, _eBlendMode);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Rasterizes a quad, vertices are ordered as bottom left, top left, bottom right, top right (same as GLFW's)
+ */
+static orxINLINE void orxDisplay_Null_RasterizeQuad(const orxDISPLAY_VERTEX *_astVertexList, const orxBITMAP *_pstTexture, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  /* Rasterizes both triangles */
+  orxDisplay_Null_RasterizeTriangle(&(_astVertexList[0]), &(_astVertexList[1]), &(_astVertexList[2]), _pstTexture, _eBlendMode);
+  orxDisplay_Null_RasterizeTriangle(&(_astVertexList[1]), &(_astVertexList[3]), &(_astVertexList[2]), _pstTexture, _eBlendMode);
+
+  /* Done! */
+  return;
+}
+
+/** Rasterizes a line, using a DDA
+ */
+static void orxFASTCALL orxDisplay_Null_RasterizeLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxBITMAP *pstDestination;
+  orxRGBA   *astPixelList;
+
+  /* Gets destination */
+  pstDestination = sstDisplay.apstDestinationBitmapList[0];
+
+  /* Gets its pixels */
+  astPixelList = (pstDestination != orxNULL) ? orxDisplay_Null_GetBitmapPixels(pstDestination) : orxNULL;
+
+  /* Valid? */
+  if(astPixelList != orxNULL)
+  {
+    orxFLOAT fDX, fDY, fX, fY;
+    orxU32   i, u32StepNumber;
+
+    /* Gets deltas */
+    fDX = _pvEnd->fX - _pvStart->fX;
+    fDY = _pvEnd->fY - _pvStart->fY;
+
+    /* Gets step number */
+    u32StepNumber = orxF2U(orxMath_Ceil(orxMAX(orxMath_Abs(fDX), orxMath_Abs(fDY))));
+
+    /* Gets step */
+    if(u32StepNumber != 0)
+    {
+      fDX /= orxU2F(u32StepNumber);
+      fDY /= orxU2F(u32StepNumber);
+    }
+
+    /* For all steps */
+    for(i = 0, fX = _pvStart->fX, fY = _pvStart->fY; i <= u32StepNumber; i++, fX += fDX, fY += fDY)
+    {
+      /* Inside clipping? */
+      if((fX >= pstDestination->stClip.vTL.fX)
+      && (fX < pstDestination->stClip.vBR.fX)
+      && (fY >= pstDestination->stClip.vTL.fY)
+      && (fY < pstDestination->stClip.vBR.fY))
+      {
+        /* Blends pixel */
+        orxDisplay_Null_BlendPixel(astPixelList + (orxF2U(fY) * pstDestination->u32Width) + orxF2U(fX), _stColor, _eBlendMode);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Outputs a textured quad given in local space
+ */
+static orxINLINE void orxDisplay_Null_DrawQuad(const orxBITMAP *_pstBitmap, const orxDISPLAY_MATRIX *_pmTransform, orxFLOAT _fX, orxFLOAT _fY, orxFLOAT _fWidth, orxFLOAT _fHeight, orxFLOAT _fLeft, orxFLOAT _fTop, orxFLOAT _fRight, orxFLOAT _fBottom, orxRGBA _stColor)
+{
+  /* Updates batch */
+  orxDisplay_Null_AddVertices(4);
+
+  /* Rasterizing? */
+  if(orxDisplay_Null_IsRasterizing() != orxFALSE)
+  {
+    orxDISPLAY_VERTEX astVertexList[4];
+
+    /* Outputs vertices and texture coordinates */
+    astVertexList[0].fX     = (_pmTransform->vX.fX * _fX) + (_pmTransform->vX.fY * (_fY + _fHeight)) + _pmTransform->vX.fZ;
+    astVertexList[0].fY     = (_pmTransform->vY.fX * _fX) + (_pmTransform->vY.fY * (_fY + _fHeight)) + _pmTransform->vY.fZ;
+    astVertexList[1].fX     = (_pmTransform->vX.fX * _fX) + (_pmTransform->vX.fY * _fY) + _pmTransform->vX.fZ;
+    astVertexList[1].fY     = (_pmTransform->vY.fX * _fX) + (_pmTransform->vY.fY * _fY) + _pmTransform->vY.fZ;
+    astVertexList[2].fX     = (_pmTransform->vX.fX * (_fX + _fWidth)) + (_pmTransform->vX.fY * (_fY + _fHeight)) + _pmTransform->vX.fZ;
+    astVertexList[2].fY     = (_pmTransform->vY.fX * (_fX + _fWidth)) + (_pmTransform->vY.fY * (_fY + _fHeight)) + _pmTransform->vY.fZ;
+    astVertexList[3].fX     = (_pmTransform->vX.fX * (_fX + _fWidth)) + (_pmTransform->vX.fY * _fY) + _pmTransform->vX.fZ;
+    astVertexList[3].fY     = (_pmTransform->vY.fX * (_fX + _fWidth)) + (_pmTransform->vY.fY * _fY) + _pmTransform->vY.fZ;
+    astVertexList[0].fU     =
+    astVertexList[1].fU     = _fLeft / _pstBitmap->fWidth;
+    astVertexList[2].fU     =
+    astVertexList[3].fU     = _fRight / _pstBitmap->fWidth;
+    astVertexList[1].fV     =
+    astVertexList[3].fV     = _fTop / _pstBitmap->fHeight;
+    astVertexList[0].fV     =
+    astVertexList[2].fV     = _fBottom / _pstBitmap->fHeight;
+    astVertexList[0].stRGBA =
+    astVertexList[1].stRGBA =
+    astVertexList[2].stRGBA =
+    astVertexList[3].stRGBA = _stColor;
+
+    /* Rasterizes it */
+    orxDisplay_Null_RasterizeQuad(astVertexList, _pstBitmap, sstDisplay.eLastBlendMode);
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Null_DrawPrimitive(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill, orxBOOL _bOpen)
+{
+  orxDISPLAY_BLEND_MODE eBlendMode;
+
+  /* Flushes current batch */
+  orxDisplay_Null_Flush();
+
+  /* Gets blend mode */
+  eBlendMode = (orxRGBA_A(_stColor) != 0xFF) ? orxDISPLAY_BLEND_MODE_ALPHA : orxDISPLAY_BLEND_MODE_NONE;
+
+  /* New blend mode? */
+  if(eBlendMode != sstDisplay.eLastBlendMode)
+  {
+    /* Stores it */
+    sstDisplay.eLastBlendMode = eBlendMode;
+
+    /* Updates counters */
+    sstDisplay.stCounters.u32StateChangeCount++;
+  }
+
+  /* Unbinds texture, as primitives are drawn without any */
+  sstDisplay.pstBoundBitmap = orxNULL;
+
+  /* Updates counters */
+  orxDisplay_Null_AddDrawCall(_u32VertexNumber);
+
+  /* Rasterizing? */
+  if(orxDisplay_Null_IsRasterizing() != orxFALSE)
+  {
+    orxU32 i;
+
+    /* Should fill? */
+    if((_bFill != orxFALSE) && (_u32VertexNumber > 2))
+    {
+      orxDISPLAY_VERTEX astVertexList[3];
+
+      /* Inits vertices */
+      orxMemory_Zero(astVertexList, sizeof(astVertexList));
+      astVertexList[0].fX     = _avVertexList[0].fX;
+      astVertexList[0].fY     = _avVertexList[0].fY;
+      astVertexList[0].stRGBA =
+      astVertexList[1].stRGBA =
+      astVertexList[2].stRGBA = _stColor;
+
+      /* For all triangles in the fan */
+      for(i = 1; i < _u32VertexNumber - 1; i++)
+      {
+        /* Updates vertices */
+        astVertexList[1].fX = _avVertexList[i].fX;
+        astVertexList[1].fY = _avVertexList[i].fY;
+        astVertexList[2].fX = _avVertexList[i + 1].fX;
+        astVertexList[2].fY = _avVertexList[i + 1].fY;
+
+        /* Rasterizes it */
+        orxDisplay_Null_RasterizeTriangle(&(astVertexList[0]), &(astVertexList[1]), &(astVertexList[2]), orxNULL, eBlendMode);
+      }
+    }
+    else
+    {
+      /* For all segments */
+      for(i = 0; i < _u32VertexNumber - 1; i++)
+      {
+        /* Rasterizes it */
+        orxDisplay_Null_RasterizeLine(&(_avVertexList[i]), &(_avVertexList[i + 1]), _stColor, eBlendMode);
+      }
+
+      /* Closed? */
+      if((_bOpen == orxFALSE) && (_u32VertexNumber > 2))
+      {
+        /* Rasterizes last segment */
+        orxDisplay_Null_RasterizeLine(&(_avVertexList[_u32VertexNumber - 1]), &(_avVertexList[0]), _stColor, eBlendMode);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Null_PublishCounters()
+{
+  /* Pushes display section */
+  orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+  /* Stores counters */
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_BATCH_COUNT, sstDisplay.stCounters.u32BatchCount);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_VERTEX_COUNT, sstDisplay.stCounters.u32VertexCount);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_STATE_CHANGE_COUNT, sstDisplay.stCounters.u32StateChangeCount);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_TEXTURE_BIND_COUNT, sstDisplay.stCounters.u32TextureBindCount);
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Null_NotifyBitmap(void *_pContext)
+{
+  orxBITMAP                *pstBitmap;
+  orxDISPLAY_EVENT_PAYLOAD  stPayload;
+
+  /* Gets bitmap */
+  pstBitmap = (orxBITMAP *)_pContext;
+
+  /* Inits payload */
+  stPayload.stBitmap.zLocation    = pstBitmap->zLocation;
+  stPayload.stBitmap.stFilenameID = pstBitmap->stFilenameID;
+  stPayload.stBitmap.u32ID        = pstBitmap->u32ID;
+
+  /* Clears loading flag */
+  orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING);
+
+  /* Sends event */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstBitmap, orxNULL, &stPayload);
+
+  /* Asked for deletion? */
+  if(orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_DELETE))
+  {
+    /* Deletes it */
+    orxDisplay_DeleteBitmap(pstBitmap);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Null_LoadBitmapData(orxBITMAP *_pstBitmap)
+{
+  orxHANDLE hResource;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Opens resource */
+  hResource = orxResource_Open(_pstBitmap->zLocation, orxFALSE);
+
+  /* Success? */
+  if(hResource != orxHANDLE_UNDEFINED)
+  {
+    orxS64  s64Size;
+    orxU8  *pu8Buffer;
+
+    /* Gets its size */
+    s64Size = orxResource_GetSize(hResource);
+
+    /* Checks */
+    orxASSERT((s64Size > 0) && (s64Size < 0xFFFFFFFF));
+
+    /* Allocates buffer */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(pu8Buffer != orxNULL)
+    {
+      /* Reads content */
+      if(orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL) == s64Size)
+      {
+        int     iWidth = 0, iHeight = 0, iDummy = 0;
+        orxU8  *pu8ImageData = orxNULL;
+
+        /* QOI? */
+        if((s64Size >= QOI_HEADER_SIZE) && (qoi_read_32(pu8Buffer, &iDummy) == QOI_MAGIC))
+        {
+          /* Rasterizing? */
+          if(orxDisplay_Null_IsRasterizing() != orxFALSE)
+          {
+            qoi_desc stDesc;
+
+            /* Decodes it */
+            pu8ImageData  = (orxU8 *)qoi_decode(pu8Buffer, (int)s64Size, &stDesc, 4);
+            iWidth        = (pu8ImageData != orxNULL) ? (int)stDesc.width : 0;
+            iHeight       = (pu8ImageData != orxNULL) ? (int)stDesc.height : 0;
+          }
+          else
+          {
+            /* Gets its size from the header */
+            iWidth  = qoi_read_32(pu8Buffer, &iDummy);
+            iHeight = qoi_read_32(pu8Buffer, &iDummy);
+          }
+        }
+        else
+        {
+          /* Rasterizing? */
+          if(orxDisplay_Null_IsRasterizing() != orxFALSE)
+          {
+            /* Decodes it */
+            pu8ImageData = (orxU8 *)stbi_load_from_memory((const stbi_uc *)pu8Buffer, (int)s64Size, &iWidth, &iHeight, &iDummy, STBI_rgb_alpha);
+          }
+          else
+          {
+            /* Only retrieves its info */
+            if(stbi_info_from_memory((const stbi_uc *)pu8Buffer, (int)s64Size, &iWidth, &iHeight, &iDummy) == 0)
+            {
+              /* Clears size */
+              iWidth = iHeight = 0;
+            }
+          }
+        }
+
+        /* Valid? */
+        if((iWidth > 0) && (iHeight > 0))
+        {
+          /* Inits bitmap */
+          orxDisplay_Null_InitBitmap(_pstBitmap, (orxU32)iWidth, (orxU32)iHeight);
+
+          /* Stores its data */
+          _pstBitmap->astData = (orxRGBA *)pu8ImageData;
+
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't process data for bitmap <%s>: only PNG, JPG, BMP, TGA & QOI are supported by the Null display plugin.", _pstBitmap->zLocation);
+        }
+      }
+
+      /* Frees buffer */
+      orxMemory_Free(pu8Buffer);
+    }
+
+    /* Closes resource */
+    orxResource_Close(hResource);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static void orxDisplay_Null_WriteResourceCallback(void *_pContext, void *_pData, int _iSize)
+{
+  /* Writes resource synchronously */
+  orxResource_Write((orxHANDLE)_pContext, (orxS64)_iSize, _pData, orxNULL, orxNULL);
+}
+
+
+/***************************************************************************
+ * Plugin functions                                                        *
+ ***************************************************************************/
+
+orxBITMAP *orxFASTCALL orxDisplay_Null_GetScreenBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstScreen;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = sstDisplay.pstScreen->fWidth;
+  *_pfHeight  = sstDisplay.pstScreen->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_Swap()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Flushes current batch */
+  orxDisplay_Null_Flush();
+
+  /* Publishes frame counters */
+  orxDisplay_Null_PublishCounters();
+
+  /* Resets them */
+  orxMemory_Zero(&(sstDisplay.stCounters), sizeof(orxDISPLAY_COUNTERS));
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Null_DeleteBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Not screen? */
+  if(_pstBitmap != sstDisplay.pstScreen)
+  {
+    /* Loading? */
+    if(orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+    {
+      /* Asks for deletion */
+      orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_DELETE, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+    }
+    else
+    {
+      orxU32 i;
+
+      /* Deletes its data */
+      orxDisplay_Null_DeleteBitmapData(_pstBitmap);
+
+      /* Is temp bitmap? */
+      if(_pstBitmap == sstDisplay.pstTempBitmap)
+      {
+        /* Clears temp bitmap */
+        sstDisplay.pstTempBitmap = orxNULL;
+      }
+
+      /* For all destinations */
+      for(i = 0; i < sstDisplay.u32DestinationBitmapCount; i++)
+      {
+        /* Is the deleted bitmap? */
+        if(sstDisplay.apstDestinationBitmapList[i] == _pstBitmap)
+        {
+          /* Clears it */
+          sstDisplay.apstDestinationBitmapList[i] = orxNULL;
+        }
+      }
+
+      /* Deletes it */
+      orxBank_Free(sstDisplay.pstBitmapBank, _pstBitmap);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Null_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxBITMAP *pstBitmap;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates bitmap */
+  pstBitmap = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+  /* Valid? */
+  if(pstBitmap != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstBitmap, sizeof(orxBITMAP));
+    orxDisplay_Null_InitBitmap(pstBitmap, _u32Width, _u32Height);
+    pstBitmap->bSmoothing     = sstDisplay.bDefaultSmoothing;
+    pstBitmap->u32ID          = ++sstDisplay.u32BitmapCounter;
+    pstBitmap->zLocation      = orxSTRING_EMPTY;
+    pstBitmap->stFilenameID   = orxSTRINGID_UNDEFINED;
+    pstBitmap->u32Flags       = orxDISPLAY_KU32_BITMAP_FLAG_NONE;
+  }
+
+  /* Done! */
+  return pstBitmap;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Flushes current batch */
+  orxDisplay_Null_Flush();
+
+  /* Rasterizing? */
+  if(orxDisplay_Null_IsRasterizing() != orxFALSE)
+  {
+    orxBITMAP *apstBitmapList[orxDISPLAY_KU32_MAX_DESTINATION_NUMBER];
+    orxU32     i, u32Number;
+
+    /* Clears current destinations? */
+    if(_pstBitmap == orxNULL)
+    {
+      /* Gets them */
+      orxMemory_Copy(apstBitmapList, sstDisplay.apstDestinationBitmapList, sstDisplay.u32DestinationBitmapCount * sizeof(orxBITMAP *));
+      u32Number = sstDisplay.u32DestinationBitmapCount;
+    }
+    else
+    {
+      /* Uses given bitmap */
+      apstBitmapList[0] = _pstBitmap;
+      u32Number         = 1;
+    }
+
+    /* For all bitmaps */
+    for(i = 0; i < u32Number; i++)
+    {
+      orxBITMAP *pstBitmap;
+      orxRGBA   *astPixelList;
+
+      /* Gets it */
+      pstBitmap = apstBitmapList[i];
+
+      /* Valid and has pixels? */
+      if((pstBitmap != orxNULL)
+      && ((astPixelList = orxDisplay_Null_GetBitmapPixels(pstBitmap)) != orxNULL))
+      {
+        orxU32 u32MinX, u32MinY, u32MaxX, u32MaxY, u32X, u32Y;
+
+        /* Gets cleared area (limited to clipping for current destinations, like a scissored clear) */
+        u32MinX = (_pstBitmap == orxNULL) ? orxF2U(pstBitmap->stClip.vTL.fX) : 0;
+        u32MinY = (_pstBitmap == orxNULL) ? orxF2U(pstBitmap->stClip.vTL.fY) : 0;
+        u32MaxX = (_pstBitmap == orxNULL) ? orxF2U(pstBitmap->stClip.vBR.fX) : pstBitmap->u32Width;
+        u32MaxY = (_pstBitmap == orxNULL) ? orxF2U(pstBitmap->stClip.vBR.fY) : pstBitmap->u32Height;
+
+        /* For all lines */
+        for(u32Y = u32MinY; u32Y < u32MaxY; u32Y++)
+        {
+          orxRGBA *pstPixel;
+
+          /* For all pixels */
+          for(u32X = u32MinX, pstPixel = astPixelList + (u32Y * pstBitmap->u32Width) + u32MinX; u32X < u32MaxX; u32X++, pstPixel++)
+          {
+            /* Sets its value */
+            *pstPixel = _stColor;
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetBlendMode(orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* New blend mode? */
+  if(_eBlendMode != sstDisplay.eLastBlendMode)
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+
+    /* Stores it */
+    sstDisplay.eLastBlendMode = _eBlendMode;
+
+    /* Updates counters */
+    sstDisplay.stCounters.u32StateChangeCount++;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetBitmapClipping(orxBITMAP *_pstBitmap, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No destination bitmap? */
+  if(_pstBitmap == orxNULL)
+  {
+    /* Defaults to first destination */
+    _pstBitmap = sstDisplay.apstDestinationBitmapList[0];
+  }
+
+  /* Valid? */
+  if(_pstBitmap != orxNULL)
+  {
+    /* Destination bitmap? */
+    if(_pstBitmap == sstDisplay.apstDestinationBitmapList[0])
+    {
+      /* Different clipping? */
+      if((orxU2F(_u32TLX) != _pstBitmap->stClip.vTL.fX)
+      || (orxU2F(_u32TLY) != _pstBitmap->stClip.vTL.fY)
+      || (orxU2F(_u32BRX) != _pstBitmap->stClip.vBR.fX)
+      || (orxU2F(_u32BRY) != _pstBitmap->stClip.vBR.fY))
+      {
+        /* Flushes current batch */
+        orxDisplay_Null_Flush();
+
+        /* Updates counters */
+        sstDisplay.stCounters.u32StateChangeCount++;
+      }
+    }
+
+    /* Stores clipping, limited to bitmap's size */
+    orxVector_Set(&(_pstBitmap->stClip.vTL), orxU2F(orxMIN(_u32TLX, _pstBitmap->u32Width)), orxU2F(orxMIN(_u32TLY, _pstBitmap->u32Height)), orxFLOAT_0);
+    orxVector_Set(&(_pstBitmap->stClip.vBR), orxU2F(orxMIN(_u32BRX, _pstBitmap->u32Width)), orxU2F(orxMIN(_u32BRY, _pstBitmap->u32Height)), orxFLOAT_0);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid? */
+  if((_pstBitmap != sstDisplay.pstScreen) && (_u32ByteNumber == _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA)))
+  {
+    orxRGBA *astPixelList;
+
+    /* Gets its pixels */
+    astPixelList = orxDisplay_Null_GetBitmapPixels(_pstBitmap);
+
+    /* Success? */
+    if(astPixelList != orxNULL)
+    {
+      /* Copies data */
+      orxMemory_Copy(astPixelList, _au8Data, _u32ByteNumber);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: format needs to be RGBA.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid? */
+  if(_u32ByteNumber == _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA))
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+
+    /* Has data? */
+    if(_pstBitmap->astData != orxNULL)
+    {
+      /* Copies it */
+      orxMemory_Copy(_au8Data, _pstBitmap->astData, _u32ByteNumber);
+    }
+    else
+    {
+      /* Clears it */
+      orxMemory_Zero(_au8Data, _u32ByteNumber);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get bitmap data: buffer size [%u] doesn't match bitmap size [%ux%u].", _u32ByteNumber, _pstBitmap->u32Width, _pstBitmap->u32Height);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid? */
+  if((_pstBitmap != sstDisplay.pstScreen) && (_u32X + _u32Width <= _pstBitmap->u32Width) && (_u32Y + _u32Height <= _pstBitmap->u32Height))
+  {
+    orxRGBA *astPixelList;
+
+    /* Gets its pixels */
+    astPixelList = orxDisplay_Null_GetBitmapPixels(_pstBitmap);
+
+    /* Success? */
+    if(astPixelList != orxNULL)
+    {
+      orxU32 i;
+
+      /* For all lines */
+      for(i = 0; i < _u32Height; i++)
+      {
+        /* Copies it */
+        orxMemory_Copy(astPixelList + ((_u32Y + i) * _pstBitmap->u32Width) + _u32X, _au8Data + (i * _u32Width * sizeof(orxRGBA)), _u32Width * sizeof(orxRGBA));
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
+{
+  orxU32    i, u32Number;
+  orxBOOL   bChanged;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_apstBitmapList != orxNULL)
+
+  /* Too many destinations? */
+  if(_u32Number > orxDISPLAY_KU32_MAX_DESTINATION_NUMBER)
+  {
+    /* Outputs logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can only attach the first <%u> bitmaps as destinations, out of the <%u> requested.", orxDISPLAY_KU32_MAX_DESTINATION_NUMBER, _u32Number);
+
+    /* Updates bitmap count */
+    u32Number = orxDISPLAY_KU32_MAX_DESTINATION_NUMBER;
+  }
+  else
+  {
+    /* Gets bitmap count */
+    u32Number = _u32Number;
+  }
+
+  /* For all destinations */
+  for(i = 0, bChanged = (u32Number != sstDisplay.u32DestinationBitmapCount) ? orxTRUE : orxFALSE; i < u32Number; i++)
+  {
+    orxBITMAP *pstBitmap;
+
+    /* Gets it, defaulting to screen */
+    pstBitmap = (_apstBitmapList[i] != orxNULL) ? _apstBitmapList[i] : sstDisplay.pstScreen;
+
+    /* Different? */
+    if(pstBitmap != sstDisplay.apstDestinationBitmapList[i])
+    {
+      /* Updates status */
+      bChanged = orxTRUE;
+    }
+  }
+
+  /* Changed? */
+  if(bChanged != orxFALSE)
+  {
+    /* Flushes current batch */
+    orxDisplay_Null_Flush();
+
+    /* For all destinations */
+    for(i = 0; i < u32Number; i++)
+    {
+      /* Stores it */
+      sstDisplay.apstDestinationBitmapList[i] = (_apstBitmapList[i] != orxNULL) ? _apstBitmapList[i] : sstDisplay.pstScreen;
+    }
+
+    /* Clears remaining ones */
+    for(; i < orxDISPLAY_KU32_MAX_DESTINATION_NUMBER; i++)
+    {
+      sstDisplay.apstDestinationBitmapList[i] = orxNULL;
+    }
+
+    /* Stores count */
+    sstDisplay.u32DestinationBitmapCount = u32Number;
+
+    /* Updates counters */
+    sstDisplay.stCounters.u32StateChangeCount++;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = _pstBitmap->fWidth;
+  *_pfHeight  = _pstBitmap->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxU32 orxFASTCALL orxDisplay_Null_GetBitmapID(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_pstBitmap != orxNULL) && (_pstBitmap != sstDisplay.pstScreen));
+
+  /* Done! */
+  return _pstBitmap->u32ID;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_TransformBitmap(const orxBITMAP *_pstSrc, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSrc != sstDisplay.pstScreen);
+  orxASSERT((_pstSrc == orxNULL) || (_pstTransform != orxNULL));
+
+  /* No bitmap? */
+  if(_pstSrc == orxNULL)
+  {
+    /* Full destination quad, drawn on its own (shader pass) */
+    orxDisplay_Null_AddDrawCall(4);
+  }
+  else
+  {
+    orxDISPLAY_MATRIX mTransform;
+    orxFLOAT          i, j, fRecRepeatX, fX, fY, fWidth, fHeight, fRight, fBottom;
+
+    /* Inits matrix */
+    orxDisplay_Null_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+    /* Prepares bitmap for drawing */
+    orxDisplay_Null_PrepareBitmap(_pstSrc, _eSmoothing, _eBlendMode);
+
+    /* Inits bitmap height */
+    fHeight = (_pstSrc->stClip.vBR.fY - _pstSrc->stClip.vTL.fY) / _pstTransform->fRepeatY;
+
+    /* For all lines */
+    for(fY = orxFLOAT_0, i = _pstTransform->fRepeatY, fRecRepeatX = orxFLOAT_1 / _pstTransform->fRepeatX; i > orxFLOAT_0; i -= orxFLOAT_1, fY += fHeight)
+    {
+      /* Partial line? */
+      if(i < orxFLOAT_1)
+      {
+        /* Updates height */
+        fHeight *= i;
+
+        /* Gets bottom texture coord */
+        fBottom = _pstSrc->stClip.vTL.fY + (i * (_pstSrc->stClip.vBR.fY - _pstSrc->stClip.vTL.fY));
+      }
+      else
+      {
+        /* Gets bottom texture coord */
+        fBottom = _pstSrc->stClip.vBR.fY;
+      }
+
+      /* Resets bitmap width */
+      fWidth = (_pstSrc->stClip.vBR.fX - _pstSrc->stClip.vTL.fX) * fRecRepeatX;
+
+      /* For all columns */
+      for(fX = orxFLOAT_0, j = _pstTransform->fRepeatX; j > orxFLOAT_0; j -= orxFLOAT_1, fX += fWidth)
+      {
+        /* Partial column? */
+        if(j < orxFLOAT_1)
+        {
+          /* Updates width */
+          fWidth *= j;
+
+          /* Gets right texture coord */
+          fRight = _pstSrc->stClip.vTL.fX + (j * (_pstSrc->stClip.vBR.fX - _pstSrc->stClip.vTL.fX));
+        }
+        else
+        {
+          /* Gets right texture coord */
+          fRight = _pstSrc->stClip.vBR.fX;
+        }
+
+        /* Draws quad */
+        orxDisplay_Null_DrawQuad(_pstSrc, &mTransform, fX, fY, fWidth, fHeight, _pstSrc->stClip.vTL.fX, _pstSrc->stClip.vTL.fY, fRight, fBottom, _stColor);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX mTransform;
+  const orxCHAR    *pc;
+  orxU32            u32CharacterCodePoint;
+  orxFLOAT          fX, fY, fHeight;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zString != orxNULL);
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Inits matrix */
+  orxDisplay_Null_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+  /* Gets character's height */
+  fHeight = _pstMap->fCharacterHeight;
+
+  /* Prepares font for drawing */
+  orxDisplay_Null_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode);
+
+  /* For all characters */
+  for(u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(_zString, &pc), fX = orxFLOAT_0, fY = orxFLOAT_0;
+      u32CharacterCodePoint != orxCHAR_NULL;
+      u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(pc, &pc))
+  {
+    /* Depending on character */
+    switch(u32CharacterCodePoint)
+    {
+      case orxCHAR_CR:
+      {
+        /* Half EOL? */
+        if(*pc == orxCHAR_LF)
+        {
+          /* Updates pointer */
+          pc++;
+        }
+
+        /* Fall through */
+      }
+
+      case orxCHAR_LF:
+      {
+        /* Updates Y position */
+        fY += fHeight;
+
+        /* Resets X position */
+        fX = orxFLOAT_0;
+
+        break;
+      }
+
+      default:
+      {
+        const orxCHARACTER_GLYPH *pstGlyph;
+        orxFLOAT                  fWidth;
+
+        /* Gets glyph */
+        pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
+
+        /* Valid? */
+        if(pstGlyph != orxNULL)
+        {
+          /* Gets character width */
+          fWidth = pstGlyph->fWidth;
+
+          /* Draws quad */
+          orxDisplay_Null_DrawQuad(_pstFont, &mTransform, fX, fY, fWidth, fHeight, pstGlyph->fX, pstGlyph->fY, pstGlyph->fX + fWidth, pstGlyph->fY + fHeight, _stColor);
+        }
+        else
+        {
+          /* Gets default width */
+          fWidth = fHeight;
+        }
+
+        /* Updates X position */
+        fX += fWidth;
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_TransformCharacterList(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadNumber, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX mTransform;
+  orxU32            i;
+  orxFLOAT          fHeight;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQuadList != orxNULL) || (_u32QuadNumber == 0));
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Has quads? */
+  if(_u32QuadNumber != 0)
+  {
+    /* Inits matrix */
+    orxDisplay_Null_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+    /* Gets character's height */
+    fHeight = _pstMap->fCharacterHeight;
+
+    /* Prepares font for drawing */
+    orxDisplay_Null_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode);
+
+    /* For all quads */
+    for(i = 0; i < _u32QuadNumber; i++)
+    {
+      const orxCHARACTER_QUAD *pstQuad;
+
+      /* Gets it */
+      pstQuad = &(_astQuadList[i]);
+
+      /* Draws it */
+      orxDisplay_Null_DrawQuad(_pstFont, &mTransform, pstQuad->fX, pstQuad->fY, pstQuad->stGlyph.fWidth, fHeight, pstQuad->stGlyph.fX, pstQuad->stGlyph.fY, pstQuad->stGlyph.fX + pstQuad->stGlyph.fWidth, pstQuad->stGlyph.fY + fHeight, _stColor);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
+{
+  orxVECTOR avVertexList[2];
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvStart != orxNULL);
+  orxASSERT(_pvEnd != orxNULL);
+
+  /* Copies vertices */
+  orxVector_Copy(&(avVertexList[0]), _pvStart);
+  orxVector_Copy(&(avVertexList[1]), _pvEnd);
+
+  /* Draws it */
+  orxDisplay_Null_DrawPrimitive(avVertexList, 2, _stColor, orxFALSE, orxTRUE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_DrawPolyline(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Draws it */
+  orxDisplay_Null_DrawPrimitive(_avVertexList, _u32VertexNumber, _stColor, orxFALSE, orxTRUE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_DrawPolygon(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Draws it */
+  orxDisplay_Null_DrawPrimitive(_avVertexList, _u32VertexNumber, _stColor, _bFill, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_DrawCircle(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxVECTOR avVertexList[orxDISPLAY_KU32_CIRCLE_LINE_NUMBER];
+  orxU32    i;
+  orxFLOAT  fAngle;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvCenter != orxNULL);
+  orxASSERT(_fRadius >= orxFLOAT_0);
+
+  /* For all vertices */
+  for(i = 0, fAngle = orxFLOAT_0; i < orxDISPLAY_KU32_CIRCLE_LINE_NUMBER; i++, fAngle += orxMATH_KF_2_PI / orxDISPLAY_KU32_CIRCLE_LINE_NUMBER)
+  {
+    /* Computes its position */
+    orxVector_Set(&(avVertexList[i]), _pvCenter->fX + (_fRadius * orxMath_Cos(fAngle)), _pvCenter->fY + (_fRadius * orxMath_Sin(fAngle)), orxFLOAT_0);
+  }
+
+  /* Draws it */
+  orxDisplay_Null_DrawPrimitive(avVertexList, orxDISPLAY_KU32_CIRCLE_LINE_NUMBER, _stColor, _bFill, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_DrawOBox(const orxOBOX *_pstBox, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxVECTOR avVertexList[4];
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBox != orxNULL);
+
+  /* Computes its vertices */
+  orxVector_Sub(&(avVertexList[0]), &(_pstBox->vPosition), &(_pstBox->vPivot));
+  orxVector_Add(&(avVertexList[1]), &(avVertexList[0]), &(_pstBox->vX));
+  orxVector_Add(&(avVertexList[2]), &(avVertexList[1]), &(_pstBox->vY));
+  orxVector_Add(&(avVertexList[3]), &(avVertexList[0]), &(_pstBox->vY));
+
+  /* Draws it */
+  orxDisplay_Null_DrawPrimitive(avVertexList, 4, _stColor, _bFill, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_DrawMesh(const orxDISPLAY_MESH *_pstMesh, const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  const orxBITMAP  *pstBitmap;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstMesh != orxNULL);
+  orxASSERT(_pstMesh->u32VertexNumber > 1);
+  orxASSERT((_pstMesh->au16IndexList == orxNULL) || (_pstMesh->u32IndexNumber > 1));
+  orxASSERT((_pstMesh->ePrimitive < orxDISPLAY_PRIMITIVE_NUMBER) || ((_pstMesh->ePrimitive == orxDISPLAY_PRIMITIVE_NONE) && (_pstMesh->au16IndexList == orxNULL)));
+
+  /* Gets bitmap to use */
+  pstBitmap = (_pstBitmap != orxNULL) ? _pstBitmap : sstDisplay.pstBoundBitmap;
+
+  /* Prepares bitmap for drawing */
+  orxDisplay_Null_PrepareBitmap(pstBitmap, _eSmoothing, _eBlendMode);
+
+  /* Updates counters */
+  orxDisplay_Null_AddDrawCall(_pstMesh->u32VertexNumber);
+
+  /* Rasterizing? */
+  if(orxDisplay_Null_IsRasterizing() != orxFALSE)
+  {
+    orxDISPLAY_PRIMITIVE  ePrimitive;
+    orxU32                i, u32ElementNumber;
+    orxBOOL               bIndexed;
+
+    /* Is indexed? */
+    bIndexed = ((_pstMesh->au16IndexList != orxNULL) && (_pstMesh->u32IndexNumber != 0)) ? orxTRUE : orxFALSE;
+
+    /* Gets primitive */
+    ePrimitive = (_pstMesh->ePrimitive != orxDISPLAY_PRIMITIVE_NONE) ? _pstMesh->ePrimitive : orxDISPLAY_PRIMITIVE_TRIANGLES;
+
+    /* Gets element number */
+    u32ElementNumber = (bIndexed != orxFALSE) ? _pstMesh->u32IndexNumber : _pstMesh->u32VertexNumber;
+
+/* Gets the vertex of an element */
+#define orxDISPLAY_NULL_GET_MESH_VERTEX(INDEX)  &(_pstMesh->astVertexList[(bIndexed != orxFALSE) ? _pstMesh->au16IndexList[INDEX] : (INDEX)])
+
+    /* Depending on primitive */
+    switch(ePrimitive)
+    {
+      case orxDISPLAY_PRIMITIVE_TRIANGLES:
+      {
+        /* Not indexed? */
+        if(bIndexed == orxFALSE)
+        {
+          /* For all quads (default index list) */
+          for(i = 0; i + 3 < _pstMesh->u32VertexNumber; i += 4)
+          {
+            /* Rasterizes it */
+            orxDisplay_Null_RasterizeQuad(&(_pstMesh->astVertexList[i]), pstBitmap, _eBlendMode);
+          }
+        }
+        else
+        {
+          /* For all triangles */
+          for(i = 0; i + 2 < u32ElementNumber; i += 3)
+          {
+            /* Rasterizes it */
+            orxDisplay_Null_RasterizeTriangle(orxDISPLAY_NULL_GET_MESH_VERTEX(i), orxDISPLAY_NULL_GET_MESH_VERTEX(i + 1), orxDISPLAY_NULL_GET_MESH_VERTEX(i + 2), pstBitmap, _eBlendMode);
+          }
+        }
+
+        break;
+      }
+
+      case orxDISPLAY_PRIMITIVE_TRIANGLE_STRIP:
+      {
+        /* For all triangles */
+        for(i = 0; i + 2 < u32ElementNumber; i++)
+        {
+          /* Rasterizes it */
+          orxDisplay_Null_RasterizeTriangle(orxDISPLAY_NULL_GET_MESH_VERTEX(i), orxDISPLAY_NULL_GET_MESH_VERTEX(i + 1), orxDISPLAY_NULL_GET_MESH_VERTEX(i + 2), pstBitmap, _eBlendMode);
+        }
+
+        break;
+      }
+
+      case orxDISPLAY_PRIMITIVE_TRIANGLE_FAN:
+      {
+        /* For all triangles */
+        for(i = 1; i + 1 < u32ElementNumber; i++)
+        {
+          /* Rasterizes it */
+          orxDisplay_Null_RasterizeTriangle(orxDISPLAY_NULL_GET_MESH_VERTEX(0), orxDISPLAY_NULL_GET_MESH_VERTEX(i), orxDISPLAY_NULL_GET_MESH_VERTEX(i + 1), pstBitmap, _eBlendMode);
+        }
+
+        break;
+      }
+
+      default:
+      {
+        /* Points & lines aren't rasterized */
+        break;
+      }
+    }
+
+#undef orxDISPLAY_NULL_GET_MESH_VERTEX
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFileName)
+{
+  orxU32    u32BufferSize;
+  orxU8    *pu8ImageData;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Gets buffer size */
+  u32BufferSize = _pstBitmap->u32Width * _pstBitmap->u32Height * sizeof(orxRGBA);
+
+  /* Allocates buffer */
+  pu8ImageData = (orxU8 *)orxMemory_Allocate(u32BufferSize, orxMEMORY_TYPE_TEMP);
+
+  /* Valid? */
+  if(pu8ImageData != orxNULL)
+  {
+    /* Gets bitmap data */
+    if(orxDisplay_Null_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+    {
+      const orxSTRING zResourceLocation;
+      orxHANDLE       hResource;
+
+      /* Valid file to open? */
+      if(((zResourceLocation = orxResource_LocateInStorage(orxTEXTURE_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, _zFileName)) != orxNULL)
+      && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+      {
+        const orxSTRING zExtension;
+        int             iWidth, iHeight;
+
+        /* Gets extension & size */
+        zExtension  = orxString_GetExtension(zResourceLocation);
+        iWidth      = (int)_pstBitmap->u32Width;
+        iHeight     = (int)_pstBitmap->u32Height;
+
+        /* PNG? */
+        if(orxString_ICompare(zExtension, "png") == 0)
+        {
+          /* Saves image (synchronously, to keep golden image captures deterministic) */
+          eResult = stbi_write_png_to_func(&orxDisplay_Null_WriteResourceCallback, hResource, iWidth, iHeight, 4, pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+        }
+        /* QOI? */
+        else if(orxString_ICompare(zExtension, "qoi") == 0)
+        {
+          qoi_desc  stDesc;
+          int       iSize;
+          void     *pBuffer;
+
+          /* Inits descriptor */
+          orxMemory_Zero(&stDesc, sizeof(qoi_desc));
+          stDesc.width      = (unsigned int)iWidth;
+          stDesc.height     = (unsigned int)iHeight;
+          stDesc.channels   = 4;
+          stDesc.colorspace = 1;
+
+          /* Encodes it */
+          pBuffer = qoi_encode(pu8ImageData, &stDesc, &iSize);
+
+          /* Success? */
+          if(pBuffer != NULL)
+          {
+            /* Saves image */
+            eResult = (orxResource_Write(hResource, (orxS64)iSize, pBuffer, orxNULL, orxNULL) == (orxS64)iSize) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+            /* Deletes buffer */
+            orxMemory_Free(pBuffer);
+          }
+        }
+        /* JPG? */
+        else if((orxString_ICompare(zExtension, "jpg") == 0) || (orxString_ICompare(zExtension, "jpeg") == 0))
+        {
+          /* Saves image */
+          eResult = stbi_write_jpg_to_func(&orxDisplay_Null_WriteResourceCallback, hResource, iWidth, iHeight, 4, pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+        }
+        /* BMP? */
+        else if(orxString_ICompare(zExtension, "bmp") == 0)
+        {
+          /* Saves image */
+          eResult = stbi_write_bmp_to_func(&orxDisplay_Null_WriteResourceCallback, hResource, iWidth, iHeight, 4, pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+        }
+        /* TGA */
+        else
+        {
+          /* Saves image */
+          eResult = stbi_write_tga_to_func(&orxDisplay_Null_WriteResourceCallback, hResource, iWidth, iHeight, 4, pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+        }
+
+        /* Closes resource */
+        orxResource_Close(hResource);
+      }
+    }
+
+    /* Frees buffer */
+    orxMemory_Free(pu8ImageData);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetTempBitmap(const orxBITMAP *_pstBitmap)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  sstDisplay.pstTempBitmap = _pstBitmap;
+
+  /* Done! */
+  return eResult;
+}
+
+const orxBITMAP *orxFASTCALL orxDisplay_Null_GetTempBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstTempBitmap;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Null_LoadBitmap(const orxSTRING _zFileName)
+{
+  const orxSTRING zResourceLocation;
+  orxBITMAP      *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Locates resource */
+  zResourceLocation = orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, _zFileName);
+
+  /* Success? */
+  if(zResourceLocation != orxNULL)
+  {
+    /* Allocates bitmap */
+    pstResult = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxBITMAP));
+      pstResult->bSmoothing     = sstDisplay.bDefaultSmoothing;
+      pstResult->zLocation      = zResourceLocation;
+      pstResult->stFilenameID   = orxString_GetID(_zFileName);
+      pstResult->u32Flags       = orxDISPLAY_KU32_BITMAP_FLAG_NONE;
+
+      /* Loads its data (always synchronously, for deterministic runs) */
+      if(orxDisplay_Null_LoadBitmapData(pstResult) != orxSTATUS_FAILURE)
+      {
+        /* Gets its ID */
+        pstResult->u32ID = ++sstDisplay.u32BitmapCounter;
+
+        /* Asynchronous request? */
+        if(sstDisplay.pstTempBitmap != orxNULL)
+        {
+          /* Marks it as loading */
+          orxFLAG_SET(pstResult->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+
+          /* Defers notification to the main thread, once the caller is done with its setup */
+          if(orxThread_RunTask(orxNULL, &orxDisplay_Null_NotifyBitmap, orxNULL, (void *)pstResult) == orxSTATUS_FAILURE)
+          {
+            /* Notifies it now */
+            orxDisplay_Null_NotifyBitmap((void *)pstResult);
+          }
+        }
+        else
+        {
+          /* Notifies it */
+          orxDisplay_Null_NotifyBitmap((void *)pstResult);
+        }
+      }
+      else
+      {
+        /* Deletes it */
+        orxBank_Free(sstDisplay.pstBitmapBank, pstResult);
+
+        /* Updates result */
+        pstResult = orxNULL;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Null_HasShaderSupport()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxTRUE;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Null_CreateShader(const orxSTRING *_azCodeList, orxU32 _u32Size, const orxLINKLIST *_pstParamList, orxBOOL _bUseCustomParam)
+{
+  orxDISPLAY_SHADER  *pstShader;
+  orxHANDLE           hResult = orxHANDLE_UNDEFINED;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates shader */
+  pstShader = (orxDISPLAY_SHADER *)orxBank_Allocate(sstDisplay.pstShaderBank);
+
+  /* Valid? */
+  if(pstShader != orxNULL)
+  {
+    /* Inits it, code is never compiled */
+    pstShader->u32ID          = ++sstDisplay.u32ShaderCounter;
+    pstShader->s32ParamCount  = 0;
+    pstShader->bActive        = orxFALSE;
+
+    /* Updates result */
+    hResult = (orxHANDLE)pstShader;
+  }
+
+  /* Done! */
+  return hResult;
+}
+
+void orxFASTCALL orxDisplay_Null_DeleteShader(orxHANDLE _hShader)
+{
+  orxDISPLAY_SHADER *pstShader;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Was active? */
+  if(pstShader == sstDisplay.pstActiveShader)
+  {
+    /* Clears it */
+    sstDisplay.pstActiveShader = orxNULL;
+  }
+
+  /* Deletes it */
+  orxBank_Free(sstDisplay.pstShaderBank, pstShader);
+
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_StartShader(const orxHANDLE _hShader)
+{
+  orxDISPLAY_SHADER  *pstShader;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Flushes current batch */
+  orxDisplay_Null_Flush();
+
+  /* Activates it */
+  pstShader->bActive          = orxTRUE;
+  sstDisplay.pstActiveShader  = pstShader;
+
+  /* Updates counters */
+  sstDisplay.stCounters.u32StateChangeCount++;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_StopShader(const orxHANDLE _hShader)
+{
+  orxDISPLAY_SHADER  *pstShader;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Flushes current batch, drawn with the shader */
+  orxDisplay_Null_Flush();
+
+  /* Deactivates it */
+  pstShader->bActive = orxFALSE;
+
+  /* Was the active one? */
+  if(pstShader == sstDisplay.pstActiveShader)
+  {
+    /* Clears it */
+    sstDisplay.pstActiveShader = orxNULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxS32 orxFASTCALL orxDisplay_Null_GetParameterID(const orxHANDLE _hShader, const orxSTRING _zParam, orxS32 _s32Index, orxBOOL _bIsTexture)
+{
+  orxDISPLAY_SHADER *pstShader;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+  orxASSERT(_zParam != orxNULL);
+
+  /* Gets shader */
+  pstShader = (orxDISPLAY_SHADER *)_hShader;
+
+  /* Done! */
+  return pstShader->s32ParamCount++;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetShaderBitmap(orxHANDLE _hShader, orxS32 _s32ID, const orxBITMAP *_pstValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+
+  /* Updates counters */
+  sstDisplay.stCounters.u32TextureBindCount++;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetShaderFloat(orxHANDLE _hShader, orxS32 _s32ID, orxFLOAT _fValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+
+  /* Updates counters */
+  sstDisplay.stCounters.u32StateChangeCount++;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+  orxASSERT(_pvValue != orxNULL);
+
+  /* Updates counters */
+  sstDisplay.stCounters.u32StateChangeCount++;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetShaderParamBlock(orxHANDLE _hShader, orxU32 _u32ParamNumber, const orxS32 *_as32IDList, const orxU32 *_au32SizeList, const orxFLOAT *_afValueList)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+  orxASSERT((_u32ParamNumber == 0) || ((_as32IDList != orxNULL) && (_au32SizeList != orxNULL) && (_afValueList != orxNULL)));
+
+  /* Updates counters */
+  sstDisplay.stCounters.u32StateChangeCount++;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxU32 orxFASTCALL orxDisplay_Null_GetShaderID(const orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+
+  /* Done! */
+  return ((orxDISPLAY_SHADER *)_hShader)->u32ID;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_EnableVSync(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates status, there's nothing to sync with */
+  if(_bEnable != orxFALSE)
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Null_IsVSyncEnabled()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_EVENT_PAYLOAD  stPayload;
+  orxDISPLAY_VIDEO_MODE     stVideoMode;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No video mode? */
+  if(_pstVideoMode == orxNULL)
+  {
+    /* Uses current one */
+    stVideoMode.u32Width        = sstDisplay.pstScreen->u32Width;
+    stVideoMode.u32Height       = sstDisplay.pstScreen->u32Height;
+    stVideoMode.u32Depth        = sstDisplay.pstScreen->u32Depth;
+    stVideoMode.u32RefreshRate  = sstDisplay.u32RefreshRate;
+    stVideoMode.bFullScreen     = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+  }
+  else
+  {
+    /* Copies it */
+    orxMemory_Copy(&stVideoMode, _pstVideoMode, sizeof(orxDISPLAY_VIDEO_MODE));
+  }
+
+  /* Inits payload */
+  orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+  stPayload.stVideoMode.u32Width                = stVideoMode.u32Width;
+  stPayload.stVideoMode.u32Height               = stVideoMode.u32Height;
+  stPayload.stVideoMode.u32Depth                = stVideoMode.u32Depth;
+  stPayload.stVideoMode.u32RefreshRate          = stVideoMode.u32RefreshRate;
+  stPayload.stVideoMode.u32PreviousWidth        = sstDisplay.pstScreen->u32Width;
+  stPayload.stVideoMode.u32PreviousHeight       = sstDisplay.pstScreen->u32Height;
+  stPayload.stVideoMode.u32PreviousDepth        = sstDisplay.pstScreen->u32Depth;
+  stPayload.stVideoMode.u32PreviousRefreshRate  = sstDisplay.u32RefreshRate;
+  stPayload.stVideoMode.bFullScreen             = stVideoMode.bFullScreen;
+
+  /* Flushes current batch */
+  orxDisplay_Null_Flush();
+
+  /* Different size? */
+  if((stVideoMode.u32Width != sstDisplay.pstScreen->u32Width) || (stVideoMode.u32Height != sstDisplay.pstScreen->u32Height))
+  {
+    /* Deletes screen data */
+    orxDisplay_Null_DeleteBitmapData(sstDisplay.pstScreen);
+
+    /* Updates screen */
+    orxDisplay_Null_InitBitmap(sstDisplay.pstScreen, stVideoMode.u32Width, stVideoMode.u32Height);
+  }
+
+  /* Stores mode */
+  sstDisplay.pstScreen->u32Depth  = stVideoMode.u32Depth;
+  sstDisplay.u32RefreshRate       = stVideoMode.u32RefreshRate;
+  orxFLAG_SET(sstDisplay.u32Flags, (stVideoMode.bFullScreen != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN : orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+
+  /* Resets destination */
+  orxDisplay_Null_SetDestinationBitmaps(&(sstDisplay.pstScreen), 1);
+
+  /* Updates config info */
+  orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+  orxConfig_SetFloat(orxDISPLAY_KZ_CONFIG_WIDTH, sstDisplay.pstScreen->fWidth);
+  orxConfig_SetFloat(orxDISPLAY_KZ_CONFIG_HEIGHT, sstDisplay.pstScreen->fHeight);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_DEPTH, sstDisplay.pstScreen->u32Depth);
+  orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_REFRESH_RATE, sstDisplay.u32RefreshRate);
+  orxConfig_PopSection();
+
+  /* Sends event */
+  orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_SET_VIDEO_MODE, orxNULL, orxNULL, &stPayload);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_SetFullScreen(orxBOOL _bFullScreen)
+{
+  orxDISPLAY_VIDEO_MODE stVideoMode;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Inits video mode */
+  stVideoMode.u32Width        = sstDisplay.pstScreen->u32Width;
+  stVideoMode.u32Height       = sstDisplay.pstScreen->u32Height;
+  stVideoMode.u32Depth        = sstDisplay.pstScreen->u32Depth;
+  stVideoMode.u32RefreshRate  = sstDisplay.u32RefreshRate;
+  stVideoMode.bFullScreen     = _bFullScreen;
+
+  /* Done! */
+  return orxDisplay_Null_SetVideoMode(&stVideoMode);
+}
+
+orxBOOL orxFASTCALL orxDisplay_Null_IsFullScreen()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+}
+
+orxU32 orxFASTCALL orxDisplay_Null_GetVideoModeCount()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Only the current mode */
+  return 1;
+}
+
+orxDISPLAY_VIDEO_MODE *orxFASTCALL orxDisplay_Null_GetVideoMode(orxU32 _u32Index, orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_VIDEO_MODE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Valid index (current or desktop mode)? */
+  if((_u32Index == 0) || (_u32Index == orxU32_UNDEFINED))
+  {
+    /* Stores info */
+    _pstVideoMode->u32Width       = sstDisplay.pstScreen->u32Width;
+    _pstVideoMode->u32Height      = sstDisplay.pstScreen->u32Height;
+    _pstVideoMode->u32Depth       = sstDisplay.pstScreen->u32Depth;
+    _pstVideoMode->u32RefreshRate = sstDisplay.u32RefreshRate;
+    _pstVideoMode->bFullScreen    = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+
+    /* Updates result */
+    pstResult = _pstVideoMode;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Null_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Any size will do */
+  return ((_pstVideoMode->u32Width != 0) && (_pstVideoMode->u32Height != 0)) ? orxTRUE : orxFALSE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Null_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Was not already initialized? */
+  if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+
+    /* Creates banks */
+    sstDisplay.pstBitmapBank  = orxBank_Create(orxDISPLAY_KU32_BITMAP_BANK_SIZE, sizeof(orxBITMAP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstDisplay.pstShaderBank  = orxBank_Create(orxDISPLAY_KU32_SHADER_BANK_SIZE, sizeof(orxDISPLAY_SHADER), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if((sstDisplay.pstBitmapBank != orxNULL)
+    && (sstDisplay.pstShaderBank != orxNULL))
+    {
+      orxDISPLAY_VIDEO_MODE stVideoMode;
+
+      /* Pushes display section */
+      orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+      /* Gets resolution from config */
+      stVideoMode.u32Width        = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_WIDTH) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_WIDTH) : orxDISPLAY_KU32_DEFAULT_WIDTH;
+      stVideoMode.u32Height       = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_HEIGHT) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_HEIGHT) : orxDISPLAY_KU32_DEFAULT_HEIGHT;
+      stVideoMode.u32Depth        = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_DEPTH) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_DEPTH) : orxDISPLAY_KU32_DEFAULT_DEPTH;
+      stVideoMode.u32RefreshRate  = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+      stVideoMode.bFullScreen     = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_FULLSCREEN);
+
+      /* Sets module as ready */
+      sstDisplay.u32Flags = orxDISPLAY_KU32_STATIC_FLAG_READY;
+
+      /* Should rasterize? */
+      if(orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_RASTERIZE) != orxFALSE)
+      {
+        /* Updates status */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_RASTERIZE, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+      }
+
+      /* Inits info */
+      sstDisplay.bDefaultSmoothing  = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_SMOOTH);
+      sstDisplay.eLastBlendMode     = orxDISPLAY_BLEND_MODE_NUMBER;
+
+      /* Updates vertical sync */
+      orxDisplay_Null_EnableVSync((orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_VSYNC) != orxFALSE) ? orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_VSYNC) : orxTRUE);
+
+      /* Allocates screen bitmap */
+      sstDisplay.pstScreen = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+      orxMemory_Zero(sstDisplay.pstScreen, sizeof(orxBITMAP));
+      sstDisplay.pstScreen->zLocation     = orxSTRING_EMPTY;
+      sstDisplay.pstScreen->stFilenameID  = orxSTRINGID_UNDEFINED;
+
+      /* Sets video mode */
+      eResult = orxDisplay_Null_SetVideoMode(&stVideoMode);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Running headless with a %ux%u screen, rasterization is %s.", stVideoMode.u32Width, stVideoMode.u32Height, orxDisplay_Null_IsRasterizing() ? "enabled" : "disabled");
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Deletes banks */
+      if(sstDisplay.pstBitmapBank != orxNULL)
+      {
+        orxBank_Delete(sstDisplay.pstBitmapBank);
+      }
+      if(sstDisplay.pstShaderBank != orxNULL)
+      {
+        orxBank_Delete(sstDisplay.pstShaderBank);
+      }
+
+      /* Cleans static controller */
+      orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Null_Exit()
+{
+  /* Was initialized? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    orxBITMAP *pstBitmap;
+
+    /* For all bitmaps */
+    for(pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, orxNULL);
+        pstBitmap != orxNULL;
+        pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap))
+    {
+      /* Deletes its data */
+      orxDisplay_Null_DeleteBitmapData(pstBitmap);
+    }
+
+    /* Deletes banks */
+    orxBank_Delete(sstDisplay.pstBitmapBank);
+    orxBank_Delete(sstDisplay.pstShaderBank);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+  }
+
+  /* Done! */
+  return;
+}
+
+
+/***************************************************************************
+ * Plugin Related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(DISPLAY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_Init, DISPLAY, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_Exit, DISPLAY, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_Swap, DISPLAY, SWAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetScreenBitmap, DISPLAY, GET_SCREEN_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_CreateBitmap, DISPLAY, CREATE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DeleteBitmap, DISPLAY, DELETE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_ClearBitmap, DISPLAY, CLEAR_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetBlendMode, DISPLAY, SET_BLEND_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetPartialBitmapData, DISPLAY, SET_PARTIAL_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetBitmapID, DISPLAY, GET_BITMAP_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DrawLine, DISPLAY, DRAW_LINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DrawPolyline, DISPLAY, DRAW_POLYLINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DrawPolygon, DISPLAY, DRAW_POLYGON);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DrawCircle, DISPLAY, DRAW_CIRCLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DrawOBox, DISPLAY, DRAW_OBOX);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DrawMesh, DISPLAY, DRAW_MESH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_HasShaderSupport, DISPLAY, HAS_SHADER_SUPPORT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_CreateShader, DISPLAY, CREATE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_DeleteShader, DISPLAY, DELETE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_StartShader, DISPLAY, START_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_StopShader, DISPLAY, STOP_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetParameterID, DISPLAY, GET_PARAMETER_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetShaderBitmap, DISPLAY, SET_SHADER_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetShaderFloat, DISPLAY, SET_SHADER_FLOAT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetShaderVector, DISPLAY, SET_SHADER_VECTOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetShaderID, DISPLAY, GET_SHADER_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_EnableVSync, DISPLAY, ENABLE_VSYNC);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_IsVSyncEnabled, DISPLAY, IS_VSYNC_ENABLED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetFullScreen, DISPLAY, SET_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_IsFullScreen, DISPLAY, IS_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetVideoModeCount, DISPLAY, GET_VIDEO_MODE_COUNT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_TransformCharacterList, DISPLAY, TRANSFORM_CHARACTER_LIST);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Null_SetShaderParamBlock, DISPLAY, SET_SHADER_PARAM_BLOCK);
+orxPLUGIN_USER_CORE_FUNCTION_END();
+
+#ifdef __orxGCC__
+  #pragma GCC diagnostic pop
+#endif /* __orxGCC__ */
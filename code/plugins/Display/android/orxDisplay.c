@@ -2407,6 +2407,56 @@ orxBITMAP *orxFASTCALL orxDisplay_Android_GetScreenBitmap()
   return sstDisplay.pstScreen;
 }
 
+static orxINLINE void orxDisplay_Android_OutputCharacter(const orxDISPLAY_MATRIX *_pmTransform, const orxBITMAP *_pstFont, const orxCHARACTER_GLYPH *_pstGlyph, GLfloat _fX, GLfloat _fY, GLfloat _fHeight, orxRGBA _stColor)
+{
+  GLfloat fX, fY, fWidth, fHeight;
+
+  /* Gets position & size */
+  fX      = _fX;
+  fY      = _fY;
+  fWidth  = _pstGlyph->fWidth;
+  fHeight = _fHeight;
+
+  /* End of buffer? */
+  if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
+  {
+    /* Draws arrays */
+    orxDisplay_Android_DrawArrays();
+  }
+
+  /* Outputs vertices and texture coordinates */
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fX     = (_pmTransform->vX.fX * fX) + (_pmTransform->vX.fY * (fY + fHeight)) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fY     = (_pmTransform->vY.fX * fX) + (_pmTransform->vY.fY * (fY + fHeight)) + _pmTransform->vY.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fX = (_pmTransform->vX.fX * fX) + (_pmTransform->vX.fY * fY) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fY = (_pmTransform->vY.fX * fX) + (_pmTransform->vY.fY * fY) + _pmTransform->vY.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fX = (_pmTransform->vX.fX * (fX + fWidth)) + (_pmTransform->vX.fY * (fY + fHeight)) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fY = (_pmTransform->vY.fX * (fX + fWidth)) + (_pmTransform->vY.fY * (fY + fHeight)) + _pmTransform->vY.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fX = (_pmTransform->vX.fX * (fX + fWidth)) + (_pmTransform->vX.fY * fY) + _pmTransform->vX.fZ;
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fY = (_pmTransform->vY.fX * (fX + fWidth)) + (_pmTransform->vY.fY * fY) + _pmTransform->vY.fZ;
+
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fU     =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fU = (GLfloat)(_pstFont->fRecRealWidth * (_pstGlyph->fX + orxDISPLAY_KF_BORDER_FIX));
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fU =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fU = (GLfloat)(_pstFont->fRecRealWidth * (_pstGlyph->fX + fWidth - orxDISPLAY_KF_BORDER_FIX));
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fV =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fV = (GLfloat)(_pstFont->fRecRealHeight * (_pstGlyph->fY + orxDISPLAY_KF_BORDER_FIX));
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fV     =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fV = (GLfloat)(_pstFont->fRecRealHeight * (_pstGlyph->fY + fHeight - orxDISPLAY_KF_BORDER_FIX));
+
+  /* Fills the color list */
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex].stRGBA     =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].stRGBA =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].stRGBA =
+  sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].stRGBA = _stColor;
+
+  /* Updates index & element number */
+  sstDisplay.s32BufferIndex   += 4;
+  sstDisplay.s32ElementNumber += 6;
+
+  /* Done! */
+  return;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
 {
   orxDISPLAY_MATRIX mTransform;
@@ -2468,7 +2518,7 @@ orxSTATUS orxFASTCALL orxDisplay_Android_TransformText(const orxSTRING _zString,
         orxFLOAT                  fWidth;
 
         /* Gets glyph from table */
-        pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+        pstGlyph = orxCharacterMap_GetGlyph(_pstMap, u32CharacterCodePoint);
 
         /* Valid? */
         if(pstGlyph != orxNULL)
@@ -2476,41 +2526,8 @@ orxSTATUS orxFASTCALL orxDisplay_Android_TransformText(const orxSTRING _zString,
           /* Gets character width */
           fWidth = pstGlyph->fWidth;
 
-          /* End of buffer? */
-          if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
-          {
-            /* Draws arrays */
-            orxDisplay_Android_DrawArrays();
-          }
-
-          /* Outputs vertices and texture coordinates */
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fX     = (mTransform.vX.fX * fX) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fY     = (mTransform.vY.fX * fX) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fX = (mTransform.vX.fX * fX) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fY = (mTransform.vY.fX * fX) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fX = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fY = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fX = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fY = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
-
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fU     =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fU = (GLfloat)(_pstFont->fRecRealWidth * (pstGlyph->fX + orxDISPLAY_KF_BORDER_FIX));
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fU =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fU = (GLfloat)(_pstFont->fRecRealWidth * (pstGlyph->fX + fWidth - orxDISPLAY_KF_BORDER_FIX));
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].fV =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].fV = (GLfloat)(_pstFont->fRecRealHeight * (pstGlyph->fY + orxDISPLAY_KF_BORDER_FIX));
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fV     =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].fV = (GLfloat)(_pstFont->fRecRealHeight * (pstGlyph->fY + fHeight - orxDISPLAY_KF_BORDER_FIX));
-
-          /* Fills the color list */
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex].stRGBA     =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 1].stRGBA =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 2].stRGBA =
-          sstDisplay.astVertexList[sstDisplay.s32BufferIndex + 3].stRGBA = _stColor;
-
-          /* Updates index & element number */
-          sstDisplay.s32BufferIndex   += 4;
-          sstDisplay.s32ElementNumber += 6;
+          /* Outputs it */
+          orxDisplay_Android_OutputCharacter(&mTransform, _pstFont, pstGlyph, fX, fY, fHeight, _stColor);
         }
         else
         {
@@ -2530,6 +2547,44 @@ orxSTATUS orxFASTCALL orxDisplay_Android_TransformText(const orxSTRING _zString,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_TransformCharacterList(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadNumber, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX mTransform;
+  orxU32            i;
+  GLfloat           fHeight;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astQuadList != orxNULL) || (_u32QuadNumber == 0));
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Has quads? */
+  if(_u32QuadNumber != 0)
+  {
+    /* Inits matrix */
+    orxDisplay_Android_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+    /* Gets character's height */
+    fHeight = _pstMap->fCharacterHeight;
+
+    /* Prepares font for drawing */
+    orxDisplay_Android_PrepareBitmap(_pstFont, _eSmoothing, _eBlendMode, orxDISPLAY_BUFFER_MODE_INDIRECT);
+
+    /* For all quads */
+    for(i = 0; i < _u32QuadNumber; i++)
+    {
+      /* Outputs it */
+      orxDisplay_Android_OutputCharacter(&mTransform, _pstFont, &(_astQuadList[i].stGlyph), _astQuadList[i].fX, _astQuadList[i].fY, fHeight, _stColor);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -5350,6 +5405,40 @@ orxSTATUS orxFASTCALL orxDisplay_Android_SetShaderVector(orxHANDLE _hShader, orx
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_SetShaderParamBlock(orxHANDLE _hShader, orxU32 _u32ParamNumber, const orxS32 *_as32IDList, const orxU32 *_au32SizeList, const orxFLOAT *_afValueList)
+{
+  const orxFLOAT *pfValue;
+  orxU32          i;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_hShader != orxHANDLE_UNDEFINED) && (_hShader != orxNULL));
+  orxASSERT((_u32ParamNumber == 0) || ((_as32IDList != orxNULL) && (_au32SizeList != orxNULL) && (_afValueList != orxNULL)));
+
+  /* For all parameters */
+  for(i = 0, pfValue = _afValueList; i < _u32ParamNumber; pfValue += _au32SizeList[i], i++)
+  {
+    /* Valid? */
+    if(_as32IDList[i] >= 0)
+    {
+      /* Vector? */
+      if(_au32SizeList[i] == 3)
+      {
+        /* Updates its value (no glASSERT() as this can be set more than once per use and would trigger it) */
+        glUNIFORM_NO_ASSERT(3f, (GLint)_as32IDList[i], (GLfloat)pfValue[0], (GLfloat)pfValue[1], (GLfloat)pfValue[2]);
+      }
+      else
+      {
+        /* Updates its value (no glASSERT() as this can be set more than once per use and would trigger it) */
+        glUNIFORM_NO_ASSERT(1f, (GLint)_as32IDList[i], (GLfloat)pfValue[0]);
+      }
+    }
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 orxU32 orxFASTCALL orxDisplay_Android_GetShaderID(const orxHANDLE _hShader)
 {
   orxDISPLAY_SHADER  *pstShader;
@@ -5420,4 +5509,6 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetVideoModeCount, DISPLAY,
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_TransformCharacterList, DISPLAY, TRANSFORM_CHARACTER_LIST);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetShaderParamBlock, DISPLAY, SET_SHADER_PARAM_BLOCK);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -363,12 +363,42 @@ orxU32 orxFASTCALL orxPhysics_Dummy_BoxPick(const orxAABOX *_pstBox, orxU16 _u16
   return orxU32_UNDEFINED;
 }
 
+orxU32 orxFASTCALL orxPhysics_Dummy_RaycastBatch(const orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number, orxPHYSICS_RAYCAST_RESULT *_astResultList, orxBOOL _bParallel)
+{
+  orxU32 i;
+
+  /* For all queries */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Clears result */
+    _astResultList[i].hUserData = orxHANDLE_UNDEFINED;
+  }
+
+  /* Done! */
+  return 0;
+}
+
+orxU32 orxFASTCALL orxPhysics_Dummy_BoxPickBatch(const orxPHYSICS_BOX_PICK *_astBoxPickList, orxU32 _u32Number, orxHANDLE _ahUserDataList[], orxU32 _u32UserDataNumber, orxU32 _au32CountList[], orxBOOL _bParallel)
+{
+  /* Clears counts */
+  orxMemory_Zero(_au32CountList, _u32Number * sizeof(orxU32));
+
+  /* Done! */
+  return 0;
+}
+
 void orxFASTCALL orxPhysics_Dummy_EnableSimulation(orxBOOL _bEnable)
 {
   /* Done! */
   return;
 }
 
+orxSTATUS orxFASTCALL orxPhysics_Dummy_SetContactCallback(const orxPHYSICS_CONTACT_FUNCTION _pfnCallback, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, void *_pContext)
+{
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
 
 /***************************************************************************
  * Plugin related                                                          *
@@ -430,4 +460,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_GetJointReactionTorque, PHYSIC
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_Raycast, PHYSICS, RAYCAST);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_BoxPick, PHYSICS, BOX_PICK);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_EnableSimulation, PHYSICS, ENABLE_SIMULATION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_SetContactCallback, PHYSICS, SET_CONTACT_CALLBACK);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_RaycastBatch, PHYSICS, RAYCAST_BATCH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_Dummy_BoxPickBatch, PHYSICS, BOX_PICK_BATCH);
 orxPLUGIN_USER_CORE_FUNCTION_END();
@@ -80,6 +80,7 @@
 #define orxPHYSICS_KU32_STATIC_FLAG_ENABLED     0x00000002 /**< Enabled flag */
 #define orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT    0x00000004 /**< Fixed DT flag */
 #define orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE 0x00000008 /**< Interpolate flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_THREADED    0x00000010 /**< Threaded flag */
 
 #define orxPHYSICS_KU32_STATIC_MASK_ALL         0xFFFFFFFF /**< All mask */
 
@@ -91,6 +92,9 @@ namespace orxPhysics
   static const orxU32   su32MessageBankSize     = 512;
   static const orxU32   su32BodyBankSize        = 512;
   static const orxFLOAT sfDefaultFrequency      = orx2F(60.0f);
+  static const orxU32   su32ApplyGrain          = 128;
+  static const orxU32   su32ContactListSize     = 256;
+  static const orxU32   su32QueryGrain          = 64;
 
 #ifdef orxPHYSICS_ENABLE_DEBUG_DRAW
 
@@ -106,6 +110,18 @@ namespace orxPhysics
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Body simulation state
+ */
+typedef struct __orxPHYSICS_BODY_STATE_t
+{
+  orxVECTOR                         vPosition;              /**< Position */
+  orxVECTOR                         vSpeed;                 /**< Speed */
+  orxFLOAT                          fRotation;              /**< Rotation */
+  orxFLOAT                          fAngularVelocity;       /**< Angular velocity */
+  orxBOOL                           bIsAwake;               /**< Non-static and awake? */
+
+} orxPHYSICS_BODY_STATE;
+
 struct __orxPHYSICS_BODY_t
 {
   orxLINKLIST_NODE                  stNode;                 /**< Link list node */
@@ -114,6 +130,13 @@ struct __orxPHYSICS_BODY_t
   b2Body                           *poBody;                 /**< Box2D body */
   orxFLOAT                          fPreviousRotation;      /**< Previous rotation */
   orxFLOAT                          fInterpolatedRotation;  /**< Interpolated rotation */
+  orxPHYSICS_BODY_STATE             astState[2];            /**< Front & back simulation states (threaded mode) */
+  orxVECTOR                         vResultPosition;        /**< Result position */
+  orxVECTOR                         vResultSpeed;           /**< Result speed */
+  orxFLOAT                          fResultRotation;        /**< Result rotation */
+  orxFLOAT                          fResultAngularVelocity; /**< Result angular velocity */
+  orxFLOAT                          fResultSpeedCoef;       /**< Result speed coef */
+  orxBOOL                           bIsEnabled;             /**< Is owner enabled? */
 };
 
 /** Event storage
@@ -128,6 +151,37 @@ typedef struct __orxPHYSICS_EVENT_STORAGE_t
 
 } orxPHYSICS_EVENT_STORAGE;
 
+/** Raycast batch context
+ */
+typedef struct __orxPHYSICS_RAYCAST_BATCH_t
+{
+  const orxPHYSICS_RAYCAST         *astRaycastList;         /**< Raycast list */
+  orxPHYSICS_RAYCAST_RESULT        *astResultList;          /**< Result list */
+
+} orxPHYSICS_RAYCAST_BATCH;
+
+/** Box pick batch context
+ */
+typedef struct __orxPHYSICS_BOX_PICK_BATCH_t
+{
+  const orxPHYSICS_BOX_PICK        *astBoxPickList;         /**< Box pick list */
+  orxHANDLE                        *ahUserDataList;         /**< User data list */
+  orxU32                           *au32CountList;          /**< Count list */
+  orxU32                            u32UserDataNumber;      /**< Number of user data per query */
+
+} orxPHYSICS_BOX_PICK_BATCH;
+
+/** Contact buffer (batched contact delivery)
+ */
+typedef struct __orxPHYSICS_CONTACT_BUFFER_t
+{
+  orxPHYSICS_CONTACT               *astContactList;         /**< Contact list */
+  b2Body                          **apoBodyList;            /**< Source & destination bodies, two per contact */
+  orxU32                            u32Count;               /**< Contact count */
+  orxU32                            u32Size;                /**< Contact list size */
+
+} orxPHYSICS_CONTACT_BUFFER;
+
 /** Contact listener
  */
 class orxPhysicsContactListener : public b2ContactListener
@@ -185,6 +239,19 @@ typedef struct __orxPHYSICS_STATIC_t
   orxFLOAT                    fDTAccumulator;         /**< DT accumulator */
   orxLINKLIST                 stBodyList;             /**< Body link list */
   orxBANK                    *pstBodyBank;            /**< Body bank */
+  orxTHREAD_JOB              *pstStepJob;             /**< Pending step job (threaded mode) */
+  orxPHYSICS_BODY           **apstApplyList;          /**< Apply list (threaded mode) */
+  orxU32                      u32ApplyListSize;       /**< Apply list size */
+  orxU32                      u32StepCount;           /**< Number of fixed steps to run */
+  orxFLOAT                    fExtraStepDT;           /**< Extra (variable) step DT to run */
+  orxU32                      u32StateIndex;          /**< Front state index */
+  orxBOOL                     bHasResult;             /**< Has pending simulation result? */
+  orxPHYSICS_CONTACT_FUNCTION pfnContactCallback;     /**< Contact batch callback */
+  void                       *pContactContext;        /**< Contact batch callback context */
+  orxPHYSICS_CONTACT_BUFFER   astContactBuffer[2];    /**< Contact buffers: one gets filled while the other one is being delivered */
+  orxU32                      u32ContactBufferIndex;  /**< Contact buffer index (filled one) */
+  orxU16                      u16ContactSelfFlags;    /**< Contact batch self flags */
+  orxU16                      u16ContactCheckMask;    /**< Contact batch check mask */
 
 #ifdef orxPHYSICS_ENABLE_DEBUG_DRAW
 
@@ -209,6 +276,72 @@ static orxPHYSICS_STATIC sstPhysics;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Waits for the pending simulation step, if any (threaded mode)
+ */
+static orxINLINE void orxPhysics_LiquidFun_WaitStep()
+{
+  /* Has pending step? */
+  if(sstPhysics.pstStepJob != orxNULL)
+  {
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxPhysics_WaitStep");
+
+    /* Waits for it */
+    orxThread_WaitJob(sstPhysics.pstStepJob);
+
+    /* Deletes it */
+    orxThread_DeleteJob(sstPhysics.pstStepJob);
+    sstPhysics.pstStepJob = orxNULL;
+
+    /* Swaps states: results become the front ones */
+    sstPhysics.u32StateIndex ^= 1;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Stores a body's current simulation state
+ * @param[in]   _pstBody                      Concerned body
+ * @param[out]  _pstState                     State to fill
+ */
+static orxINLINE void orxPhysics_LiquidFun_StoreState(const orxPHYSICS_BODY *_pstBody, orxPHYSICS_BODY_STATE *_pstState)
+{
+  const b2Body *poBody;
+
+  /* Gets body */
+  poBody = _pstBody->poBody;
+
+  /* Stores its state */
+  orxVector_Set(&(_pstState->vPosition), sstPhysics.fRecDimensionRatio * poBody->GetPosition().x, sstPhysics.fRecDimensionRatio * poBody->GetPosition().y, orxFLOAT_0);
+  orxVector_Set(&(_pstState->vSpeed), sstPhysics.fRecDimensionRatio * poBody->GetLinearVelocity().x, sstPhysics.fRecDimensionRatio * poBody->GetLinearVelocity().y, orxFLOAT_0);
+  _pstState->fRotation        = poBody->GetAngle();
+  _pstState->fAngularVelocity = poBody->GetAngularVelocity();
+  _pstState->bIsAwake         = ((poBody->GetType() != b2_staticBody) && (poBody->IsAwake() != false)) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Refreshes a body's front state after a change (threaded mode)
+ * @param[in]   _pstBody                      Concerned body
+ */
+static orxINLINE void orxPhysics_LiquidFun_RefreshState(orxPHYSICS_BODY *_pstBody)
+{
+  /* Threaded? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+  {
+    /* Stores front state */
+    orxPhysics_LiquidFun_StoreState(_pstBody, &(_pstBody->astState[sstPhysics.u32StateIndex]));
+  }
+
+  /* Done! */
+  return;
+}
+
 void *orxPhysics_LiquidFun_Allocate(int32 _iSize, void* callbackData)
 {
   return orxMemory_Allocate((orxU32)_iSize, orxMEMORY_TYPE_PHYSICS);
@@ -331,6 +464,92 @@ public:
   orxU16      u16CheckMask;
 };
 
+/** Should a contact be batched?
+ * @param[in]   _poContact                    Concerned contact
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxPhysics_LiquidFun_IsContactBatched(const b2Contact *_poContact)
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Has callback? */
+  if(sstPhysics.pfnContactCallback != orxNULL)
+  {
+    const b2Filter &rstFilterA = _poContact->GetFixtureA()->GetFilterData();
+    const b2Filter &rstFilterB = _poContact->GetFixtureB()->GetFilterData();
+
+    /* Does any of its parts match? */
+    if((((rstFilterA.maskBits & sstPhysics.u16ContactSelfFlags) != 0)
+     && ((rstFilterA.categoryBits & sstPhysics.u16ContactCheckMask) != 0))
+    || (((rstFilterB.maskBits & sstPhysics.u16ContactSelfFlags) != 0)
+     && ((rstFilterB.categoryBits & sstPhysics.u16ContactCheckMask) != 0)))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Adds a contact to the current contact buffer
+ * @param[in]   _poSource                     Source body
+ * @param[in]   _poDestination                Destination body
+ * @return      Added contact / orxNULL
+ */
+static orxPHYSICS_CONTACT *orxFASTCALL orxPhysics_LiquidFun_AddContact(b2Body *_poSource, b2Body *_poDestination)
+{
+  orxPHYSICS_CONTACT_BUFFER  *pstBuffer;
+  orxPHYSICS_CONTACT         *pstResult = orxNULL;
+
+  /* Gets current buffer */
+  pstBuffer = &(sstPhysics.astContactBuffer[sstPhysics.u32ContactBufferIndex]);
+
+  /* Full? */
+  if(pstBuffer->u32Count == pstBuffer->u32Size)
+  {
+    orxPHYSICS_CONTACT *astContactList;
+    b2Body            **apoBodyList;
+    orxU32              u32Size;
+
+    /* Gets new size */
+    u32Size = (pstBuffer->u32Size != 0) ? pstBuffer->u32Size << 1 : orxPhysics::su32ContactListSize;
+
+    /* Grows lists */
+    astContactList  = (orxPHYSICS_CONTACT *)orxMemory_Reallocate(pstBuffer->astContactList, u32Size * sizeof(orxPHYSICS_CONTACT), orxMEMORY_TYPE_PHYSICS);
+    apoBodyList     = (astContactList != orxNULL) ? (b2Body **)orxMemory_Reallocate(pstBuffer->apoBodyList, 2 * u32Size * sizeof(b2Body *), orxMEMORY_TYPE_PHYSICS) : orxNULL;
+
+    /* Stores contact list */
+    if(astContactList != orxNULL)
+    {
+      pstBuffer->astContactList = astContactList;
+    }
+
+    /* Success? */
+    if(apoBodyList != orxNULL)
+    {
+      /* Stores body list & new size */
+      pstBuffer->apoBodyList  = apoBodyList;
+      pstBuffer->u32Size      = u32Size;
+    }
+  }
+
+  /* Has room? */
+  if(pstBuffer->u32Count < pstBuffer->u32Size)
+  {
+    /* Stores its bodies */
+    pstBuffer->apoBodyList[pstBuffer->u32Count << 1]        = _poSource;
+    pstBuffer->apoBodyList[(pstBuffer->u32Count << 1) + 1]  = _poDestination;
+
+    /* Updates result */
+    pstResult = &(pstBuffer->astContactList[pstBuffer->u32Count++]);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poContact, orxPHYSICS_EVENT _eEventID)
 {
   orxBODY_PART             *pstSourceBodyPart, *pstDestinationBodyPart;
@@ -342,31 +561,62 @@ static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poCont
   /* Valid? */
   if((pstSourceBodyPart != orxNULL) && (pstDestinationBodyPart != orxNULL))
   {
-    orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+    orxPHYSICS_EVENT_PAYLOAD *pstPayload = orxNULL;
+    b2Body                   *poSource, *poDestination;
 
-    /* Adds a contact event */
-    pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxBank_Allocate(sstPhysics.pstEventBank);
+    /* Gets both bodies */
+    poSource      = _poContact->GetFixtureA()->GetBody();
+    poDestination = _poContact->GetFixtureB()->GetBody();
 
-    /* Valid? */
-    if(pstEventStorage != orxNULL)
+    /* Should be batched? */
+    if(orxPhysics_LiquidFun_IsContactBatched(_poContact) != orxFALSE)
     {
-      b2Body *poSource, *poDestination;
+      orxPHYSICS_CONTACT *pstContact;
+
+      /* Adds a contact */
+      pstContact = orxPhysics_LiquidFun_AddContact(poSource, poDestination);
+
+      /* Valid? */
+      if(pstContact != orxNULL)
+      {
+        /* Inits it (owners will be retrieved upon delivery) */
+        pstContact->eID         = _eEventID;
+        pstContact->hSender     = orxHANDLE_UNDEFINED;
+        pstContact->hRecipient  = orxHANDLE_UNDEFINED;
 
-      /* Clears it */
-      orxMemory_Zero(pstEventStorage, sizeof(orxPHYSICS_EVENT_STORAGE));
+        /* Gets its payload */
+        pstPayload = &(pstContact->stPayload);
+      }
+    }
+    else
+    {
+      orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+
+      /* Adds a contact event */
+      pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxBank_Allocate(sstPhysics.pstEventBank);
+
+      /* Valid? */
+      if(pstEventStorage != orxNULL)
+      {
+        /* Clears it */
+        orxMemory_Zero(pstEventStorage, sizeof(orxPHYSICS_EVENT_STORAGE));
 
-      /* Adds it to list */
-      orxLinkList_AddEnd(&(sstPhysics.stEventList), &(pstEventStorage->stNode));
+        /* Adds it to list */
+        orxLinkList_AddEnd(&(sstPhysics.stEventList), &(pstEventStorage->stNode));
 
-      /* Gets both bodies */
-      poSource      = _poContact->GetFixtureA()->GetBody();
-      poDestination = _poContact->GetFixtureB()->GetBody();
+        /* Inits it */
+        pstEventStorage->eID            = _eEventID;
+        pstEventStorage->poSource       = poSource;
+        pstEventStorage->poDestination  = poDestination;
 
-      /* Inits it */
-      pstEventStorage->eID            = _eEventID;
-      pstEventStorage->poSource       = poSource;
-      pstEventStorage->poDestination  = poDestination;
+        /* Gets its payload */
+        pstPayload = &(pstEventStorage->stPayload);
+      }
+    }
 
+    /* Valid? */
+    if(pstPayload != orxNULL)
+    {
       /* Contact add? */
       if(_eEventID == orxPHYSICS_EVENT_CONTACT_ADD)
       {
@@ -384,8 +634,8 @@ static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poCont
           _poContact->GetWorldManifold(&oManifold);
 
           /* Updates values */
-          orxVector_Set(&(pstEventStorage->stPayload.vPosition), orx2F(0.5f) * sstPhysics.fRecDimensionRatio * (oManifold.points[0].x + oManifold.points[1].x), orx2F(0.5f) * sstPhysics.fRecDimensionRatio * (oManifold.points[0].y + oManifold.points[1].y), orxFLOAT_0);
-          orxVector_Set(&(pstEventStorage->stPayload.vNormal), oManifold.normal.x, oManifold.normal.y, orxFLOAT_0);
+          orxVector_Set(&(pstPayload->vPosition), orx2F(0.5f) * sstPhysics.fRecDimensionRatio * (oManifold.points[0].x + oManifold.points[1].x), orx2F(0.5f) * sstPhysics.fRecDimensionRatio * (oManifold.points[0].y + oManifold.points[1].y), orxFLOAT_0);
+          orxVector_Set(&(pstPayload->vNormal), oManifold.normal.x, oManifold.normal.y, orxFLOAT_0);
         }
         /* 1 contact? */
         else if(poManifold->pointCount == 1)
@@ -396,25 +646,25 @@ static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poCont
           _poContact->GetWorldManifold(&oManifold);
 
           /* Updates values */
-          orxVector_Set(&(pstEventStorage->stPayload.vPosition), sstPhysics.fRecDimensionRatio * oManifold.points[0].x, sstPhysics.fRecDimensionRatio * oManifold.points[0].y, orxFLOAT_0);
-          orxVector_Set(&(pstEventStorage->stPayload.vNormal), oManifold.normal.x, oManifold.normal.y, orxFLOAT_0);
+          orxVector_Set(&(pstPayload->vPosition), sstPhysics.fRecDimensionRatio * oManifold.points[0].x, sstPhysics.fRecDimensionRatio * oManifold.points[0].y, orxFLOAT_0);
+          orxVector_Set(&(pstPayload->vNormal), oManifold.normal.x, oManifold.normal.y, orxFLOAT_0);
         }
         /* 0 contact */
         else
         {
-          orxVector_Copy(&(pstEventStorage->stPayload.vPosition), &orxVECTOR_0);
-          orxVector_Copy(&(pstEventStorage->stPayload.vNormal), &orxVECTOR_0);
+          orxVector_Copy(&(pstPayload->vPosition), &orxVECTOR_0);
+          orxVector_Copy(&(pstPayload->vNormal), &orxVECTOR_0);
         }
       }
       else
       {
-        orxVector_Copy(&(pstEventStorage->stPayload.vPosition), &orxVECTOR_0);
-        orxVector_Copy(&(pstEventStorage->stPayload.vNormal), &orxVECTOR_0);
+        orxVector_Copy(&(pstPayload->vPosition), &orxVECTOR_0);
+        orxVector_Copy(&(pstPayload->vNormal), &orxVECTOR_0);
       }
 
       /* Updates part names */
-      pstEventStorage->stPayload.pstSenderPart    = pstSourceBodyPart;
-      pstEventStorage->stPayload.pstRecipientPart = pstDestinationBodyPart;
+      pstPayload->pstSenderPart     = pstSourceBodyPart;
+      pstPayload->pstRecipientPart  = pstDestinationBodyPart;
     }
   }
 
@@ -900,6 +1150,9 @@ static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_EventHandler(const orxEVENT *_
     {
       orxPHYSICS_DEBUG_RAY *pstRay;
 
+      /* Waits for pending step */
+      orxPhysics_LiquidFun_WaitStep();
+
       /* Draws debug */
       sstPhysics.poWorld->DrawDebugData();
 
@@ -926,41 +1179,28 @@ static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_EventHandler(const orxEVENT *_
 
 #endif /* orxPHYSICS_ENABLE_DEBUG_DRAW */
 
-/** Applies physics simulation result to the body
+/** Prepares physics simulation result for the body, can be run concurrently for different bodies
  * @param[in]   _pstBody                      Concerned body
  */
-static void orxFASTCALL orxPhysics_ApplySimulationResult(orxPHYSICS_BODY *_pstBody)
+static void orxFASTCALL orxPhysics_LiquidFun_PrepareResult(orxPHYSICS_BODY *_pstBody)
 {
-  b2Body         *poBody;
-  orxOBJECT      *pstObject;
-  orxBODY        *pstBody;
-  orxFRAME       *pstFrame;
-  orxFRAME_SPACE  eFrameSpace;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxPhysics_ApplySimResult");
-
-  /* Gets physics body */
-  poBody = (b2Body *)_pstBody->poBody;
+  orxOBJECT *pstObject;
+  orxBODY   *pstBody;
 
   /* Gets associated body */
-  pstBody = orxBODY(poBody->GetUserData());
+  pstBody = orxBODY(_pstBody->poBody->GetUserData());
 
   /* Gets owner object */
   pstObject = orxOBJECT(orxStructure_GetOwner(pstBody));
 
-  /* Gets its frame */
-  pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
-
-  /* Gets its frame space */
-  eFrameSpace = (orxFrame_IsRootChild(pstFrame) != orxFALSE) ? orxFRAME_SPACE_LOCAL : orxFRAME_SPACE_GLOBAL;
+  /* Stores its status */
+  _pstBody->bIsEnabled = orxObject_IsEnabled(pstObject);
 
   /* Is enabled? */
-  if(orxObject_IsEnabled(pstObject) != orxFALSE)
+  if(_pstBody->bIsEnabled != orxFALSE)
   {
-    orxVECTOR   vSpeed, vOldPos, vNewPos;
-    orxCLOCK   *pstClock;
-    orxFLOAT    fCoef = orxFLOAT_1;
+    orxCLOCK *pstClock;
+    orxFLOAT  fCoef = orxFLOAT_1;
 
     /* Gets its clock */
     pstClock = orxObject_GetClock(pstObject);
@@ -981,8 +1221,89 @@ static void orxFASTCALL orxPhysics_ApplySimulationResult(orxPHYSICS_BODY *_pstBo
       }
     }
 
+    /* Gets resulting speed & angular velocity */
+    orxPhysics_GetSpeed(_pstBody, &(_pstBody->vResultSpeed));
+    _pstBody->fResultSpeedCoef        = fCoef;
+    _pstBody->fResultAngularVelocity  = fCoef * orxPhysics_GetAngularVelocity(_pstBody);
+
+    /* Gets resulting rotation & position */
+    _pstBody->fResultRotation = orxPhysics_GetRotation(_pstBody);
+    orxPhysics_GetPosition(_pstBody, &(_pstBody->vResultPosition));
+
+    /* Should interpolate? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
+    {
+      /* Gets interpolation coef */
+      fCoef = sstPhysics.fDTAccumulator / sstPhysics.fFixedDT;
+
+      /* Interpolates rotation & position */
+      _pstBody->fResultRotation     = orxLERP(_pstBody->fPreviousRotation, _pstBody->fResultRotation, fCoef);
+      _pstBody->vResultPosition.fX  = orxLERP(_pstBody->vPreviousPosition.fX, _pstBody->vResultPosition.fX, fCoef);
+      _pstBody->vResultPosition.fY  = orxLERP(_pstBody->vPreviousPosition.fY, _pstBody->vResultPosition.fY, fCoef);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Prepares physics simulation results for a range of the apply list (threaded mode)
+ * @param[in]   _u32Start                     First index
+ * @param[in]   _u32End                       Index after the last one
+ * @param[in]   _pContext                     Unused
+ * @return      orxSTATUS_SUCCESS
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_PrepareResultRange(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  orxU32 i;
+
+  /* For all bodies in range */
+  for(i = _u32Start; i < _u32End; i++)
+  {
+    /* Prepares its result */
+    orxPhysics_LiquidFun_PrepareResult(sstPhysics.apstApplyList[i]);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Applies prepared physics simulation result to the body
+ * @param[in]   _pstBody                      Concerned body
+ */
+static void orxFASTCALL orxPhysics_ApplySimulationResult(orxPHYSICS_BODY *_pstBody)
+{
+  b2Body         *poBody;
+  orxOBJECT      *pstObject;
+  orxBODY        *pstBody;
+  orxFRAME       *pstFrame;
+  orxFRAME_SPACE  eFrameSpace;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_ApplySimResult");
+
+  /* Gets physics body */
+  poBody = (b2Body *)_pstBody->poBody;
+
+  /* Gets associated body */
+  pstBody = orxBODY(poBody->GetUserData());
+
+  /* Gets owner object */
+  pstObject = orxOBJECT(orxStructure_GetOwner(pstBody));
+
+  /* Gets its frame */
+  pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+
+  /* Gets its frame space */
+  eFrameSpace = (orxFrame_IsRootChild(pstFrame) != orxFALSE) ? orxFRAME_SPACE_LOCAL : orxFRAME_SPACE_GLOBAL;
+
+  /* Is enabled? */
+  if(_pstBody->bIsEnabled != orxFALSE)
+  {
+    orxVECTOR vSpeed, vOldPos;
+
     /* Gets resulting speed */
-    orxPhysics_GetSpeed(_pstBody, &vSpeed);
+    orxVector_Copy(&vSpeed, &(_pstBody->vResultSpeed));
 
     /* Global space? */
     if(eFrameSpace == orxFRAME_SPACE_GLOBAL)
@@ -999,38 +1320,33 @@ static void orxFASTCALL orxPhysics_ApplySimulationResult(orxPHYSICS_BODY *_pstBo
     }
 
     /* Updates its speed & angular velocity */
-    orxBody_SetSpeed(pstBody, orxVector_Mulf(&vSpeed, &vSpeed, fCoef));
-    orxBody_SetAngularVelocity(pstBody, fCoef * orxPhysics_GetAngularVelocity(_pstBody));
+    orxBody_SetSpeed(pstBody, orxVector_Mulf(&vSpeed, &vSpeed, _pstBody->fResultSpeedCoef));
+    orxBody_SetAngularVelocity(pstBody, _pstBody->fResultAngularVelocity);
 
     /* Should interpolate? */
     if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
     {
-      orxFLOAT fCoef;
-
-      /* Gets interpolation coef */
-      fCoef = sstPhysics.fDTAccumulator / sstPhysics.fFixedDT;
-
       /* Updates rotation */
-      _pstBody->fInterpolatedRotation = orxLERP(_pstBody->fPreviousRotation, orxPhysics_GetRotation(_pstBody), fCoef);
+      _pstBody->fInterpolatedRotation = _pstBody->fResultRotation;
       orxFrame_SetRotation(pstFrame, eFrameSpace, _pstBody->fInterpolatedRotation);
 
       /* Updates position */
       orxFrame_GetPosition(pstFrame, eFrameSpace, &vOldPos);
-      orxPhysics_GetPosition(_pstBody, &vNewPos);
-      _pstBody->vInterpolatedPosition.fX = orxLERP(_pstBody->vPreviousPosition.fX, vNewPos.fX, fCoef);
-      _pstBody->vInterpolatedPosition.fY = orxLERP(_pstBody->vPreviousPosition.fY, vNewPos.fY, fCoef);
+      _pstBody->vInterpolatedPosition.fX = _pstBody->vResultPosition.fX;
+      _pstBody->vInterpolatedPosition.fY = _pstBody->vResultPosition.fY;
       _pstBody->vInterpolatedPosition.fZ = vOldPos.fZ;
       orxFrame_SetPosition(pstFrame, eFrameSpace, &_pstBody->vInterpolatedPosition);
     }
     else
     {
+      orxVECTOR vNewPos;
+
       /* Updates rotation */
-      orxFrame_SetRotation(pstFrame, eFrameSpace, orxPhysics_GetRotation(_pstBody));
+      orxFrame_SetRotation(pstFrame, eFrameSpace, _pstBody->fResultRotation);
 
       /* Updates position */
       orxFrame_GetPosition(pstFrame, eFrameSpace, &vOldPos);
-      orxPhysics_GetPosition(_pstBody, &vNewPos);
-      vNewPos.fZ = vOldPos.fZ;
+      orxVector_Set(&vNewPos, _pstBody->vResultPosition.fX, _pstBody->vResultPosition.fY, vOldPos.fZ);
       orxFrame_SetPosition(pstFrame, eFrameSpace, &vNewPos);
     }
   }
@@ -1052,6 +1368,191 @@ static void orxFASTCALL orxPhysics_ApplySimulationResult(orxPHYSICS_BODY *_pstBo
   return;
 }
 
+/** Applies physics simulation results to all non-static awake bodies
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_ApplyResults()
+{
+  orxPHYSICS_BODY *pstPhysicBody;
+
+  /* Threaded? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+  {
+    orxU32 u32Count, u32BodyCount, i;
+
+    /* Gets body count */
+    u32BodyCount = orxBank_GetCount(sstPhysics.pstBodyBank);
+
+    /* Should grow apply list? */
+    if(u32BodyCount > sstPhysics.u32ApplyListSize)
+    {
+      orxPHYSICS_BODY **apstApplyList;
+
+      /* Grows it */
+      apstApplyList = (orxPHYSICS_BODY **)orxMemory_Reallocate(sstPhysics.apstApplyList, u32BodyCount * sizeof(orxPHYSICS_BODY *), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(apstApplyList != orxNULL)
+      {
+        /* Stores it */
+        sstPhysics.apstApplyList    = apstApplyList;
+        sstPhysics.u32ApplyListSize = u32BodyCount;
+      }
+    }
+
+    /* For all physical bodies */
+    for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList)), u32Count = 0;
+        (pstPhysicBody != orxNULL) && (u32Count < sstPhysics.u32ApplyListSize);
+        pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+    {
+      /* Was non-static and awake at the end of the step? */
+      if(pstPhysicBody->astState[sstPhysics.u32StateIndex].bIsAwake != orxFALSE)
+      {
+        /* Adds it to the apply list */
+        sstPhysics.apstApplyList[u32Count++] = pstPhysicBody;
+      }
+    }
+
+    /* Prepares all results in parallel (read-only pass) */
+    orxThread_ParallelFor(u32Count, orxPhysics::su32ApplyGrain, orxPhysics_LiquidFun_PrepareResultRange, orxNULL);
+
+    /* For all bodies in the apply list */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Applies its result (frame updates are not thread-safe) */
+      orxPhysics_ApplySimulationResult(sstPhysics.apstApplyList[i]);
+    }
+  }
+  else
+  {
+    /* For all physical bodies */
+    for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
+        pstPhysicBody != orxNULL;
+        pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+    {
+      b2Body *poBody;
+
+      /* Gets body */
+      poBody = pstPhysicBody->poBody;
+
+      /* Non-static and awake? */
+      if((poBody->GetType() != b2_staticBody)
+      && (poBody->IsAwake() != false))
+      {
+        /* Prepares simulation result */
+        orxPhysics_LiquidFun_PrepareResult(pstPhysicBody);
+
+        /* Applies it */
+        orxPhysics_ApplySimulationResult(pstPhysicBody);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Sends all stored contact events
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_SendEvents()
+{
+  orxPHYSICS_CONTACT_BUFFER  *pstBuffer;
+  orxPHYSICS_EVENT_STORAGE   *pstEventStorage;
+
+  /* Gets current contact buffer */
+  pstBuffer = &(sstPhysics.astContactBuffer[sstPhysics.u32ContactBufferIndex]);
+
+  /* Has batched contacts? */
+  if(pstBuffer->u32Count != 0)
+  {
+    orxU32 i, u32Count;
+
+    /* Swaps buffers: contacts added during delivery will go to the other one */
+    sstPhysics.u32ContactBufferIndex ^= 1;
+
+    /* For all contacts */
+    for(i = 0, u32Count = 0; i < pstBuffer->u32Count; i++)
+    {
+      b2Body *poSource, *poDestination;
+
+      /* Gets its bodies */
+      poSource      = pstBuffer->apoBodyList[i << 1];
+      poDestination = pstBuffer->apoBodyList[(i << 1) + 1];
+
+      /* Still valid? */
+      if((poSource != orxNULL) && (poDestination != orxNULL))
+      {
+        orxPHYSICS_CONTACT *pstContact;
+
+        /* Gets its packed location */
+        pstContact = &(pstBuffer->astContactList[u32Count++]);
+
+        /* Should move? */
+        if(pstContact != &(pstBuffer->astContactList[i]))
+        {
+          /* Moves it, along with its bodies */
+          orxMemory_Copy(pstContact, &(pstBuffer->astContactList[i]), sizeof(orxPHYSICS_CONTACT));
+          pstBuffer->apoBodyList[(u32Count - 1) << 1]       = poSource;
+          pstBuffer->apoBodyList[((u32Count - 1) << 1) + 1] = poDestination;
+        }
+
+        /* Updates its sender & recipient */
+        pstContact->hSender     = (orxHANDLE)orxStructure_GetOwner(orxBODY(poSource->GetUserData()));
+        pstContact->hRecipient  = (orxHANDLE)orxStructure_GetOwner(orxBODY(poDestination->GetUserData()));
+      }
+    }
+
+    /* Only keeps valid contacts (bodies deleted during delivery will get their contacts scrubbed) */
+    pstBuffer->u32Count = u32Count;
+
+    /* Has callback and valid contacts? */
+    if((sstPhysics.pfnContactCallback != orxNULL) && (u32Count != 0))
+    {
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("orxPhysics_SendContacts");
+
+      /* Delivers them */
+      sstPhysics.pfnContactCallback(pstBuffer->astContactList, u32Count, sstPhysics.pContactContext);
+
+      /* Profiles */
+      orxPROFILER_POP_MARKER();
+    }
+
+    /* Clears buffer */
+    pstBuffer->u32Count = 0;
+  }
+
+  /* For all stored events */
+  for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
+      pstEventStorage != orxNULL;
+      pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
+  {
+    /* Depending on type */
+    switch(pstEventStorage->eID)
+    {
+      case orxPHYSICS_EVENT_CONTACT_ADD:
+      case orxPHYSICS_EVENT_CONTACT_REMOVE:
+      {
+        /* Sends event */
+        orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Clears stored events */
+  orxLinkList_Clean(&(sstPhysics.stEventList));
+  orxBank_Clear(sstPhysics.pstEventBank);
+
+  /* Done! */
+  return;
+}
+
 /** Resets interpolation values
  */
 static void orxFASTCALL orxPhysics_LiquidFun_ResetInterpolation()
@@ -1072,11 +1573,11 @@ static void orxFASTCALL orxPhysics_LiquidFun_ResetInterpolation()
     if((poBody->GetType() != b2_staticBody)
     && (poBody->IsAwake() != false))
     {
-      /* Resets its values */
-      orxPhysics_GetPosition(pstPhysicBody, &pstPhysicBody->vPreviousPosition);
+      /* Resets its values (directly from the world, as this can be run from the step job) */
+      orxVector_Set(&pstPhysicBody->vPreviousPosition, sstPhysics.fRecDimensionRatio * poBody->GetPosition().x, sstPhysics.fRecDimensionRatio * poBody->GetPosition().y, pstPhysicBody->vPreviousPosition.fZ);
       orxVector_Copy(&pstPhysicBody->vInterpolatedPosition, &pstPhysicBody->vPreviousPosition);
       pstPhysicBody->fPreviousRotation      =
-      pstPhysicBody->fInterpolatedRotation  = orxPhysics_GetRotation(pstPhysicBody);
+      pstPhysicBody->fInterpolatedRotation  = poBody->GetAngle();
     }
   }
 
@@ -1084,27 +1585,87 @@ static void orxFASTCALL orxPhysics_LiquidFun_ResetInterpolation()
   return;
 }
 
-/** Update (callback to register on a clock)
- * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
- * @param[in]   _pContext       Context sent when registering callback to the clock
+/** Runs all the pending simulation steps
  */
-static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+static void orxFASTCALL orxPhysics_LiquidFun_Step()
+{
+  orxU32 i;
+
+  /* For all steps */
+  for(i = 0; i < sstPhysics.u32StepCount; i++)
+  {
+    /* Last step and should interpolate? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE)
+    && (i == sstPhysics.u32StepCount - 1))
+    {
+      /* Resets interpolation */
+      orxPhysics_LiquidFun_ResetInterpolation();
+    }
+
+    /* Updates world simulation */
+    sstPhysics.poWorld->Step(sstPhysics.fFixedDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+  }
+
+  /* Should run a last simulation step? */
+  if(sstPhysics.fExtraStepDT > orxFLOAT_0)
+  {
+    /* Updates last step of world simulation */
+    sstPhysics.poWorld->Step(sstPhysics.fExtraStepDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+  }
+
+  /* Clears forces */
+  sstPhysics.poWorld->ClearForces();
+
+  /* Done! */
+  return;
+}
+
+/** Runs the pending simulation steps and stores all body states in the back buffer (threaded mode, step job)
+ * @param[in]   _pContext                     Unused
+ * @return      orxSTATUS_SUCCESS
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_RunStep(void *_pContext)
 {
   orxPHYSICS_BODY  *pstPhysicBody;
-  b2Body           *poBody;
+  orxU32            u32BackIndex;
 
   /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxPhysics_Update");
+  orxPROFILER_PUSH_MARKER("orxPhysics_Step");
 
-  /* Checks */
-  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
-  orxASSERT(_pstClockInfo != orxNULL);
+  /* Runs simulation */
+  orxPhysics_LiquidFun_Step();
+
+  /* Gets back state index */
+  u32BackIndex = sstPhysics.u32StateIndex ^ 1;
 
   /* For all physical bodies */
   for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
       pstPhysicBody != orxNULL;
       pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
   {
+    /* Stores its back state */
+    orxPhysics_LiquidFun_StoreState(pstPhysicBody, &(pstPhysicBody->astState[u32BackIndex]));
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Prepares all bodies for simulation, using their owners' current state
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_PrepareBodies()
+{
+  orxPHYSICS_BODY *pstPhysicBody;
+
+  /* For all physical bodies */
+  for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
+      pstPhysicBody != orxNULL;
+      pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+  {
+    b2Body     *poBody;
     orxOBJECT  *pstObject;
     orxBODY    *pstBody;
 
@@ -1195,12 +1756,45 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
     }
   }
 
+  /* Done! */
+  return;
+}
+
+/** Update (callback to register on a clock)
+ * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
+ * @param[in]   _pContext       Context sent when registering callback to the clock
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_Update");
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstClockInfo != orxNULL);
+
+  /* Waits for previous step */
+  orxPhysics_LiquidFun_WaitStep();
+
+  /* Has pending result? */
+  if(sstPhysics.bHasResult != orxFALSE)
+  {
+    /* Applies simulation results */
+    orxPhysics_LiquidFun_ApplyResults();
+
+    /* Sends stored events */
+    orxPhysics_LiquidFun_SendEvents();
+
+    /* Updates status */
+    sstPhysics.bHasResult = orxFALSE;
+  }
+
+  /* Prepares all bodies */
+  orxPhysics_LiquidFun_PrepareBodies();
+
   /* Is simulation enabled? */
   if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ENABLED))
   {
-    orxPHYSICS_EVENT_STORAGE *pstEventStorage;
-    orxU32                    u32Steps, i;
-
     /* Stores DT */
     sstPhysics.fLastDT = _pstClockInfo->fDT;
 
@@ -1208,25 +1802,13 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
     sstPhysics.fDTAccumulator += _pstClockInfo->fDT;
 
     /* Computes the number of steps */
-    u32Steps = (orxU32)orxMath_Floor((sstPhysics.fDTAccumulator + orxPhysics::sfMinStepDuration) / sstPhysics.fFixedDT);
+    sstPhysics.u32StepCount = (orxU32)orxMath_Floor((sstPhysics.fDTAccumulator + orxPhysics::sfMinStepDuration) / sstPhysics.fFixedDT);
 
     /* Updates accumulator */
-    sstPhysics.fDTAccumulator = orxMAX(orxFLOAT_0, sstPhysics.fDTAccumulator - (orxU2F(u32Steps) * sstPhysics.fFixedDT));
+    sstPhysics.fDTAccumulator = orxMAX(orxFLOAT_0, sstPhysics.fDTAccumulator - (orxU2F(sstPhysics.u32StepCount) * sstPhysics.fFixedDT));
 
-    /* For all steps */
-    for(i = 0; i < u32Steps; i++)
-    {
-      /* Last step and should interpolate? */
-      if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE)
-      && (i == u32Steps - 1))
-      {
-        /* Resets interpolation */
-        orxPhysics_LiquidFun_ResetInterpolation();
-      }
-
-      /* Updates world simulation */
-      sstPhysics.poWorld->Step(sstPhysics.fFixedDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
-    }
+    /* Clears extra step */
+    sstPhysics.fExtraStepDT = orxFLOAT_0;
 
     /* Not absolute fixed DT? */
     if(!orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT))
@@ -1234,60 +1816,53 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
       /* Should run a last simulation step? */
       if(sstPhysics.fDTAccumulator >= orxPhysics::sfMinStepDuration)
       {
-        /* Updates last step of world simulation */
-        sstPhysics.poWorld->Step(sstPhysics.fDTAccumulator, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+        /* Stores its duration */
+        sstPhysics.fExtraStepDT = sstPhysics.fDTAccumulator;
 
         /* Clears accumulator */
         sstPhysics.fDTAccumulator = orxFLOAT_0;
       }
     }
 
-    /* Clears forces */
-    sstPhysics.poWorld->ClearForces();
-
-    /* For all physical bodies */
-    for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
-        pstPhysicBody != orxNULL;
-        pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+    /* Threaded? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
     {
-      poBody = pstPhysicBody->poBody;
+      /* Creates step job */
+      sstPhysics.pstStepJob = orxThread_CreateJob(orxPhysics_LiquidFun_RunStep, orxNULL);
 
-      /* Non-static and awake? */
-      if((poBody->GetType() != b2_staticBody)
-      && (poBody->IsAwake() != false))
+      /* Failure? */
+      if((sstPhysics.pstStepJob != orxNULL)
+      && (orxThread_SubmitJob(sstPhysics.pstStepJob) == orxSTATUS_FAILURE))
       {
-        /* Applies simulation result */
-        orxPhysics_ApplySimulationResult(pstPhysicBody);
+        /* Deletes it */
+        orxThread_DeleteJob(sstPhysics.pstStepJob);
+        sstPhysics.pstStepJob = orxNULL;
       }
-    }
 
-    /* For all stored events */
-    for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
-        pstEventStorage != orxNULL;
-        pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
-    {
-      /* Depending on type */
-      switch(pstEventStorage->eID)
+      /* No job? */
+      if(sstPhysics.pstStepJob == orxNULL)
       {
-        case orxPHYSICS_EVENT_CONTACT_ADD:
-        case orxPHYSICS_EVENT_CONTACT_REMOVE:
-        {
-          /* Sends event */
-          orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
+        /* Runs step inline */
+        orxPhysics_LiquidFun_RunStep(orxNULL);
 
-          break;
-        }
-
-        default:
-        {
-          break;
-        }
+        /* Swaps states */
+        sstPhysics.u32StateIndex ^= 1;
       }
+
+      /* Updates status */
+      sstPhysics.bHasResult = orxTRUE;
     }
+    else
+    {
+      /* Runs simulation */
+      orxPhysics_LiquidFun_Step();
+
+      /* Applies simulation results */
+      orxPhysics_LiquidFun_ApplyResults();
 
-    /* Clears stored events */
-    orxLinkList_Clean(&(sstPhysics.stEventList));
-    orxBank_Clear(sstPhysics.pstEventBank);
+      /* Sends stored events */
+      orxPhysics_LiquidFun_SendEvents();
+    }
   }
 
   /* Profiles */
@@ -1307,6 +1882,9 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_LiquidFun_CreateBody(const or
   orxASSERT(_hUserData != orxHANDLE_UNDEFINED);
   orxASSERT(_pstBodyDef != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* 2D? */
   if(orxFLAG_TEST(_pstBodyDef->u32Flags, orxBODY_DEF_KU32_FLAG_2D))
   {
@@ -1387,6 +1965,14 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_LiquidFun_CreateBody(const or
         orxLinkList_AddEnd(&(sstPhysics.stBodyList), &(pstResult->stNode));
       }
     }
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Inits both its states */
+      orxPhysics_LiquidFun_StoreState(pstResult, &(pstResult->astState[0]));
+      orxPhysics_LiquidFun_StoreState(pstResult, &(pstResult->astState[1]));
+    }
   }
 
   /* Done! */
@@ -1396,11 +1982,15 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_LiquidFun_CreateBody(const or
 extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteBody(orxPHYSICS_BODY *_pstBody)
 {
   orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+  orxU32                    j;
 
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* For all stored events */
   for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
       pstEventStorage != orxNULL;
@@ -1423,6 +2013,51 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteBody(orxPHYSICS_BODY *_ps
     }
   }
 
+  /* For both contact buffers (the one being filled and the one being delivered, if any) */
+  for(j = 0; j < 2; j++)
+  {
+    orxPHYSICS_CONTACT_BUFFER *pstBuffer;
+
+    /* Gets it */
+    pstBuffer = &(sstPhysics.astContactBuffer[j]);
+
+    /* Has batched contacts? */
+    if(pstBuffer->u32Count != 0)
+    {
+      orxBOOL bDelivering;
+      orxU32  i, u32Count;
+
+      /* Is being delivered? */
+      bDelivering = (j != sstPhysics.u32ContactBufferIndex) ? orxTRUE : orxFALSE;
+
+      /* For all body references */
+      for(i = 0, u32Count = pstBuffer->u32Count << 1; i < u32Count; i++)
+      {
+        /* Is concerned body? */
+        if(pstBuffer->apoBodyList[i] == (b2Body *)_pstBody->poBody)
+        {
+          /* Invalidates it */
+          pstBuffer->apoBodyList[i] = orxNULL;
+
+          /* Being delivered? */
+          if(bDelivering != orxFALSE)
+          {
+            orxPHYSICS_CONTACT *pstContact;
+
+            /* Gets contact */
+            pstContact = &(pstBuffer->astContactList[i >> 1]);
+
+            /* Scrubs it, as its owners and parts were already resolved */
+            pstContact->hSender                     =
+            pstContact->hRecipient                  = orxNULL;
+            pstContact->stPayload.pstSenderPart     =
+            pstContact->stPayload.pstRecipientPart  = orxNULL;
+          }
+        }
+      }
+    }
+  }
+
   /* Deletes it */
   sstPhysics.poWorld->DestroyBody((b2Body *)_pstBody->poBody);
 
@@ -1449,6 +2084,9 @@ extern "C" orxPHYSICS_BODY_PART *orxFASTCALL orxPhysics_LiquidFun_CreatePart(orx
   orxASSERT(_pstBodyPartDef != orxNULL);
   orxASSERT(orxFLAG_TEST(_pstBodyPartDef->u32Flags, orxBODY_PART_DEF_KU32_MASK_TYPE));
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -1631,19 +2269,96 @@ extern "C" orxPHYSICS_BODY_PART *orxFASTCALL orxPhysics_LiquidFun_CreatePart(orx
 
 extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeletePart(orxPHYSICS_BODY_PART *_pstBodyPart)
 {
-  b2Fixture  *poFixture;
-  b2Body     *poBody;
+  orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+  orxBODY_PART             *pstPart;
+  b2Fixture                *poFixture;
+  b2Body                   *poBody;
+  orxU32                    j;
 
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets Fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
   /* Gets its body */
   poBody = poFixture->GetBody();
 
+  /* Gets its part */
+  pstPart = (orxBODY_PART *)poFixture->GetUserData();
+
+  /* For all stored events */
+  for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
+      pstEventStorage != orxNULL;
+      pstEventStorage = (pstEventStorage == orxNULL) ? (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList)) : (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
+  {
+    /* Is part of the event? */
+    if((pstEventStorage->stPayload.pstSenderPart == pstPart) || (pstEventStorage->stPayload.pstRecipientPart == pstPart))
+    {
+      orxPHYSICS_EVENT_STORAGE *pstCurrentEventStorage;
+
+      /* Gets current event */
+      pstCurrentEventStorage = pstEventStorage;
+
+      /* Goes back to previous */
+      pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetPrevious(&(pstEventStorage->stNode));
+
+      /* Removes event */
+      orxLinkList_Remove(&(pstCurrentEventStorage->stNode));
+      orxBank_Free(sstPhysics.pstEventBank, pstCurrentEventStorage);
+    }
+  }
+
+  /* For both contact buffers (the one being filled and the one being delivered, if any) */
+  for(j = 0; j < 2; j++)
+  {
+    orxPHYSICS_CONTACT_BUFFER *pstBuffer;
+
+    /* Gets it */
+    pstBuffer = &(sstPhysics.astContactBuffer[j]);
+
+    /* Has batched contacts? */
+    if(pstBuffer->u32Count != 0)
+    {
+      orxBOOL bDelivering;
+      orxU32  i;
+
+      /* Is being delivered? */
+      bDelivering = (j != sstPhysics.u32ContactBufferIndex) ? orxTRUE : orxFALSE;
+
+      /* For all contacts */
+      for(i = 0; i < pstBuffer->u32Count; i++)
+      {
+        orxPHYSICS_CONTACT *pstContact;
+
+        /* Gets it */
+        pstContact = &(pstBuffer->astContactList[i]);
+
+        /* Is concerned part? */
+        if((pstContact->stPayload.pstSenderPart == pstPart) || (pstContact->stPayload.pstRecipientPart == pstPart))
+        {
+          /* Invalidates its bodies */
+          pstBuffer->apoBodyList[i << 1]        =
+          pstBuffer->apoBodyList[(i << 1) + 1]  = orxNULL;
+
+          /* Being delivered? */
+          if(bDelivering != orxFALSE)
+          {
+            /* Scrubs it, as its owners and parts were already resolved */
+            pstContact->hSender                     =
+            pstContact->hRecipient                  = orxNULL;
+            pstContact->stPayload.pstSenderPart     =
+            pstContact->stPayload.pstRecipientPart  = orxNULL;
+          }
+        }
+      }
+    }
+  }
+
   /* Deletes its part */
   poBody->DestroyFixture(poFixture);
 
@@ -1673,6 +2388,9 @@ extern "C" orxPHYSICS_BODY_JOINT *orxFASTCALL orxPhysics_LiquidFun_CreateJoint(o
   orxASSERT(_pstBodyJointDef != orxNULL);
   orxASSERT(orxFLAG_TEST(_pstBodyJointDef->u32Flags, orxBODY_JOINT_DEF_KU32_MASK_TYPE));
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Depending on joint type */
   switch(orxFLAG_GET(_pstBodyJointDef->u32Flags, orxBODY_JOINT_DEF_KU32_MASK_TYPE))
   {
@@ -2002,6 +2720,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteJoint(orxPHYSICS_BODY_JOI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Deletes it */
   sstPhysics.poWorld->DestroyJoint((b2Joint *)_pstBodyJoint);
 
@@ -2016,6 +2737,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableMotor(orxPHYSICS_BODY_JOI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -2043,6 +2767,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_SetJointMotorSpeed(orxPHYSICS_B
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -2070,6 +2797,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_SetJointMaxMotorTorque(orxPHYSI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -2099,6 +2829,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetJointReactionForce(con
   orxASSERT(_pstBodyJoint != orxNULL);
   orxASSERT(_pvForce != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (const b2Joint *)_pstBodyJoint;
 
@@ -2121,6 +2854,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetJointReactionTorque(cons
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (const b2Joint *)_pstBodyJoint;
 
@@ -2142,6 +2878,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPosition(orxPHYSICS_BOD
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2184,6 +2923,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPosition(orxPHYSICS_BOD
     }
   }
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2198,6 +2940,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetRotation(orxPHYSICS_BOD
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2232,6 +2977,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetRotation(orxPHYSICS_BOD
     }
   }
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2247,6 +2995,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetSpeed(orxPHYSICS_BODY *
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2266,6 +3017,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetSpeed(orxPHYSICS_BODY *
     poBody->SetLinearVelocity(vSpeed);
   }
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2280,6 +3034,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularVelocity(orxPHYS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2296,6 +3053,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularVelocity(orxPHYS
     poBody->SetAngularVelocity(_fVelocity);
   }
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2310,6 +3070,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetCustomGravity(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2360,6 +3123,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetFixedRotation(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2379,6 +3145,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetDynamic(orxPHYSICS_BODY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2399,6 +3168,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetDynamic(orxPHYSICS_BODY
     poBody->SetType(orxBody_GetAllowMoving(pstBody) != orxFALSE ? b2_kinematicBody : b2_staticBody);
   }
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2412,6 +3184,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAllowMoving(orxPHYSICS_
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2422,6 +3197,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAllowMoving(orxPHYSICS_
     poBody->SetType(_bAllowMoving != orxFALSE ? b2_kinematicBody : b2_staticBody);
   }
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2437,16 +3215,28 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetPosition(const orxPHYS
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Updates result */
+  pvResult = _pvPosition;
+
+  /* Threaded? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+  {
+    /* Gets its front position */
+    pvResult->fX  = _pstBody->astState[sstPhysics.u32StateIndex].vPosition.fX;
+    pvResult->fY  = _pstBody->astState[sstPhysics.u32StateIndex].vPosition.fY;
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Gets its position */
-  vPosition = poBody->GetPosition();
+    /* Gets its position */
+    vPosition = poBody->GetPosition();
 
-  /* Updates result */
-  pvResult      = _pvPosition;
-  pvResult->fX  = sstPhysics.fRecDimensionRatio * vPosition.x;
-  pvResult->fY  = sstPhysics.fRecDimensionRatio * vPosition.y;
+    /* Updates result */
+    pvResult->fX  = sstPhysics.fRecDimensionRatio * vPosition.x;
+    pvResult->fY  = sstPhysics.fRecDimensionRatio * vPosition.y;
+  }
 
   /* Done! */
   return pvResult;
@@ -2461,11 +3251,20 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetRotation(const orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Threaded? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+  {
+    /* Gets its front rotation */
+    fResult = _pstBody->astState[sstPhysics.u32StateIndex].fRotation;
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Gets its rotation */
-  fResult = poBody->GetAngle();
+    /* Gets its rotation */
+    fResult = poBody->GetAngle();
+  }
 
   /* Done! */
   return fResult;
@@ -2482,17 +3281,28 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetSpeed(const orxPHYSICS
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Updates result */
+  pvResult = _pvSpeed;
 
-  /* Gets its speed */
-  vSpeed = poBody->GetLinearVelocity();
+  /* Threaded? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+  {
+    /* Gets its front speed */
+    orxVector_Copy(pvResult, &(_pstBody->astState[sstPhysics.u32StateIndex].vSpeed));
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Updates result */
-  pvResult      = _pvSpeed;
-  pvResult->fX  = sstPhysics.fRecDimensionRatio * vSpeed.x;
-  pvResult->fY  = sstPhysics.fRecDimensionRatio * vSpeed.y;
-  pvResult->fZ  = orxFLOAT_0;
+    /* Gets its speed */
+    vSpeed = poBody->GetLinearVelocity();
+
+    /* Updates result */
+    pvResult->fX  = sstPhysics.fRecDimensionRatio * vSpeed.x;
+    pvResult->fY  = sstPhysics.fRecDimensionRatio * vSpeed.y;
+    pvResult->fZ  = orxFLOAT_0;
+  }
 
   /* Done! */
   return pvResult;
@@ -2510,6 +3320,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetSpeedAtWorldPosition(c
   orxASSERT(_pvPosition != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2535,11 +3348,20 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetAngularVelocity(const or
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
-  /* Gets body */
-  poBody = (b2Body *)_pstBody->poBody;
+  /* Threaded? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED))
+  {
+    /* Gets its front angular velocity */
+    fResult = _pstBody->astState[sstPhysics.u32StateIndex].fAngularVelocity;
+  }
+  else
+  {
+    /* Gets body */
+    poBody = (b2Body *)_pstBody->poBody;
 
-  /* Gets its angular velocity */
-  fResult = poBody->GetAngularVelocity();
+    /* Gets its angular velocity */
+    fResult = poBody->GetAngularVelocity();
+  }
 
   /* Done! */
   return fResult;
@@ -2588,6 +3410,9 @@ extern "C" orxBOOL orxFASTCALL orxPhysics_LiquidFun_IsFixedRotation(const orxPHY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2628,6 +3453,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetMassCenter(const orxPH
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvMassCenter != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2655,6 +3483,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetLinearDamping(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2674,6 +3505,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularDamping(orxPHYSI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2733,6 +3567,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyTorque(orxPHYSICS_BOD
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2783,6 +3620,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyForce(orxPHYSICS_BODY
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvForce != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Sets force */
   vForce.Set(sstPhysics.fDimensionRatio * _pvForce->fX, sstPhysics.fDimensionRatio * _pvForce->fY);
 
@@ -2848,6 +3688,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyImpulse(orxPHYSICS_BO
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvImpulse != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Sets impulse */
   vImpulse.Set(sstPhysics.fDimensionRatio * _pvImpulse->fX, sstPhysics.fDimensionRatio * _pvImpulse->fY);
 
@@ -2897,6 +3740,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyImpulse(orxPHYSICS_BO
   /* Applies force */
   poBody->ApplyLinearImpulse(vImpulse, vPoint, true);
 
+  /* Refreshes its state */
+  orxPhysics_LiquidFun_RefreshState(_pstBody);
+
   /* Done! */
   return eResult;
 }
@@ -2911,6 +3757,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSelfFlags(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2937,6 +3786,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartCheckMask(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3000,6 +3852,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSolid(orxPHYSICS_BO
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3038,6 +3893,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartFriction(orxPHYSICS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3076,6 +3934,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartRestitution(orxPHYS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3114,6 +3975,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartDensity(orxPHYSICS_
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3153,6 +4017,9 @@ extern "C" orxBOOL orxFASTCALL orxPhysics_LiquidFun_IsInsidePart(const orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3166,6 +4033,149 @@ extern "C" orxBOOL orxFASTCALL orxPhysics_LiquidFun_IsInsidePart(const orxPHYSIC
   return bResult;
 }
 
+#ifdef orxPHYSICS_ENABLE_DEBUG_DRAW
+
+/** Adds debug rays for a raycast
+ * @param[in]   _rvBegin                      Beginning of raycast (world space)
+ * @param[in]   _rvEnd                        End of raycast (world space)
+ * @param[in]   _pvContact                    Contact position, orxNULL if nothing was hit
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_AddDebugRays(const b2Vec2 &_rvBegin, const b2Vec2 &_rvEnd, const orxVECTOR *_pvContact)
+{
+  /* Hit? */
+  if(_pvContact != orxNULL)
+  {
+    orxPHYSICS_DEBUG_RAY *pstBeforeHitRay, *pstAfterHitRay;
+
+    /* Allocates debug rays */
+    pstBeforeHitRay  = (orxPHYSICS_DEBUG_RAY *)orxBank_Allocate(sstPhysics.pstRayBank);
+    pstAfterHitRay   = (orxPHYSICS_DEBUG_RAY *)orxBank_Allocate(sstPhysics.pstRayBank);
+    orxASSERT(pstBeforeHitRay != orxNULL);
+    orxASSERT(pstAfterHitRay != orxNULL);
+
+    /* Inits them */
+    pstBeforeHitRay->vBegin   = _rvBegin;
+    pstBeforeHitRay->vEnd.Set(sstPhysics.fDimensionRatio * _pvContact->fX, sstPhysics.fDimensionRatio * _pvContact->fY);
+    pstBeforeHitRay->stColor  = orxPhysics::stRayBeforeHitColor;
+    pstAfterHitRay->vBegin.Set(sstPhysics.fDimensionRatio * _pvContact->fX, sstPhysics.fDimensionRatio * _pvContact->fY);
+    pstAfterHitRay->vEnd      = _rvEnd;
+    pstAfterHitRay->stColor   = orxPhysics::stRayAfterHitColor;
+  }
+  else
+  {
+    orxPHYSICS_DEBUG_RAY *pstMissRay;
+
+    /* Allocates debug ray */
+    pstMissRay = (orxPHYSICS_DEBUG_RAY *)orxBank_Allocate(sstPhysics.pstRayBank);
+    orxASSERT(pstMissRay != orxNULL);
+
+    /* Inits it */
+    pstMissRay->vBegin  = _rvBegin;
+    pstMissRay->vEnd    = _rvEnd;
+    pstMissRay->stColor = orxPhysics::stRayMissColor;
+  }
+
+  /* Done! */
+  return;
+}
+
+#endif /* orxPHYSICS_ENABLE_DEBUG_DRAW */
+
+/** Issues a range of batched raycasts, can be run concurrently
+ * @param[in]   _u32Start                     First index
+ * @param[in]   _u32End                       Index after the last one
+ * @param[in]   _pContext                     Raycast batch context
+ * @return      orxSTATUS_SUCCESS
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_RaycastRange(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  orxPHYSICS_RAYCAST_BATCH *pstBatch;
+  orxU32                    i;
+
+  /* Gets batch */
+  pstBatch = (orxPHYSICS_RAYCAST_BATCH *)_pContext;
+
+  /* For all queries in range */
+  for(i = _u32Start; i < _u32End; i++)
+  {
+    const orxPHYSICS_RAYCAST   *pstRaycast;
+    orxPHYSICS_RAYCAST_RESULT  *pstResult;
+    b2Vec2                      vBegin, vEnd;
+    RayCastCallback             oRaycastCallback;
+
+    /* Gets query & result */
+    pstRaycast  = &(pstBatch->astRaycastList[i]);
+    pstResult   = &(pstBatch->astResultList[i]);
+
+    /* Gets extremities */
+    vBegin.Set(sstPhysics.fDimensionRatio * pstRaycast->vBegin.fX, sstPhysics.fDimensionRatio * pstRaycast->vBegin.fY);
+    vEnd.Set(sstPhysics.fDimensionRatio * pstRaycast->vEnd.fX, sstPhysics.fDimensionRatio * pstRaycast->vEnd.fY);
+
+    /* Inits filter data & early exit status */
+    oRaycastCallback.u16SelfFlags = pstRaycast->u16SelfFlags;
+    oRaycastCallback.u16CheckMask = pstRaycast->u16CheckMask;
+    oRaycastCallback.bEarlyExit   = pstRaycast->bEarlyExit;
+
+    /* Issues raycast */
+    sstPhysics.poWorld->RayCast(&oRaycastCallback, vBegin, vEnd);
+
+    /* Stores result */
+    pstResult->hUserData = oRaycastCallback.hResult;
+    orxVector_Set(&(pstResult->vContact), oRaycastCallback.vContact.fX, oRaycastCallback.vContact.fY, pstRaycast->vBegin.fZ);
+    orxVector_Copy(&(pstResult->vNormal), &(oRaycastCallback.vNormal));
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Issues a range of batched box picks, can be run concurrently
+ * @param[in]   _u32Start                     First index
+ * @param[in]   _u32End                       Index after the last one
+ * @param[in]   _pContext                     Box pick batch context
+ * @return      orxSTATUS_SUCCESS
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_BoxPickRange(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  orxPHYSICS_BOX_PICK_BATCH  *pstBatch;
+  orxU32                      i;
+
+  /* Gets batch */
+  pstBatch = (orxPHYSICS_BOX_PICK_BATCH *)_pContext;
+
+  /* For all queries in range */
+  for(i = _u32Start; i < _u32End; i++)
+  {
+    const orxPHYSICS_BOX_PICK  *pstBoxPick;
+    b2AABB                      stBox;
+    BoxPickCallback             oBoxPickCallback;
+
+    /* Gets query */
+    pstBoxPick = &(pstBatch->astBoxPickList[i]);
+
+    /* Gets extremities */
+    stBox.lowerBound.Set(sstPhysics.fDimensionRatio * pstBoxPick->stBox.vTL.fX, sstPhysics.fDimensionRatio * pstBoxPick->stBox.vTL.fY);
+    stBox.upperBound.Set(sstPhysics.fDimensionRatio * pstBoxPick->stBox.vBR.fX, sstPhysics.fDimensionRatio * pstBoxPick->stBox.vBR.fY);
+
+    /* Inits filter data */
+    oBoxPickCallback.u16SelfFlags = pstBoxPick->u16SelfFlags;
+    oBoxPickCallback.u16CheckMask = pstBoxPick->u16CheckMask;
+
+    /* Inits storage with its slice */
+    oBoxPickCallback.ahUserDataList = (pstBatch->ahUserDataList != orxNULL) ? pstBatch->ahUserDataList + i * pstBatch->u32UserDataNumber : orxNULL;
+    oBoxPickCallback.u32Size        = (pstBatch->ahUserDataList != orxNULL) ? pstBatch->u32UserDataNumber : 0;
+
+    /* Issues query */
+    sstPhysics.poWorld->QueryAABB(&oBoxPickCallback, stBox);
+
+    /* Stores count */
+    pstBatch->au32CountList[i] = oBoxPickCallback.u32Count;
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_pvBegin, const orxVECTOR *_pvEnd, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, orxBOOL _bEarlyExit, orxVECTOR *_pvContact, orxVECTOR *_pvNormal)
 {
   b2Vec2          vBegin, vEnd;
@@ -3177,6 +4187,9 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_
   orxASSERT(_pvBegin != orxNULL);
   orxASSERT(_pvEnd != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets extremities */
   vBegin.Set(sstPhysics.fDimensionRatio * _pvBegin->fX, sstPhysics.fDimensionRatio * _pvBegin->fY);
   vEnd.Set(sstPhysics.fDimensionRatio * _pvEnd->fX, sstPhysics.fDimensionRatio * _pvEnd->fY);
@@ -3214,38 +4227,8 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_
 
 #ifdef orxPHYSICS_ENABLE_DEBUG_DRAW
 
-  /* Hit? */
-  if(oRaycastCallback.hResult != orxHANDLE_UNDEFINED)
-  {
-    orxPHYSICS_DEBUG_RAY *pstBeforeHitRay, *pstAfterHitRay;
-
-    /* Allocates debug rays */
-    pstBeforeHitRay  = (orxPHYSICS_DEBUG_RAY *)orxBank_Allocate(sstPhysics.pstRayBank);
-    pstAfterHitRay   = (orxPHYSICS_DEBUG_RAY *)orxBank_Allocate(sstPhysics.pstRayBank);
-    orxASSERT(pstBeforeHitRay != orxNULL);
-    orxASSERT(pstAfterHitRay != orxNULL);
-
-    /* Inits them */
-    pstBeforeHitRay->vBegin   = vBegin;
-    pstBeforeHitRay->vEnd.Set(sstPhysics.fDimensionRatio * oRaycastCallback.vContact.fX, sstPhysics.fDimensionRatio * oRaycastCallback.vContact.fY);
-    pstBeforeHitRay->stColor  = orxPhysics::stRayBeforeHitColor;
-    pstAfterHitRay->vBegin.Set(sstPhysics.fDimensionRatio * oRaycastCallback.vContact.fX, sstPhysics.fDimensionRatio * oRaycastCallback.vContact.fY);
-    pstAfterHitRay->vEnd      = vEnd;
-    pstAfterHitRay->stColor   = orxPhysics::stRayAfterHitColor;
-  }
-  else
-  {
-    orxPHYSICS_DEBUG_RAY *pstMissRay;
-
-    /* Allocates debug ray */
-    pstMissRay = (orxPHYSICS_DEBUG_RAY *)orxBank_Allocate(sstPhysics.pstRayBank);
-    orxASSERT(pstMissRay != orxNULL);
-
-    /* Inits it */
-    pstMissRay->vBegin  = vBegin;
-    pstMissRay->vEnd    = vEnd;
-    pstMissRay->stColor = orxPhysics::stRayMissColor;
-  }
+  /* Adds debug rays */
+  orxPhysics_LiquidFun_AddDebugRays(vBegin, vEnd, (oRaycastCallback.hResult != orxHANDLE_UNDEFINED) ? &(oRaycastCallback.vContact) : orxNULL);
 
 #endif /* orxPHYSICS_ENABLE_DEBUG_DRAW */
 
@@ -3262,6 +4245,9 @@ extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_BoxPick(const orxAABOX *_pstB
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBox != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets extremities */
   stBox.lowerBound.Set(sstPhysics.fDimensionRatio * _pstBox->vTL.fX, sstPhysics.fDimensionRatio * _pstBox->vTL.fY);
   stBox.upperBound.Set(sstPhysics.fDimensionRatio * _pstBox->vBR.fX, sstPhysics.fDimensionRatio * _pstBox->vBR.fY);
@@ -3281,6 +4267,113 @@ extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_BoxPick(const orxAABOX *_pstB
   return oBoxPickCallback.u32Count;
 }
 
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_RaycastBatch(const orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number, orxPHYSICS_RAYCAST_RESULT *_astResultList, orxBOOL _bParallel)
+{
+  orxPHYSICS_RAYCAST_BATCH  stBatch;
+  orxU32                    i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astRaycastList != orxNULL) || (_u32Number == 0));
+  orxASSERT((_astResultList != orxNULL) || (_u32Number == 0));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_RaycastBatch");
+
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
+  /* Inits batch */
+  stBatch.astRaycastList  = _astRaycastList;
+  stBatch.astResultList   = _astResultList;
+
+  /* Parallel? */
+  if(_bParallel != orxFALSE)
+  {
+    /* Issues all raycasts over workers (world is read-only at this point) */
+    orxThread_ParallelFor(_u32Number, orxPhysics::su32QueryGrain, orxPhysics_LiquidFun_RaycastRange, &stBatch);
+  }
+  else
+  {
+    /* Issues all raycasts */
+    orxPhysics_LiquidFun_RaycastRange(0, _u32Number, &stBatch);
+  }
+
+  /* For all results */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Hit? */
+    if(_astResultList[i].hUserData != orxHANDLE_UNDEFINED)
+    {
+      /* Updates result */
+      u32Result++;
+    }
+
+#ifdef orxPHYSICS_ENABLE_DEBUG_DRAW
+
+    /* Adds debug rays */
+    orxPhysics_LiquidFun_AddDebugRays(b2Vec2(sstPhysics.fDimensionRatio * _astRaycastList[i].vBegin.fX, sstPhysics.fDimensionRatio * _astRaycastList[i].vBegin.fY),
+                                      b2Vec2(sstPhysics.fDimensionRatio * _astRaycastList[i].vEnd.fX, sstPhysics.fDimensionRatio * _astRaycastList[i].vEnd.fY),
+                                      (_astResultList[i].hUserData != orxHANDLE_UNDEFINED) ? &(_astResultList[i].vContact) : orxNULL);
+
+#endif /* orxPHYSICS_ENABLE_DEBUG_DRAW */
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
+extern "C" orxU32 orxFASTCALL orxPhysics_LiquidFun_BoxPickBatch(const orxPHYSICS_BOX_PICK *_astBoxPickList, orxU32 _u32Number, orxHANDLE _ahUserDataList[], orxU32 _u32UserDataNumber, orxU32 _au32CountList[], orxBOOL _bParallel)
+{
+  orxPHYSICS_BOX_PICK_BATCH stBatch;
+  orxU32                    i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astBoxPickList != orxNULL) || (_u32Number == 0));
+  orxASSERT((_au32CountList != orxNULL) || (_u32Number == 0));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxPhysics_BoxPickBatch");
+
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
+  /* Inits batch */
+  stBatch.astBoxPickList    = _astBoxPickList;
+  stBatch.ahUserDataList    = _ahUserDataList;
+  stBatch.au32CountList     = _au32CountList;
+  stBatch.u32UserDataNumber = _u32UserDataNumber;
+
+  /* Parallel? */
+  if(_bParallel != orxFALSE)
+  {
+    /* Issues all queries over workers (world is read-only at this point) */
+    orxThread_ParallelFor(_u32Number, orxPhysics::su32QueryGrain, orxPhysics_LiquidFun_BoxPickRange, &stBatch);
+  }
+  else
+  {
+    /* Issues all queries */
+    orxPhysics_LiquidFun_BoxPickRange(0, _u32Number, &stBatch);
+  }
+
+  /* For all counts */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Updates result */
+    u32Result += _au32CountList[i];
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
 extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableSimulation(orxBOOL _bEnable)
 {
   /* Checks */
@@ -3302,6 +4395,26 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableSimulation(orxBOOL _bEnab
   return;
 }
 
+extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetContactCallback(const orxPHYSICS_CONTACT_FUNCTION _pfnCallback, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
+
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
+  /* Stores callback & filter */
+  sstPhysics.pfnContactCallback   = _pfnCallback;
+  sstPhysics.pContactContext      = _pContext;
+  sstPhysics.u16ContactSelfFlags  = _u16SelfFlags;
+  sstPhysics.u16ContactCheckMask  = _u16CheckMask;
+
+  /* Done! */
+  return eResult;
+}
+
 extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetGravity(const orxVECTOR *_pvGravity)
 {
   b2Vec2    vGravity;
@@ -3311,6 +4424,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetGravity(const orxVECTOR
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvGravity != orxNULL);
 
+  /* Waits for pending step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Sets gravity vector */
   vGravity.Set(sstPhysics.fDimensionRatio * _pvGravity->fX, sstPhysics.fDimensionRatio * _pvGravity->fY);
 
@@ -3389,6 +4505,13 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Init()
       }
     }
 
+    /* Threaded? */
+    if(orxConfig_GetBool(orxPHYSICS_KZ_CONFIG_THREADED) != orxFALSE)
+    {
+      /* Updates status */
+      orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_THREADED, orxPHYSICS_KU32_STATIC_FLAG_NONE);
+    }
+
     /* Gets dimension ratio */
     fRatio = orxConfig_GetFloat(orxPHYSICS_KZ_CONFIG_RATIO);
 
@@ -3561,15 +4684,45 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_Exit()
   /* Was initialized? */
   if(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY)
   {
+    orxU32 i;
+
     /* Unregisters update */
     orxClock_Unregister(orxClock_Get(orxCLOCK_KZ_CORE), orxPhysics_LiquidFun_Update);
 
+    /* Waits for pending step */
+    orxPhysics_LiquidFun_WaitStep();
+
+    /* Has apply list? */
+    if(sstPhysics.apstApplyList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstPhysics.apstApplyList);
+    }
+
     /* Deletes body bank */
     orxBank_Delete(sstPhysics.pstBodyBank);
 
     /* Deletes event bank */
     orxBank_Delete(sstPhysics.pstEventBank);
 
+    /* For both contact buffers */
+    for(i = 0; i < 2; i++)
+    {
+      /* Has contact list? */
+      if(sstPhysics.astContactBuffer[i].astContactList != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstPhysics.astContactBuffer[i].astContactList);
+      }
+
+      /* Has body list? */
+      if(sstPhysics.astContactBuffer[i].apoBodyList != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstPhysics.astContactBuffer[i].apoBodyList);
+      }
+    }
+
     /* Deletes the listeners */
     delete sstPhysics.poContactListener;
 
@@ -3657,6 +4810,9 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_GetJointReactionTorque, PH
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_Raycast, PHYSICS, RAYCAST);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_BoxPick, PHYSICS, BOX_PICK);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_EnableSimulation, PHYSICS, ENABLE_SIMULATION);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_SetContactCallback, PHYSICS, SET_CONTACT_CALLBACK);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_RaycastBatch, PHYSICS, RAYCAST_BATCH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxPhysics_LiquidFun_BoxPickBatch, PHYSICS, BOX_PICK_BATCH);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
 
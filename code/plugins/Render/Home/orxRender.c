@@ -61,7 +61,12 @@
 
 /** Defines
  */
-#define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_NODE_LIST_SIZE               1024
+#define orxRENDER_KU32_SORT_DIGIT_NUMBER            8
+#define orxRENDER_KU32_SORT_DIGIT_SIZE              256
+#define orxRENDER_KU32_SORT_DIGIT_MASK              0xFF
+#define orxRENDER_KU32_SORT_BLEND_MODE_NUMBER       (orxDISPLAY_BLEND_MODE_NUMBER + 1)
+#define orxRENDER_KU32_SORT_SMOOTHING_NUMBER        (orxDISPLAY_SMOOTHING_NUMBER + 1)
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %u"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -118,33 +123,47 @@
 
 typedef struct __orxRENDER_RENDER_NODE_t
 {
-  orxLINKLIST_NODE      stNode;                     /**< Linklist node : 12 */
-  orxTEXTURE           *pstTexture;                 /**< Texture pointer : 16 */
-  const orxSHADER      *pstShader;                  /**< Shader pointer : 20 */
-  orxOBJECT            *pstObject;                  /**< Object pointer : 24 */
-  orxFLOAT              fZ;                         /**< Z coordinate : 28 */
-  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode : 32 */
-  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 36 */
-  orxFLOAT              fDepthCoef;                 /**< Depth coef : 40 */
+  orxTEXTURE           *pstTexture;                 /**< Texture pointer : 4 */
+  const orxSHADER      *pstShader;                  /**< Shader pointer : 8 */
+  orxOBJECT            *pstObject;                  /**< Object pointer : 12 */
+  orxFLOAT              fZ;                         /**< Z coordinate : 16 */
+  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode : 20 */
+  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 24 */
+  orxFLOAT              fDepthCoef;                 /**< Depth coef : 28 */
+  orxU32                u32TextureRank;             /**< Texture rank : 32 */
+  orxU32                u32ShaderRank;              /**< Shader rank : 36 */
 
 } orxRENDER_NODE;
 
+/** Sort entry
+ */
+typedef struct __orxRENDER_SORT_ENTRY_t
+{
+  orxU64                u64Key;                     /**< Sort key : 8 */
+  orxU32                u32Index;                   /**< Node index : 12 */
+
+} orxRENDER_SORT_ENTRY;
+
 /** Static structure
  */
 typedef struct __orxRENDER_STATIC_t
 {
-  orxU32        u32Flags;                           /**< Control flags */
-  orxCLOCK     *pstClock;                           /**< Rendering clock pointer */
-  orxFRAME     *pstFrame;                           /**< Conversion frame */
-  orxBANK      *pstRenderBank;                      /**< Rendering bank */
-  orxLINKLIST   stRenderList;                       /**< Rendering list */
-  orxFLOAT      fDefaultConsoleOffset;              /**< Default console offset */
-  orxFLOAT      fConsoleOffset;                     /**< Console offset */
-  orxFLOAT      fConsoleFontScale;                  /**< Console font scale */
-  orxU32        u32SelectedFrame;                   /**< Selected frame */
-  orxU32        u32SelectedThread;                  /**< Selected thread */
-  orxU32        u32SelectedMarkerDepth;             /**< Selected marker depth */
-  orxU32        u32MaxMarkerDepth;                  /**< Maximum marker depth */
+  orxU32                u32Flags;                   /**< Control flags */
+  orxCLOCK             *pstClock;                   /**< Rendering clock pointer */
+  orxFRAME             *pstFrame;                   /**< Conversion frame */
+  orxRENDER_NODE       *astNodeList;                /**< Render node list */
+  orxRENDER_SORT_ENTRY *astSortList;                /**< Sort list */
+  orxRENDER_SORT_ENTRY *astSortBuffer;              /**< Sort buffer */
+  orxOBJECT_BOX_QUERY   stBoxQuery;                 /**< Culling box query */
+  orxU32                u32NodeCount;               /**< Render node count */
+  orxU32                u32NodeSize;                /**< Render node list size */
+  orxFLOAT              fDefaultConsoleOffset;      /**< Default console offset */
+  orxFLOAT              fConsoleOffset;             /**< Console offset */
+  orxFLOAT              fConsoleFontScale;          /**< Console font scale */
+  orxU32                u32SelectedFrame;           /**< Selected frame */
+  orxU32                u32SelectedThread;          /**< Selected thread */
+  orxU32                u32SelectedMarkerDepth;     /**< Selected marker depth */
+  orxU32                u32MaxMarkerDepth;          /**< Maximum marker depth */
 
 } orxRENDER_STATIC;
 
@@ -422,7 +441,7 @@ static orxINLINE void orxRender_Home_RenderProfiler()
   pstMap = orxFont_GetMap(pstFont);
 
   /* Gets its marker width */
-  fMarkerWidth = ((orxCHARACTER_GLYPH *)orxHashTable_Get(pstMap->pstCharacterTable, orxRENDER_KC_PROFILER_DEPTH_MARKER))->fWidth;
+  fMarkerWidth = orxCharacterMap_GetGlyph(pstMap, orxRENDER_KC_PROFILER_DEPTH_MARKER)->fWidth;
 
   /* Creates pixel texture */
   pstTexture = orxTexture_Get(orxTEXTURE_KZ_PIXEL);
@@ -1458,6 +1477,271 @@ static orxINLINE void orxRender_Home_RenderConsole()
   return;
 }
 
+/** Resizes render node list
+ * @param[in]   _u32Size        New size
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_ResizeNodeList(orxU32 _u32Size)
+{
+  orxRENDER_NODE       *astNodeList;
+  orxRENDER_SORT_ENTRY *astSortList, *astSortBuffer;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Reallocates all lists */
+  if((astNodeList = (orxRENDER_NODE *)orxMemory_Reallocate(sstRender.astNodeList, _u32Size * sizeof(orxRENDER_NODE), orxMEMORY_TYPE_MAIN)) != orxNULL)
+  {
+    /* Stores it */
+    sstRender.astNodeList = astNodeList;
+
+    if((astSortList = (orxRENDER_SORT_ENTRY *)orxMemory_Reallocate(sstRender.astSortList, _u32Size * sizeof(orxRENDER_SORT_ENTRY), orxMEMORY_TYPE_MAIN)) != orxNULL)
+    {
+      /* Stores it */
+      sstRender.astSortList = astSortList;
+
+      if((astSortBuffer = (orxRENDER_SORT_ENTRY *)orxMemory_Reallocate(sstRender.astSortBuffer, _u32Size * sizeof(orxRENDER_SORT_ENTRY), orxMEMORY_TYPE_MAIN)) != orxNULL)
+      {
+        /* Stores it */
+        sstRender.astSortBuffer = astSortBuffer;
+
+        /* Updates size */
+        sstRender.u32NodeSize   = _u32Size;
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Deletes render node list
+ */
+static void orxFASTCALL orxRender_Home_DeleteNodeList()
+{
+  /* Frees all lists */
+  if(sstRender.astNodeList != orxNULL)
+  {
+    orxMemory_Free(sstRender.astNodeList);
+    sstRender.astNodeList = orxNULL;
+  }
+  if(sstRender.astSortList != orxNULL)
+  {
+    orxMemory_Free(sstRender.astSortList);
+    sstRender.astSortList = orxNULL;
+  }
+  if(sstRender.astSortBuffer != orxNULL)
+  {
+    orxMemory_Free(sstRender.astSortBuffer);
+    sstRender.astSortBuffer = orxNULL;
+  }
+
+  /* Clears counters */
+  sstRender.u32NodeCount  = 0;
+  sstRender.u32NodeSize   = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Gets a sortable key from a Z coordinate
+ * @param[in]   _fZ             Z coordinate
+ * @return      Key that preserves Z ordering when compared as an unsigned integer
+ */
+static orxINLINE orxU32 orxRender_Home_GetZKey(orxFLOAT _fZ)
+{
+  union
+  {
+    orxFLOAT  fValue;
+    orxU32    u32Value;
+  } stValue;
+  orxU32 u32Result;
+
+  /* Gets value, merging both zeros */
+  stValue.fValue = (_fZ != orxFLOAT_0) ? _fZ : orxFLOAT_0;
+
+  /* Flips all bits for negative values, only the sign bit for positive ones */
+  u32Result = (stValue.u32Value & 0x80000000) ? ~stValue.u32Value : stValue.u32Value | 0x80000000;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sorts entries by ascending keys (stable LSD radix sort)
+ * @param[in]   _astList        List to sort
+ * @param[in]   _astBuffer      Buffer of the same size, used as scratch memory
+ * @param[in]   _u32Count       Number of entries
+ * @return      Sorted list (either _astList or _astBuffer)
+ */
+static orxRENDER_SORT_ENTRY *orxFASTCALL orxRender_Home_RadixSort(orxRENDER_SORT_ENTRY *_astList, orxRENDER_SORT_ENTRY *_astBuffer, orxU32 _u32Count)
+{
+  orxU32                au32Histogram[orxRENDER_KU32_SORT_DIGIT_NUMBER][orxRENDER_KU32_SORT_DIGIT_SIZE];
+  orxRENDER_SORT_ENTRY *astSrc, *astDst;
+  orxU32                i, j;
+
+  /* Clears histograms */
+  orxMemory_Zero(au32Histogram, sizeof(au32Histogram));
+
+  /* For all entries */
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxU64 u64Key;
+
+    /* Updates all digit histograms at once */
+    for(j = 0, u64Key = _astList[i].u64Key; j < orxRENDER_KU32_SORT_DIGIT_NUMBER; j++, u64Key >>= 8)
+    {
+      au32Histogram[j][u64Key & orxRENDER_KU32_SORT_DIGIT_MASK]++;
+    }
+  }
+
+  /* For all digits */
+  for(j = 0, astSrc = _astList, astDst = _astBuffer; j < orxRENDER_KU32_SORT_DIGIT_NUMBER; j++)
+  {
+    orxU32 *au32Offset, u32Offset, u32Shift;
+
+    /* Gets digit's histogram and shift */
+    au32Offset  = au32Histogram[j];
+    u32Shift    = j << 3;
+
+    /* Not all entries sharing this digit? */
+    if(au32Offset[(orxU32)(astSrc[0].u64Key >> u32Shift) & orxRENDER_KU32_SORT_DIGIT_MASK] != _u32Count)
+    {
+      orxRENDER_SORT_ENTRY *astSwap;
+
+      /* Converts histogram to offsets */
+      for(i = 0, u32Offset = 0; i < orxRENDER_KU32_SORT_DIGIT_SIZE; i++)
+      {
+        orxU32 u32Count;
+
+        u32Count      = au32Offset[i];
+        au32Offset[i] = u32Offset;
+        u32Offset    += u32Count;
+      }
+
+      /* Scatters entries */
+      for(i = 0; i < _u32Count; i++)
+      {
+        astDst[au32Offset[(orxU32)(astSrc[i].u64Key >> u32Shift) & orxRENDER_KU32_SORT_DIGIT_MASK]++] = astSrc[i];
+      }
+
+      /* Swaps lists */
+      astSwap = astSrc;
+      astSrc  = astDst;
+      astDst  = astSwap;
+    }
+  }
+
+  /* Done! */
+  return astSrc;
+}
+
+/** Sorts render nodes
+ * @return      Sorted entry list, in ascending order
+ */
+static orxRENDER_SORT_ENTRY *orxFASTCALL orxRender_Home_SortNodes()
+{
+  orxRENDER_SORT_ENTRY *astResult;
+  orxU64                u64StateNumber;
+  orxU32                u32TextureNumber, u32ShaderNumber, i;
+  orxUPTR               uPrevious;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_SortNodes");
+
+  /* Checks */
+  orxASSERT(sstRender.u32NodeCount > 0);
+
+  /* Ranks textures by address */
+  for(i = 0; i < sstRender.u32NodeCount; i++)
+  {
+    sstRender.astSortList[i].u64Key   = (orxU64)(orxUPTR)sstRender.astNodeList[i].pstTexture;
+    sstRender.astSortList[i].u32Index = i;
+  }
+  astResult = orxRender_Home_RadixSort(sstRender.astSortList, sstRender.astSortBuffer, sstRender.u32NodeCount);
+  for(i = 0, u32TextureNumber = 0, uPrevious = (orxUPTR)astResult[0].u64Key; i < sstRender.u32NodeCount; i++)
+  {
+    /* New texture? */
+    if((orxUPTR)astResult[i].u64Key != uPrevious)
+    {
+      /* Updates rank */
+      u32TextureNumber++;
+      uPrevious = (orxUPTR)astResult[i].u64Key;
+    }
+    sstRender.astNodeList[astResult[i].u32Index].u32TextureRank = u32TextureNumber;
+  }
+  u32TextureNumber++;
+
+  /* Ranks shaders by address */
+  for(i = 0; i < sstRender.u32NodeCount; i++)
+  {
+    sstRender.astSortList[i].u64Key   = (orxU64)(orxUPTR)sstRender.astNodeList[i].pstShader;
+    sstRender.astSortList[i].u32Index = i;
+  }
+  astResult = orxRender_Home_RadixSort(sstRender.astSortList, sstRender.astSortBuffer, sstRender.u32NodeCount);
+  for(i = 0, u32ShaderNumber = 0, uPrevious = (orxUPTR)astResult[0].u64Key; i < sstRender.u32NodeCount; i++)
+  {
+    /* New shader? */
+    if((orxUPTR)astResult[i].u64Key != uPrevious)
+    {
+      /* Updates rank */
+      u32ShaderNumber++;
+      uPrevious = (orxUPTR)astResult[i].u64Key;
+    }
+    sstRender.astNodeList[astResult[i].u32Index].u32ShaderRank = u32ShaderNumber;
+  }
+  u32ShaderNumber++;
+
+  /* Gets number of distinct render states */
+  u64StateNumber = (orxU64)u32TextureNumber * (orxU64)u32ShaderNumber * (orxU64)(orxRENDER_KU32_SORT_BLEND_MODE_NUMBER * orxRENDER_KU32_SORT_SMOOTHING_NUMBER);
+
+  /* For all nodes */
+  for(i = 0; i < sstRender.u32NodeCount; i++)
+  {
+    const orxRENDER_NODE *pstNode;
+    orxU64                u64State;
+
+    /* Gets it */
+    pstNode = &(sstRender.astNodeList[i]);
+
+    /* Gets its render state (texture, shader, blend mode, smoothing), none values being sorted last */
+    u64State  = ((orxU64)pstNode->u32TextureRank * (orxU64)u32ShaderNumber) + (orxU64)pstNode->u32ShaderRank;
+    u64State  = (u64State * (orxU64)orxRENDER_KU32_SORT_BLEND_MODE_NUMBER) + (orxU64)orxMIN((orxU32)pstNode->eBlendMode, (orxU32)orxDISPLAY_BLEND_MODE_NUMBER);
+    u64State  = (u64State * (orxU64)orxRENDER_KU32_SORT_SMOOTHING_NUMBER) + (orxU64)orxMIN((orxU32)pstNode->eSmoothing, (orxU32)orxDISPLAY_SMOOTHING_NUMBER);
+
+    /* Can pack Z & state in a single key? */
+    if(u64StateNumber <= (orxU64)0x100000000ULL)
+    {
+      sstRender.astSortList[i].u64Key = ((orxU64)orxRender_Home_GetZKey(pstNode->fZ) << 32) | u64State;
+    }
+    else
+    {
+      sstRender.astSortList[i].u64Key = u64State;
+    }
+    sstRender.astSortList[i].u32Index = i;
+  }
+
+  /* Sorts nodes */
+  astResult = orxRender_Home_RadixSort(sstRender.astSortList, sstRender.astSortBuffer, sstRender.u32NodeCount);
+
+  /* Couldn't pack keys? */
+  if(u64StateNumber > (orxU64)0x100000000ULL)
+  {
+    /* Sorts them again, by Z only (stable sort, state order is kept among equal Z) */
+    for(i = 0; i < sstRender.u32NodeCount; i++)
+    {
+      astResult[i].u64Key = (orxU64)orxRender_Home_GetZKey(sstRender.astNodeList[astResult[i].u32Index].fZ);
+    }
+    astResult = orxRender_Home_RadixSort(astResult, (astResult == sstRender.astSortList) ? sstRender.astSortBuffer : sstRender.astSortList, sstRender.u32NodeCount);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return astResult;
+}
+
 /** Renders a viewport
  * @param[in]   _pstRenderNode    Render node
  * @param[in]   _pstTransform     Rendering transform
@@ -1622,8 +1906,23 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
         }
         else
         {
-          /* Transforms text */
-          eResult = orxDisplay_TransformText(orxText_GetString(pstText), pstBitmap, orxFont_GetMap(pstFont), stPayload.stObject.pstTransform, orxColor_ToRGBA(&stColor), _pstRenderNode->eSmoothing, _pstRenderNode->eBlendMode);
+          const orxCHARACTER_QUAD  *astQuadList;
+          orxU32                    u32QuadCount;
+
+          /* Gets text's cached character quads */
+          astQuadList = orxText_GetCharacterList(pstText, &u32QuadCount);
+
+          /* Valid? */
+          if(astQuadList != orxNULL)
+          {
+            /* Transforms them */
+            eResult = orxDisplay_TransformCharacterList(astQuadList, u32QuadCount, pstBitmap, orxFont_GetMap(pstFont), stPayload.stObject.pstTransform, orxColor_ToRGBA(&stColor), _pstRenderNode->eSmoothing, _pstRenderNode->eBlendMode);
+          }
+          else
+          {
+            /* Transforms text */
+            eResult = orxDisplay_TransformText(orxText_GetString(pstText), pstBitmap, orxFont_GetMap(pstFont), stPayload.stObject.pstTransform, orxColor_ToRGBA(&stColor), _pstRenderNode->eSmoothing, _pstRenderNode->eBlendMode);
+          }
         }
 
         /* Has shader pointer? */
@@ -1822,12 +2121,14 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             if((fCameraWidth > orxFLOAT_0)
             && (fCameraHeight > orxFLOAT_0))
             {
-              orxU32          u32Number;
-              orxOBJECT      *pstObject;
-              orxFRAME       *pstCameraFrame;
-              orxRENDER_NODE *pstRenderNode;
-              orxVECTOR       vCameraScale, vCameraCenter, vCameraPosition;
-              orxFLOAT        fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
+              orxU32                u32Number, j;
+              orxOBJECT            *pstObject;
+              orxFRAME             *pstCameraFrame;
+              orxRENDER_NODE       *pstRenderNode;
+              orxRENDER_SORT_ENTRY *astSortList;
+              orxVECTOR             vCameraScale, vCameraCenter, vCameraPosition;
+              orxAABOX              stCullingBox;
+              orxFLOAT              fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius, fCullingCellSize;
 
               /* Gets camera frame */
               pstCameraFrame = orxCamera_GetFrame(pstCamera);
@@ -1862,6 +2163,13 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
               /* Gets camera rotation */
               fRenderRotation = orxFrame_GetRotation(pstCameraFrame, orxFRAME_SPACE_GLOBAL);
 
+              /* Gets camera culling box */
+              orxVector_Set(&(stCullingBox.vTL), vCameraCenter.fX - fCameraBoundingRadius, vCameraCenter.fY - fCameraBoundingRadius, stFrustum.vTL.fZ);
+              orxVector_Set(&(stCullingBox.vBR), vCameraCenter.fX + fCameraBoundingRadius, vCameraCenter.fY + fCameraBoundingRadius, stFrustum.vBR.fZ);
+
+              /* Gets camera culling cell size */
+              fCullingCellSize = orxCamera_GetCullingCellSize(pstCamera);
+
               /* For all camera group IDs */
               for(i = 0, u32Number = orxCamera_GetGroupIDCount(pstCamera); i < u32Number; i++)
               {
@@ -1874,10 +2182,18 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                 /* Gets its sorting status */
                 bSorting = orxCamera_IsGroupIDSortingEnabled(pstCamera, i);
 
-                /* For all objects in this group */
-                for(pstObject = orxObject_GetNextEnabled(orxNULL, stGroupID);
+                /* Uses grid culling and group doesn't have a grid yet? */
+                if((fCullingCellSize > orxFLOAT_0)
+                && (orxObject_GetGroupIDCellSize(stGroupID) == orxFLOAT_0))
+                {
+                  /* Creates it */
+                  orxObject_SetGroupIDCellSize(stGroupID, fCullingCellSize);
+                }
+
+                /* For all objects in this group that might be seen by the camera */
+                for(pstObject = orxObject_GetNextEnabledInBox(orxNULL, stGroupID, &stCullingBox, &(sstRender.stBoxQuery));
                     pstObject != orxNULL;
-                    pstObject = orxObject_GetNextEnabled(pstObject, stGroupID))
+                    pstObject = orxObject_GetNextEnabledInBox(pstObject, stGroupID, &stCullingBox, &(sstRender.stBoxQuery)))
                 {
                   /* Is object enabled? */
                   if(orxObject_IsEnabled(pstObject) != orxFALSE)
@@ -2064,62 +2380,30 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                               eBlendMode = orxDISPLAY_BLEND_MODE_ALPHA;
                             }
 
-                            /* Creates a render node */
-                            pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
-
-                            /* Cleans its internal node */
-                            orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
-                            /* Stores object */
-                            pstRenderNode->pstObject  = pstObject;
-                            pstRenderNode->pstTexture = pstTexture;
-                            pstRenderNode->pstShader  = pstShader;
-                            pstRenderNode->eSmoothing = eSmoothing;
-                            pstRenderNode->eBlendMode = eBlendMode;
+                            /* Is there room left in render node list or can it be expanded? */
+                            if((sstRender.u32NodeCount < sstRender.u32NodeSize)
+                            || (orxRender_Home_ResizeNodeList(sstRender.u32NodeSize << 1) != orxSTATUS_FAILURE))
+                            {
+                              /* Gets a new render node */
+                              pstRenderNode = &(sstRender.astNodeList[sstRender.u32NodeCount++]);
 
-                            /* Stores its Z coordinate */
-                            pstRenderNode->fZ = vObjectPos.fZ;
+                              /* Stores object */
+                              pstRenderNode->pstObject  = pstObject;
+                              pstRenderNode->pstTexture = pstTexture;
+                              pstRenderNode->pstShader  = pstShader;
+                              pstRenderNode->eSmoothing = eSmoothing;
+                              pstRenderNode->eBlendMode = eBlendMode;
 
-                            /* Stores its depth coef */
-                            pstRenderNode->fDepthCoef = fDepthCoef;
+                              /* Stores its Z coordinate */
+                              pstRenderNode->fZ = vObjectPos.fZ;
 
-                            /* No sorting or empty list? */
-                            if((bSorting == orxFALSE)
-                            || (orxLinkList_GetCount(&(sstRender.stRenderList)) == 0))
-                            {
-                              /* Adds node at beginning */
-                              orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
+                              /* Stores its depth coef */
+                              pstRenderNode->fDepthCoef = fDepthCoef;
                             }
                             else
                             {
-                              orxRENDER_NODE *pstNode;
-
-                              /* Finds correct node position */
-                              for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                  (pstNode != orxNULL)
-                               && ((vObjectPos.fZ < pstNode->fZ)
-                                || ((vObjectPos.fZ == pstNode->fZ)
-                                 && ((pstTexture < pstNode->pstTexture)
-                                  || ((pstTexture == pstNode->pstTexture)
-                                   && ((pstShader < pstNode->pstShader)
-                                    || ((pstShader == pstNode->pstShader)
-                                     && ((eBlendMode < pstNode->eBlendMode)
-                                      || ((eBlendMode == pstNode->eBlendMode)
-                                       && (eSmoothing < pstNode->eSmoothing)))))))));
-                                  pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)))
-                                ;
-
-                              /* End of list reached? */
-                              if(pstNode == orxNULL)
-                              {
-                                /* Adds it at end */
-                                orxLinkList_AddEnd(&(sstRender.stRenderList), &(pstRenderNode->stNode));
-                              }
-                              else
-                              {
-                                /* Adds it before found node */
-                                orxLinkList_AddBefore(&(pstNode->stNode), &(pstRenderNode->stNode));
-                              }
+                              /* Logs message */
+                              orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxOBJECT %p / %s] couldn't be added to render list: out of memory.", pstObject, orxObject_GetName(pstObject));
                             }
                           }
                         }
@@ -2128,16 +2412,29 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                    pstRenderNode != orxNULL;
-                    pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                /* Sorting and has more than one node? */
+                if((bSorting != orxFALSE) && (sstRender.u32NodeCount > 1))
+                {
+                  /* Sorts nodes */
+                  astSortList = orxRender_Home_SortNodes();
+                }
+                else
+                {
+                  /* No sorting */
+                  astSortList = orxNULL;
+                }
+
+                /* For all render nodes, back to front (descending sort order, last added first) */
+                for(j = sstRender.u32NodeCount; j > 0; j--)
                 {
                   orxFRAME             *pstFrame;
                   orxVECTOR             vObjectPos, vRenderPos, vObjectScale;
                   orxFLOAT              fObjectRotation, fObjectScaleX, fObjectScaleY, fRepeatX, fRepeatY;
                   orxDISPLAY_TRANSFORM  stTransform;
 
+                  /* Gets render node */
+                  pstRenderNode = &(sstRender.astNodeList[(astSortList != orxNULL) ? astSortList[j - 1].u32Index : j - 1]);
+
                   /* Gets object */
                   pstObject = pstRenderNode->pstObject;
 
@@ -2232,11 +2529,8 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* Cleans rendering bank */
-                orxBank_Clear(sstRender.pstRenderBank);
-
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
+                /* Clears render nodes */
+                sstRender.u32NodeCount = 0;
               }
             }
             else
@@ -2333,6 +2627,9 @@ static void orxFASTCALL orxRender_Home_RenderAll(const orxCLOCK_INFO *_pstClockI
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxRender_RenderAll");
 
+    /* Updates all dirty frames (lazy update) */
+    orxFrame_UpdateAll();
+
     /* For all viewports */
     for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
         pstViewport != orxNULL;
@@ -2980,11 +3277,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstRender, sizeof(orxRENDER_STATIC));
 
-    /* Creates rendering bank */
-    sstRender.pstRenderBank = orxBank_Create(orxRENDER_KU32_ORDER_BANK_SIZE, sizeof(orxRENDER_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-
-    /* Valid? */
-    if(sstRender.pstRenderBank != orxNULL)
+    /* Creates render node list */
+    if(orxRender_Home_ResizeNodeList(orxRENDER_KU32_NODE_LIST_SIZE) != orxSTATUS_FAILURE)
     {
       /* Gets core clock */
       sstRender.pstClock = orxClock_Get(orxCLOCK_KZ_CORE);
@@ -3071,14 +3365,14 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
             /* Deletes frame */
             orxFrame_Delete(sstRender.pstFrame);
 
-            /* Deletes bank */
-            orxBank_Delete(sstRender.pstRenderBank);
+            /* Deletes render node list */
+            orxRender_Home_DeleteNodeList();
           }
         }
         else
         {
-          /* Deletes bank */
-          orxBank_Delete(sstRender.pstRenderBank);
+          /* Deletes render node list */
+          orxRender_Home_DeleteNodeList();
 
           /* Updates result */
           eResult = orxSTATUS_FAILURE;
@@ -3086,8 +3380,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
       }
       else
       {
-        /* Deletes bank */
-        orxBank_Delete(sstRender.pstRenderBank);
+        /* Deletes render node list */
+        orxRender_Home_DeleteNodeList();
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -3095,6 +3389,9 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     }
     else
     {
+      /* Deletes render node list */
+      orxRender_Home_DeleteNodeList();
+
       /* Updates result */
       eResult = orxSTATUS_FAILURE;
     }
@@ -3137,8 +3434,11 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes conversion frame */
     orxFrame_Delete(sstRender.pstFrame);
 
-    /* Deletes rendering bank */
-    orxBank_Delete(sstRender.pstRenderBank);
+    /* Deletes render node list */
+    orxRender_Home_DeleteNodeList();
+
+    /* Clears culling box query */
+    orxObject_ClearBoxQuery(&(sstRender.stBoxQuery));
 
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
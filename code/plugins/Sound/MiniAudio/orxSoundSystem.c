@@ -310,6 +310,17 @@ typedef struct __orxSOUNDSYSTEM_TASK_PARAM_t
 
 } orxSOUNDSYSTEM_TASK_PARAM;
 
+/** Internal VFS file structure
+ */
+typedef struct __orxSOUNDSYSTEM_VFS_FILE_t
+{
+  orxHANDLE                 hResource;
+  const orxU8              *pu8Map;
+  orxS64                    s64Size;
+  orxS64                    s64Cursor;
+
+} orxSOUNDSYSTEM_VFS_FILE;
+
 /** Static structure
  */
 typedef struct __orxSOUNDSYSTEM_STATIC_t
@@ -1302,6 +1313,8 @@ static ma_result orxSoundSystem_MiniAudio_InitVorbis(ma_read_proc _pfnRead, ma_s
     /* Success? */
     if(hResult == MA_SUCCESS)
     {
+      orxSOUNDSYSTEM_VFS_FILE *pstFile;
+
       /* Inits callbacks */
       _pstVorbis->onRead                = _pfnRead;
       _pstVorbis->onSeek                = _pfnSeek;
@@ -1309,8 +1322,13 @@ static ma_result orxSoundSystem_MiniAudio_InitVorbis(ma_read_proc _pfnRead, ma_s
       _pstVorbis->pReadSeekTellUserData = _pReadSeekTellUserData;
       ma_allocation_callbacks_init_copy(&(_pstVorbis->allocationCallbacks), _pstAllocationCallbacks);
 
-      /* Inits vorbis decoder */
-      _pstVorbis->stb = stb_vorbis_open_file(((ma_decoder*)_pReadSeekTellUserData)->data.vfs.file, FALSE, NULL, NULL);
+      /* Gets VFS file */
+      pstFile = (orxSOUNDSYSTEM_VFS_FILE *)((ma_decoder *)_pReadSeekTellUserData)->data.vfs.file;
+
+      /* Inits vorbis decoder, directly from the mapping if any (it stays valid until the VFS file is closed) */
+      _pstVorbis->stb = ((pstFile->pu8Map != orxNULL) && (pstFile->s64Size <= (orxS64)0x7FFFFFFF))
+                        ? stb_vorbis_open_memory(pstFile->pu8Map, (int)pstFile->s64Size, NULL, NULL)
+                        : stb_vorbis_open_file(pstFile->hResource, FALSE, NULL, NULL);
 
       /* Success? */
       if(_pstVorbis->stb != NULL)
@@ -1466,11 +1484,35 @@ static ma_result orxSoundSystem_MiniAudio_Open(ma_vfs *_pstVFS, const char *_zFi
     /* Success? */
     if(hResource != orxHANDLE_UNDEFINED)
     {
-      /* Stores file */
-      *_pstFile = (ma_vfs_file)hResource;
+      orxSOUNDSYSTEM_VFS_FILE *pstFile;
 
-      /* Updates result */
-      hResult = MA_SUCCESS;
+      /* Allocates file */
+      pstFile = (orxSOUNDSYSTEM_VFS_FILE *)orxMemory_Allocate(sizeof(orxSOUNDSYSTEM_VFS_FILE), orxMEMORY_TYPE_AUDIO);
+
+      /* Success? */
+      if(pstFile != orxNULL)
+      {
+        /* Inits it */
+        pstFile->hResource  = hResource;
+        pstFile->s64Cursor  = 0;
+
+        /* Maps content when only reading (reads are then copied from it, vorbis decodes it in place) */
+        pstFile->pu8Map     = ((_u32OpenMode & MA_OPEN_MODE_WRITE) == 0) ? (const orxU8 *)orxResource_Map(hResource, &(pstFile->s64Size)) : orxNULL;
+
+        /* Stores file */
+        *_pstFile = (ma_vfs_file)pstFile;
+
+        /* Updates result */
+        hResult = MA_SUCCESS;
+      }
+      else
+      {
+        /* Closes resource */
+        orxResource_Close(hResource);
+
+        /* Updates result */
+        hResult = MA_OUT_OF_MEMORY;
+      }
     }
     else
     {
@@ -1484,8 +1526,16 @@ static ma_result orxSoundSystem_MiniAudio_Open(ma_vfs *_pstVFS, const char *_zFi
 
 static ma_result orxSoundSystem_MiniAudio_Close(ma_vfs *_pstVFS, ma_vfs_file _stFile)
 {
-  /* Closes resource */
-  orxResource_Close((orxHANDLE)_stFile);
+  orxSOUNDSYSTEM_VFS_FILE *pstFile;
+
+  /* Gets file */
+  pstFile = (orxSOUNDSYSTEM_VFS_FILE *)_stFile;
+
+  /* Closes resource (releases its mapping) */
+  orxResource_Close(pstFile->hResource);
+
+  /* Frees file */
+  orxMemory_Free(pstFile);
 
   /* Done! */
   return MA_SUCCESS;
@@ -1493,8 +1543,28 @@ static ma_result orxSoundSystem_MiniAudio_Close(ma_vfs *_pstVFS, ma_vfs_file _st
 
 static ma_result orxSoundSystem_MiniAudio_Read(ma_vfs *_pstVFS, ma_vfs_file _stFile, void *_pDst, size_t _sSizeInBytes, size_t *_psBytesRead)
 {
-  /* Reads data */
-  *_psBytesRead = (size_t)orxResource_Read((orxHANDLE)_stFile, (orxS64)_sSizeInBytes, _pDst, orxNULL, orxNULL);
+  orxSOUNDSYSTEM_VFS_FILE *pstFile;
+
+  /* Gets file */
+  pstFile = (orxSOUNDSYSTEM_VFS_FILE *)_stFile;
+
+  /* Mapped? */
+  if(pstFile->pu8Map != orxNULL)
+  {
+    /* Gets available size */
+    *_psBytesRead = (size_t)orxMIN((orxS64)_sSizeInBytes, orxMAX(pstFile->s64Size - pstFile->s64Cursor, 0));
+
+    /* Copies data */
+    orxMemory_Copy(_pDst, pstFile->pu8Map + pstFile->s64Cursor, (orxU32)*_psBytesRead);
+
+    /* Updates cursor */
+    pstFile->s64Cursor += (orxS64)*_psBytesRead;
+  }
+  else
+  {
+    /* Reads data */
+    *_psBytesRead = (size_t)orxResource_Read(pstFile->hResource, (orxS64)_sSizeInBytes, _pDst, orxNULL, orxNULL);
+  }
 
   /* Done! */
   return (*_psBytesRead == 0) ? MA_AT_END : MA_SUCCESS;
@@ -1503,7 +1573,7 @@ static ma_result orxSoundSystem_MiniAudio_Read(ma_vfs *_pstVFS, ma_vfs_file _stF
 static ma_result orxSoundSystem_MiniAudio_Write(ma_vfs *_pstVFS, ma_vfs_file _stFile, const void *_pSrc, size_t _sSizeInBytes, size_t *_psBytesWritten)
 {
   /* Writes data */
-  *_psBytesWritten = (size_t)orxResource_Write((orxHANDLE)_stFile, _sSizeInBytes, _pSrc, orxNULL, orxNULL);
+  *_psBytesWritten = (size_t)orxResource_Write(((orxSOUNDSYSTEM_VFS_FILE *)_stFile)->hResource, _sSizeInBytes, _pSrc, orxNULL, orxNULL);
 
   /* Done! */
   return (*_psBytesWritten != _sSizeInBytes) ? MA_ACCESS_DENIED : MA_SUCCESS;
@@ -1511,10 +1581,40 @@ static ma_result orxSoundSystem_MiniAudio_Write(ma_vfs *_pstVFS, ma_vfs_file _st
 
 static ma_result orxSoundSystem_MiniAudio_Seek(ma_vfs *_pstVFS, ma_vfs_file _stFile, ma_int64 _s64Offset, ma_seek_origin _eOrigin)
 {
-  ma_result hResult;
+  orxSOUNDSYSTEM_VFS_FILE  *pstFile;
+  ma_result                 hResult;
 
-  /* Seeks */
-  hResult = (orxResource_Seek((orxHANDLE)_stFile, _s64Offset, (orxSEEK_OFFSET_WHENCE)_eOrigin) >= 0) ? MA_SUCCESS : MA_ERROR;
+  /* Gets file */
+  pstFile = (orxSOUNDSYSTEM_VFS_FILE *)_stFile;
+
+  /* Mapped? */
+  if(pstFile->pu8Map != orxNULL)
+  {
+    orxS64 s64Cursor;
+
+    /* Gets new cursor */
+    s64Cursor = _s64Offset + ((_eOrigin == ma_seek_origin_current) ? pstFile->s64Cursor : (_eOrigin == ma_seek_origin_end) ? pstFile->s64Size : 0);
+
+    /* Valid? */
+    if((s64Cursor >= 0) && (s64Cursor <= pstFile->s64Size))
+    {
+      /* Updates cursor */
+      pstFile->s64Cursor = s64Cursor;
+
+      /* Updates result */
+      hResult = MA_SUCCESS;
+    }
+    else
+    {
+      /* Updates result */
+      hResult = MA_ERROR;
+    }
+  }
+  else
+  {
+    /* Seeks */
+    hResult = (orxResource_Seek(pstFile->hResource, _s64Offset, (orxSEEK_OFFSET_WHENCE)_eOrigin) >= 0) ? MA_SUCCESS : MA_ERROR;
+  }
 
   /* Done! */
   return hResult;
@@ -1522,11 +1622,15 @@ static ma_result orxSoundSystem_MiniAudio_Seek(ma_vfs *_pstVFS, ma_vfs_file _stF
 
 static ma_result orxSoundSystem_MiniAudio_Tell(ma_vfs *_pstVFS, ma_vfs_file _stFile, ma_int64 *_ps64Cursor)
 {
-  orxS64    s64Cursor;
-  ma_result hResult;
+  orxSOUNDSYSTEM_VFS_FILE  *pstFile;
+  orxS64                    s64Cursor;
+  ma_result                 hResult;
+
+  /* Gets file */
+  pstFile = (orxSOUNDSYSTEM_VFS_FILE *)_stFile;
 
   /* Tells */
-  s64Cursor = orxResource_Tell((orxHANDLE)_stFile);
+  s64Cursor = (pstFile->pu8Map != orxNULL) ? pstFile->s64Cursor : orxResource_Tell(pstFile->hResource);
 
   /* Valid? */
   if(s64Cursor >= 0)
@@ -1549,8 +1653,13 @@ static ma_result orxSoundSystem_MiniAudio_Tell(ma_vfs *_pstVFS, ma_vfs_file _stF
 
 static ma_result orxSoundSystem_MiniAudio_Info(ma_vfs *_pstVFS, ma_vfs_file _stFile, ma_file_info *_pstInfo)
 {
+  orxSOUNDSYSTEM_VFS_FILE *pstFile;
+
+  /* Gets file */
+  pstFile = (orxSOUNDSYSTEM_VFS_FILE *)_stFile;
+
   /* Gets size */
-  _pstInfo->sizeInBytes = (ma_uint64)orxResource_GetSize((orxHANDLE)_stFile);
+  _pstInfo->sizeInBytes = (pstFile->pu8Map != orxNULL) ? (ma_uint64)pstFile->s64Size : (ma_uint64)orxResource_GetSize(pstFile->hResource);
 
   /* Done! */
   return MA_SUCCESS;
@@ -33,6 +33,7 @@
 #include "core/orxClock.h"
 
 #include "debug/orxDebug.h"
+#include "debug/orxProfiler.h"
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
@@ -74,6 +75,7 @@
 #define orxCLOCK_KZ_CONFIG_SECTION              "Clock"
 #define orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY "MainClockFrequency"
 #define orxCLOCK_KZ_CONFIG_ALLOW_SLEEP          "AllowSleep"
+#define orxCLOCK_KZ_CONFIG_SLEEP_MARGIN         "SleepMargin"
 
 #define orxCLOCK_KZ_MODIFIER_FIXED              "fixed"
 #define orxCLOCK_KZ_MODIFIER_MULTIPLY           "multiply"
@@ -86,8 +88,10 @@
 
 #define orxCLOCK_KU32_BANK_SIZE                 8           /**< Bank size */
 
-#define orxCLOCK_KF_DELAY_THRESHOLD             orx2F(0.003f)
-#define orxCLOCK_KF_DELAY_ADJUSTMENT            orx2F(-0.001f)
+#define orxCLOCK_KU32_TIMER_TABLE_SIZE          256         /**< Timer handle table size */
+#define orxCLOCK_KU32_TIMER_HEAP_SIZE           16          /**< Initial timer heap size */
+
+#define orxCLOCK_KF_DEFAULT_SLEEP_MARGIN        orx2F(0.001f)
 #define orxCLOCK_KF_DEFAULT_MODIFIER_FIXED      (-orxFLOAT_1)
 #define orxCLOCK_KF_DEFAULT_MODIFIER_MULTIPLY   orxFLOAT_0
 #define orxCLOCK_KF_DEFAULT_MODIFIER_MAXED      orx2F(0.1f)
@@ -118,6 +122,10 @@ typedef struct __orxCLOCK_TIMER_STORAGE_t
   void                       *pContext;         /**< Timer function context : 24 */
   orxS32                      s32Repetition;    /**< Timer repetition : 28 */
   orxFLOAT                    fTimeStamp;       /**< Next call time stamp : 32 */
+  orxCLOCK                   *pstClock;         /**< Owner clock : 36 */
+  orxU32                      u32HeapIndex;     /**< Index in owner's timer heap, orxU32_UNDEFINED when not scheduled : 40 */
+  orxBOOL                     bHandle;          /**< Is in handle table? : 44 */
+  orxU64                      u64ID;            /**< Creation ID, also used as handle : 52 */
 
 } orxCLOCK_TIMER_STORAGE;
 
@@ -134,6 +142,9 @@ struct __orxCLOCK_t
   const orxSTRING   zReference;                 /**< Reference : 96 */
   orxU32            u32HistoryIndex;            /**< Average history index : 100 */
   orxFLOAT         *afHistory;                  /**< Average history : 104 */
+  orxCLOCK_TIMER_STORAGE **apstTimerHeap;       /**< Timer min-heap, sorted by time stamp : 108 */
+  orxU32            u32TimerHeapCount;          /**< Timer heap count : 112 */
+  orxU32            u32TimerHeapSize;           /**< Timer heap size : 116 */
 };
 
 
@@ -143,10 +154,17 @@ typedef struct __orxCLOCK_STATIC_t
 {
   orxCLOCK         *pstCore;                    /**< Core clock */
   orxBANK          *pstTimerBank;               /**< Timer bank */
+  orxHASHTABLE     *pstTimerTable;              /**< Timer handle table */
+  orxCLOCK_TIMER_STORAGE **apstDueTimerList;    /**< Due timer list */
+  orxU32            u32DueTimerSize;            /**< Due timer list size */
+  orxU64            u64TimerCount;              /**< Created timer count */
   orxDOUBLE         dTime;                      /**< Current time */
   orxDOUBLE         dNextTime;                  /**< Next time */
   orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file */
   orxFLOAT          fDisplayTickSize;           /**< Display tick size */
+  orxDOUBLE         dSleepMargin;               /**< Time before next update under which to stop sleeping and actively wait */
+  orxDOUBLE         dJitterSum;                 /**< Pacing jitter sum */
+  orxCLOCK_PACING_STATS stPacingStats;          /**< Pacing stats */
   orxU32            u32Flags;                   /**< Control flags */
 
 } orxCLOCK_STATIC;
@@ -267,24 +285,542 @@ static orxINLINE orxCLOCK_FUNCTION_STORAGE *orxClock_FindFunctionStorage(const o
   return pstFunctionStorage;
 }
 
+/** Is a timer scheduled before another one?
+ * @param[in]   _pstTimer1                            First timer
+ * @param[in]   _pstTimer2                            Second timer
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxClock_IsTimerBefore(const orxCLOCK_TIMER_STORAGE *_pstTimer1, const orxCLOCK_TIMER_STORAGE *_pstTimer2)
+{
+  orxBOOL bResult;
+
+  /* Updates result, using creation order for identical time stamps */
+  bResult = ((_pstTimer1->fTimeStamp < _pstTimer2->fTimeStamp)
+          || ((_pstTimer1->fTimeStamp == _pstTimer2->fTimeStamp)
+           && (_pstTimer1->u64ID < _pstTimer2->u64ID))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Stores a timer in a clock's heap
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pstTimer                             Concerned timer
+ * @param[in]   _u32Index                             Heap index
+ */
+static orxINLINE void orxClock_SetHeapTimer(orxCLOCK *_pstClock, orxCLOCK_TIMER_STORAGE *_pstTimer, orxU32 _u32Index)
+{
+  /* Stores it */
+  _pstClock->apstTimerHeap[_u32Index] = _pstTimer;
+  _pstTimer->u32HeapIndex             = _u32Index;
+
+  /* Done! */
+  return;
+}
+
+/** Restores the heap property around a timer
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pstTimer                             Concerned timer, already in heap
+ */
+static void orxFASTCALL orxClock_SortHeapTimer(orxCLOCK *_pstClock, orxCLOCK_TIMER_STORAGE *_pstTimer)
+{
+  orxU32 u32Index;
+
+  /* Checks */
+  orxASSERT(_pstTimer->u32HeapIndex < _pstClock->u32TimerHeapCount);
+
+  /* Gets its index */
+  u32Index = _pstTimer->u32HeapIndex;
+
+  /* Moves it up while before its parent */
+  while((u32Index > 0) && (orxClock_IsTimerBefore(_pstTimer, _pstClock->apstTimerHeap[(u32Index - 1) >> 1]) != orxFALSE))
+  {
+    /* Moves parent down */
+    orxClock_SetHeapTimer(_pstClock, _pstClock->apstTimerHeap[(u32Index - 1) >> 1], u32Index);
+    u32Index = (u32Index - 1) >> 1;
+  }
+
+  /* Moves it down while after one of its children */
+  for(;;)
+  {
+    orxU32 u32Child;
+
+    /* Gets first child */
+    u32Child = (u32Index << 1) + 1;
+
+    /* No child? */
+    if(u32Child >= _pstClock->u32TimerHeapCount)
+    {
+      break;
+    }
+
+    /* Second child is earlier? */
+    if((u32Child + 1 < _pstClock->u32TimerHeapCount)
+    && (orxClock_IsTimerBefore(_pstClock->apstTimerHeap[u32Child + 1], _pstClock->apstTimerHeap[u32Child]) != orxFALSE))
+    {
+      /* Uses it */
+      u32Child++;
+    }
+
+    /* Already before its earliest child? */
+    if(orxClock_IsTimerBefore(_pstClock->apstTimerHeap[u32Child], _pstTimer) == orxFALSE)
+    {
+      break;
+    }
+
+    /* Moves child up */
+    orxClock_SetHeapTimer(_pstClock, _pstClock->apstTimerHeap[u32Child], u32Index);
+    u32Index = u32Child;
+  }
+
+  /* Stores timer */
+  orxClock_SetHeapTimer(_pstClock, _pstTimer, u32Index);
+
+  /* Done! */
+  return;
+}
+
+/** Schedules a timer in its clock's heap
+ * @param[in]   _pstTimer                             Concerned timer
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxClock_ScheduleTimer(orxCLOCK_TIMER_STORAGE *_pstTimer)
+{
+  orxCLOCK *pstClock;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstTimer->u32HeapIndex == orxU32_UNDEFINED);
+
+  /* Gets its clock */
+  pstClock = _pstTimer->pstClock;
+
+  /* Heap full? */
+  if(pstClock->u32TimerHeapCount == pstClock->u32TimerHeapSize)
+  {
+    orxCLOCK_TIMER_STORAGE **apstNewHeap;
+    orxU32                   u32NewSize;
+
+    /* Gets new size */
+    u32NewSize = (pstClock->u32TimerHeapSize != 0) ? pstClock->u32TimerHeapSize << 1 : orxCLOCK_KU32_TIMER_HEAP_SIZE;
+
+    /* Grows heap */
+    apstNewHeap = (orxCLOCK_TIMER_STORAGE **)orxMemory_Reallocate(pstClock->apstTimerHeap, u32NewSize * sizeof(orxCLOCK_TIMER_STORAGE *), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(apstNewHeap != orxNULL)
+    {
+      /* Stores it */
+      pstClock->apstTimerHeap     = apstNewHeap;
+      pstClock->u32TimerHeapSize  = u32NewSize;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "Couldn't grow timer heap to <%u> entries.", u32NewSize);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Adds it at the end */
+    orxClock_SetHeapTimer(pstClock, _pstTimer, pstClock->u32TimerHeapCount++);
+
+    /* Sorts it */
+    orxClock_SortHeapTimer(pstClock, _pstTimer);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Unschedules a timer from its clock's heap
+ * @param[in]   _pstTimer                             Concerned timer
+ */
+static void orxFASTCALL orxClock_UnscheduleTimer(orxCLOCK_TIMER_STORAGE *_pstTimer)
+{
+  orxCLOCK *pstClock;
+  orxU32    u32Index;
+
+  /* Gets its clock & index */
+  pstClock = _pstTimer->pstClock;
+  u32Index = _pstTimer->u32HeapIndex;
+
+  /* Checks */
+  orxASSERT(u32Index < pstClock->u32TimerHeapCount);
+  orxASSERT(pstClock->apstTimerHeap[u32Index] == _pstTimer);
+
+  /* Updates count */
+  pstClock->u32TimerHeapCount--;
+
+  /* Wasn't last? */
+  if(u32Index != pstClock->u32TimerHeapCount)
+  {
+    orxCLOCK_TIMER_STORAGE *pstLastTimer;
+
+    /* Moves last timer in its place */
+    pstLastTimer = pstClock->apstTimerHeap[pstClock->u32TimerHeapCount];
+    orxClock_SetHeapTimer(pstClock, pstLastTimer, u32Index);
+
+    /* Sorts it */
+    orxClock_SortHeapTimer(pstClock, pstLastTimer);
+  }
+
+  /* Updates timer */
+  _pstTimer->u32HeapIndex = orxU32_UNDEFINED;
+
+  /* Done! */
+  return;
+}
+
+/** Deletes a timer
+ * @param[in]   _pstTimer                             Concerned timer, must not be scheduled
+ */
+static void orxFASTCALL orxClock_DeleteTimer(orxCLOCK_TIMER_STORAGE *_pstTimer)
+{
+  /* Checks */
+  orxASSERT(_pstTimer->u32HeapIndex == orxU32_UNDEFINED);
+
+  /* Removes it from clock timer list */
+  orxLinkList_Remove(&(_pstTimer->stNode));
+
+  /* Has handle? */
+  if(_pstTimer->bHandle != orxFALSE)
+  {
+    /* Removes it from table */
+    orxHashTable_Remove(sstClock.pstTimerTable, _pstTimer->u64ID);
+  }
+
+  /* Deletes it */
+  orxBank_Free(sstClock.pstTimerBank, _pstTimer);
+
+  /* Done! */
+  return;
+}
+
+/** Cancels a timer: deletes it right away if scheduled, otherwise it's currently being processed and will be deleted once done
+ * @param[in]   _pstTimer                             Concerned timer
+ */
+static orxINLINE void orxClock_CancelTimer(orxCLOCK_TIMER_STORAGE *_pstTimer)
+{
+  /* Marks it for deletion */
+  _pstTimer->s32Repetition = 0;
+
+  /* Scheduled? */
+  if(_pstTimer->u32HeapIndex != orxU32_UNDEFINED)
+  {
+    /* Unschedules it */
+    orxClock_UnscheduleTimer(_pstTimer);
+
+    /* Deletes it */
+    orxClock_DeleteTimer(_pstTimer);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Creates a timer
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pfnCallback                          Concerned timer callback
+ * @param[in]   _fDelay                               Timer's delay between 2 calls, must be strictly positive
+ * @param[in]   _s32Repetition                        Number of times this timer should be called before removed, -1 for infinite
+ * @param[in]   _pContext                             Context that will be transmitted to the callback when called
+ * @return      orxCLOCK_TIMER_STORAGE / orxNULL
+ */
+static orxCLOCK_TIMER_STORAGE *orxFASTCALL orxClock_CreateTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, orxS32 _s32Repetition, void *_pContext)
+{
+  orxCLOCK_TIMER_STORAGE *pstResult = orxNULL;
+
+  /* Are delay and repetition correct? */
+  if((_fDelay > orxFLOAT_0) && (_s32Repetition != 0))
+  {
+    /* Allocates a timer storage */
+    pstResult = (orxCLOCK_TIMER_STORAGE *)orxBank_Allocate(sstClock.pstTimerBank);
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Clears it */
+      orxMemory_Zero(pstResult, sizeof(orxCLOCK_TIMER_STORAGE));
+
+      /* Inits it */
+      pstResult->pfnCallback    = _pfnCallback;
+      pstResult->pContext       = _pContext;
+      pstResult->fDelay         = _fDelay;
+      pstResult->s32Repetition  = _s32Repetition;
+      pstResult->pstClock       = _pstClock;
+      pstResult->u32HeapIndex   = orxU32_UNDEFINED;
+      pstResult->u64ID          = ++sstClock.u64TimerCount;
+
+      /* Gets it next call time stamp */
+      pstResult->fTimeStamp = _pstClock->stClockInfo.fTime + _fDelay;
+
+      /* Schedules it */
+      if(orxClock_ScheduleTimer(pstResult) != orxSTATUS_FAILURE)
+      {
+        /* Adds it to clock timer list */
+        orxLinkList_AddEnd(&(_pstClock->stTimerList), &(pstResult->stNode));
+      }
+      else
+      {
+        /* Deletes it */
+        orxBank_Free(sstClock.pstTimerBank, pstResult);
+        pstResult = orxNULL;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Updates the due timers of a clock
+ * @param[in]   _pstClock                             Concerned clock
+ */
+static void orxFASTCALL orxClock_UpdateTimers(orxCLOCK *_pstClock)
+{
+  orxU32 u32DueCount = 0, i;
+
+  /* For all due timers */
+  while((_pstClock->u32TimerHeapCount != 0)
+     && (_pstClock->apstTimerHeap[0]->fTimeStamp <= _pstClock->stClockInfo.fTime))
+  {
+    orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+
+    /* Due list full? */
+    if(u32DueCount == sstClock.u32DueTimerSize)
+    {
+      orxCLOCK_TIMER_STORAGE **apstNewList;
+      orxU32                   u32NewSize;
+
+      /* Gets new size */
+      u32NewSize = (sstClock.u32DueTimerSize != 0) ? sstClock.u32DueTimerSize << 1 : orxCLOCK_KU32_TIMER_HEAP_SIZE;
+
+      /* Grows list */
+      apstNewList = (orxCLOCK_TIMER_STORAGE **)orxMemory_Reallocate(sstClock.apstDueTimerList, u32NewSize * sizeof(orxCLOCK_TIMER_STORAGE *), orxMEMORY_TYPE_MAIN);
+
+      /* Failure? */
+      if(apstNewList == orxNULL)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "Couldn't grow due timer list to <%u> entries, remaining timers will be processed next tick.", u32NewSize);
+
+        break;
+      }
+
+      /* Stores it */
+      sstClock.apstDueTimerList = apstNewList;
+      sstClock.u32DueTimerSize  = u32NewSize;
+    }
+
+    /* Gets earliest timer */
+    pstTimerStorage = _pstClock->apstTimerHeap[0];
+
+    /* Unschedules it */
+    orxClock_UnscheduleTimer(pstTimerStorage);
+
+    /* Finds its place in creation order, as timers were always processed */
+    for(i = u32DueCount; (i > 0) && (sstClock.apstDueTimerList[i - 1]->u64ID > pstTimerStorage->u64ID); i--)
+    {
+      /* Shifts later timer */
+      sstClock.apstDueTimerList[i] = sstClock.apstDueTimerList[i - 1];
+    }
+
+    /* Stores it */
+    sstClock.apstDueTimerList[i] = pstTimerStorage;
+    u32DueCount++;
+  }
+
+  /* For all due timers */
+  for(i = 0; i < u32DueCount; i++)
+  {
+    orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+
+    /* Gets it */
+    pstTimerStorage = sstClock.apstDueTimerList[i];
+
+    /* Not marked for deletion? */
+    if(pstTimerStorage->s32Repetition != 0)
+    {
+      /* Calls it */
+      pstTimerStorage->pfnCallback(&(_pstClock->stClockInfo), pstTimerStorage->pContext);
+
+      /* Updates its time stamp */
+      pstTimerStorage->fTimeStamp = _pstClock->stClockInfo.fTime + pstTimerStorage->fDelay;
+
+      /* Should update count */
+      if(pstTimerStorage->s32Repetition > 0)
+      {
+        /* Updates it */
+        pstTimerStorage->s32Repetition--;
+      }
+    }
+
+    /* Should delete it or couldn't reschedule it? */
+    if((pstTimerStorage->s32Repetition == 0)
+    || (orxClock_ScheduleTimer(pstTimerStorage) == orxSTATUS_FAILURE))
+    {
+      /* Deletes it */
+      orxClock_DeleteTimer(pstTimerStorage);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates frame pacing config
+ */
+static void orxFASTCALL orxClock_UpdatePacingConfig()
+{
+  /* Pushes core clock section */
+  orxConfig_PushSection(orxCLOCK_KZ_CORE);
+
+  /* Updates allow sleep status */
+  if((orxConfig_HasValue(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) == orxFALSE)
+  || (orxConfig_GetBool(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) != orxFALSE))
+  {
+    sstClock.u32Flags |= orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
+  }
+  else
+  {
+    sstClock.u32Flags &= ~orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
+  }
+
+  /* Updates sleep margin */
+  sstClock.dSleepMargin = (orxConfig_HasValue(orxCLOCK_KZ_CONFIG_SLEEP_MARGIN) != orxFALSE) ? orxMAX(orx2D(orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_SLEEP_MARGIN)), orxDOUBLE_0) : orx2D(orxCLOCK_KF_DEFAULT_SLEEP_MARGIN);
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return;
+}
+
+/** Waits until next update, sleeping until the sleep margin then actively waiting
+ * @return      Current time
+ */
+static orxDOUBLE orxFASTCALL orxClock_WaitNextUpdate()
+{
+  orxDOUBLE dResult;
+
+  /* Gets current time */
+  dResult = orxSystem_GetTime();
+
+  /* Too early? */
+  if(dResult < sstClock.dNextTime)
+  {
+    orxDOUBLE dStartTime;
+
+    /* Stores start time */
+    dStartTime = dResult;
+
+    /* Can sleep? */
+    if(sstClock.u32Flags & orxCLOCK_KU32_FLAG_ALLOW_SLEEP)
+    {
+      orxDOUBLE dSleep;
+
+      /* Gets sleep duration */
+      dSleep = sstClock.dNextTime - dResult - sstClock.dSleepMargin;
+
+      /* Should sleep? */
+      if(dSleep > orxDOUBLE_0)
+      {
+        /* Profiles */
+        orxPROFILER_PUSH_MARKER("orxClock_Sleep");
+
+        /* Sleeps */
+        orxSystem_Delay(orx2F(dSleep));
+
+        /* Profiles */
+        orxPROFILER_POP_MARKER();
+
+        /* Updates time */
+        dResult = orxSystem_GetTime();
+
+        /* Updates stats */
+        sstClock.stPacingStats.dSleepTime += dResult - dStartTime;
+        dStartTime = dResult;
+      }
+    }
+
+    /* Still too early? */
+    if(dResult < sstClock.dNextTime)
+    {
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("orxClock_Spin");
+
+      /* Actively waits until next update */
+      while((dResult = orxSystem_GetTime()) < sstClock.dNextTime)
+        ;
+
+      /* Profiles */
+      orxPROFILER_POP_MARKER();
+
+      /* Updates stats */
+      sstClock.stPacingStats.dSpinTime += dResult - dStartTime;
+    }
+  }
+
+  /* Paced update (non-zero delay since last one)? */
+  if(sstClock.dNextTime > sstClock.dTime)
+  {
+    orxDOUBLE dJitter;
+
+    /* Gets jitter (lateness, including overruns) */
+    dJitter = dResult - sstClock.dNextTime;
+
+    /* Updates stats */
+    sstClock.dJitterSum                  += dJitter;
+    sstClock.stPacingStats.u32UpdateCount++;
+    sstClock.stPacingStats.dLastJitter    = dJitter;
+    sstClock.stPacingStats.dAverageJitter = sstClock.dJitterSum / orx2D(sstClock.stPacingStats.u32UpdateCount);
+    if(dJitter > sstClock.stPacingStats.dMaxJitter)
+    {
+      sstClock.stPacingStats.dMaxJitter   = dJitter;
+    }
+  }
+
+  /* Done! */
+  return dResult;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
  */
 static orxSTATUS orxFASTCALL orxClock_EventHandler(const orxEVENT *_pstEvent)
 {
-  orxDISPLAY_EVENT_PAYLOAD *pstPayload;
-  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
 
-  /* Checks */
-  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_DISPLAY);
-  orxASSERT(_pstEvent->eID == orxDISPLAY_EVENT_SET_VIDEO_MODE);
+  /* Display? */
+  if(_pstEvent->eType == orxEVENT_TYPE_DISPLAY)
+  {
+    orxDISPLAY_EVENT_PAYLOAD *pstPayload;
+
+    /* Checks */
+    orxASSERT(_pstEvent->eID == orxDISPLAY_EVENT_SET_VIDEO_MODE);
 
-  /* Gets payload */
-  pstPayload = (orxDISPLAY_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+    /* Gets payload */
+    pstPayload = (orxDISPLAY_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
-  /* Stores display tick size */
-  sstClock.fDisplayTickSize = (pstPayload->stVideoMode.u32RefreshRate != 0) ? orxFLOAT_1 / orxU2F(pstPayload->stVideoMode.u32RefreshRate) : orxFLOAT_0;
+    /* Stores display tick size */
+    sstClock.fDisplayTickSize = (pstPayload->stVideoMode.u32RefreshRate != 0) ? orxFLOAT_1 / orxU2F(pstPayload->stVideoMode.u32RefreshRate) : orxFLOAT_0;
+  }
+  else
+  {
+    /* Checks */
+    orxASSERT(_pstEvent->eType == orxEVENT_TYPE_CONFIG);
+    orxASSERT(_pstEvent->eID == orxCONFIG_EVENT_RELOAD_STOP);
+
+    /* Updates pacing config */
+    orxClock_UpdatePacingConfig();
+  }
 
   /* Done! */
   return eResult;
@@ -461,6 +997,7 @@ void orxFASTCALL orxClock_Setup()
   orxModule_AddDependency(orxMODULE_ID_CLOCK, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_CLOCK, orxMODULE_ID_COMMAND);
   orxModule_AddDependency(orxMODULE_ID_CLOCK, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_CLOCK, orxMODULE_ID_PROFILER);
 
   /* Done! */
   return;
@@ -494,6 +1031,10 @@ orxSTATUS orxFASTCALL orxClock_Init()
         /* Filters relevant event IDs */
         orxEvent_SetHandlerIDFlags(orxClock_EventHandler, orxEVENT_TYPE_DISPLAY, orxNULL, orxEVENT_GET_FLAG(orxDISPLAY_EVENT_SET_VIDEO_MODE), orxEVENT_KU32_MASK_ID_ALL);
 
+        /* Adds config event handler */
+        orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxClock_EventHandler);
+        orxEvent_SetHandlerIDFlags(orxClock_EventHandler, orxEVENT_TYPE_CONFIG, orxNULL, orxEVENT_GET_FLAG(orxCONFIG_EVENT_RELOAD_STOP), orxEVENT_KU32_MASK_ID_ALL);
+
         /* Creates timer bank */
         sstClock.pstTimerBank = orxBank_Create(orxCLOCK_KU32_TIMER_BANK_SIZE, sizeof(orxCLOCK_TIMER_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
@@ -515,6 +1056,9 @@ orxSTATUS orxFASTCALL orxClock_Init()
             /* Inits Flags */
             sstClock.u32Flags = orxCLOCK_KU32_STATIC_FLAG_READY;
 
+            /* Updates pacing config */
+            orxClock_UpdatePacingConfig();
+
             /* Gets main clock tick size */
             orxConfig_PushSection(orxCLOCK_KZ_CONFIG_SECTION);
             fTickSize = (orxConfig_HasValue(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY) && orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY) > orxFLOAT_0) ? (orxFLOAT_1 / orxConfig_GetFloat(orxCLOCK_KZ_CONFIG_MAIN_CLOCK_FREQUENCY)) : orxFLOAT_0;
@@ -628,8 +1172,9 @@ void orxFASTCALL orxClock_Exit()
   /* Initialized? */
   if(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY)
   {
-    /* Removes event handler */
+    /* Removes event handlers */
     orxEvent_RemoveHandler(orxEVENT_TYPE_DISPLAY, orxClock_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxClock_EventHandler);
 
     /* Unregisters commands */
     orxClock_UnregisterCommands();
@@ -641,6 +1186,23 @@ void orxFASTCALL orxClock_Exit()
     orxBank_Delete(sstClock.pstTimerBank);
     sstClock.pstTimerBank = orxNULL;
 
+    /* Has timer table? */
+    if(sstClock.pstTimerTable != orxNULL)
+    {
+      /* Deletes it */
+      orxHashTable_Delete(sstClock.pstTimerTable);
+      sstClock.pstTimerTable = orxNULL;
+    }
+
+    /* Has due timer list? */
+    if(sstClock.apstDueTimerList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstClock.apstDueTimerList);
+      sstClock.apstDueTimerList = orxNULL;
+      sstClock.u32DueTimerSize  = 0;
+    }
+
     /* Deletes reference table */
     orxHashTable_Delete(sstClock.pstReferenceTable);
 
@@ -675,22 +1237,8 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Lock clocks */
     sstClock.u32Flags |= orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
 
-    /* Updates allow sleep status */
-    orxConfig_PushSection(orxCLOCK_KZ_CORE);
-    if((orxConfig_HasValue(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) == orxFALSE)
-    || (orxConfig_GetBool(orxCLOCK_KZ_CONFIG_ALLOW_SLEEP) != orxFALSE))
-    {
-      sstClock.u32Flags |= orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
-    }
-    else
-    {
-      sstClock.u32Flags &= ~orxCLOCK_KU32_FLAG_ALLOW_SLEEP;
-    }
-    orxConfig_PopSection();
-
-    /* Actively waits until next update */
-    while((dNewTime = orxSystem_GetTime()) < sstClock.dNextTime)
-      ;
+    /* Waits until next update */
+    dNewTime = orxClock_WaitNextUpdate();
 
     /* Computes natural DT */
     fDT = (orxFLOAT)(dNewTime - sstClock.dTime);
@@ -728,7 +1276,6 @@ orxSTATUS orxFASTCALL orxClock_Update()
         if(pstClock->fPartialDT >= pstClock->stClockInfo.fTickSize)
         {
           orxFLOAT                    fClockDT;
-          orxCLOCK_TIMER_STORAGE     *pstTimerStorage, *pstNextTimerStorage;
           orxCLOCK_FUNCTION_STORAGE  *pstFunctionStorage, *pstNextFunctionStorage;
 
           /* Gets clock modified DT */
@@ -740,41 +1287,8 @@ orxSTATUS orxFASTCALL orxClock_Update()
           /* Updates clock time */
           pstClock->stClockInfo.fTime += fClockDT;
 
-          /* For all timers */
-          for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(pstClock->stTimerList));
-              pstTimerStorage != orxNULL;
-              pstTimerStorage = pstNextTimerStorage)
-          {
-            /* Gets the next timer */
-            pstNextTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode));
-
-            /* Should call it? */
-            if((pstTimerStorage->fTimeStamp <= pstClock->stClockInfo.fTime) && (pstTimerStorage->s32Repetition != 0))
-            {
-              /* Calls it */
-              pstTimerStorage->pfnCallback(&(pstClock->stClockInfo), pstTimerStorage->pContext);
-
-              /* Updates its time stamp */
-              pstTimerStorage->fTimeStamp = pstClock->stClockInfo.fTime + pstTimerStorage->fDelay;
-
-              /* Should update count */
-              if(pstTimerStorage->s32Repetition > 0)
-              {
-                /* Updates it */
-                pstTimerStorage->s32Repetition--;
-              }
-            }
-
-            /* Should delete it? */
-            if(pstTimerStorage->s32Repetition == 0)
-            {
-              /* Removes current timer */
-              orxLinkList_Remove(&(pstTimerStorage->stNode));
-
-              /* Deletes it */
-              orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
-            }
-          }
+          /* Updates its due timers */
+          orxClock_UpdateTimers(pstClock);
 
           /* For all registered callbacks */
           for(pstFunctionStorage = (orxCLOCK_FUNCTION_STORAGE *)orxLinkList_GetFirst(&(pstClock->stFunctionList));
@@ -826,17 +1340,6 @@ orxSTATUS orxFASTCALL orxClock_Update()
 
     /* Sets next tick time */
     sstClock.dNextTime = sstClock.dTime + (orxDOUBLE)fDelay;
-
-    /* Gets real remaining delay */
-    fDelay = orx2F(sstClock.dNextTime - orxSystem_GetTime());
-
-    /* Should delay? */
-    if((fDelay > orxCLOCK_KF_DELAY_THRESHOLD)
-    && (sstClock.u32Flags & orxCLOCK_KU32_FLAG_ALLOW_SLEEP))
-    {
-      /* Waits for next time slice */
-      orxSystem_Delay(fDelay + orxCLOCK_KF_DELAY_ADJUSTMENT);
-    }
   }
 
   /* Done! */
@@ -1084,11 +1587,16 @@ orxSTATUS orxFASTCALL orxClock_Delete(orxCLOCK *_pstClock)
           pstTimerStorage != orxNULL;
           pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList)))
       {
-        /* Removes it */
-        orxLinkList_Remove(&(pstTimerStorage->stNode));
-
         /* Deletes it */
-        orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
+        pstTimerStorage->u32HeapIndex = orxU32_UNDEFINED;
+        orxClock_DeleteTimer(pstTimerStorage);
+      }
+
+      /* Has timer heap? */
+      if(_pstClock->apstTimerHeap != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(_pstClock->apstTimerHeap);
       }
 
       /* Deletes function bank */
@@ -1680,6 +2188,32 @@ const orxSTRING orxFASTCALL orxClock_GetName(const orxCLOCK *_pstClock)
   return zResult;
 }
 
+/** Gets frame pacing stats, accumulated since the last reset
+ * @param[out]  _pstStats                             Stats to fill
+ * @param[in]   _bReset                               Reset stats once retrieved
+ * @return      orxCLOCK_PACING_STATS
+ */
+orxCLOCK_PACING_STATS *orxFASTCALL orxClock_GetPacingStats(orxCLOCK_PACING_STATS *_pstStats, orxBOOL _bReset)
+{
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Copies stats */
+  orxMemory_Copy(_pstStats, &(sstClock.stPacingStats), sizeof(orxCLOCK_PACING_STATS));
+
+  /* Should reset? */
+  if(_bReset != orxFALSE)
+  {
+    /* Clears them */
+    orxMemory_Zero(&(sstClock.stPacingStats), sizeof(orxCLOCK_PACING_STATS));
+    sstClock.dJitterSum = orxDOUBLE_0;
+  }
+
+  /* Done! */
+  return _pstStats;
+}
+
 /** Adds a timer function to a clock
  * @param[in]   _pstClock                             Concerned clock
  * @param[in]   _pfnCallback                          Concerned timer callback
@@ -1697,35 +2231,11 @@ orxSTATUS orxFASTCALL orxClock_AddTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNC
   orxSTRUCTURE_ASSERT(_pstClock);
   orxASSERT(_pfnCallback != orxNULL);
 
-  /* Are delay and repetition correct? */
-  if((_fDelay > orxFLOAT_0) && (_s32Repetition != 0))
+  /* Creates timer */
+  if(orxClock_CreateTimer(_pstClock, _pfnCallback, _fDelay, _s32Repetition, _pContext) != orxNULL)
   {
-    orxCLOCK_TIMER_STORAGE *pstTimerStorage;
-
-    /* Allocates a timer storage */
-    pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxBank_Allocate(sstClock.pstTimerBank);
-
-    /* Valid? */
-    if(pstTimerStorage != orxNULL)
-    {
-      /* Clears it */
-      orxMemory_Zero(pstTimerStorage, sizeof(orxCLOCK_TIMER_STORAGE));
-
-      /* Adds it to clock timer list */
-      orxLinkList_AddEnd(&(_pstClock->stTimerList), &(pstTimerStorage->stNode));
-
-      /* Inits it */
-      pstTimerStorage->pfnCallback    = _pfnCallback;
-      pstTimerStorage->pContext       = _pContext;
-      pstTimerStorage->fDelay         = _fDelay;
-      pstTimerStorage->s32Repetition  = _s32Repetition;
-
-      /* Gets it next call time stamp */
-      pstTimerStorage->fTimeStamp = _pstClock->stClockInfo.fTime + _fDelay;
-
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
-    }
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
 
   /* Done! */
@@ -1741,7 +2251,7 @@ orxSTATUS orxFASTCALL orxClock_AddTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNC
  */
 orxSTATUS orxFASTCALL orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, void *_pContext)
 {
-  orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+  orxCLOCK_TIMER_STORAGE *pstTimerStorage, *pstNextTimerStorage;
   orxSTATUS               eResult = orxSTATUS_FAILURE;
 
   /* Checks */
@@ -1751,8 +2261,11 @@ orxSTATUS orxFASTCALL orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_F
   /* For all stored timers */
   for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList));
       pstTimerStorage != orxNULL;
-      pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode)))
+      pstTimerStorage = pstNextTimerStorage)
   {
+    /* Gets next timer */
+    pstNextTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode));
+
     /* Matches criteria? */
     if(((_pfnCallback == orxNULL)
      || (pstTimerStorage->pfnCallback == _pfnCallback))
@@ -1761,8 +2274,98 @@ orxSTATUS orxFASTCALL orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_F
     && ((_pContext == orxNULL)
      || (pstTimerStorage->pContext == _pContext)))
     {
-      /* Marks it for deletion */
-      pstTimerStorage->s32Repetition = 0;
+      /* Cancels it */
+      orxClock_CancelTimer(pstTimerStorage);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a timer function to a clock and gets its handle
+ * @param[in]   _pstClock                             Concerned clock
+ * @param[in]   _pfnCallback                          Concerned timer callback
+ * @param[in]   _fDelay                               Timer's delay between 2 calls, must be strictly positive
+ * @param[in]   _s32Repetition                        Number of times this timer should be called before removed, -1 for infinite
+ * @param[in]   _pContext                             Context that will be transmitted to the callback when called
+ * @return      Timer handle / orxU64_UNDEFINED
+ */
+orxU64 orxFASTCALL orxClock_AddTimerWithHandle(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, orxS32 _s32Repetition, void *_pContext)
+{
+  orxU64 u64Result = orxU64_UNDEFINED;
+
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstClock);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* No timer table yet? */
+  if(sstClock.pstTimerTable == orxNULL)
+  {
+    /* Creates it */
+    sstClock.pstTimerTable = orxHashTable_Create(orxCLOCK_KU32_TIMER_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  }
+
+  /* Valid? */
+  if(sstClock.pstTimerTable != orxNULL)
+  {
+    orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+
+    /* Creates timer */
+    pstTimerStorage = orxClock_CreateTimer(_pstClock, _pfnCallback, _fDelay, _s32Repetition, _pContext);
+
+    /* Success? */
+    if(pstTimerStorage != orxNULL)
+    {
+      /* Adds it to table */
+      if(orxHashTable_Add(sstClock.pstTimerTable, pstTimerStorage->u64ID, pstTimerStorage) != orxSTATUS_FAILURE)
+      {
+        /* Updates status */
+        pstTimerStorage->bHandle = orxTRUE;
+
+        /* Updates result */
+        u64Result = pstTimerStorage->u64ID;
+      }
+      else
+      {
+        /* Deletes it */
+        orxClock_CancelTimer(pstTimerStorage);
+      }
+    }
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Removes a timer function using its handle
+ * @param[in]   _u64Handle                            Handle of the timer to remove, as returned by orxClock_AddTimerWithHandle
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxClock_RemoveTimerFromHandle(orxU64 _u64Handle)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
+
+  /* Has timer table? */
+  if(sstClock.pstTimerTable != orxNULL)
+  {
+    orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+
+    /* Gets timer */
+    pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxHashTable_Get(sstClock.pstTimerTable, _u64Handle);
+
+    /* Found and not already removed? */
+    if((pstTimerStorage != orxNULL) && (pstTimerStorage->s32Repetition != 0))
+    {
+      /* Cancels it */
+      orxClock_CancelTimer(pstTimerStorage);
 
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
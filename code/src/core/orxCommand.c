@@ -41,6 +41,7 @@
 #include "memory/orxMemory.h"
 #include "memory/orxBank.h"
 #include "object/orxTimeLine.h"
+#include "utils/orxHashTable.h"
 #include "utils/orxString.h"
 #include "utils/orxTree.h"
 
@@ -74,6 +75,13 @@
 #define orxCOMMAND_KU32_PROCESS_BUFFER_SIZE           65536
 #define orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE         512
 
+#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH               32
+
+#define orxCOMMAND_KU32_COMPILED_TABLE_SIZE           256
+#define orxCOMMAND_KU32_COMPILED_MAX_COUNT            4096
+#define orxCOMMAND_KU32_COMPILED_STATEMENT_NUMBER     16
+#define orxCOMMAND_KU32_COMPILED_ARG_NUMBER           64
+
 #define orxCOMMAND_KZ_ERROR_VALUE                     "ERROR"
 #define orxCOMMAND_KZ_STACK_ERROR_VALUE               "STACK_ERROR"
 
@@ -137,6 +145,31 @@ typedef struct __orxCOMMAND_TRIE_NODE_t
 
 } orxCOMMAND_TRIE_NODE;
 
+/** Compiled command statement
+ */
+typedef struct __orxCOMMAND_STATEMENT_t
+{
+  const orxCOMMAND         *pstCommand;                                               /**< Command : 4 */
+  const orxCHAR            *pcArgs;                                                   /**< Expanded arguments, when they depend on GUID/stack : 8 */
+  const orxCOMMAND_VAR     *astArgList;                                               /**< Pre-parsed arguments : 12 */
+  orxU32                    u32ArgNumber;                                             /**< Pre-parsed argument number : 16 */
+  orxU32                    u32PushCount;                                             /**< Push count : 20 */
+
+} orxCOMMAND_STATEMENT;
+
+/** Compiled command line
+ */
+typedef struct __orxCOMMAND_COMPILED_t
+{
+  orxSTRINGID               stID;                                                     /**< ID : 8 */
+  const orxSTRING           zCommandLine;                                             /**< Command line : 12 */
+  orxCOMMAND_STATEMENT     *astStatementList;                                         /**< Statement list : 16 */
+  orxU32                    u32StatementNumber;                                       /**< Statement number, 0 if the command line couldn't be compiled : 20 */
+  orxU32                    u32Generation;                                            /**< Command generation : 24 */
+  orxU32                    u32RefCount;                                              /**< Reference count : 28 */
+
+} orxCOMMAND_COMPILED;
+
 /** Static structure
  */
 typedef struct __orxCOMMAND_STATIC_t
@@ -145,12 +178,14 @@ typedef struct __orxCOMMAND_STATIC_t
   orxBANK                  *pstTrieBank;                                              /**< Command trie bank */
   orxTREE                   stCommandTrie;                                            /**< Command trie */
   orxBANK                  *pstResultBank;                                            /**< Command result bank */
+  orxHASHTABLE             *pstCompiledTable;                                         /**< Compiled command table */
   orxCHAR                   acEvaluateBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];   /**< Evaluate buffer */
   orxCHAR                   acProcessBuffer[orxCOMMAND_KU32_PROCESS_BUFFER_SIZE];     /**< Process buffer */
   orxCHAR                   acPrototypeBuffer[orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE]; /**< Prototype buffer */
   orxCHAR                   acResultBuffer[orxCOMMAND_KU32_RESULT_BUFFER_SIZE];       /**< Result buffer */
   orxS32                    s32EvaluateOffset;                                        /**< Evaluate buffer offset */
   orxS32                    s32ProcessOffset;                                         /**< Process buffer offset */
+  orxU32                    u32Generation;                                            /**< Command generation, updated when commands/aliases change */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
 } orxCOMMAND_STATIC;
@@ -214,7 +249,7 @@ static orxINLINE const orxSTRING orxCommand_GetTypeString(orxCOMMAND_VAR_TYPE _e
 
 /** Runs a command
  */
-static orxINLINE orxCOMMAND_VAR *orxCommand_Run(const orxCOMMAND *_pstCommand, orxBOOL _bCheckArgList, orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxINLINE orxCOMMAND_VAR *orxCommand_RunCommand(const orxCOMMAND *_pstCommand, orxBOOL _bCheckArgList, orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
 {
   orxCOMMAND_VAR *pstResult = orxNULL;
 
@@ -444,707 +479,1267 @@ static orxINLINE const orxCOMMAND *orxCommand_FindNext(const orxCOMMAND_TRIE_NOD
   return pstResult;
 }
 
-static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+/** Gets the argument buffer list of a command (aliases arguments + command line arguments)
+ */
+static orxINLINE orxS32 orxCommand_GetArgumentBufferList(const orxSTRING _zCommand, const orxSTRING _zArgs, const orxSTRING *_azBufferList)
 {
-  const orxSTRING zCommand;
-  orxBOOL         bProcessed = orxFALSE;
-  orxCOMMAND_VAR *pstResult = orxNULL;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxCommand_Process");
+  orxCOMMAND_TRIE_NODE *pstCommandNode;
+  orxS32                s32Result = 0;
 
-  /* Gets start of command */
-  zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
+  /* Adds input to the buffer list */
+  ((const orxCHAR **)_azBufferList)[s32Result++] = _zArgs;
 
-  /* For all commands */
-  while(*zCommand != orxCHAR_NULL)
+  /* For all alias nodes */
+  for(pstCommandNode = orxCommand_FindTrieNode(_zCommand, orxFALSE);
+      (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32Result < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
+      pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
   {
-    orxU32          u32PushCount;
-    const orxCHAR  *pcCommandEnd;
-    orxCOMMAND     *pstCommand;
-    orxCHAR         cBackupChar;
-
-    /* Updates status */
-    bProcessed = orxTRUE;
-
-    /* For all push markers / spaces */
-    for(u32PushCount = 0; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+    /* Has args? */
+    if(pstCommandNode->pstCommand->zArgs != orxNULL)
     {
-      /* Is a push marker? */
-      if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
-      {
-        /* Updates push count */
-        u32PushCount++;
-      }
+      /* Adds it to the buffer list */
+      ((const orxCHAR **)_azBufferList)[s32Result++] = pstCommandNode->pstCommand->zArgs;
     }
+  }
 
-    /* Finds end of command */
-    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
-      ;
+  /* Done! */
+  return s32Result;
+}
 
-    /* Ends command */
-    cBackupChar               = *pcCommandEnd;
-    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+/** Expands arguments from a buffer list into the process buffer, replacing GUID & pop markers if requested
+ */
+static const orxCHAR *orxFASTCALL orxCommand_ExpandArguments(const orxSTRING *_azBufferList, orxS32 _s32BufferCount, const orxSTRING _zGUID, orxS32 _s32GUIDLength, orxBOOL _bSubstitute, orxCHAR **_ppcDst, orxBOOL *_pbDynamic, const orxSTRING _zCommandLine)
+{
+  const orxCHAR  *pcSrc = orxNULL;
+  orxCHAR        *pcDst;
+  orxS32          s32VectorDepth = 0, i;
+  orxBOOL         bInBlock = orxFALSE;
 
-    /* Gets it */
-    pstCommand = orxCommand_FindNoAlias(zCommand);
+  /* For all stacked buffers */
+  for(i = _s32BufferCount - 1, pcDst = *_ppcDst; i >= 0; i--)
+  {
+    orxBOOL bStop;
 
-    /* Found? */
-    if(pstCommand != orxNULL)
+    /* Has room for next buffer? */
+    if((i != _s32BufferCount - 1) && (*_azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2))
     {
-#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH             32
-      orxSTATUS             eStatus;
-      orxS32                s32GUIDLength, s32BufferCount = 0, s32VectorDepth = 0, s32Offset, i;
-      orxBOOL               bInBlock = orxFALSE;
-      orxCOMMAND_TRIE_NODE *pstCommandNode;
-      const orxCHAR        *pcSrc;
-      orxCHAR              *pcDst;
-      const orxSTRING       zArg;
-      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
-      orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
-      orxCHAR               acGUID[20];
-
-#ifdef __orxMSVC__
-
-      orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca(u32ParamNumber * sizeof(orxCOMMAND_VAR));
-
-#else /* __orxMSVC__ */
-
-      orxCOMMAND_VAR astArgList[u32ParamNumber];
-
-#endif /* __orxMSVC__ */
-
-      /* Is GUID valid? */
-      if(_u64GUID != orxU64_UNDEFINED)
-      {
-        /* Gets owner's GUID */
-        s32GUIDLength = orxString_NPrint(acGUID, sizeof(acGUID), "0x%016llX", _u64GUID);
-      }
-      else
-      {
-        /* No GUID */
-        s32GUIDLength = 0;
-      }
-
-      /* Adds input to the buffer list */
-      azBufferList[s32BufferCount++] = pcCommandEnd;
+      /* Inserts space */
+      *pcDst++ = ' ';
+    }
 
-      /* For all alias nodes */
-      for(pstCommandNode = orxCommand_FindTrieNode(zCommand, orxFALSE);
-          (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCount < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
-          pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
+    /* For all characters */
+    for(pcSrc = _azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2); pcSrc++)
+    {
+      /* Depending on character */
+      switch(*pcSrc)
       {
-        /* Has args? */
-        if(pstCommandNode->pstCommand->zArgs != orxNULL)
+        case orxCOMMAND_KC_GUID_MARKER:
         {
-          /* Adds it to the buffer list */
-          azBufferList[s32BufferCount++] = pstCommandNode->pstCommand->zArgs;
-        }
-      }
+          /* Should substitute and has valid GUID? */
+          if((_bSubstitute != orxFALSE) && (_s32GUIDLength != 0))
+          {
+            /* Replaces it with GUID */
+            orxString_NCopy(pcDst, _zGUID, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
 
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
+            /* Updates pointer */
+            pcDst += _s32GUIDLength;
+          }
+          else
+          {
+            /* Not substituting? */
+            if(_bSubstitute == orxFALSE)
+            {
+              /* Updates status */
+              *_pbDynamic = orxTRUE;
+            }
 
-      /* For all stacked buffers */
-      for(i = s32BufferCount - 1, pcDst = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset; i >= 0; i--)
-      {
-        orxBOOL bStop;
+            /* Copies character */
+            *pcDst++ = *pcSrc;
+          }
 
-        /* Has room for next buffer? */
-        if((i != s32BufferCount - 1) && (*azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2))
-        {
-          /* Inserts space */
-          *pcDst++ = ' ';
+          break;
         }
 
-        /* For all characters */
-        for(pcSrc = azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2); pcSrc++)
+        case orxCOMMAND_KC_POP_MARKER:
         {
-          /* Depending on character */
-          switch(*pcSrc)
+          /* Not substituting? */
+          if(_bSubstitute == orxFALSE)
           {
-            case orxCOMMAND_KC_GUID_MARKER:
-            {
-              /* Has valid GUID? */
-              if(s32GUIDLength != 0)
-              {
-                /* Replaces it with GUID */
-                orxString_NCopy(pcDst, acGUID, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+            /* Updates status */
+            *_pbDynamic = orxTRUE;
 
-                /* Updates pointer */
-                pcDst += s32GUIDLength;
-              }
-              else
-              {
-                /* Copies character */
-                *pcDst++ = *pcSrc;
-              }
+            /* Copies character */
+            *pcDst++ = *pcSrc;
+          }
+          /* Valid? */
+          else if(orxBank_GetCount(sstCommand.pstResultBank) > 0)
+          {
+            orxCOMMAND_STACK_ENTRY *pstEntry;
+            orxCHAR                 acValue[64];
+            orxBOOL                 bUseStringMarker = orxFALSE;
+            const orxSTRING         zValue = acValue;
 
-              break;
-            }
+            /* Gets last stack entry */
+            pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCount(sstCommand.pstResultBank) - 1);
 
-            case orxCOMMAND_KC_POP_MARKER:
+            /* Inits value */
+            acValue[sizeof(acValue) - 1] = orxCHAR_NULL;
+
+            /* Depending on type */
+            switch(pstEntry->stValue.eType)
             {
-              /* Valid? */
-              if(orxBank_GetCount(sstCommand.pstResultBank) > 0)
+              case orxCOMMAND_VAR_TYPE_STRING:
               {
-                orxCOMMAND_STACK_ENTRY *pstEntry;
-                orxCHAR                 acValue[64];
-                orxBOOL                 bUseStringMarker = orxFALSE;
-                const orxSTRING         zValue = acValue;
-
-                /* Gets last stack entry */
-                pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCount(sstCommand.pstResultBank) - 1);
-
-                /* Inits value */
-                acValue[sizeof(acValue) - 1] = orxCHAR_NULL;
+                /* Updates pointer */
+                zValue = pstEntry->stValue.zValue;
 
-                /* Depending on type */
-                switch(pstEntry->stValue.eType)
+                /* Is not in block? */
+                if(bInBlock == orxFALSE)
                 {
-                  case orxCOMMAND_VAR_TYPE_STRING:
-                  {
-                    /* Updates pointer */
-                    zValue = pstEntry->stValue.zValue;
+                  const orxCHAR *pc = zValue;
 
-                    /* Is not in block? */
-                    if(bInBlock == orxFALSE)
+                  /* For all characters */
+                  do
+                  {
+                    /* Is a white space? */
+                    if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
                     {
-                      const orxCHAR *pc = zValue;
-
-                      /* For all characters */
-                      do
+                      /* Has room? */
+                      if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
                       {
-                        /* Is a white space? */
-                        if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
-                        {
-                          /* Has room? */
-                          if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
-                          {
-                            /* Adds block marker */
-                            *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
-
-                            /* Updates string marker status */
-                            bUseStringMarker = orxTRUE;
-                          }
-
-                          break;
-                        }
-
-                        /* Gets next character */
-                        pc++;
-
-                      } while(*pc != orxCHAR_NULL);
-                    }
+                        /* Adds block marker */
+                        *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
 
-                    break;
-                  }
+                        /* Updates string marker status */
+                        bUseStringMarker = orxTRUE;
+                      }
 
-                  default:
-                  {
-                    orxCommand_PrintVar(acValue, sizeof(acValue), &(pstEntry->stValue));
-
-                    break;
-                  }
-                }
-
-                /* Replaces marker with stacked value */
-                orxString_NCopy(pcDst, zValue, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+                      break;
+                    }
 
-                /* Updates pointers */
-                pcDst += orxString_GetLength(zValue);
+                    /* Gets next character */
+                    pc++;
 
-                /* Used a string marker? */
-                if(bUseStringMarker != orxFALSE)
-                {
-                  /* Has room? */
-                  if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
-                  {
-                    *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
-                  }
+                  } while(*pc != orxCHAR_NULL);
                 }
 
-                /* Deletes stack entry */
-                orxBank_Free(sstCommand.pstResultBank, pstEntry);
+                break;
               }
-              else
-              {
-                /* Logs message */
-                orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
 
-                /* Replaces marker with stack error */
-                orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+              default:
+              {
+                orxCommand_PrintVar(acValue, sizeof(acValue), &(pstEntry->stValue));
 
-                /* Updates pointers */
-                pcDst += orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+                break;
               }
-
-              break;
             }
 
-            case orxCOMMAND_KC_SEPARATOR:
-            case orxCHAR_CR:
-            case orxCHAR_LF:
+            /* Replaces marker with stacked value */
+            orxString_NCopy(pcDst, zValue, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+
+            /* Updates pointers */
+            pcDst += orxString_GetLength(zValue);
+
+            /* Used a string marker? */
+            if(bUseStringMarker != orxFALSE)
             {
-              /* Not in block or in vector? */
-              if((bInBlock == orxFALSE)
-              && (s32VectorDepth == 0))
-              {
-                /* Stops */
-                bStop = orxTRUE;
-              }
-              else
+              /* Has room? */
+              if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
               {
-                /* Copies it */
-                *pcDst++ = *pcSrc;
+                *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
               }
-
-              break;
             }
 
-            case orxSTRING_KC_VECTOR_START:
-            case orxSTRING_KC_VECTOR_START_ALT:
-            {
-              /* Increments vector depth */
-              s32VectorDepth++;
+            /* Deletes stack entry */
+            orxBank_Free(sstCommand.pstResultBank, pstEntry);
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
 
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+            /* Replaces marker with stack error */
+            orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
 
-              break;
-            }
+            /* Updates pointers */
+            pcDst += orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+          }
 
-            case orxSTRING_KC_VECTOR_END:
-            case orxSTRING_KC_VECTOR_END_ALT:
-            {
-              /* Decrements vector depth */
-              s32VectorDepth--;
+          break;
+        }
 
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+        case orxCOMMAND_KC_SEPARATOR:
+        case orxCHAR_CR:
+        case orxCHAR_LF:
+        {
+          /* Not in block or in vector? */
+          if((bInBlock == orxFALSE)
+          && (s32VectorDepth == 0))
+          {
+            /* Stops */
+            bStop = orxTRUE;
+          }
+          else
+          {
+            /* Copies it */
+            *pcDst++ = *pcSrc;
+          }
 
-              break;
-            }
+          break;
+        }
 
-            case orxCOMMAND_KC_BLOCK_MARKER:
-            {
-              /* Toggles block status */
-              bInBlock = !bInBlock;
+        case orxSTRING_KC_VECTOR_START:
+        case orxSTRING_KC_VECTOR_START_ALT:
+        {
+          /* Increments vector depth */
+          s32VectorDepth++;
 
-              /* Fall through */
-            }
+          /* Copies it */
+          *pcDst++ = *pcSrc;
 
-            default:
-            {
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+          break;
+        }
 
-              break;
-            }
-          }
+        case orxSTRING_KC_VECTOR_END:
+        case orxSTRING_KC_VECTOR_END_ALT:
+        {
+          /* Decrements vector depth */
+          s32VectorDepth--;
+
+          /* Copies it */
+          *pcDst++ = *pcSrc;
+
+          break;
+        }
+
+        case orxCOMMAND_KC_BLOCK_MARKER:
+        {
+          /* Toggles block status */
+          bInBlock = !bInBlock;
+
+          /* Fall through */
+        }
+
+        default:
+        {
+          /* Copies it */
+          *pcDst++ = *pcSrc;
+
+          break;
         }
       }
+    }
+  }
 
-      /* Copies end of string */
-      *pcDst = orxCHAR_NULL;
+  /* Copies end of string */
+  *pcDst = orxCHAR_NULL;
 
-      /* Gets new additional offset */
-      s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+  /* Updates destination */
+  *_ppcDst = pcDst;
 
-      /* Updates next command expression */
-      zCommand = orxString_SkipWhiteSpaces(pcSrc);
+  /* Done! */
+  return pcSrc;
+}
+
+/** Parses expanded arguments, in place
+ */
+static orxSTATUS orxFASTCALL orxCommand_ParseArguments(const orxCOMMAND *_pstCommand, const orxCHAR *_pcBuffer, orxCOMMAND_VAR *_astArgList, orxU32 *_pu32ArgNumber)
+{
+  const orxCHAR  *pcSrc;
+  const orxSTRING zArg;
+  orxS32          s32VectorDepth;
+  orxU32          u32ArgNumber, u32ParamNumber = (orxU32)_pstCommand->u16RequiredParamNumber + (orxU32)_pstCommand->u16OptionalParamNumber;
+  orxSTATUS       eStatus;
+
+  /* For all characters in the buffer */
+  for(pcSrc = _pcBuffer, eStatus = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
+      (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
+      pcSrc++, u32ArgNumber++)
+  {
+    /* Skips all whitespaces */
+    pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+
+    /* Valid? */
+    if(*pcSrc != orxCHAR_NULL)
+    {
+      orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
+
+      /* Inits vector depth */
+      s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
 
-      /* For all characters in the buffer */
-      for(pcSrc = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset, eStatus = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
-          (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
-          pcSrc++, u32ArgNumber++)
+      /* Gets arg's beginning */
+      zArg = pcSrc;
+
+      /* Is a block marker? */
+      if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
       {
-        /* Skips all whitespaces */
-        pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+        /* Updates arg pointer */
+        zArg++;
+        pcSrc++;
 
-        /* Valid? */
-        if(*pcSrc != orxCHAR_NULL)
+        /* Is an empty block? */
+        if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+        && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
         {
-          orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
+          /* Uses default */
+          bUseDefault = orxTRUE;
 
-          /* Inits vector depth */
-          s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
+          /* Updates arg pointer */
+          zArg++;
+          pcSrc++;
+        }
+        else
+        {
+          /* Updates block status */
+          bInBlock = orxTRUE;
+        }
+      }
+
+      /* Stores its type */
+      _astArgList[u32ArgNumber].eType = _pstCommand->astParamList[u32ArgNumber].eType;
 
-          /* Gets arg's beginning */
-          zArg = pcSrc;
+      /* Depending on its type */
+      switch(_pstCommand->astParamList[u32ArgNumber].eType)
+      {
+        case orxCOMMAND_VAR_TYPE_NUMERIC:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Replaces block end marker with 0 */
+            pcSrc--;
+            zArg--;
+            *((orxCHAR *)pcSrc) = '0';
 
-          /* Is a block marker? */
-          if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+            /* Fall through */
+          }
+          /* Not in block? */
+          else if(bInBlock == orxFALSE)
           {
-            /* Updates arg pointer */
-            zArg++;
-            pcSrc++;
+            orxVECTOR vValue;
 
-            /* Is an empty block? */
-            if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-            && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
+            /* Is a vector */
+            if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
             {
-              /* Uses default */
-              bUseDefault = orxTRUE;
+              /* Stores its value */
+              _astArgList[u32ArgNumber].zValue = zArg;
 
-              /* Updates arg pointer */
-              zArg++;
-              pcSrc++;
+              /* Stops */
+              break;
             }
             else
             {
-              /* Updates block status */
-              bInBlock = orxTRUE;
+              /* Fall through */
             }
           }
+        }
 
-          /* Stores its type */
-          astArgList[u32ArgNumber].eType = pstCommand->astParamList[u32ArgNumber].eType;
-
-          /* Depending on its type */
-          switch(pstCommand->astParamList[u32ArgNumber].eType)
+        default:
+        case orxCOMMAND_VAR_TYPE_STRING:
+        {
+          /* For all argument characters */
+          for(; *pcSrc != orxCHAR_NULL; pcSrc++)
           {
-            case orxCOMMAND_VAR_TYPE_NUMERIC:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Replaces block end marker with 0 */
-                pcSrc--;
-                zArg--;
-                *((orxCHAR *)pcSrc) = '0';
+            orxCHAR *pcTemp;
 
-                /* Fall through */
-              }
-              /* Not in block? */
-              else if(bInBlock == orxFALSE)
+            /* Depending on character */
+            switch(*pcSrc)
+            {
+              case orxSTRING_KC_VECTOR_START:
+              case orxSTRING_KC_VECTOR_START_ALT:
               {
-                orxVECTOR vValue;
-
-                /* Is a vector */
-                if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
-                {
-                  /* Stores its value */
-                  astArgList[u32ArgNumber].zValue = zArg;
-
-                  /* Stops */
-                  break;
-                }
-                else
+                /* Should update? */
+                if(s32VectorDepth >= 0)
                 {
-                  /* Fall through */
+                  /* Increments vector depth */
+                  s32VectorDepth++;
                 }
+                break;
               }
-            }
 
-            default:
-            case orxCOMMAND_VAR_TYPE_STRING:
-            {
-              /* For all argument characters */
-              for(; *pcSrc != orxCHAR_NULL; pcSrc++)
+              case orxSTRING_KC_VECTOR_END:
+              case orxSTRING_KC_VECTOR_END_ALT:
               {
-                orxCHAR *pcTemp;
-
-                /* Depending on character */
-                switch(*pcSrc)
+                /* Should update? */
+                if(s32VectorDepth >= 0)
                 {
-                  case orxSTRING_KC_VECTOR_START:
-                  case orxSTRING_KC_VECTOR_START_ALT:
-                  {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Increments vector depth */
-                      s32VectorDepth++;
-                    }
-                    break;
-                  }
-
-                  case orxSTRING_KC_VECTOR_END:
-                  case orxSTRING_KC_VECTOR_END_ALT:
-                  {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Decrements vector depth */
-                      s32VectorDepth--;
-                    }
-                    break;
-                  }
-
-                  case orxCOMMAND_KC_BLOCK_MARKER:
-                  {
-                    /* Erases it */
-                    for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
-                    {
-                      *pcTemp = *(pcTemp + 1);
-                    }
-
-                    /* Not double marker? */
-                    if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
-                    {
-                      /* Updates block status */
-                      bInBlock = !bInBlock;
-
-                      /* Handles current character in new mode */
-                      pcSrc--;
-                    }
-                    continue;
-                  }
-                  default:
-                  {
-                    break;
-                  }
+                  /* Decrements vector depth */
+                  s32VectorDepth--;
                 }
+                break;
+              }
 
-                /* Not in block or in vector? */
-                if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
+              case orxCOMMAND_KC_BLOCK_MARKER:
+              {
+                /* Erases it */
+                for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
                 {
-                  /* End of string? */
-                  if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
-                  {
-                    /* Stops */
-                    break;
-                  }
+                  *pcTemp = *(pcTemp + 1);
                 }
-              }
 
-              /* Stores its value */
-              astArgList[u32ArgNumber].zValue = zArg;
-
-              break;
-            }
+                /* Not double marker? */
+                if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
+                {
+                  /* Updates block status */
+                  bInBlock = !bInBlock;
 
-            case orxCOMMAND_VAR_TYPE_FLOAT:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].fValue = orxFLOAT_0;
+                  /* Handles current character in new mode */
+                  pcSrc--;
+                }
+                continue;
               }
-              else
+              default:
               {
-                /* Gets its value */
-                eStatus = orxString_ToFloat(zArg, &(astArgList[u32ArgNumber].fValue), &pcSrc);
+                break;
               }
-
-              break;
             }
 
-            case orxCOMMAND_VAR_TYPE_S32:
+            /* Not in block or in vector? */
+            if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s32Value = 0;
-              }
-              else
+              /* End of string? */
+              if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
               {
-                /* Gets its value */
-                eStatus = orxString_ToS32(zArg, &(astArgList[u32ArgNumber].s32Value), &pcSrc);
+                /* Stops */
+                break;
               }
-
-              break;
             }
+          }
 
-            case orxCOMMAND_VAR_TYPE_U32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU32(zArg, &(astArgList[u32ArgNumber].u32Value), &pcSrc);
-              }
-
-              break;
-            }
+          /* Stores its value */
+          _astArgList[u32ArgNumber].zValue = zArg;
 
-            case orxCOMMAND_VAR_TYPE_S64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS64(zArg, &(astArgList[u32ArgNumber].s64Value), &pcSrc);
-              }
+          break;
+        }
 
-              break;
-            }
+        case orxCOMMAND_VAR_TYPE_FLOAT:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].fValue = orxFLOAT_0;
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToFloat(zArg, &(_astArgList[u32ArgNumber].fValue), &pcSrc);
+          }
 
-            case orxCOMMAND_VAR_TYPE_U64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU64(zArg, &(astArgList[u32ArgNumber].u64Value), &pcSrc);
-              }
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_S32:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].s32Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToS32(zArg, &(_astArgList[u32ArgNumber].s32Value), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_U32:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].u32Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToU32(zArg, &(_astArgList[u32ArgNumber].u32Value), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_S64:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].s64Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToS64(zArg, &(_astArgList[u32ArgNumber].s64Value), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_U64:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].u64Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToU64(zArg, &(_astArgList[u32ArgNumber].u64Value), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_BOOL:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].bValue = orxFALSE;
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToBool(zArg, &(_astArgList[u32ArgNumber].bValue), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_VECTOR:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            orxVector_Copy(&(_astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
+          }
+          else
+          {
+            /* Gets its value */
+            eStatus = orxString_ToVector(zArg, &(_astArgList[u32ArgNumber].vValue), &pcSrc);
+          }
+
+          break;
+        }
+      }
+
+      /* Interrupted? */
+      if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
+      {
+        /* Updates argument count */
+        u32ArgNumber++;
+
+        /* Stops processing */
+        break;
+      }
+      else
+      {
+        /* Ends current argument */
+        *(orxCHAR *)pcSrc = orxCHAR_NULL;
+      }
+    }
+    else
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Stores argument count */
+  *_pu32ArgNumber = u32ArgNumber;
+
+  /* Done! */
+  return eStatus;
+}
+
+/** Checks parsed arguments
+ */
+static orxINLINE orxBOOL orxCommand_CheckArguments(const orxCOMMAND *_pstCommand, orxSTATUS _eStatus, orxU32 _u32ArgNumber, const orxSTRING _zCommandLine, orxBOOL _bLog)
+{
+  orxBOOL bResult;
+
+  /* Error? */
+  if((_eStatus == orxSTATUS_FAILURE) || (_u32ArgNumber < (orxU32)_pstCommand->u16RequiredParamNumber))
+  {
+    /* Should log? */
+    if(_bLog != orxFALSE)
+    {
+      /* Incorrect parameter? */
+      if(_eStatus == orxSTATUS_FAILURE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, _u32ArgNumber, orxString_GetFromID(_pstCommand->stNameID));
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], expected %d[+%d] arguments for command [%s], found %d.", _zCommandLine, (orxU32)_pstCommand->u16RequiredParamNumber, (orxU32)_pstCommand->u16OptionalParamNumber, orxString_GetFromID(_pstCommand->stNameID), _u32ArgNumber);
+      }
+    }
+
+    /* Updates result */
+    bResult = orxFALSE;
+  }
+  else
+  {
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Parses expanded arguments from the process buffer and runs a command
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_ParseAndRun(const orxCOMMAND *_pstCommand, orxS32 _s32Offset, orxCOMMAND_VAR *_pstResult, const orxSTRING _zCommandLine)
+{
+  orxSTATUS       eStatus;
+  orxU32          u32ArgNumber, u32ParamNumber = (orxU32)_pstCommand->u16RequiredParamNumber + (orxU32)_pstCommand->u16OptionalParamNumber;
+  orxCOMMAND_VAR *pstResult = orxNULL;
+
+#ifdef __orxMSVC__
+
+  orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca(u32ParamNumber * sizeof(orxCOMMAND_VAR));
+
+#else /* __orxMSVC__ */
+
+  orxCOMMAND_VAR astArgList[u32ParamNumber];
+
+#endif /* __orxMSVC__ */
+
+  /* Parses arguments */
+  eStatus = orxCommand_ParseArguments(_pstCommand, sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset, astArgList, &u32ArgNumber);
+
+  /* Valid? */
+  if(orxCommand_CheckArguments(_pstCommand, eStatus, u32ArgNumber, _zCommandLine, orxTRUE) != orxFALSE)
+  {
+    /* Runs it */
+    sstCommand.s32ProcessOffset += _s32Offset;
+    pstResult = orxCommand_RunCommand(_pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+    sstCommand.s32ProcessOffset -= _s32Offset;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Pushes a result on the stack
+ */
+static void orxFASTCALL orxCommand_PushResult(const orxCOMMAND_VAR *_pstResult, orxU32 _u32PushCount)
+{
+  /* For all requested pushes */
+  while(_u32PushCount > 0)
+  {
+    orxCOMMAND_STACK_ENTRY *pstEntry;
+
+    /* Allocates stack entry */
+    pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+
+    /* Checks */
+    orxASSERT(pstEntry != orxNULL);
+
+    /* Is a string or numeric value? */
+    if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
+    || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+    {
+      /* Checks */
+      orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+
+      /* Duplicates it */
+      pstEntry->stValue.eType   = _pstResult->eType;
+      pstEntry->stValue.zValue  = pstEntry->acBuffer;
+      orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, sizeof(pstEntry->acBuffer) - 1);
+      pstEntry->acBuffer[sizeof(pstEntry->acBuffer) - 1] = orxCHAR_NULL;
+    }
+    else
+    {
+      /* Stores value */
+      orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+    }
+
+    /* Updates push count */
+    _u32PushCount--;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the beginning of the next command in a command line
+ */
+static orxINLINE const orxCHAR *orxCommand_GetCommandStart(const orxCHAR *_pcCommand, orxU32 *_pu32PushCount, const orxCHAR **_ppcCommandEnd)
+{
+  const orxCHAR  *pcResult, *pcCommandEnd;
+  orxU32          u32PushCount;
+
+  /* For all push markers / spaces */
+  for(u32PushCount = 0, pcResult = _pcCommand; (*pcResult == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*pcResult) != orxFALSE); pcResult++)
+  {
+    /* Is a push marker? */
+    if(*pcResult == orxCOMMAND_KC_PUSH_MARKER)
+    {
+      /* Updates push count */
+      u32PushCount++;
+    }
+  }
+
+  /* Finds end of command */
+  for(pcCommandEnd = pcResult + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
+    ;
+
+  /* Stores values */
+  *_pu32PushCount = u32PushCount;
+  *_ppcCommandEnd = pcCommandEnd;
+
+  /* Done! */
+  return pcResult;
+}
+
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  const orxSTRING zCommand;
+  orxBOOL         bProcessed = orxFALSE;
+  orxCOMMAND_VAR *pstResult = orxNULL;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_Process");
+
+  /* Gets start of command */
+  zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
+
+  /* For all commands */
+  while(*zCommand != orxCHAR_NULL)
+  {
+    orxU32          u32PushCount;
+    const orxCHAR  *pcCommandEnd;
+    orxCOMMAND     *pstCommand;
+    orxCHAR         cBackupChar;
+
+    /* Updates status */
+    bProcessed = orxTRUE;
+
+    /* Gets command's boundaries */
+    zCommand = orxCommand_GetCommandStart(zCommand, &u32PushCount, &pcCommandEnd);
+
+    /* Ends command */
+    cBackupChar               = *pcCommandEnd;
+    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+
+    /* Gets it */
+    pstCommand = orxCommand_FindNoAlias(zCommand);
+
+    /* Found? */
+    if(pstCommand != orxNULL)
+    {
+      orxS32                s32GUIDLength, s32BufferCount, s32Offset;
+      orxCHAR              *pcDst;
+      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+      orxCHAR               acGUID[20];
+
+      /* Is GUID valid? */
+      if(_u64GUID != orxU64_UNDEFINED)
+      {
+        /* Gets owner's GUID */
+        s32GUIDLength = orxString_NPrint(acGUID, sizeof(acGUID), "0x%016llX", _u64GUID);
+      }
+      else
+      {
+        /* No GUID */
+        s32GUIDLength = 0;
+      }
+
+      /* Gets argument buffers */
+      s32BufferCount = orxCommand_GetArgumentBufferList(zCommand, pcCommandEnd, azBufferList);
+
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Expands arguments */
+      pcDst     = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset;
+      zCommand  = orxCommand_ExpandArguments(azBufferList, s32BufferCount, acGUID, s32GUIDLength, orxTRUE, &pcDst, orxNULL, _zCommandLine);
+
+      /* Gets new additional offset */
+      s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+
+      /* Updates next command expression */
+      zCommand = orxString_SkipWhiteSpaces(zCommand);
+
+      /* Parses arguments and runs command */
+      if(orxCommand_ParseAndRun(pstCommand, s32Offset, _pstResult, _zCommandLine) != orxNULL)
+      {
+        /* Updates result */
+        pstResult = _pstResult;
+      }
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Not silent? */
+      if(_bSilent == orxFALSE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+      }
+
+      /* Stops */
+      zCommand = orxSTRING_EMPTY;
+    }
+
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Stores error */
+      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+    }
+
+    /* Pushes result */
+    orxCommand_PushResult(_pstResult, u32PushCount);
+  }
+
+  /* Unprocessed? */
+  if(bProcessed == orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Releases a compiled command line
+ */
+static orxINLINE void orxCommand_ReleaseCompiled(orxCOMMAND_COMPILED *_pstCompiled)
+{
+  /* Checks */
+  orxASSERT(_pstCompiled->u32RefCount > 0);
+
+  /* Updates ref count */
+  _pstCompiled->u32RefCount--;
+
+  /* Not referenced anymore? */
+  if(_pstCompiled->u32RefCount == 0)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstCompiled);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Compiles a command line: resolves commands & aliases and pre-parses arguments that don't depend on GUID/stack
+ */
+static orxCOMMAND_COMPILED *orxFASTCALL orxCommand_CompileLine(const orxSTRING _zCommandLine, orxSTRINGID _stID)
+{
+  orxCOMMAND_STATEMENT  astStatementList[orxCOMMAND_KU32_COMPILED_STATEMENT_NUMBER];
+  const orxCHAR        *apcTextList[orxCOMMAND_KU32_COMPILED_STATEMENT_NUMBER];
+  orxCOMMAND_VAR        astArgList[orxCOMMAND_KU32_COMPILED_ARG_NUMBER];
+  const orxCHAR        *pcCommand;
+  orxCHAR              *pcDst;
+  orxU32                u32StatementNumber = 0, u32ArgNumber = 0, u32TextSize = 0, u32LineSize;
+  orxBOOL               bValid = orxTRUE;
+  orxCOMMAND_COMPILED  *pstResult;
+
+  /* Stores a working copy of the command line */
+  orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine);
+
+  /* Gets start of command */
+  pcCommand = orxString_SkipWhiteSpaces(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset);
+
+  /* For all commands */
+  for(pcDst = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset;
+      (bValid != orxFALSE) && (*pcCommand != orxCHAR_NULL);
+      u32StatementNumber++)
+  {
+    orxCOMMAND_STATEMENT *pstStatement;
+    const orxCHAR        *pcCommandEnd;
+    orxCOMMAND           *pstCommand;
+    orxCHAR               cBackupChar;
+
+    /* Too many commands? */
+    if(u32StatementNumber >= orxCOMMAND_KU32_COMPILED_STATEMENT_NUMBER)
+    {
+      /* Updates status */
+      bValid = orxFALSE;
+
+      break;
+    }
+
+    /* Gets statement */
+    pstStatement = &astStatementList[u32StatementNumber];
+
+    /* Gets command's boundaries */
+    pcCommand = orxCommand_GetCommandStart(pcCommand, &(pstStatement->u32PushCount), &pcCommandEnd);
+
+    /* Ends command */
+    cBackupChar               = *pcCommandEnd;
+    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+
+    /* Gets it */
+    pstCommand = orxCommand_FindNoAlias(pcCommand);
+
+    /* Found? */
+    if(pstCommand != orxNULL)
+    {
+      orxCHAR        *pcArgs;
+      const orxSTRING azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+      orxS32          s32BufferCount;
+      orxU32          u32ArgSize, u32ParamNumber;
+      orxBOOL         bDynamic = orxFALSE;
+
+      /* Gets argument buffers */
+      s32BufferCount = orxCommand_GetArgumentBufferList(pcCommand, pcCommandEnd, azBufferList);
+
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Expands arguments, without substitution */
+      pcArgs    = pcDst;
+      pcCommand = orxString_SkipWhiteSpaces(orxCommand_ExpandArguments(azBufferList, s32BufferCount, orxNULL, 0, orxFALSE, &pcDst, &bDynamic, _zCommandLine));
+      pcDst++;
+
+      /* Gets sizes */
+      u32ArgSize      = (orxU32)(pcDst - pcArgs);
+      u32ParamNumber  = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
+
+      /* Inits statement */
+      pstStatement->pstCommand    = pstCommand;
+      pstStatement->pcArgs        = orxNULL;
+      pstStatement->astArgList    = orxNULL;
+      pstStatement->u32ArgNumber  = 0;
+
+      /* Not enough room left? */
+      if((orxU32)(pcDst - sstCommand.acProcessBuffer) + u32ArgSize >= orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2)
+      {
+        /* Updates status */
+        bValid = orxFALSE;
+      }
+      /* Independent from GUID/stack and has room for its arguments? */
+      else if((bDynamic == orxFALSE) && (u32ArgNumber + u32ParamNumber <= orxCOMMAND_KU32_COMPILED_ARG_NUMBER))
+      {
+        orxSTATUS eStatus;
+        orxU32    u32StatementArgNumber;
+
+        /* Parses a copy of the arguments */
+        orxMemory_Copy(pcDst, pcArgs, u32ArgSize);
+        eStatus = orxCommand_ParseArguments(pstCommand, pcDst, &astArgList[u32ArgNumber], &u32StatementArgNumber);
+
+        /* Valid? */
+        if(orxCommand_CheckArguments(pstCommand, eStatus, u32StatementArgNumber, _zCommandLine, orxFALSE) != orxFALSE)
+        {
+          /* Stores arguments */
+          pstStatement->astArgList    = &astArgList[u32ArgNumber];
+          pstStatement->u32ArgNumber  = u32StatementArgNumber;
+          apcTextList[u32StatementNumber] = pcDst;
+          u32ArgNumber               += u32StatementArgNumber;
+          pcDst                      += u32ArgSize;
+        }
+      }
+
+      /* Valid but not pre-parsed? */
+      if((bValid != orxFALSE) && (pstStatement->astArgList == orxNULL))
+      {
+        /* Keeps expanded arguments for later */
+        pstStatement->pcArgs            = pcArgs;
+        apcTextList[u32StatementNumber] = pcArgs;
+      }
+
+      /* Updates text size */
+      u32TextSize += u32ArgSize;
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Updates status */
+      bValid = orxFALSE;
+    }
+  }
 
-              break;
-            }
+  /* Nothing compiled? */
+  if((bValid == orxFALSE) || (u32StatementNumber == 0))
+  {
+    /* Clears statements */
+    u32StatementNumber  = 0;
+    u32ArgNumber        = 0;
+    u32TextSize         = 0;
+  }
 
-            case orxCOMMAND_VAR_TYPE_BOOL:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].bValue = orxFALSE;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToBool(zArg, &(astArgList[u32ArgNumber].bValue), &pcSrc);
-              }
+  /* Gets command line size */
+  u32LineSize = orxString_GetLength(_zCommandLine) + 1;
 
-              break;
-            }
+  /* Allocates compiled command line */
+  pstResult = (orxCOMMAND_COMPILED *)orxMemory_Allocate(sizeof(orxCOMMAND_COMPILED) + (u32ArgNumber * sizeof(orxCOMMAND_VAR)) + (u32StatementNumber * sizeof(orxCOMMAND_STATEMENT)) + u32TextSize + u32LineSize, orxMEMORY_TYPE_MAIN);
 
-            case orxCOMMAND_VAR_TYPE_VECTOR:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                orxVector_Copy(&(astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToVector(zArg, &(astArgList[u32ArgNumber].vValue), &pcSrc);
-              }
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    orxCOMMAND_VAR *astCompiledArgList;
+    orxCHAR        *pcText;
+    orxU32          i;
+
+    /* Inits it */
+    astCompiledArgList              = (orxCOMMAND_VAR *)(pstResult + 1);
+    pstResult->astStatementList     = (orxCOMMAND_STATEMENT *)(astCompiledArgList + u32ArgNumber);
+    pcText                          = (orxCHAR *)(pstResult->astStatementList + u32StatementNumber);
+    pstResult->stID                 = _stID;
+    pstResult->u32StatementNumber   = u32StatementNumber;
+    pstResult->u32Generation        = sstCommand.u32Generation;
+    pstResult->u32RefCount          = 1;
+
+    /* For all statements */
+    for(i = 0; i < u32StatementNumber; i++)
+    {
+      orxCOMMAND_STATEMENT *pstStatement;
+      orxU32                u32Size;
 
-              break;
-            }
-          }
+      /* Gets statement */
+      pstStatement = &(pstResult->astStatementList[i]);
 
-          /* Interrupted? */
-          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
-          {
-            /* Updates argument count */
-            u32ArgNumber++;
+      /* Copies it */
+      orxMemory_Copy(pstStatement, &astStatementList[i], sizeof(orxCOMMAND_STATEMENT));
 
-            /* Stops processing */
-            break;
-          }
-          else
+      /* Pre-parsed? */
+      if(pstStatement->astArgList != orxNULL)
+      {
+        orxU32 j;
+
+        /* Gets text size (arguments are only terminated by the last null character) */
+        for(u32Size = 0, j = 0; j < pstStatement->u32ArgNumber; j++)
+        {
+          /* Is a string? */
+          if((pstStatement->astArgList[j].eType == orxCOMMAND_VAR_TYPE_STRING)
+          || (pstStatement->astArgList[j].eType == orxCOMMAND_VAR_TYPE_NUMERIC))
           {
-            /* Ends current argument */
-            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+            /* Updates size */
+            u32Size = orxMAX(u32Size, (orxU32)(pstStatement->astArgList[j].zValue - apcTextList[i]) + orxString_GetLength(pstStatement->astArgList[j].zValue) + 1);
           }
         }
-        else
-        {
-          /* Stops */
-          break;
-        }
-      }
 
-      /* Error? */
-      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
-      {
-        /* Incorrect parameter? */
-        if(eStatus == orxSTATUS_FAILURE)
-        {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, u32ArgNumber, orxString_GetFromID(pstCommand->stNameID));
-        }
-        else
+        /* Copies arguments */
+        orxMemory_Copy(astCompiledArgList, pstStatement->astArgList, pstStatement->u32ArgNumber * sizeof(orxCOMMAND_VAR));
+        pstStatement->astArgList = astCompiledArgList;
+
+        /* For all arguments */
+        for(j = 0; j < pstStatement->u32ArgNumber; j++)
         {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], expected %d[+%d] arguments for command [%s], found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, orxString_GetFromID(pstCommand->stNameID), u32ArgNumber);
+          /* Is a string? */
+          if((astCompiledArgList[j].eType == orxCOMMAND_VAR_TYPE_STRING)
+          || (astCompiledArgList[j].eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+          {
+            /* Relocates it */
+            astCompiledArgList[j].zValue = pcText + (astCompiledArgList[j].zValue - apcTextList[i]);
+          }
         }
+
+        /* Updates argument pointer */
+        astCompiledArgList += pstStatement->u32ArgNumber;
       }
       else
       {
-        /* Runs it */
-        sstCommand.s32ProcessOffset += s32Offset;
-        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
-        sstCommand.s32ProcessOffset -= s32Offset;
+        /* Gets text size */
+        u32Size = orxString_GetLength(apcTextList[i]) + 1;
+
+        /* Relocates expanded arguments */
+        pstStatement->pcArgs = pcText;
       }
+
+      /* Copies text */
+      orxMemory_Copy(pcText, apcTextList[i], u32Size);
+
+      /* Updates text pointer */
+      pcText += u32Size;
     }
-    else
+
+    /* Stores command line */
+    orxMemory_Copy(pcText, _zCommandLine, u32LineSize);
+    pstResult->zCommandLine = pcText;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a compiled command line from the cache, compiling it if needed
+ */
+static orxCOMMAND_COMPILED *orxFASTCALL orxCommand_GetCompiled(const orxSTRING _zCommandLine, orxBOOL _bCreate)
+{
+  orxSTRINGID           stID;
+  orxCOMMAND_COMPILED  *pstResult;
+
+  /* Gets its ID */
+  stID = orxString_Hash(_zCommandLine);
+
+  /* Gets cached version */
+  pstResult = (orxCOMMAND_COMPILED *)orxHashTable_Get(sstCommand.pstCompiledTable, stID);
+
+  /* Found? */
+  if(pstResult != orxNULL)
+  {
+    /* Hash collision? */
+    if(orxString_Compare(pstResult->zCommandLine, _zCommandLine) != 0)
     {
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
+      /* Ignores it */
+      pstResult = orxNULL;
+    }
+    /* Outdated? */
+    else if(pstResult->u32Generation != sstCommand.u32Generation)
+    {
+      orxCOMMAND_COMPILED *pstCompiled;
 
-      /* Not silent? */
-      if(_bSilent == orxFALSE)
+      /* Compiles it again */
+      pstCompiled = orxCommand_CompileLine(_zCommandLine, stID);
+
+      /* Success? */
+      if(pstCompiled != orxNULL)
       {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+        /* Replaces it in cache */
+        orxHashTable_Set(sstCommand.pstCompiledTable, stID, pstCompiled);
+
+        /* Releases old version */
+        orxCommand_ReleaseCompiled(pstResult);
       }
 
-      /* Stops */
-      zCommand = orxSTRING_EMPTY;
+      /* Updates result */
+      pstResult = pstCompiled;
     }
+  }
+  /* Should create it? */
+  else if(_bCreate != orxFALSE)
+  {
+    /* Compiles it */
+    pstResult = orxCommand_CompileLine(_zCommandLine, stID);
 
-    /* Failure? */
-    if(pstResult == orxNULL)
+    /* Success? */
+    if(pstResult != orxNULL)
     {
-      /* Stores error */
-      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
-      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+      /* Adds it to cache */
+      if(orxHashTable_Add(sstCommand.pstCompiledTable, stID, pstResult) == orxSTATUS_FAILURE)
+      {
+        /* Deletes it */
+        orxCommand_ReleaseCompiled(pstResult);
+        pstResult = orxNULL;
+      }
     }
+  }
 
-    /* For all requested pushes */
-    while(u32PushCount > 0)
-    {
-      orxCOMMAND_STACK_ENTRY *pstEntry;
+  /* Done! */
+  return pstResult;
+}
 
-      /* Allocates stack entry */
-      pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+/** Runs a compiled command line
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_RunCompiled(orxCOMMAND_COMPILED *_pstCompiled, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  orxCOMMAND_VAR *pstResult = orxNULL;
 
-      /* Checks */
-      orxASSERT(pstEntry != orxNULL);
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_Run");
 
-      /* Is a string or numeric value? */
-      if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
-      || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
-      {
-        /* Checks */
-        orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+  /* Holds it while running */
+  _pstCompiled->u32RefCount++;
+
+  /* Not compiled? */
+  if(_pstCompiled->u32StatementNumber == 0)
+  {
+    orxS32 s32Offset;
+
+    /* Stores it in buffer */
+    s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _pstCompiled->zCommandLine) + 1;
+    sstCommand.s32EvaluateOffset += s32Offset;
+
+    /* Processes it */
+    pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, _bSilent);
+
+    /* Restores buffer offset */
+    sstCommand.s32EvaluateOffset -= s32Offset;
+  }
+  else
+  {
+    orxU32 i;
+
+    /* For all statements */
+    for(i = 0; i < _pstCompiled->u32StatementNumber; i++)
+    {
+      const orxCOMMAND_STATEMENT *pstStatement;
+
+      /* Gets statement */
+      pstStatement = &(_pstCompiled->astStatementList[i]);
 
-        /* Duplicates it */
-        pstEntry->stValue.eType   = _pstResult->eType;
-        pstEntry->stValue.zValue  = pstEntry->acBuffer;
-        orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, sizeof(pstEntry->acBuffer) - 1);
-        pstEntry->acBuffer[sizeof(pstEntry->acBuffer) - 1] = orxCHAR_NULL;
+      /* Pre-parsed? */
+      if(pstStatement->astArgList != orxNULL)
+      {
+        /* Runs it */
+        pstResult = orxCommand_RunCommand(pstStatement->pstCommand, orxFALSE, pstStatement->u32ArgNumber, pstStatement->astArgList, _pstResult);
       }
       else
       {
-        /* Stores value */
-        orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+        orxS32          s32GUIDLength, s32Offset;
+        orxCHAR        *pcDst;
+        const orxSTRING azBufferList[1];
+        orxCHAR         acGUID[20];
+
+        /* Is GUID valid? */
+        if(_u64GUID != orxU64_UNDEFINED)
+        {
+          /* Gets owner's GUID */
+          s32GUIDLength = orxString_NPrint(acGUID, sizeof(acGUID), "0x%016llX", _u64GUID);
+        }
+        else
+        {
+          /* No GUID */
+          s32GUIDLength = 0;
+        }
+
+        /* Expands arguments */
+        azBufferList[0] = pstStatement->pcArgs;
+        pcDst           = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset;
+        orxCommand_ExpandArguments(azBufferList, 1, acGUID, s32GUIDLength, orxTRUE, &pcDst, orxNULL, _pstCompiled->zCommandLine);
+
+        /* Gets new additional offset */
+        s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+
+        /* Parses arguments and runs command */
+        if(orxCommand_ParseAndRun(pstStatement->pstCommand, s32Offset, _pstResult, _pstCompiled->zCommandLine) != orxNULL)
+        {
+          /* Updates result */
+          pstResult = _pstResult;
+        }
+      }
+
+      /* Failure? */
+      if(pstResult == orxNULL)
+      {
+        /* Stores error */
+        _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+        _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
       }
 
-      /* Updates push count */
-      u32PushCount--;
+      /* Pushes result */
+      orxCommand_PushResult(_pstResult, pstStatement->u32PushCount);
     }
   }
 
-  /* Unprocessed? */
-  if(bProcessed == orxFALSE)
-  {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
-  }
+  /* Releases it */
+  orxCommand_ReleaseCompiled(_pstCompiled);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -1153,6 +1748,41 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
   return pstResult;
 }
 
+/** Evaluates a command line, using the compiled command cache when possible
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateCached(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  orxCOMMAND_COMPILED  *pstCompiled;
+  orxCOMMAND_VAR       *pstResult;
+
+  /* Gets compiled version (only caches new command lines when there's room left) */
+  pstCompiled = orxCommand_GetCompiled(_zCommandLine, (orxHashTable_GetCount(sstCommand.pstCompiledTable) < orxCOMMAND_KU32_COMPILED_MAX_COUNT) ? orxTRUE : orxFALSE);
+
+  /* Success? */
+  if(pstCompiled != orxNULL)
+  {
+    /* Runs it */
+    pstResult = orxCommand_RunCompiled(pstCompiled, _u64GUID, _pstResult, _bSilent);
+  }
+  else
+  {
+    orxS32 s32Offset;
+
+    /* Stores it in buffer */
+    s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine) + 1;
+    sstCommand.s32EvaluateOffset += s32Offset;
+
+    /* Processes it */
+    pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, _bSilent);
+
+    /* Restores buffer offset */
+    sstCommand.s32EvaluateOffset -= s32Offset;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -1178,8 +1808,8 @@ static orxSTATUS orxFASTCALL orxCommand_EventHandler(const orxEVENT *_pstEvent)
           /* Gets payload */
           pstPayload = (orxTIMELINE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
-          /* Processes command */
-          orxCommand_Process(pstPayload->zEvent, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+          /* Evaluates command */
+          orxCommand_EvaluateCached(pstPayload->zEvent, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
 
           break;
         }
@@ -1207,8 +1837,8 @@ static orxSTATUS orxFASTCALL orxCommand_EventHandler(const orxEVENT *_pstEvent)
           /* Gets payload */
           pstPayload = (orxANIM_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
-          /* Processes command */
-          orxCommand_Process(pstPayload->stCustom.zName, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+          /* Evaluates command */
+          orxCommand_EvaluateCached(pstPayload->stCustom.zName, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
 
           break;
         }
@@ -2748,6 +3378,31 @@ void orxFASTCALL orxCommand_CommandLogAllStructures(orxU32 _u32ArgNumber, const
   return;
 }
 
+/** Command: EnableProfilerTrace
+ */
+void orxFASTCALL orxCommand_CommandEnableProfilerTrace(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Enables/disables trace */
+  orxProfiler_EnableTrace((_u32ArgNumber > 0) ? _astArgList[0].bValue : orxTRUE);
+
+  /* Updates result */
+  _pstResult->bValue = orxProfiler_IsTraceEnabled();
+
+  /* Done! */
+  return;
+}
+
+/** Command: ExportProfilerTrace
+ */
+void orxFASTCALL orxCommand_CommandExportProfilerTrace(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxProfiler_ExportTrace(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
 /** Command: GetClipboard
  */
 void orxFASTCALL orxCommand_CommandGetClipboard(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
@@ -2894,6 +3549,11 @@ static orxINLINE void orxCommand_RegisterCommands()
   /* Command: LogAllStructures */
   orxCOMMAND_REGISTER_CORE_COMMAND(Command, LogAllStructures, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Private = false", orxCOMMAND_VAR_TYPE_STRING});
 
+  /* Command: EnableProfilerTrace */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, EnableProfilerTrace, "Enabled?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Enable = true", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: ExportProfilerTrace */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, ExportProfilerTrace, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
+
   /* Command: GetClipboard */
   orxCOMMAND_REGISTER_CORE_COMMAND(Command, GetClipboard, "Content", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
   /* Command: SetClipboard */
@@ -3076,6 +3736,11 @@ static orxINLINE void orxCommand_RegisterCommands()
   /* Alias: Structure.LogAll */
   orxCommand_AddAlias("Structure.LogAll", "Command.LogAllStructures", orxNULL);
 
+  /* Alias: Profiler.EnableTrace */
+  orxCommand_AddAlias("Profiler.EnableTrace", "Command.EnableProfilerTrace", orxNULL);
+  /* Alias: Profiler.ExportTrace */
+  orxCommand_AddAlias("Profiler.ExportTrace", "Command.ExportProfilerTrace", orxNULL);
+
   /* Alias: Clipboard.Get */
   orxCommand_AddAlias("Clipboard.Get", "Command.GetClipboard", orxNULL);
   /* Alias: Clipboard.Set */
@@ -3266,6 +3931,11 @@ static orxINLINE void orxCommand_UnregisterCommands()
   /* Alias: Structure.LogAll */
   orxCommand_RemoveAlias("Structure.LogAll");
 
+  /* Alias: Profiler.EnableTrace */
+  orxCommand_RemoveAlias("Profiler.EnableTrace");
+  /* Alias: Profiler.ExportTrace */
+  orxCommand_RemoveAlias("Profiler.ExportTrace");
+
   /* Alias: Clipboard.Get */
   orxCommand_RemoveAlias("Clipboard.Get");
   /* Alias: Clipboard.Set */
@@ -3391,6 +4061,11 @@ static orxINLINE void orxCommand_UnregisterCommands()
   /* Command: LogAllStructures */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, LogAllStructures);
 
+  /* Command: EnableProfilerTrace */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, EnableProfilerTrace);
+  /* Command: ExportProfilerTrace */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, ExportProfilerTrace);
+
   /* Command: GetClipboard */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, GetClipboard);
   /* Command: SetClipboard */
@@ -3447,8 +4122,11 @@ orxSTATUS orxFASTCALL orxCommand_Init()
       sstCommand.pstTrieBank    = orxBank_Create(orxCOMMAND_KU32_TRIE_BANK_SIZE, sizeof(orxCOMMAND_TRIE_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
       sstCommand.pstResultBank  = orxBank_Create(orxCOMMAND_KU32_RESULT_BANK_SIZE, sizeof(orxCOMMAND_STACK_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates compiled command table */
+      sstCommand.pstCompiledTable = orxHashTable_Create(orxCOMMAND_KU32_COMPILED_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_MAIN);
+
       /* Valid? */
-      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL))
+      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL) && (sstCommand.pstCompiledTable != orxNULL))
       {
         orxCOMMAND_TRIE_NODE *pstTrieRoot;
 
@@ -3496,6 +4174,9 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxBank_Delete(sstCommand.pstTrieBank);
           orxBank_Delete(sstCommand.pstResultBank);
 
+          /* Deletes compiled command table */
+          orxHashTable_Delete(sstCommand.pstCompiledTable);
+
           /* Logs message */
           orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Failed to create command trie.");
         }
@@ -3516,6 +4197,13 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxBank_Delete(sstCommand.pstBank);
         }
 
+        /* Partly initialized? */
+        if(sstCommand.pstCompiledTable != orxNULL)
+        {
+          /* Deletes compiled command table */
+          orxHashTable_Delete(sstCommand.pstCompiledTable);
+        }
+
         /* Removes event handler */
         orxEvent_RemoveHandler(orxEVENT_TYPE_TIMELINE, orxCommand_EventHandler);
         orxEvent_RemoveHandler(orxEVENT_TYPE_ANIM, orxCommand_EventHandler);
@@ -3554,7 +4242,21 @@ void orxFASTCALL orxCommand_Exit()
   /* Initialized? */
   if(sstCommand.u32Flags & orxCOMMAND_KU32_STATIC_FLAG_READY)
   {
-    orxCOMMAND *pstCommand;
+    orxCOMMAND           *pstCommand;
+    orxCOMMAND_COMPILED  *pstCompiled;
+    orxHANDLE             hIterator;
+
+    /* For all compiled commands */
+    for(hIterator = orxHashTable_GetNext(sstCommand.pstCompiledTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstCompiled);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(sstCommand.pstCompiledTable, hIterator, orxNULL, (void **)&pstCompiled))
+    {
+      /* Releases it */
+      orxCommand_ReleaseCompiled(pstCompiled);
+    }
+
+    /* Deletes compiled command table */
+    orxHashTable_Delete(sstCommand.pstCompiledTable);
 
     /* Unregisters commands */
     orxCommand_UnregisterCommands();
@@ -3669,6 +4371,9 @@ orxSTATUS orxFASTCALL orxCommand_Register(const orxSTRING _zCommand, const orxCO
         /* Inserts in trie */
         orxCommand_InsertInTrie(pstCommand);
 
+        /* Updates generation */
+        sstCommand.u32Generation++;
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -3720,6 +4425,9 @@ orxSTATUS orxFASTCALL orxCommand_Unregister(const orxSTRING _zCommand)
       /* Deletes it */
       orxBank_Free(sstCommand.pstBank, pstCommand);
 
+      /* Updates generation */
+      sstCommand.u32Generation++;
+
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
     }
@@ -3865,6 +4573,9 @@ orxSTATUS orxFASTCALL orxCommand_AddAlias(const orxSTRING _zAlias, const orxSTRI
             /* Updates aliased name */
             pstAliasNode->pstCommand->zAliasedCommandName = orxString_Duplicate(_zCommand);
             pstAliasNode->pstCommand->zArgs               = (_zArgs != orxNULL) ? orxString_Duplicate(_zArgs) : orxNULL;
+
+            /* Updates generation */
+            sstCommand.u32Generation++;
           }
         }
         else
@@ -3930,6 +4641,9 @@ orxSTATUS orxFASTCALL orxCommand_RemoveAlias(const orxSTRING _zAlias)
         /* Removes its reference */
         pstNode->pstCommand = orxNULL;
 
+        /* Updates generation */
+        sstCommand.u32Generation++;
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -4251,17 +4965,89 @@ extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateWithGUID(const o
   /* Valid? */
   if((_zCommandLine != orxNULL) && (*_zCommandLine != orxCHAR_NULL))
   {
-    orxS32 s32Offset;
+    /* Evaluates it */
+    pstResult = orxCommand_EvaluateCached(_zCommandLine, _u64GUID, _pstResult, orxFALSE);
+  }
 
-    /* Stores it in buffer */
-    s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine) + 1;
-    sstCommand.s32EvaluateOffset += s32Offset;
+  /* Done! */
+  return pstResult;
+}
 
-    /* Processes it */
-    pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, orxFALSE);
+/** Compiles a command line: resolves its commands & aliases and pre-parses its constant arguments, the result is cached until commands or aliases change
+* @param[in]   _zCommandLine  Command name + arguments
+* @return      Compiled command line ID if successful, orxSTRINGID_UNDEFINED otherwise
+*/
+orxSTRINGID orxFASTCALL orxCommand_Compile(const orxSTRING _zCommandLine)
+{
+  orxSTRINGID stResult = orxSTRINGID_UNDEFINED;
 
-    /* Restores buffer offset */
-    sstCommand.s32EvaluateOffset -= s32Offset;
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_READY));
+
+  /* Valid? */
+  if((_zCommandLine != orxNULL) && (*_zCommandLine != orxCHAR_NULL))
+  {
+    orxCOMMAND_COMPILED *pstCompiled;
+
+    /* Gets compiled version */
+    pstCompiled = orxCommand_GetCompiled(_zCommandLine, orxTRUE);
+
+    /* Success? */
+    if((pstCompiled != orxNULL) && (pstCompiled->u32StatementNumber != 0))
+    {
+      /* Updates result */
+      stResult = pstCompiled->stID;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't compile command line [%s].", _zCommandLine);
+    }
+  }
+
+  /* Done! */
+  return stResult;
+}
+
+/** Runs a compiled command line
+* @param[in]   _stCompiledID  Compiled command line ID, as returned by orxCommand_Compile
+* @param[in]   _u64GUID       GUID to use in place of the GUID markers in the command, orxU64_UNDEFINED for none
+* @param[out]  _pstResult     Variable that will contain the result
+* @return      Command result if found, orxNULL otherwise
+*/
+orxCOMMAND_VAR *orxFASTCALL orxCommand_Run(orxSTRINGID _stCompiledID, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult)
+{
+  orxCOMMAND_COMPILED  *pstCompiled;
+  orxCOMMAND_VAR       *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstResult != orxNULL);
+
+  /* Gets compiled version */
+  pstCompiled = (orxCOMMAND_COMPILED *)orxHashTable_Get(sstCommand.pstCompiledTable, _stCompiledID);
+
+  /* Found? */
+  if(pstCompiled != orxNULL)
+  {
+    /* Outdated? */
+    if(pstCompiled->u32Generation != sstCommand.u32Generation)
+    {
+      /* Compiles it again */
+      pstCompiled = orxCommand_GetCompiled(pstCompiled->zCommandLine, orxTRUE);
+    }
+
+    /* Valid? */
+    if(pstCompiled != orxNULL)
+    {
+      /* Runs it */
+      pstResult = orxCommand_RunCompiled(pstCompiled, _u64GUID, _pstResult, orxFALSE);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't run compiled command line <0x%016llX>: not found.", _stCompiledID);
   }
 
   /* Done! */
@@ -4301,7 +5087,7 @@ orxCOMMAND_VAR *orxFASTCALL orxCommand_Execute(const orxSTRING _zCommand, orxU32
       if(pstCommandNode->pstCommand->bIsAlias == orxFALSE)
       {
         /* Runs it */
-        pstResult = orxCommand_Run(pstCommandNode->pstCommand, orxTRUE, _u32ArgNumber, _astArgList, _pstResult);
+        pstResult = orxCommand_RunCommand(pstCommandNode->pstCommand, orxTRUE, _u32ArgNumber, _astArgList, _pstResult);
       }
       else
       {
@@ -92,6 +92,8 @@
 #define orxCONFIG_KU32_SECTION_BANK_SIZE          2048        /**< Default section bank size */
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            16384       /**< Default entry bank size */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          32          /**< Default history bank size */
+#define orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD      16          /**< Entry count from which a section gets indexed */
+#define orxCONFIG_KU32_ENTRY_INDEX_MIN_SIZE       32          /**< Entry index minimal size (power of two) */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 #define orxCONFIG_KU32_STACK_SIZE                 64          /**< Section stack size */
 
@@ -319,6 +321,8 @@ typedef struct __orxCONFIG_SECTION_t
   orxLINKLIST       stEntryList;            /**< Entry list : 32 */
   orxS32            s32ProtectionCount;     /**< Protection count : 36 */
   orxSTRINGID       stOriginID;             /**< Origin : 40 */
+  orxCONFIG_ENTRY **apstEntryIndex;         /**< Entry index (open addressing) : 44 */
+  orxU32            u32EntryIndexSize;      /**< Entry index size : 48 */
 
 } orxCONFIG_SECTION;
 
@@ -333,6 +337,7 @@ typedef struct __orxCONFIG_STATIC_t
   orxU32              u32Flags;             /**< Control flags */
   orxSTRINGID         stResourceGroupID;    /**< Resource group ID */
   orxU32              u32LoadCount;         /**< Load count */
+  orxU32              u32Revision;          /**< Revision, incremented on any value, section or parent change */
   orxSTRING           zEncryptionKey;       /**< Encryption key */
   orxCONFIG_BOOTSTRAP_FUNCTION pfnBootstrap;/**< Bootstrap */
   orxSTRINGID         stLoadFileID;         /**< Loading file ID */
@@ -664,17 +669,183 @@ static orxINLINE void orxConfig_CleanValue(orxCONFIG_VALUE *_pstValue)
   return;
 }
 
+/** Inserts an entry in its section's index, which is expected to have room for it
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to insert
+ */
+static orxINLINE void orxConfig_InsertIndexEntry(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  orxU32 u32Mask, i;
+
+  /* Checks */
+  orxASSERT(_pstSection->apstEntryIndex != orxNULL);
+
+  /* Gets mask */
+  u32Mask = _pstSection->u32EntryIndexSize - 1;
+
+  /* Finds first free slot (key IDs are already hashes) */
+  for(i = (orxU32)_pstEntry->stID & u32Mask; _pstSection->apstEntryIndex[i] != orxNULL; i = (i + 1) & u32Mask);
+
+  /* Stores entry */
+  _pstSection->apstEntryIndex[i] = _pstEntry;
+
+  /* Done! */
+  return;
+}
+
+/** (Re)Builds a section's entry index
+ * @param[in] _pstSection       Concerned section
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxConfig_BuildEntryIndex(orxCONFIG_SECTION *_pstSection)
+{
+  orxCONFIG_ENTRY **apstEntryIndex;
+  orxU32            u32Size;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
+
+  /* Gets size, keeping load factor under one half */
+  for(u32Size = orxCONFIG_KU32_ENTRY_INDEX_MIN_SIZE; u32Size < 2 * (orxLinkList_GetCount(&(_pstSection->stEntryList)) + 1); u32Size <<= 1);
+
+  /* Allocates index */
+  apstEntryIndex = (orxCONFIG_ENTRY **)orxMemory_Allocate(u32Size * sizeof(orxCONFIG_ENTRY *), orxMEMORY_TYPE_CONFIG);
+
+  /* Deletes previous index */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    orxMemory_Free(_pstSection->apstEntryIndex);
+  }
+
+  /* Success? */
+  if(apstEntryIndex != orxNULL)
+  {
+    orxCONFIG_ENTRY *pstEntry;
+
+    /* Clears it */
+    orxMemory_Zero(apstEntryIndex, u32Size * sizeof(orxCONFIG_ENTRY *));
+
+    /* Stores it */
+    _pstSection->apstEntryIndex     = apstEntryIndex;
+    _pstSection->u32EntryIndexSize  = u32Size;
+
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Inserts it */
+      orxConfig_InsertIndexEntry(_pstSection, pstEntry);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Couldn't allocate entry index for section [%s], using linear search.", _pstSection->zName);
+
+    /* Falls back to linear search */
+    _pstSection->apstEntryIndex     = orxNULL;
+    _pstSection->u32EntryIndexSize  = 0;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds an entry, already part of its section's list, to the section's index, if any
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to add
+ */
+static orxINLINE void orxConfig_AddIndexEntry(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  /* Is indexed? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    /* Too crowded? */
+    if(2 * orxLinkList_GetCount(&(_pstSection->stEntryList)) > _pstSection->u32EntryIndexSize)
+    {
+      /* Rebuilds index */
+      orxConfig_BuildEntryIndex(_pstSection);
+    }
+    else
+    {
+      /* Inserts entry */
+      orxConfig_InsertIndexEntry(_pstSection, _pstEntry);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Removes an entry from its section's index, if any
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to remove
+ */
+static orxINLINE void orxConfig_RemoveIndexEntry(orxCONFIG_SECTION *_pstSection, const orxCONFIG_ENTRY *_pstEntry)
+{
+  /* Is indexed? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    orxU32 u32Mask, i, j;
+
+    /* Gets mask */
+    u32Mask = _pstSection->u32EntryIndexSize - 1;
+
+    /* Finds entry */
+    for(i = (orxU32)_pstEntry->stID & u32Mask; _pstSection->apstEntryIndex[i] != _pstEntry; i = (i + 1) & u32Mask)
+    {
+      /* Checks */
+      orxASSERT(_pstSection->apstEntryIndex[i] != orxNULL);
+    }
+
+    /* For all following entries of the cluster */
+    for(j = (i + 1) & u32Mask; _pstSection->apstEntryIndex[j] != orxNULL; j = (j + 1) & u32Mask)
+    {
+      /* Is hole between its home slot and its current slot? */
+      if(((j - ((orxU32)_pstSection->apstEntryIndex[j]->stID & u32Mask)) & u32Mask) >= ((j - i) & u32Mask))
+      {
+        /* Moves it back to the hole */
+        _pstSection->apstEntryIndex[i] = _pstSection->apstEntryIndex[j];
+        i = j;
+      }
+    }
+
+    /* Clears last hole */
+    _pstSection->apstEntryIndex[i] = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes an entry
  * @param[in] _pstEntry         Entry to delete
  */
 static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
 {
+  orxLINKLIST *pstList;
+
   /* Checks */
   orxASSERT(_pstEntry != orxNULL);
 
+  /* Updates revision */
+  sstConfig.u32Revision++;
+
   /* Deletes value */
   orxConfig_CleanValue(&(_pstEntry->stValue));
 
+  /* Gets its list */
+  pstList = orxLinkList_GetList(&(_pstEntry->stNode));
+
+  /* Valid? */
+  if(pstList != orxNULL)
+  {
+    /* Removes it from its section's index */
+    orxConfig_RemoveIndexEntry(orxSTRUCT_GET_FROM_FIELD(orxCONFIG_SECTION, stEntryList, pstList), _pstEntry);
+  }
+
   /* Removes it from list */
   orxLinkList_Remove(&(_pstEntry->stNode));
 
@@ -1323,29 +1494,103 @@ static orxINLINE void orxConfig_CryptBuffer(orxCHAR *_acBuffer, orxU32 _u32Buffe
   return;
 }
 
+/** Reads a chunk of a config resource, either from its mapped content or through orxResource_Read
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _pu8Map           Mapped content, orxNULL if not mapped
+ * @param[in] _s64MapSize       Mapped content size
+ * @param[in,out] _ps64Offset   Current offset in the mapped content
+ * @param[in] _u32Size          Size to read
+ * @param[out] _acBuffer        Destination buffer
+ * @return Size of the read data, in bytes
+ */
+static orxINLINE orxU32 orxConfig_ReadChunk(orxHANDLE _hResource, const orxU8 *_pu8Map, orxS64 _s64MapSize, orxS64 *_ps64Offset, orxU32 _u32Size, orxCHAR *_acBuffer)
+{
+  orxU32 u32Result;
+
+  /* Mapped? */
+  if(_pu8Map != orxNULL)
+  {
+    /* Gets available size */
+    u32Result = (orxU32)orxMIN((orxS64)_u32Size, _s64MapSize - *_ps64Offset);
+
+    /* Copies it (the parser works in place) */
+    orxMemory_Copy(_acBuffer, _pu8Map + *_ps64Offset, u32Result);
+
+    /* Updates offset */
+    *_ps64Offset += (orxS64)u32Result;
+  }
+  else
+  {
+    /* Reads it */
+    u32Result = (orxU32)orxResource_Read(_hResource, (orxS64)_u32Size, _acBuffer, orxNULL, orxNULL);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Gets an entry from the current section
  * @param[in] _stKeyID          Entry key ID
  * @return                      orxCONFIG_ENTRY / orxNULL
  */
 static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxSTRINGID _stKeyID)
 {
-  orxCONFIG_ENTRY *pstResult = orxNULL, *pstEntry;
+  orxCONFIG_SECTION  *pstSection;
+  orxCONFIG_ENTRY    *pstResult = orxNULL;
 
   /* Checks */
   orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* For all entries */
-  for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  /* Gets current section */
+  pstSection = sstConfig.pstCurrentSection;
+
+  /* Should be indexed? */
+  if((pstSection->apstEntryIndex == orxNULL)
+  && (orxLinkList_GetCount(&(pstSection->stEntryList)) >= orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD))
   {
-    /* Found? */
-    if(_stKeyID == pstEntry->stID)
+    /* Builds its index */
+    orxConfig_BuildEntryIndex(pstSection);
+  }
+
+  /* Is indexed? */
+  if(pstSection->apstEntryIndex != orxNULL)
+  {
+    orxCONFIG_ENTRY  *pstEntry;
+    orxU32            u32Mask, i;
+
+    /* Gets mask */
+    u32Mask = pstSection->u32EntryIndexSize - 1;
+
+    /* For all slots in probe sequence */
+    for(i = (orxU32)_stKeyID & u32Mask; (pstEntry = pstSection->apstEntryIndex[i]) != orxNULL; i = (i + 1) & u32Mask)
     {
-      /* Updates result */
-      pstResult = pstEntry;
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
 
-      break;
+        break;
+      }
+    }
+  }
+  else
+  {
+    orxCONFIG_ENTRY *pstEntry;
+
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
+
+        break;
+      }
     }
   }
 
@@ -1658,6 +1903,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
   orxASSERT(_zValue != orxNULL);
   orxASSERT((_bBlockMode && _bAppend) == orxFALSE);
 
+  /* Updates revision */
+  sstConfig.u32Revision++;
+
   /* Valid? */
   if(_zKey != orxSTRING_EMPTY)
   {
@@ -1735,6 +1983,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
 
           /* Sets its ID */
           pstEntry->stID = stKeyID;
+
+          /* Adds it to index */
+          orxConfig_AddIndexEntry(sstConfig.pstCurrentSection, pstEntry);
         }
 
         /* Inits its type */
@@ -1751,6 +2002,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
           /* Reusing entry? */
           if(bReuse != orxFALSE)
           {
+            /* Removes it from index */
+            orxConfig_RemoveIndexEntry(sstConfig.pstCurrentSection, pstEntry);
+
             /* Removes it from list */
             orxLinkList_Remove(&(pstEntry->stNode));
           }
@@ -1777,6 +2031,9 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
 {
   orxCONFIG_SECTION *pstSection;
 
+  /* Updates revision */
+  sstConfig.u32Revision++;
+
   /* Allocates it */
   pstSection = (orxCONFIG_SECTION *)orxBank_Allocate(sstConfig.pstSectionBank);
 
@@ -1786,8 +2043,10 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
     /* Creates origin */
     pstSection->stOriginID = sstConfig.stLoadFileID;
 
-    /* Clears its entry list */
+    /* Clears its entry list & index */
     orxMemory_Zero(&(pstSection->stEntryList), sizeof(orxLINKLIST));
+    pstSection->apstEntryIndex    = orxNULL;
+    pstSection->u32EntryIndexSize = 0;
 
     /* Adds it to list */
     orxMemory_Zero(&(pstSection->stNode), sizeof(orxLINKLIST_NODE));
@@ -1837,6 +2096,9 @@ static orxINLINE orxSTATUS orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSectio
   {
     orxCONFIG_ENTRY *pstNewEntry, *pstLastEntry;
 
+    /* Updates revision */
+    sstConfig.u32Revision++;
+
     /* For all entries */
     for(pstLastEntry = orxNULL, pstNewEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
         pstNewEntry != orxNULL;
@@ -1913,6 +2175,13 @@ static orxINLINE orxSTATUS orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSectio
         /* Removes it from table */
         orxHashTable_Remove(sstConfig.pstSectionTable, orxString_Hash(_pstSection->zName));
 
+        /* Has index? */
+        if(_pstSection->apstEntryIndex != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(_pstSection->apstEntryIndex);
+        }
+
         /* Removes section */
         orxBank_Free(sstConfig.pstSectionBank, _pstSection);
 
@@ -3644,6 +3913,9 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
 
           /* Updates parent ID */
           pstSection->pstParent = pstParent;
+
+          /* Updates revision */
+          sstConfig.u32Revision++;
         }
       }
     }
@@ -4712,6 +4984,8 @@ void orxFASTCALL orxConfig_Exit()
   /* Initialized? */
   if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY))
   {
+    orxCONFIG_SECTION *pstSection;
+
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxConfig_EventHandler);
 
@@ -4724,6 +4998,20 @@ void orxFASTCALL orxConfig_Exit()
     /* Clears all data */
     orxConfig_Clear(orxNULL);
 
+    /* For all remaining sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* Has index? */
+      if(pstSection->apstEntryIndex != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstSection->apstEntryIndex);
+        pstSection->apstEntryIndex = orxNULL;
+      }
+    }
+
     /* Clears section list */
     orxLinkList_Clean(&(sstConfig.stSectionList));
 
@@ -4947,6 +5235,8 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
   {
     orxCHAR             acBuffer[orxCONFIG_KU32_BUFFER_SIZE], *pcPreviousEncryptionChar;
+    const orxU8        *pu8Map;
+    orxS64              s64MapSize, s64MapOffset = 0;
     orxU32              u32Size, u32Offset;
     orxBOOL             bUseEncryption = orxFALSE, bFirstTime;
     orxCONFIG_SECTION  *pstPreviousSection;
@@ -4960,10 +5250,13 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
     /* Reinits current encryption character */
     sstConfig.pcEncryptionChar = sstConfig.zEncryptionKey;
 
+    /* Maps file content, if supported */
+    pu8Map = (const orxU8 *)orxResource_Map(hResource, &s64MapSize);
+
     /* While file isn't empty */
-    for(u32Size = (orxU32)orxResource_Read(hResource, orxCONFIG_KU32_BUFFER_SIZE, acBuffer, orxNULL, orxNULL), u32Offset = 0, bFirstTime = orxTRUE;
+    for(u32Size = orxConfig_ReadChunk(hResource, pu8Map, s64MapSize, &s64MapOffset, orxCONFIG_KU32_BUFFER_SIZE, acBuffer), u32Offset = 0, bFirstTime = orxTRUE;
         u32Size > 0;
-        u32Size = (orxU32)orxResource_Read(hResource, (orxS64)(orxCONFIG_KU32_BUFFER_SIZE - u32Offset), acBuffer + u32Offset, orxNULL, orxNULL) + u32Offset, bFirstTime = orxFALSE)
+        u32Size = orxConfig_ReadChunk(hResource, pu8Map, s64MapSize, &s64MapOffset, orxCONFIG_KU32_BUFFER_SIZE - u32Offset, acBuffer + u32Offset) + u32Offset, bFirstTime = orxFALSE)
     {
       /* First time? */
       if(bFirstTime != orxFALSE)
@@ -5057,7 +5350,7 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
     /* Restores previous encryption character */
     sstConfig.pcEncryptionChar = pcPreviousEncryptionChar;
 
-    /* Closes file */
+    /* Closes file (and releases its mapping) */
     orxResource_Close(hResource);
   }
   else
@@ -5763,6 +6056,9 @@ orxSTATUS orxFASTCALL orxConfig_RenameSection(const orxSTRING _zSectionName, con
         /* Stores it */
         pstSection->zName = zNewName;
 
+        /* Updates revision */
+        sstConfig.u32Revision++;
+
         /* Removes it from table */
         orxHashTable_Remove(sstConfig.pstSectionTable, stID);
 
@@ -5825,6 +6121,9 @@ orxSTATUS orxFASTCALL orxConfig_SetParent(const orxSTRING _zSectionName, const o
   /* Success? */
   if(eResult != orxSTATUS_FAILURE)
   {
+    /* Updates revision */
+    sstConfig.u32Revision++;
+
     /* Already has a parent? */
     if((sstConfig.pstCurrentSection->pstParent != orxNULL) && (sstConfig.pstCurrentSection->pstParent != orxHANDLE_UNDEFINED))
     {
@@ -5929,6 +6228,9 @@ orxSTATUS orxFASTCALL orxConfig_SetDefaultParent(const orxSTRING _zSectionName)
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
 
+  /* Updates revision */
+  sstConfig.u32Revision++;
+
   /* Has current default parent? */
   if(sstConfig.pstDefaultSection != orxNULL)
   {
@@ -5995,6 +6297,19 @@ const orxSTRING orxFASTCALL orxConfig_GetDefaultParent()
   return zResult;
 }
 
+/** Gets config revision, incremented whenever a value, a section or a parent is added, modified or removed. Can be used to
+ * validate data derived from config without having to re-read it.
+ * @return Current revision
+ */
+orxU32 orxFASTCALL orxConfig_GetRevision()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Done! */
+  return sstConfig.u32Revision;
+}
+
 /** Gets current working section
  * @return Current selected section
  */
@@ -54,6 +54,8 @@
 #define orxEVENT_KU32_HANDLER_TABLE_SIZE  64
 #define orxEVENT_KU32_HANDLER_BANK_SIZE   32
 #define orxEVENT_KU32_STORAGE_BANK_SIZE   32
+#define orxEVENT_KU32_ID_NUMBER           32
+#define orxEVENT_KU32_DIRECT_TYPE_NUMBER  ((orxU32)orxEVENT_TYPE_USER_DEFINED + 256) /**< Types below this value are directly indexed, the others go through the hash table */
 
 
 /***************************************************************************
@@ -71,13 +73,27 @@ typedef struct __orxEVENT_HANDLER_INFO_t
 
 } orxEVENT_HANDLER_INFO;
 
+/** Event dispatch entry structure
+ */
+typedef struct __orxEVENT_DISPATCH_ENTRY_t
+{
+  orxEVENT_HANDLER        pfnHandler;
+  void                   *pContext;
+  orxEVENT_HANDLER_INFO  *pstInfo;
+
+} orxEVENT_DISPATCH_ENTRY;
+
 /** Event handler storage
  */
 typedef struct __orxEVENT_HANDLER_STORAGE_t
 {
-  orxU8       au8HandledIDList[32];
-  orxLINKLIST stList;
-  orxBANK    *pstBank;
+  orxU32                    au32DispatchIndexList[orxEVENT_KU32_ID_NUMBER + 1]; /**< First dispatch entry of each ID (the last one is the end marker) */
+  orxEVENT_DISPATCH_ENTRY  *astDispatchList;          /**< Compiled handlers, sorted by ID */
+  orxU32                    u32DispatchSize;          /**< Dispatch list capacity */
+  orxU32                    u32SendCount;             /**< Sends in progress (main thread only) */
+  orxBOOL                   bDirty;                   /**< Dispatch list needs to be compiled */
+  orxLINKLIST               stList;
+  orxBANK                  *pstBank;
 
 } orxEVENT_HANDLER_STORAGE;
 
@@ -89,7 +105,7 @@ typedef struct __orxEVENT_STATIC_t
   orxS32                    s32EventSendCount;        /**< Event send count */
   orxHASHTABLE             *pstHandlerStorageTable;   /**< Handler storage table */
   orxBANK                  *pstHandlerStorageBank;    /**< Handler storage bank */
-  orxEVENT_HANDLER_STORAGE *astCoreHandlerStorageList[orxEVENT_TYPE_CORE_NUMBER]; /**< Core handler storage list */
+  orxEVENT_HANDLER_STORAGE *apstHandlerStorageList[orxEVENT_KU32_DIRECT_TYPE_NUMBER]; /**< Directly indexed handler storage list */
 
 } orxEVENT_STATIC;
 
@@ -105,6 +121,183 @@ static orxEVENT_STATIC sstEvent;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Gets the handler storage of an event type
+ * @param[in] _eEventType           Concerned type of event
+ * @return orxEVENT_HANDLER_STORAGE / orxNULL
+ */
+static orxINLINE orxEVENT_HANDLER_STORAGE *orxEvent_GetStorage(orxEVENT_TYPE _eEventType)
+{
+  orxEVENT_HANDLER_STORAGE *pstResult;
+
+  /* Updates result */
+  pstResult = ((orxU32)_eEventType < orxEVENT_KU32_DIRECT_TYPE_NUMBER) ? sstEvent.apstHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Disables the compiled dispatch entries of a handler
+ * @param[in] _pstStorage           Concerned storage
+ * @param[in] _pstInfo              Concerned handler info
+ * @param[in] _u32IDFlags           ID flags for which to disable the entries
+ */
+static orxINLINE void orxEvent_DisableDispatchEntries(orxEVENT_HANDLER_STORAGE *_pstStorage, const orxEVENT_HANDLER_INFO *_pstInfo, orxU32 _u32IDFlags)
+{
+  orxU32 i;
+
+  /* Has a dispatch list? */
+  if(_pstStorage->astDispatchList != orxNULL)
+  {
+    /* For all IDs */
+    for(i = 0; i < orxEVENT_KU32_ID_NUMBER; i++)
+    {
+      /* Concerned? */
+      if(orxFLAG_TEST(_u32IDFlags, orxEVENT_GET_FLAG(i)))
+      {
+        orxU32 j;
+
+        /* For all its entries */
+        for(j = _pstStorage->au32DispatchIndexList[i]; j < _pstStorage->au32DispatchIndexList[i + 1]; j++)
+        {
+          /* Found? */
+          if(_pstStorage->astDispatchList[j].pstInfo == _pstInfo)
+          {
+            /* Disables it */
+            _pstStorage->astDispatchList[j].pfnHandler = orxNULL;
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Compiles the dispatch list of a storage, purging all handlers marked for deletion
+ * @param[in] _pstStorage           Concerned storage
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxEvent_CompileStorage(orxEVENT_HANDLER_STORAGE *_pstStorage)
+{
+  orxEVENT_HANDLER_INFO  *pstInfo, *pstNextInfo;
+  orxU32                  au32CursorList[orxEVENT_KU32_ID_NUMBER], u32Count = 0, i;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstStorage->u32SendCount == 0);
+
+  /* Clears cursors */
+  orxMemory_Zero(au32CursorList, sizeof(au32CursorList));
+
+  /* For all handlers */
+  for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+      pstInfo != orxNULL;
+      pstInfo = pstNextInfo)
+  {
+    /* Gets next info */
+    pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
+
+    /* Marked for deletion? */
+    if(pstInfo->pfnHandler == orxNULL)
+    {
+      /* Removes it from list */
+      orxLinkList_Remove(&(pstInfo->stNode));
+
+      /* Frees it */
+      orxBank_Free(_pstStorage->pstBank, pstInfo);
+    }
+    else
+    {
+      /* For all IDs */
+      for(i = 0; i < orxEVENT_KU32_ID_NUMBER; i++)
+      {
+        /* Handled? */
+        if(orxFLAG_TEST(pstInfo->u32IDFlags, orxEVENT_GET_FLAG(i)))
+        {
+          /* Updates counts */
+          au32CursorList[i]++;
+          u32Count++;
+        }
+      }
+    }
+  }
+
+  /* Needs more room? */
+  if(u32Count > _pstStorage->u32DispatchSize)
+  {
+    orxEVENT_DISPATCH_ENTRY *astNewList;
+
+    /* Grows list */
+    astNewList = (orxEVENT_DISPATCH_ENTRY *)orxMemory_Reallocate(_pstStorage->astDispatchList, u32Count * sizeof(orxEVENT_DISPATCH_ENTRY), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(astNewList != orxNULL)
+    {
+      /* Stores it */
+      _pstStorage->astDispatchList  = astNewList;
+      _pstStorage->u32DispatchSize  = u32Count;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't allocate event dispatch list of size <%u>.", u32Count);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* For all IDs */
+    for(i = 0, u32Count = 0; i < orxEVENT_KU32_ID_NUMBER; i++)
+    {
+      orxU32 u32IDCount;
+
+      /* Stores its first entry */
+      u32IDCount                                = au32CursorList[i];
+      _pstStorage->au32DispatchIndexList[i]     = u32Count;
+      au32CursorList[i]                         = u32Count;
+      u32Count                                 += u32IDCount;
+    }
+
+    /* Stores end marker */
+    _pstStorage->au32DispatchIndexList[orxEVENT_KU32_ID_NUMBER] = u32Count;
+
+    /* For all handlers */
+    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+        pstInfo != orxNULL;
+        pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+    {
+      /* For all IDs */
+      for(i = 0; i < orxEVENT_KU32_ID_NUMBER; i++)
+      {
+        /* Handled? */
+        if(orxFLAG_TEST(pstInfo->u32IDFlags, orxEVENT_GET_FLAG(i)))
+        {
+          orxEVENT_DISPATCH_ENTRY *pstEntry;
+
+          /* Gets its entry, keeping registration order */
+          pstEntry = &(_pstStorage->astDispatchList[au32CursorList[i]++]);
+
+          /* Inits it */
+          pstEntry->pfnHandler  = pstInfo->pfnHandler;
+          pstEntry->pContext    = pstInfo->pContext;
+          pstEntry->pstInfo     = pstInfo;
+        }
+      }
+    }
+
+    /* Updates status */
+    _pstStorage->bDirty = orxFALSE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -208,6 +401,13 @@ void orxFASTCALL orxEvent_Exit()
     {
       /* Deletes its bank */
       orxBank_Delete(pstStorage->pstBank);
+
+      /* Has a dispatch list? */
+      if(pstStorage->astDispatchList != orxNULL)
+      {
+        /* Frees it */
+        orxMemory_Free(pstStorage->astDispatchList);
+      }
     }
 
     /* Deletes bank */
@@ -252,7 +452,7 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
   orxASSERT(_pfnEventHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+  pstStorage = orxEvent_GetStorage(_eEventType);
 
   /* No storage yet? */
   if(pstStorage == orxNULL)
@@ -275,11 +475,11 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
         /* Clears its list */
         orxMemory_Zero(&(pstStorage->stList), sizeof(orxLINKLIST));
 
-        /* Is a core event handler? */
-        if(_eEventType < orxEVENT_TYPE_CORE_NUMBER)
+        /* Is a directly indexed event type? */
+        if((orxU32)_eEventType < orxEVENT_KU32_DIRECT_TYPE_NUMBER)
         {
           /* Stores it */
-          sstEvent.astCoreHandlerStorageList[_eEventType] = pstStorage;
+          sstEvent.apstHandlerStorageList[_eEventType] = pstStorage;
         }
         else
         {
@@ -307,43 +507,30 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
   /* Valid? */
   if(pstStorage != orxNULL)
   {
-    orxEVENT_HANDLER_INFO *pstInfo, *pstNextInfo;
+    orxEVENT_HANDLER_INFO *pstInfo;
 
-    /* For all handlers */
-    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
-        pstInfo != orxNULL;
-        pstInfo = pstNextInfo)
+    /* Not dispatching and on main thread? */
+    if((pstStorage->u32SendCount == 0) && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
     {
-      /* Gets next info */
-      pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
+      orxEVENT_HANDLER_INFO *pstNextInfo;
 
-      /* Marked for deletion? */
-      if(pstInfo->pfnHandler == orxNULL)
+      /* For all handlers */
+      for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
+          pstInfo != orxNULL;
+          pstInfo = pstNextInfo)
       {
-        /* Removes it from list */
-        orxLinkList_Remove(&(pstInfo->stNode));
+        /* Gets next info */
+        pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
 
-        /* For all IDs */
-        for(orxU32 i = 0; i < 32; i++)
+        /* Marked for deletion? */
+        if(pstInfo->pfnHandler == orxNULL)
         {
-          orxU32 u32ID;
+          /* Removes it from list */
+          orxLinkList_Remove(&(pstInfo->stNode));
 
-          /* Gets it */
-          u32ID = (orxU32)(1 << i);
-
-          /* Should be removed? */
-          if(orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
-          {
-            /* Checks */
-            orxASSERT(pstStorage->au8HandledIDList[i] > 0);
-
-            /* Updates ID tracking */
-            pstStorage->au8HandledIDList[i]--;
-          }
+          /* Frees it */
+          orxBank_Free(pstStorage->pstBank, pstInfo);
         }
-
-        /* Frees it */
-        orxBank_Free(pstStorage->pstBank, pstInfo);
       }
     }
 
@@ -368,15 +555,8 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
       /* Adds it to the list */
       if(orxLinkList_AddEnd(&(pstStorage->stList), &(pstInfo->stNode)) != orxSTATUS_FAILURE)
       {
-        /* For all IDs */
-        for(orxU32 i = 0; i < 32; i++)
-        {
-          /* Checks */
-          orxASSERT(pstStorage->au8HandledIDList[i] < 255);
-
-          /* Updates ID tracking */
-          pstStorage->au8HandledIDList[i]++;
-        }
+        /* Marks dispatch list as dirty */
+        pstStorage->bDirty = orxTRUE;
 
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
@@ -425,7 +605,7 @@ orxSTATUS orxFASTCALL orxEvent_RemoveHandlerWithContext(orxEVENT_TYPE _eEventTyp
   orxASSERT(_pfnEventHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+  pstStorage = orxEvent_GetStorage(_eEventType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
@@ -443,9 +623,15 @@ orxSTATUS orxFASTCALL orxEvent_RemoveHandlerWithContext(orxEVENT_TYPE _eEventTyp
        || (_pContext == _pfnEventHandler)
        || (_pContext == pstInfo->pContext)))
       {
+        /* Disables its dispatch entries */
+        orxEvent_DisableDispatchEntries(pstStorage, pstInfo, pstInfo->u32IDFlags);
+
         /* Marks it for deletion */
         pstInfo->pfnHandler = orxNULL;
 
+        /* Marks dispatch list as dirty */
+        pstStorage->bDirty = orxTRUE;
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
 
@@ -486,7 +672,7 @@ orxSTATUS orxFASTCALL orxEvent_SetHandlerIDFlags(orxEVENT_HANDLER _pfnEventHandl
   orxASSERT(_pfnEventHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+  pstStorage = orxEvent_GetStorage(_eEventType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
@@ -503,41 +689,25 @@ orxSTATUS orxFASTCALL orxEvent_SetHandlerIDFlags(orxEVENT_HANDLER _pfnEventHandl
       && ((_pContext == orxNULL)
        || (_pContext == pstInfo->pContext)))
       {
-        /* For all IDs */
-        for(orxU32 i = 0; i < 32; i++)
-        {
-          orxU32 u32ID;
+        orxU32 u32IDFlags;
 
-          /* Gets it */
-          u32ID = (orxU32)(1 << i);
+        /* Gets new ID flags */
+        u32IDFlags = pstInfo->u32IDFlags;
+        orxFLAG_SET(u32IDFlags, _u32AddIDFlags, _u32RemoveIDFlags);
 
-          /* Should be removed? */
-          if(orxFLAG_TEST(_u32RemoveIDFlags, u32ID) && orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
-          {
-            /* Shouldn't be added back? */
-            if(!orxFLAG_TEST(_u32AddIDFlags, u32ID))
-            {
-              /* Checks */
-              orxASSERT(pstStorage->au8HandledIDList[i] > 0);
+        /* Changed? */
+        if(u32IDFlags != pstInfo->u32IDFlags)
+        {
+          /* Disables dispatch entries of removed IDs */
+          orxEvent_DisableDispatchEntries(pstStorage, pstInfo, pstInfo->u32IDFlags & ~u32IDFlags);
 
-              /* Updates ID tracking */
-              pstStorage->au8HandledIDList[i]--;
-            }
-          }
-          /* Should be added? */
-          else if(orxFLAG_TEST(_u32AddIDFlags, u32ID) && !orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
-          {
-            /* Checks */
-            orxASSERT(pstStorage->au8HandledIDList[i] < 255);
+          /* Updates its ID flags */
+          pstInfo->u32IDFlags = u32IDFlags;
 
-            /* Updates ID tracking */
-            pstStorage->au8HandledIDList[i]++;
-          }
+          /* Marks dispatch list as dirty */
+          pstStorage->bDirty = orxTRUE;
         }
 
-        /* Updates its ID flags */
-        orxFLAG_SET(pstInfo->u32IDFlags, _u32AddIDFlags, _u32RemoveIDFlags);
-
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -565,79 +735,103 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
   orxASSERT((_pstEvent->eID >= 0) && (_pstEvent->eID < 32));
 
   /* Gets corresponding storage */
-  pstStorage = (_pstEvent->eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_pstEvent->eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _pstEvent->eType);
+  pstStorage = orxEvent_GetStorage(_pstEvent->eType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
   {
-    /* Should handle this ID? */
-    if(pstStorage->au8HandledIDList[_pstEvent->eID] != 0)
+    orxU32  u32CurrentThread;
+    orxBOOL bMainThread;
+
+    /* Gets current thread */
+    u32CurrentThread  = orxThread_GetCurrent();
+    bMainThread       = (u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID) ? orxTRUE : orxFALSE;
+
+    /* Needs compiling and not dispatching from main thread yet? */
+    if((pstStorage->bDirty != orxFALSE) && (bMainThread != orxFALSE) && (pstStorage->u32SendCount == 0))
     {
-      orxEVENT_HANDLER_INFO  *pstInfo, *pstNextInfo;
-      orxU32                  u32IDFlag, u32CurrentThread;
+      /* Compiles it */
+      orxEvent_CompileStorage(pstStorage);
+    }
 
-      /* Get its ID flag */
-      u32IDFlag = orxEVENT_GET_FLAG(_pstEvent->eID);
+    /* Compiled and on main thread? (other threads never read the dispatch list as it can be reallocated by a main thread compilation) */
+    if((pstStorage->bDirty == orxFALSE) && (bMainThread != orxFALSE))
+    {
+      orxU32 u32Index, u32EndIndex;
 
-      /* Gets current thread */
-      u32CurrentThread = orxThread_GetCurrent();
+      /* Gets its dispatch range */
+      u32Index    = pstStorage->au32DispatchIndexList[_pstEvent->eID];
+      u32EndIndex = pstStorage->au32DispatchIndexList[_pstEvent->eID + 1];
 
-      /* Main thread? */
-      if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
+      /* Should handle this ID? */
+      if(u32Index != u32EndIndex)
       {
-        /* Updates event send count */
+        /* Updates send counts */
         sstEvent.s32EventSendCount++;
-      }
-
-      /* For all handlers */
-      for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
-          pstInfo != orxNULL;
-          pstInfo = pstNextInfo)
-      {
-        /* Gets next info */
-        pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
+        pstStorage->u32SendCount++;
 
-        /* Should process? */
-        if(orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
+        /* For all its entries */
+        for(; u32Index < u32EndIndex; u32Index++)
         {
-          /* Not marked for deletion? */
-          if(pstInfo->pfnHandler != orxNULL)
+          const orxEVENT_DISPATCH_ENTRY *pstEntry;
+
+          /* Gets it */
+          pstEntry = &(pstStorage->astDispatchList[u32Index]);
+
+          /* Not disabled? */
+          if(pstEntry->pfnHandler != orxNULL)
           {
             /* Stores context */
-            _pstEvent->pContext = pstInfo->pContext;
+            _pstEvent->pContext = pstEntry->pContext;
 
             /* Calls it */
-            eResult = (pstInfo->pfnHandler)(_pstEvent);
+            eResult = (pstEntry->pfnHandler)(_pstEvent);
+
+            /* Should stop? */
+            if(eResult == orxSTATUS_FAILURE)
+            {
+              break;
+            }
           }
+        }
 
-          /* Marked for deletion? */
-          if(pstInfo->pfnHandler == orxNULL)
-          {
-            /* Removes it from list */
-            orxLinkList_Remove(&(pstInfo->stNode));
+        /* Clears context */
+        _pstEvent->pContext = orxNULL;
 
-            /* For all IDs */
-            for(orxU32 i = 0; i < 32; i++)
-            {
-              orxU32 u32ID;
+        /* Updates send counts */
+        sstEvent.s32EventSendCount--;
+        pstStorage->u32SendCount--;
+      }
+    }
+    else
+    {
+      orxEVENT_HANDLER_INFO  *pstInfo;
+      orxU32                  u32IDFlag;
 
-              /* Gets it */
-              u32ID = (orxU32)(1 << i);
+      /* Get its ID flag */
+      u32IDFlag = orxEVENT_GET_FLAG(_pstEvent->eID);
 
-              /* Should be removed? */
-              if(orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
-              {
-                /* Checks */
-                orxASSERT(pstStorage->au8HandledIDList[i] > 0);
+      /* Main thread? */
+      if(bMainThread != orxFALSE)
+      {
+        /* Updates send counts */
+        sstEvent.s32EventSendCount++;
+        pstStorage->u32SendCount++;
+      }
 
-                /* Updates ID tracking */
-                pstStorage->au8HandledIDList[i]--;
-              }
-            }
+      /* For all handlers (handlers were modified during a dispatch, or sending from another thread) */
+      for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
+          pstInfo != orxNULL;
+          pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+      {
+        /* Should process and not marked for deletion? */
+        if(orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag) && (pstInfo->pfnHandler != orxNULL))
+        {
+          /* Stores context */
+          _pstEvent->pContext = pstInfo->pContext;
 
-            /* Frees it */
-            orxBank_Free(pstStorage->pstBank, pstInfo);
-          }
+          /* Calls it */
+          eResult = (pstInfo->pfnHandler)(_pstEvent);
 
           /* Should stop? */
           if(eResult == orxSTATUS_FAILURE)
@@ -651,10 +845,11 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
       _pstEvent->pContext = orxNULL;
 
       /* Main thread? */
-      if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
+      if(bMainThread != orxFALSE)
       {
-        /* Updates event send count */
+        /* Updates send counts */
         sstEvent.s32EventSendCount--;
+        pstStorage->u32SendCount--;
       }
     }
   }
@@ -37,6 +37,7 @@
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
+#include "core/orxSystem.h"
 #include "core/orxThread.h"
 #include "debug/orxProfiler.h"
 #include "io/orxFile.h"
@@ -50,6 +51,13 @@
 
 #include "main/android/orxAndroid.h"
 
+#elif defined(__orxLINUX__)
+
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+
 #endif /* __orxANDROID__ */
 
 /** Module flags
@@ -61,6 +69,9 @@
 #define orxRESOURCE_KU32_STATIC_FLAG_WATCH_SET        0x00000004                      /**< Watch set flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_NOTIFY_SET       0x00000008                      /**< Notify set flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_WATCH_REGISTERED 0x00000010                      /**< Watch registered flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY     0x00000020                      /**< Watch notify flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_QUEUE_REGISTERED 0x00000040                      /**< Queue registered flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFIED   0x00000080                      /**< Watch notified flag */
 
 #define orxRESOURCE_KU32_STATIC_MASK_ALL              0xFFFFFFFF                      /**< All mask */
 
@@ -80,15 +91,24 @@
 #define orxRESOURCE_KU32_WATCH_ITERATION_LIMIT        2                               /**< Watch iteration limit */
 #define orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED     -1                              /**< Watch time uninitialized */
 #define orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY       0.2                             /**< Watch notification delay */
+#define orxRESOURCE_KU32_WATCH_TABLE_SIZE             64                              /**< Watch (directory) table size */
+#define orxRESOURCE_KS32_WATCH_POLL_TIMEOUT           100                             /**< Watch poll timeout (ms) */
+#define orxRESOURCE_KF_WATCH_RETRY_DELAY              orx2F(0.01f)                    /**< Watch request retry delay */
+#define orxRESOURCE_KU32_WATCH_EVENT_BUFFER_SIZE      4096                            /**< Watch event buffer size */
 
 #define orxRESOURCE_KU32_BUFFER_SIZE                  256                             /**< Buffer size */
 
+#define orxRESOURCE_KU32_ARCHIVE_TABLE_SIZE           8                               /**< Archive table size */
+#define orxRESOURCE_KU32_ARCHIVE_PARALLEL_BLOCK_COUNT 2                               /**< Minimum number of whole blocks to decompress them on the thread pool */
+
 #define orxRESOURCE_KZ_CONFIG_SECTION                 "Resource"                      /**< Config section name */
 #define orxRESOURCE_KZ_CONFIG_WATCH_LIST              "WatchList"                     /**< Config watch list */
+#define orxRESOURCE_KZ_CONFIG_WATCH_NOTIFY            "WatchNotify"                   /**< Config watch notify */
 
 #define orxRESOURCE_KU32_REQUEST_LIST_SIZE            8192                            /**< Request list size */
 
 #define orxRESOURCE_KZ_THREAD_NAME                    "Resource"
+#define orxRESOURCE_KZ_WATCH_THREAD_NAME              "ResourceWatch"
 
 
 /***************************************************************************
@@ -135,6 +155,7 @@ typedef struct __orxRESOURCE_INFO_t
   orxSTRINGID               stStorageID;                                              /**< Storage ID */
   orxSTRINGID               stNameID;                                                 /**< Name ID */
   orxBOOL                   bPendingWatch;                                            /**< Pending watch */
+  orxBOOL                   bNotifiedWatch;                                           /**< Notified watch, time request not queued yet */
 
 } orxRESOURCE_INFO;
 
@@ -145,6 +166,8 @@ typedef struct __orxRESOURCE_OPEN_INFO_t
   orxRESOURCE_TYPE_INFO    *pstTypeInfo;                                              /**< Resource type info */
   orxHANDLE                 hResource;                                                /**< Resource handle */
   orxSTRING                 zLocation;                                                /**< Resource location */
+  const void               *pMap;                                                     /**< Mapped content */
+  orxS64                    s64MapSize;                                               /**< Mapped content size */
   volatile orxU32           u32OpCount;                                               /**< Operation count */
 
 } orxRESOURCE_OPEN_INFO;
@@ -157,6 +180,7 @@ typedef enum __orxRESOURCE_REQUEST_TYPE_t
   orxRESOURCE_REQUEST_TYPE_WRITE,
   orxRESOURCE_REQUEST_TYPE_CLOSE,
   orxRESOURCE_REQUEST_TYPE_GET_TIME,
+  orxRESOURCE_REQUEST_TYPE_WATCH_NOTIFY,
 
   orxRESOURCE_REQUEST_TYPE_NUMBER,
 
@@ -177,6 +201,60 @@ typedef struct __orxRESOURCE_REQUEST_t
 
 } orxRESOURCE_REQUEST;
 
+/** Archive entry
+ */
+typedef struct __orxRESOURCE_ARCHIVE_ENTRY_t
+{
+  orxU64                    u64NameID;                                                /**< Name ID (hash) */
+  orxU64                    u64Offset;                                                /**< Block table offset */
+  orxU64                    u64Size;                                                  /**< Uncompressed size */
+  orxU32                    u32NameOffset;                                            /**< Name offset in name table */
+  orxU32                    u32BlockCount;                                            /**< Block count */
+
+} orxRESOURCE_ARCHIVE_ENTRY;
+
+/** Archive
+ */
+typedef struct __orxRESOURCE_ARCHIVE_t
+{
+  orxSTRING                 zPath;                                                    /**< Archive path */
+  const orxU8              *pu8Map;                                                   /**< Mapped content */
+  orxS64                    s64MapSize;                                               /**< Mapped content size */
+  orxS64                    s64Size;                                                  /**< Archive file size */
+  orxRESOURCE_ARCHIVE_ENTRY *astEntryList;                                            /**< Entry list, sorted by name ID */
+  orxCHAR                  *acNameTable;                                              /**< Name table */
+  orxU32                    u32EntryCount;                                            /**< Entry count */
+  orxU32                    u32BlockSize;                                             /**< Uncompressed block size */
+
+} orxRESOURCE_ARCHIVE;
+
+/** Open archive entry
+ */
+typedef struct __orxRESOURCE_ARCHIVE_FILE_t
+{
+  const orxRESOURCE_ARCHIVE *pstArchive;                                              /**< Archive */
+  const orxRESOURCE_ARCHIVE_ENTRY *pstEntry;                                          /**< Entry */
+  orxFILE                  *pstFile;                                                  /**< Archive file, when not mapped */
+  orxU64                   *au64BlockOffsetList;                                      /**< Block offset list (block count + 1) */
+  orxU8                    *pu8Block;                                                 /**< Decompressed block cache */
+  orxU8                    *pu8PackedBlock;                                           /**< Packed block buffer, when not mapped */
+  orxS64                    s64Cursor;                                                /**< Cursor */
+  orxU32                    u32CachedBlock;                                           /**< Cached block index */
+  orxBOOL                   bIsRaw;                                                   /**< All blocks are stored uncompressed */
+
+} orxRESOURCE_ARCHIVE_FILE;
+
+/** Archive parallel decompression context
+ */
+typedef struct __orxRESOURCE_ARCHIVE_RANGE_t
+{
+  orxRESOURCE_ARCHIVE_FILE *pstFile;                                                  /**< Concerned file */
+  orxU8                    *pu8Buffer;                                                /**< Destination buffer */
+  orxU32                    u32FirstBlock;                                            /**< First block index */
+
+} orxRESOURCE_ARCHIVE_RANGE;
+
+
 /** Static structure
  */
 typedef struct __orxRESOURCE_STATIC_t
@@ -187,16 +265,23 @@ typedef struct __orxRESOURCE_STATIC_t
   orxBANK                  *pstOpenInfoBank;                                          /**< Open resource table size */
   orxTHREAD_SEMAPHORE*      pstRequestSemaphore;                                      /**< Request semaphore */
   orxTHREAD_SEMAPHORE*      pstWorkerSemaphore;                                       /**< Worker semaphore */
+  orxTHREAD_SEMAPHORE*      pstArchiveSemaphore;                                      /**< Archive semaphore */
   orxLINKLIST               stTypeList;                                               /**< Type list */
   orxSTRING                 zLastUncachedLocation;                                    /**< Last uncached location */
   orxSTRINGID               stLastWatchedGroupID;                                     /**< Last watched group ID */
   volatile orxSTATUS        eThreadResult;                                            /**< Thread result */
   orxCHAR                   acFileLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];       /**< File location buffer size */
+  orxCHAR                   acArchiveLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];    /**< Archive location buffer */
   volatile orxRESOURCE_REQUEST astRequestList[orxRESOURCE_KU32_REQUEST_LIST_SIZE];    /**< Request list */
   volatile orxU32           u32RequestInIndex;                                        /**< Request in index */
   volatile orxU32           u32RequestProcessIndex;                                   /**< Request process index */
   volatile orxU32           u32RequestOutIndex;                                       /**< Request out index */
   orxU32                    u32RequestThreadID;                                       /**< Request thread ID */
+  orxHASHTABLE             *pstWatchTable;                                            /**< Watch (directory) table */
+  orxHASHTABLE             *pstArchiveTable;                                          /**< Archive table */
+  orxS32                    s32WatchFD;                                               /**< Watch file descriptor */
+  orxU32                    u32WatchThreadID;                                         /**< Watch thread ID */
+  volatile orxBOOL          bStopWatch;                                               /**< Stop watch */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
 } orxRESOURCE_STATIC;
@@ -388,254 +473,1202 @@ static orxSTATUS orxFASTCALL orxResource_File_Delete(const orxSTRING _zLocation)
   return eResult;
 }
 
-static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
+static const void *orxFASTCALL orxResource_File_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
 {
-  orxRESOURCE_INFO *pstResourceInfo;
-  orxHANDLE         hIterator;
-
-  /* For all cached resources */
-  for(hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
-      hIterator != orxHANDLE_UNDEFINED;
-      hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
-  {
-    /* Deletes its location */
-    orxMemory_Free(pstResourceInfo->zLocation);
+  orxFILE    *pstFile;
+  const void *pResult;
 
-    /* Frees it */
-    orxBank_Free(sstResource.pstResourceInfoBank, pstResourceInfo);
-  }
+  /* Gets file */
+  pstFile = (orxFILE *)_hResource;
 
-  /* Deletes cache table */
-  orxHashTable_Delete(_pstGroup->pstCacheTable);
+  /* Updates result */
+  pResult = orxFile_Map(pstFile, _ps64Size);
 
-  /* Deletes storage bank */
-  orxBank_Delete(_pstGroup->pstStorageBank);
+  /* Done! */
+  return pResult;
+}
 
-  /* Deletes it */
-  orxBank_Free(sstResource.pstGroupBank, _pstGroup);
+static void orxFASTCALL orxResource_File_Unmap(orxHANDLE _hResource, const void *_pMap, orxS64 _s64Size)
+{
+  /* Unmaps it */
+  orxFile_Unmap(_pMap, _s64Size);
 
   /* Done! */
   return;
 }
 
-static orxINLINE orxRESOURCE_GROUP *orxResource_CreateGroup(orxSTRINGID _stGroupID)
+static orxINLINE orxU32 orxResource_Archive_ReadU32(const orxU8 *_pu8Data)
 {
-  orxRESOURCE_GROUP *pstResult;
+  /* Done! */
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8) | ((orxU32)_pu8Data[2] << 16) | ((orxU32)_pu8Data[3] << 24);
+}
 
-  /* Creates group */
-  pstResult = (orxRESOURCE_GROUP *)orxBank_Allocate(sstResource.pstGroupBank);
+static orxINLINE orxU64 orxResource_Archive_ReadU64(const orxU8 *_pu8Data)
+{
+  /* Done! */
+  return (orxU64)orxResource_Archive_ReadU32(_pu8Data) | ((orxU64)orxResource_Archive_ReadU32(_pu8Data + 4) << 32);
+}
 
-  /* Success? */
-  if(pstResult != orxNULL)
+/** Decodes an LZ4 block (raw block format, no frame)
+ * @param[in] _pu8Src           Packed data
+ * @param[in] _u32SrcSize       Packed data size
+ * @param[out] _pu8Dst          Destination buffer
+ * @param[in] _u32DstSize       Destination buffer size
+ * @return Decoded size, -1 if the data is corrupted
+ */
+static orxS32 orxFASTCALL orxResource_Archive_DecodeLZ4(const orxU8 *_pu8Src, orxU32 _u32SrcSize, orxU8 *_pu8Dst, orxU32 _u32DstSize)
+{
+  const orxU8  *pu8Src, *pu8SrcEnd;
+  orxU8        *pu8Dst, *pu8DstEnd;
+
+  /* Inits cursors */
+  pu8Src    = _pu8Src;
+  pu8SrcEnd = _pu8Src + _u32SrcSize;
+  pu8Dst    = _pu8Dst;
+  pu8DstEnd = _pu8Dst + _u32DstSize;
+
+  /* For all sequences */
+  while(pu8Src < pu8SrcEnd)
   {
-    orxRESOURCE_STORAGE *pstStorage;
+    const orxU8  *pu8Match;
+    orxU32        u32Token, u32Length, u32Offset;
 
-    /* Inits it */
-    pstResult->stID           = _stGroupID;
-    pstResult->pstStorageBank = orxBank_Create(orxRESOURCE_KU32_STORAGE_BANK_SIZE, sizeof(orxRESOURCE_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-    pstResult->pstCacheTable  = orxHashTable_Create(orxRESOURCE_KU32_CACHE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-    orxMemory_Zero(&(pstResult->stStorageList), sizeof(orxLINKLIST));
+    /* Gets token */
+    u32Token = *pu8Src++;
 
-    /* Creates storage */
-    pstStorage = (orxRESOURCE_STORAGE *)orxBank_Allocate(pstResult->pstStorageBank);
+    /* Gets literal length */
+    u32Length = u32Token >> 4;
+    if(u32Length == 15)
+    {
+      orxU32 u32Byte;
 
-    /* Success? */
-    if(pstStorage != orxNULL)
+      do
+      {
+        /* Corrupted? */
+        if(pu8Src >= pu8SrcEnd)
+        {
+          return -1;
+        }
+        u32Byte    = *pu8Src++;
+        u32Length += u32Byte;
+      } while(u32Byte == 255);
+    }
+
+    /* Corrupted? */
+    if((u32Length > (orxU32)(pu8SrcEnd - pu8Src)) || (u32Length > (orxU32)(pu8DstEnd - pu8Dst)))
     {
-      /* Stores its content */
-      pstStorage->stID = orxString_GetID(orxRESOURCE_KZ_DEFAULT_STORAGE);
+      return -1;
+    }
 
-      /* Clears node */
-      orxMemory_Zero(&(pstStorage->stNode), sizeof(orxLINKLIST_NODE));
+    /* Copies literals */
+    orxMemory_Copy(pu8Dst, pu8Src, u32Length);
+    pu8Src += u32Length;
+    pu8Dst += u32Length;
 
-      /* Adds it first */
-      orxLinkList_AddStart(&(pstResult->stStorageList), &(pstStorage->stNode));
+    /* Last sequence? */
+    if(pu8Src >= pu8SrcEnd)
+    {
+      break;
     }
-    else
+
+    /* Gets match offset */
+    if(pu8Src + 2 > pu8SrcEnd)
     {
-      /* Deletes it */
-      orxResource_DeleteGroup(pstResult);
+      return -1;
+    }
+    u32Offset = (orxU32)pu8Src[0] | ((orxU32)pu8Src[1] << 8);
+    pu8Src   += 2;
 
-      /* Updates result */
-      pstResult = orxNULL;
+    /* Corrupted? */
+    if((u32Offset == 0) || (u32Offset > (orxU32)(pu8Dst - _pu8Dst)))
+    {
+      return -1;
     }
-  }
 
-  /* Done! */
-  return pstResult;
-}
+    /* Gets match length */
+    u32Length = u32Token & 0x0F;
+    if(u32Length == 15)
+    {
+      orxU32 u32Byte;
 
-static orxINLINE orxRESOURCE_GROUP *orxResource_FindGroup(orxSTRINGID _stGroupID)
-{
-  orxRESOURCE_GROUP *pstResult;
+      do
+      {
+        /* Corrupted? */
+        if(pu8Src >= pu8SrcEnd)
+        {
+          return -1;
+        }
+        u32Byte    = *pu8Src++;
+        u32Length += u32Byte;
+      } while(u32Byte == 255);
+    }
+    u32Length += 4;
 
-  /* Gets group */
-  for(pstResult = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
-      (pstResult != orxNULL) && (pstResult->stID != _stGroupID);
-      pstResult = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstResult))
-    ;
+    /* Corrupted? */
+    if(u32Length > (orxU32)(pu8DstEnd - pu8Dst))
+    {
+      return -1;
+    }
+
+    /* Copies match */
+    pu8Match = pu8Dst - u32Offset;
+    if(u32Offset >= u32Length)
+    {
+      orxMemory_Copy(pu8Dst, pu8Match, u32Length);
+      pu8Dst += u32Length;
+    }
+    else
+    {
+      /* Overlapping: byte per byte */
+      for(; u32Length != 0; u32Length--)
+      {
+        *pu8Dst++ = *pu8Match++;
+      }
+    }
+  }
 
   /* Done! */
-  return pstResult;
+  return (orxS32)(pu8Dst - _pu8Dst);
 }
 
-static void orxFASTCALL orxResource_NotifyRequest(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+static void orxFASTCALL orxResource_Archive_Delete(orxRESOURCE_ARCHIVE *_pstArchive)
 {
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxResource_NotifyRequest");
-
-  /* While there are processed requests */
-  while(sstResource.u32RequestOutIndex != sstResource.u32RequestProcessIndex)
+  /* Is mapped? */
+  if(_pstArchive->pu8Map != orxNULL)
   {
-    volatile orxRESOURCE_REQUEST *pstRequest;
-
-    /* Gets request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestOutIndex]);
-
-    /* Decrements operation count */
-    if(pstRequest->pstResourceInfo != orxNULL)
-    {
-      pstRequest->pstResourceInfo->u32OpCount--;
-    }
+    /* Unmaps it */
+    orxFile_Unmap(_pstArchive->pu8Map, _pstArchive->s64MapSize);
+  }
 
-    /* Has callback? */
-    if(pstRequest->pfnCallback != orxNULL)
-    {
-      /* Notifies it */
-      pstRequest->pfnCallback((orxHANDLE)pstRequest->pstResourceInfo, pstRequest->s64Size, pstRequest->pBuffer, pstRequest->pContext);
-    }
+  /* Has entries? */
+  if(_pstArchive->astEntryList != orxNULL)
+  {
+    /* Frees them */
+    orxMemory_Free(_pstArchive->astEntryList);
+  }
 
-    /* Updates request out index */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestOutIndex = (sstResource.u32RequestOutIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+  /* Has name table? */
+  if(_pstArchive->acNameTable != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstArchive->acNameTable);
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
+  /* Deletes path */
+  orxString_Delete(_pstArchive->zPath);
+
+  /* Frees archive */
+  orxMemory_Free(_pstArchive);
 
   /* Done! */
   return;
 }
 
-static orxSTATUS orxFASTCALL orxResource_ProcessRequests(void *_pContext)
+static orxRESOURCE_ARCHIVE *orxFASTCALL orxResource_Archive_Get(const orxSTRING _zPath)
 {
-  orxSTATUS eResult;
+  orxRESOURCE_ARCHIVE  *pstResult = orxNULL;
 
-  /* Waits for worker semaphore */
-  orxThread_WaitSemaphore(sstResource.pstWorkerSemaphore);
+  /* Locks archive table (archives are located & opened from worker threads too) */
+  orxThread_WaitSemaphore(sstResource.pstArchiveSemaphore);
 
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxResource_ProcessRequests");
+  /* No archive table yet? */
+  if(sstResource.pstArchiveTable == orxNULL)
+  {
+    /* Creates it */
+    sstResource.pstArchiveTable = orxHashTable_Create(orxRESOURCE_KU32_ARCHIVE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  }
 
-  /* While there are pending requests */
-  while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex)
+  /* Valid? */
+  if(sstResource.pstArchiveTable != orxNULL)
   {
-    volatile orxRESOURCE_REQUEST *pstRequest;
+    orxSTRINGID stID;
 
-    /* Gets request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestProcessIndex]);
+    /* Gets path ID */
+    stID = orxString_Hash(_zPath);
 
-    /* Depending on request type */
-    switch(pstRequest->eType)
+    /* Gets archive */
+    pstResult = (orxRESOURCE_ARCHIVE *)orxHashTable_Get(sstResource.pstArchiveTable, stID);
+
+    /* Not loaded yet? */
+    if(pstResult == orxNULL)
     {
-      case orxRESOURCE_REQUEST_TYPE_READ:
+      /* Allocates it */
+      pstResult = (orxRESOURCE_ARCHIVE *)orxMemory_Allocate(sizeof(orxRESOURCE_ARCHIVE), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstResult != orxNULL)
       {
-        /* Services it */
-        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnRead(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+        orxFILE *pstFile;
 
-        break;
-      }
+        /* Inits it */
+        orxMemory_Zero(pstResult, sizeof(orxRESOURCE_ARCHIVE));
+        pstResult->zPath = orxString_Duplicate(_zPath);
 
-      case orxRESOURCE_REQUEST_TYPE_WRITE:
-      {
-        /* Services it */
-        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnWrite(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+        /* Opens archive file */
+        pstFile = orxFile_Open(_zPath, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
 
-        break;
-      }
+        /* Success? */
+        if(pstFile != orxNULL)
+        {
+          orxU8 au8Header[orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE];
 
-      case orxRESOURCE_REQUEST_TYPE_CLOSE:
-      {
-        /* Services it */
-        pstRequest->pstResourceInfo->pstTypeInfo->pfnClose(pstRequest->pstResourceInfo->hResource);
+          /* Is a valid archive? */
+          if((orxFile_Read(au8Header, sizeof(orxU8), orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE, pstFile) == orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE)
+          && (orxMemory_Compare(au8Header, orxRESOURCE_KZ_ARCHIVE_BINARY_TAG, 4) == 0))
+          {
+            orxU8  *pu8Index = orxNULL;
+            orxS64  s64FileSize, s64DataSize;
+            orxU32  u32EntryCount, u32BlockSize, u32NameTableSize, u32IndexSize = 0;
+
+            /* Gets header info */
+            u32EntryCount     = orxResource_Archive_ReadU32(au8Header + 4);
+            u32BlockSize      = orxResource_Archive_ReadU32(au8Header + 8);
+            u32NameTableSize  = orxResource_Archive_ReadU32(au8Header + 12);
+
+            /* Gets size available for index & name table */
+            s64FileSize       = orxFile_GetSize(pstFile);
+            s64DataSize       = s64FileSize - orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE;
+
+            /* Do index & name table fit in the archive? (checked before computing any size, as header values might be corrupted) */
+            if((s64DataSize > 0)
+            && (u32EntryCount <= orxU32_UNDEFINED / sizeof(orxRESOURCE_ARCHIVE_ENTRY))
+            && (u32NameTableSize < orxU32_UNDEFINED)
+            && ((orxU64)u32EntryCount * (orxU64)orxRESOURCE_KU32_ARCHIVE_ENTRY_SIZE + (orxU64)u32NameTableSize <= (orxU64)s64DataSize))
+            {
+              /* Gets index size */
+              u32IndexSize            = u32EntryCount * orxRESOURCE_KU32_ARCHIVE_ENTRY_SIZE;
 
-        /* Deletes location */
-        orxString_Delete(pstRequest->pstResourceInfo->zLocation);
+              /* Allocates index & name table */
+              pu8Index                = (orxU8 *)orxMemory_Allocate(u32IndexSize, orxMEMORY_TYPE_TEMP);
+              pstResult->astEntryList = (orxRESOURCE_ARCHIVE_ENTRY *)orxMemory_Allocate(u32EntryCount * sizeof(orxRESOURCE_ARCHIVE_ENTRY), orxMEMORY_TYPE_MAIN);
+              pstResult->acNameTable  = (orxCHAR *)orxMemory_Allocate(u32NameTableSize + 1, orxMEMORY_TYPE_MAIN);
+            }
 
-        /* Frees open info */
-        orxBank_Free(sstResource.pstOpenInfoBank, pstRequest->pstResourceInfo);
-        pstRequest->pstResourceInfo = orxNULL;
+            /* Valid? */
+            if((u32EntryCount != 0)
+            && (u32BlockSize != 0)
+            && (pu8Index != orxNULL)
+            && (pstResult->astEntryList != orxNULL)
+            && (pstResult->acNameTable != orxNULL)
+            && (orxFile_Read(pu8Index, sizeof(orxU8), u32IndexSize, pstFile) == u32IndexSize)
+            && (orxFile_Read(pstResult->acNameTable, sizeof(orxCHAR), u32NameTableSize, pstFile) == u32NameTableSize))
+            {
+              orxU32 i;
 
-        break;
-      }
+              /* For all entries */
+              for(i = 0; i < u32EntryCount; i++)
+              {
+                const orxU8                *pu8Entry;
+                orxRESOURCE_ARCHIVE_ENTRY  *pstEntry;
+
+                /* Gets it */
+                pu8Entry = pu8Index + i * orxRESOURCE_KU32_ARCHIVE_ENTRY_SIZE;
+                pstEntry = &(pstResult->astEntryList[i]);
+
+                /* Decodes it */
+                pstEntry->u64NameID     = orxResource_Archive_ReadU64(pu8Entry);
+                pstEntry->u64Offset     = orxResource_Archive_ReadU64(pu8Entry + 8);
+                pstEntry->u64Size       = orxResource_Archive_ReadU64(pu8Entry + 16);
+                pstEntry->u32NameOffset = orxResource_Archive_ReadU32(pu8Entry + 24);
+                pstEntry->u32BlockCount = orxResource_Archive_ReadU32(pu8Entry + 28);
+
+                /* Invalid name? */
+                if(pstEntry->u32NameOffset >= u32NameTableSize)
+                {
+                  break;
+                }
+
+                /* Block count doesn't match size? (computed in 64-bit, as all values come from the file) */
+                if((orxU64)pstEntry->u32BlockCount != pstEntry->u64Size / (orxU64)u32BlockSize + ((pstEntry->u64Size % (orxU64)u32BlockSize != 0) ? 1 : 0))
+                {
+                  break;
+                }
+
+                /* Block table or open file allocation not fitting? */
+                if((pstEntry->u64Offset > (orxU64)s64FileSize)
+                || ((orxU64)pstEntry->u32BlockCount * (orxU64)sizeof(orxU32) > (orxU64)s64FileSize - pstEntry->u64Offset)
+                || ((orxU64)sizeof(orxRESOURCE_ARCHIVE_FILE) + ((orxU64)pstEntry->u32BlockCount + 1) * (orxU64)sizeof(orxU64) > (orxU64)orxU32_UNDEFINED))
+                {
+                  break;
+                }
+              }
 
-      case orxRESOURCE_REQUEST_TYPE_GET_TIME:
-      {
-        orxRESOURCE_INFO *pstResourceInfo;
+              /* Valid? */
+              if(i == u32EntryCount)
+              {
+                /* Terminates name table */
+                pstResult->acNameTable[u32NameTableSize] = orxCHAR_NULL;
 
-        /* Gets resource info */
-        pstResourceInfo = (orxRESOURCE_INFO *)pstRequest->pContext;
+                /* Stores info */
+                pstResult->u32EntryCount  = u32EntryCount;
+                pstResult->u32BlockSize   = u32BlockSize;
+                pstResult->s64Size        = s64FileSize;
 
-        /* Gets its modification time (cheating for the storage) */
-        pstRequest->s64Size = pstResourceInfo->pstTypeInfo->pfnGetTime(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1);
+                /* Maps content (blocks will be read through the file otherwise) */
+                pstResult->pu8Map = (const orxU8 *)orxFile_Map(pstFile, &(pstResult->s64MapSize));
+              }
+            }
 
-        /* Updates its status */
-        pstResourceInfo->bPendingWatch = orxFALSE;
+            /* Frees index */
+            if(pu8Index != orxNULL)
+            {
+              orxMemory_Free(pu8Index);
+            }
+          }
 
-        break;
-      }
+          /* Closes file */
+          orxFile_Close(pstFile);
+        }
 
-      default:
-      {
-        break;
+        /* Failure? */
+        if(pstResult->u32EntryCount == 0)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't load resource archive <%s>: invalid or missing file.", _zPath);
+        }
+
+        /* Adds it (invalid archives are kept empty, so as to not be probed again) */
+        orxHashTable_Add(sstResource.pstArchiveTable, stID, pstResult);
       }
     }
-
-    /* Updates request process index */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestProcessIndex = (sstResource.u32RequestProcessIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
-
-  /* Updates result */
-  eResult = sstResource.eThreadResult;
+  /* Unlocks archive table */
+  orxThread_SignalSemaphore(sstResource.pstArchiveSemaphore);
 
   /* Done! */
-  return eResult;
+  return pstResult;
 }
 
-static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64Size, void *_pBuffer, orxRESOURCE_OP_FUNCTION _pfnCallback, void *_pContext, orxRESOURCE_OPEN_INFO *_pstResourceInfo)
+static orxU32 orxFASTCALL orxResource_Archive_FindEntry(const orxRESOURCE_ARCHIVE *_pstArchive, const orxSTRING _zName)
 {
-  orxU32  u32NextRequestIndex;
-  orxBOOL bAdd = orxTRUE;
-
-  /* Checks */
-  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
-
-  /* Waits for semaphore */
-  orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+  orxU64  u64NameID;
+  orxU32  u32Min, u32Max, u32Result = orxU32_UNDEFINED;
 
-  /* Gets next request index */
-  u32NextRequestIndex = (sstResource.u32RequestInIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+  /* Gets name ID */
+  u64NameID = (orxU64)orxString_Hash(_zName);
 
-  /* Time request? */
-  if(_eType == orxRESOURCE_REQUEST_TYPE_GET_TIME)
+  /* Binary search for first entry with that ID */
+  for(u32Min = 0, u32Max = _pstArchive->u32EntryCount; u32Min < u32Max;)
   {
-    orxU32 u32InIndex, u32ProcessIndex, u32FreeSlots;
-
-    /* Gets indices */
-    u32InIndex      = sstResource.u32RequestInIndex;
-    u32ProcessIndex = sstResource.u32RequestProcessIndex;
+    orxU32 u32Middle;
 
-    /* Gets number of free slots */
-    u32FreeSlots = (u32InIndex >= u32ProcessIndex) ? orxRESOURCE_KU32_REQUEST_LIST_SIZE - u32InIndex + u32ProcessIndex : u32ProcessIndex - u32InIndex;
+    /* Gets middle */
+    u32Middle = u32Min + ((u32Max - u32Min) >> 1);
 
-    /* More than a quarter of the slots are free? */
-    if(u32FreeSlots >= orxRESOURCE_KU32_REQUEST_LIST_SIZE / 4)
+    /* Updates range */
+    if(_pstArchive->astEntryList[u32Middle].u64NameID < u64NameID)
     {
-      /* Process addition */
+      u32Min = u32Middle + 1;
+    }
+    else
+    {
+      u32Max = u32Middle;
+    }
+  }
+
+  /* For all entries with that ID (collisions) */
+  for(; (u32Min < _pstArchive->u32EntryCount) && (_pstArchive->astEntryList[u32Min].u64NameID == u64NameID); u32Min++)
+  {
+    /* Same name? */
+    if(orxString_Compare(_pstArchive->acNameTable + _pstArchive->astEntryList[u32Min].u32NameOffset, _zName) == 0)
+    {
+      /* Updates result */
+      u32Result = u32Min;
+      break;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxINLINE orxU32 orxResource_Archive_GetBlockSize(const orxRESOURCE_ARCHIVE_FILE *_pstFile, orxU32 _u32Block)
+{
+  /* Done! */
+  return (orxU32)orxMIN((orxU64)_pstFile->pstArchive->u32BlockSize, _pstFile->pstEntry->u64Size - (orxU64)_u32Block * (orxU64)_pstFile->pstArchive->u32BlockSize);
+}
+
+static orxSTATUS orxFASTCALL orxResource_Archive_DecompressBlock(orxRESOURCE_ARCHIVE_FILE *_pstFile, orxU32 _u32Block, orxU8 *_pu8Buffer)
+{
+  const orxU8  *pu8Packed = orxNULL;
+  orxU32        u32PackedSize, u32Size;
+  orxSTATUS     eResult = orxSTATUS_FAILURE;
+
+  /* Gets sizes */
+  u32PackedSize = (orxU32)(_pstFile->au64BlockOffsetList[_u32Block + 1] - _pstFile->au64BlockOffsetList[_u32Block]);
+  u32Size       = orxResource_Archive_GetBlockSize(_pstFile, _u32Block);
+
+  /* Is archive mapped? */
+  if(_pstFile->pstArchive->pu8Map != orxNULL)
+  {
+    /* Gets packed data */
+    pu8Packed = _pstFile->pstArchive->pu8Map + _pstFile->au64BlockOffsetList[_u32Block];
+  }
+  else
+  {
+    /* Doesn't have a packed buffer yet? */
+    if(_pstFile->pu8PackedBlock == orxNULL)
+    {
+      /* Allocates it (LZ4 blocks are never stored larger than their uncompressed size) */
+      _pstFile->pu8PackedBlock = (orxU8 *)orxMemory_Allocate(_pstFile->pstArchive->u32BlockSize, orxMEMORY_TYPE_TEMP);
+    }
+
+    /* Reads packed data */
+    if((_pstFile->pu8PackedBlock != orxNULL)
+    && (u32PackedSize <= _pstFile->pstArchive->u32BlockSize)
+    && (orxFile_Seek(_pstFile->pstFile, (orxS64)_pstFile->au64BlockOffsetList[_u32Block], orxSEEK_OFFSET_WHENCE_START) >= 0)
+    && (orxFile_Read(_pstFile->pu8PackedBlock, sizeof(orxU8), u32PackedSize, _pstFile->pstFile) == u32PackedSize))
+    {
+      /* Gets packed data */
+      pu8Packed = _pstFile->pu8PackedBlock;
+    }
+  }
+
+  /* Valid? */
+  if(pu8Packed != orxNULL)
+  {
+    /* Stored uncompressed? */
+    if(u32PackedSize == u32Size)
+    {
+      /* Copies it */
+      orxMemory_Copy(_pu8Buffer, pu8Packed, u32Size);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    /* Decompresses it */
+    else if(orxResource_Archive_DecodeLZ4(pu8Packed, u32PackedSize, _pu8Buffer, u32Size) == (orxS32)u32Size)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't decompress block #%u of <%s> in resource archive <%s>: corrupted data.", _u32Block, _pstFile->pstArchive->acNameTable + _pstFile->pstEntry->u32NameOffset, _pstFile->pstArchive->zPath);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxResource_Archive_DecompressRange(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  orxRESOURCE_ARCHIVE_RANGE  *pstRange;
+  orxU32                      i;
+  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
+
+  /* Gets range */
+  pstRange = (orxRESOURCE_ARCHIVE_RANGE *)_pContext;
+
+  /* For all blocks */
+  for(i = _u32Start; (i < _u32End) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    /* Decompresses it (all blocks but the entry's last one are full) */
+    eResult = orxResource_Archive_DecompressBlock(pstRange->pstFile, pstRange->u32FirstBlock + i, pstRange->pu8Buffer + (orxU64)i * (orxU64)pstRange->pstFile->pstArchive->u32BlockSize);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static const orxSTRING orxFASTCALL orxResource_Archive_Locate(const orxSTRING _zGroup, const orxSTRING _zStorage, const orxSTRING _zName, orxBOOL _bRequireExistence)
+{
+  static orxU32   su32TagLength = 0;
+  const orxSTRING zResult = orxNULL;
+
+  /* First call? */
+  if(su32TagLength == 0)
+  {
+    /* Gets tag length */
+    su32TagLength = orxString_GetLength(orxRESOURCE_KZ_TYPE_TAG_ARCHIVE);
+  }
+
+  /* Archive storage? */
+  if((orxString_NICompare(_zStorage, orxRESOURCE_KZ_TYPE_TAG_ARCHIVE, su32TagLength) == 0)
+  && (_zStorage[su32TagLength] == orxRESOURCE_KC_LOCATION_SEPARATOR)
+  && (_zStorage[su32TagLength + 1] != orxCHAR_NULL))
+  {
+    orxRESOURCE_ARCHIVE *pstArchive;
+
+    /* Gets archive */
+    pstArchive = orxResource_Archive_Get(_zStorage + su32TagLength + 1);
+
+    /* Valid? */
+    if(pstArchive != orxNULL)
+    {
+      orxU32 u32Index;
+
+      /* Finds entry (read-only type, existence is always required) */
+      u32Index = orxResource_Archive_FindEntry(pstArchive, _zName);
+
+      /* Found? */
+      if(u32Index != orxU32_UNDEFINED)
+      {
+        /* Composes location: path + entry index */
+        orxString_NPrint(sstResource.acArchiveLocationBuffer, sizeof(sstResource.acArchiveLocationBuffer), "%s%c0x%X", pstArchive->zPath, orxRESOURCE_KC_LOCATION_SEPARATOR, u32Index);
+
+        /* Updates result */
+        zResult = sstResource.acArchiveLocationBuffer;
+      }
+    }
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+static orxHANDLE orxFASTCALL orxResource_Archive_Open(const orxSTRING _zLocation, orxBOOL _bEraseMode)
+{
+  const orxCHAR  *pc, *zIndex = orxNULL;
+  orxHANDLE       hResult = orxHANDLE_UNDEFINED;
+
+  /* Gets index (after last separator, as path might contain some) */
+  for(pc = _zLocation; *pc != orxCHAR_NULL; pc++)
+  {
+    /* Separator? */
+    if(*pc == orxRESOURCE_KC_LOCATION_SEPARATOR)
+    {
+      /* Stores it */
+      zIndex = pc;
+    }
+  }
+
+  /* Valid & read-only? */
+  if((_bEraseMode == orxFALSE) && (zIndex != orxNULL) && ((orxU32)(zIndex - _zLocation) < orxRESOURCE_KU32_BUFFER_SIZE))
+  {
+    orxCHAR acPath[orxRESOURCE_KU32_BUFFER_SIZE];
+    orxU32  u32Index;
+
+    /* Gets archive path */
+    orxMemory_Copy(acPath, _zLocation, (orxU32)(zIndex - _zLocation));
+    acPath[zIndex - _zLocation] = orxCHAR_NULL;
+
+    /* Gets entry index */
+    if(orxString_ToU32(zIndex + 1, &u32Index, orxNULL) != orxSTATUS_FAILURE)
+    {
+      orxRESOURCE_ARCHIVE *pstArchive;
+
+      /* Gets archive */
+      pstArchive = orxResource_Archive_Get(acPath);
+
+      /* Valid entry? */
+      if((pstArchive != orxNULL) && (u32Index < pstArchive->u32EntryCount))
+      {
+        const orxRESOURCE_ARCHIVE_ENTRY  *pstEntry;
+        orxRESOURCE_ARCHIVE_FILE         *pstFile;
+
+        /* Gets entry */
+        pstEntry = &(pstArchive->astEntryList[u32Index]);
+
+        /* Allocates file with its block offset list (size fits in 32-bit, as checked when loading the archive) */
+        pstFile = (orxRESOURCE_ARCHIVE_FILE *)orxMemory_Allocate((orxU32)((orxU64)sizeof(orxRESOURCE_ARCHIVE_FILE) + ((orxU64)pstEntry->u32BlockCount + 1) * (orxU64)sizeof(orxU64)), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstFile != orxNULL)
+        {
+          const orxU8  *pu8BlockTable = orxNULL;
+          orxU8        *pu8Buffer = orxNULL;
+          orxU32        u32TableSize;
+
+          /* Inits it */
+          orxMemory_Zero(pstFile, sizeof(orxRESOURCE_ARCHIVE_FILE));
+          pstFile->pstArchive           = pstArchive;
+          pstFile->pstEntry             = pstEntry;
+          pstFile->au64BlockOffsetList  = (orxU64 *)(pstFile + 1);
+          pstFile->u32CachedBlock       = orxU32_UNDEFINED;
+
+          /* Gets block table size */
+          u32TableSize = (orxU32)((orxU64)pstEntry->u32BlockCount * (orxU64)sizeof(orxU32));
+
+          /* Is archive mapped? */
+          if(pstArchive->pu8Map != orxNULL)
+          {
+            /* Valid? */
+            if(pstEntry->u64Offset + (orxU64)u32TableSize <= (orxU64)pstArchive->s64MapSize)
+            {
+              /* Gets block table */
+              pu8BlockTable = pstArchive->pu8Map + pstEntry->u64Offset;
+            }
+          }
+          else
+          {
+            /* Opens its own file handle */
+            pstFile->pstFile = orxFile_Open(pstArchive->zPath, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+            /* Allocates block table buffer */
+            pu8Buffer = (orxU8 *)orxMemory_Allocate(orxMAX(u32TableSize, 1), orxMEMORY_TYPE_TEMP);
+
+            /* Reads block table */
+            if((pstFile->pstFile != orxNULL)
+            && (pu8Buffer != orxNULL)
+            && (orxFile_Seek(pstFile->pstFile, (orxS64)pstEntry->u64Offset, orxSEEK_OFFSET_WHENCE_START) >= 0)
+            && (orxFile_Read(pu8Buffer, sizeof(orxU8), u32TableSize, pstFile->pstFile) == u32TableSize))
+            {
+              /* Gets block table */
+              pu8BlockTable = pu8Buffer;
+            }
+          }
+
+          /* Valid? */
+          if(pu8BlockTable != orxNULL)
+          {
+            orxU32 i;
+
+            /* Computes block offsets */
+            pstFile->au64BlockOffsetList[0] = pstEntry->u64Offset + u32TableSize;
+            for(i = 0, pstFile->bIsRaw = orxTRUE; i < pstEntry->u32BlockCount; i++)
+            {
+              orxU32 u32PackedSize;
+
+              /* Gets packed size */
+              u32PackedSize = orxResource_Archive_ReadU32(pu8BlockTable + i * sizeof(orxU32));
+
+              /* Updates status */
+              pstFile->bIsRaw = (pstFile->bIsRaw != orxFALSE) && (u32PackedSize == orxResource_Archive_GetBlockSize(pstFile, i)) ? orxTRUE : orxFALSE;
+
+              /* Stores next offset */
+              pstFile->au64BlockOffsetList[i + 1] = pstFile->au64BlockOffsetList[i] + u32PackedSize;
+            }
+
+            /* Packed data within archive? */
+            if(pstFile->au64BlockOffsetList[pstEntry->u32BlockCount] <= (orxU64)((pstArchive->pu8Map != orxNULL) ? pstArchive->s64MapSize : pstArchive->s64Size))
+            {
+              /* Updates result */
+              hResult = (orxHANDLE)pstFile;
+            }
+          }
+
+          /* Has buffer? */
+          if(pu8Buffer != orxNULL)
+          {
+            /* Frees it */
+            orxMemory_Free(pu8Buffer);
+          }
+
+          /* Failure? */
+          if(hResult == orxHANDLE_UNDEFINED)
+          {
+            /* Has file? */
+            if(pstFile->pstFile != orxNULL)
+            {
+              /* Closes it */
+              orxFile_Close(pstFile->pstFile);
+            }
+
+            /* Frees it */
+            orxMemory_Free(pstFile);
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return hResult;
+}
+
+static void orxFASTCALL orxResource_Archive_Close(orxHANDLE _hResource)
+{
+  orxRESOURCE_ARCHIVE_FILE *pstFile;
+
+  /* Gets file */
+  pstFile = (orxRESOURCE_ARCHIVE_FILE *)_hResource;
+
+  /* Has own file handle? */
+  if(pstFile->pstFile != orxNULL)
+  {
+    /* Closes it */
+    orxFile_Close(pstFile->pstFile);
+  }
+
+  /* Has block cache? */
+  if(pstFile->pu8Block != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(pstFile->pu8Block);
+  }
+
+  /* Has packed buffer? */
+  if(pstFile->pu8PackedBlock != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(pstFile->pu8PackedBlock);
+  }
+
+  /* Frees file */
+  orxMemory_Free(pstFile);
+
+  /* Done! */
+  return;
+}
+
+static orxS64 orxFASTCALL orxResource_Archive_GetSize(orxHANDLE _hResource)
+{
+  /* Done! */
+  return (orxS64)((orxRESOURCE_ARCHIVE_FILE *)_hResource)->pstEntry->u64Size;
+}
+
+static orxS64 orxFASTCALL orxResource_Archive_Seek(orxHANDLE _hResource, orxS64 _s64Offset, orxSEEK_OFFSET_WHENCE _eWhence)
+{
+  orxRESOURCE_ARCHIVE_FILE *pstFile;
+  orxS64                    s64Cursor, s64Result = -1;
+
+  /* Gets file */
+  pstFile = (orxRESOURCE_ARCHIVE_FILE *)_hResource;
+
+  /* Gets new cursor */
+  s64Cursor = _s64Offset + ((_eWhence == orxSEEK_OFFSET_WHENCE_CURRENT) ? pstFile->s64Cursor : (_eWhence == orxSEEK_OFFSET_WHENCE_END) ? (orxS64)pstFile->pstEntry->u64Size : 0);
+
+  /* Valid? */
+  if((s64Cursor >= 0) && (s64Cursor <= (orxS64)pstFile->pstEntry->u64Size))
+  {
+    /* Updates cursor */
+    pstFile->s64Cursor = s64Cursor;
+
+    /* Updates result */
+    s64Result = s64Cursor;
+  }
+
+  /* Done! */
+  return s64Result;
+}
+
+static orxS64 orxFASTCALL orxResource_Archive_Tell(orxHANDLE _hResource)
+{
+  /* Done! */
+  return ((orxRESOURCE_ARCHIVE_FILE *)_hResource)->s64Cursor;
+}
+
+static orxS64 orxFASTCALL orxResource_Archive_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer)
+{
+  orxRESOURCE_ARCHIVE_FILE *pstFile;
+  orxU8                    *pu8Buffer;
+  orxU64                    u64Remaining;
+  orxU32                    u32BlockSize;
+
+  /* Gets file */
+  pstFile = (orxRESOURCE_ARCHIVE_FILE *)_hResource;
+
+  /* Gets block size */
+  u32BlockSize = pstFile->pstArchive->u32BlockSize;
+
+  /* Gets size to read */
+  u64Remaining = (orxU64)orxMAX(orxMIN(_s64Size, (orxS64)pstFile->pstEntry->u64Size - pstFile->s64Cursor), 0);
+
+  /* While there's data to read */
+  for(pu8Buffer = (orxU8 *)_pBuffer; u64Remaining != 0;)
+  {
+    orxU32 u32Block, u32BlockOffset, u32Size;
+
+    /* Gets current block */
+    u32Block        = (orxU32)((orxU64)pstFile->s64Cursor / u32BlockSize);
+    u32BlockOffset  = (orxU32)((orxU64)pstFile->s64Cursor - (orxU64)u32Block * u32BlockSize);
+    u32Size         = orxResource_Archive_GetBlockSize(pstFile, u32Block);
+
+    /* Reading whole blocks? */
+    if((u32BlockOffset == 0) && (u64Remaining >= u32Size))
+    {
+      orxU64    u64Size;
+      orxU32    u32Count;
+      orxSTATUS eResult;
+
+      /* Gets number of whole blocks */
+      for(u32Count = 0, u64Size = 0;
+          (u32Block + u32Count < pstFile->pstEntry->u32BlockCount) && (u64Size + orxResource_Archive_GetBlockSize(pstFile, u32Block + u32Count) <= u64Remaining);
+          u64Size += orxResource_Archive_GetBlockSize(pstFile, u32Block + u32Count), u32Count++)
+        ;
+
+      /* Mapped and worth spreading? */
+      if((pstFile->pstArchive->pu8Map != orxNULL) && (u32Count >= orxRESOURCE_KU32_ARCHIVE_PARALLEL_BLOCK_COUNT))
+      {
+        orxRESOURCE_ARCHIVE_RANGE stRange;
+
+        /* Inits range */
+        stRange.pstFile       = pstFile;
+        stRange.pu8Buffer     = pu8Buffer;
+        stRange.u32FirstBlock = u32Block;
+
+        /* Decompresses blocks directly into destination, on the thread pool */
+        eResult = orxThread_ParallelFor(u32Count, 1, orxResource_Archive_DecompressRange, &stRange);
+      }
+      else
+      {
+        orxU32 i;
+
+        /* For all blocks */
+        for(i = 0, eResult = orxSTATUS_SUCCESS; (i < u32Count) && (eResult != orxSTATUS_FAILURE); i++)
+        {
+          /* Decompresses it directly into destination */
+          eResult = orxResource_Archive_DecompressBlock(pstFile, u32Block + i, pu8Buffer + (orxU64)i * u32BlockSize);
+        }
+      }
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        break;
+      }
+
+      /* Updates cursors */
+      pu8Buffer          += u64Size;
+      pstFile->s64Cursor += (orxS64)u64Size;
+      u64Remaining       -= u64Size;
+    }
+    else
+    {
+      const orxU8  *pu8Source;
+      orxU32        u32CopySize;
+
+      /* Gets copy size */
+      u32CopySize = (orxU32)orxMIN((orxU64)(u32Size - u32BlockOffset), u64Remaining);
+
+      /* Mapped & stored uncompressed? */
+      if((pstFile->pstArchive->pu8Map != orxNULL)
+      && (pstFile->au64BlockOffsetList[u32Block + 1] - pstFile->au64BlockOffsetList[u32Block] == u32Size))
+      {
+        /* Reads directly from archive */
+        pu8Source = pstFile->pstArchive->pu8Map + pstFile->au64BlockOffsetList[u32Block];
+      }
+      else
+      {
+        /* Not cached? */
+        if(pstFile->u32CachedBlock != u32Block)
+        {
+          /* Doesn't have a block cache yet? */
+          if(pstFile->pu8Block == orxNULL)
+          {
+            /* Allocates it */
+            pstFile->pu8Block = (orxU8 *)orxMemory_Allocate(u32BlockSize, orxMEMORY_TYPE_TEMP);
+          }
+
+          /* Decompresses block in cache */
+          if((pstFile->pu8Block == orxNULL)
+          || (orxResource_Archive_DecompressBlock(pstFile, u32Block, pstFile->pu8Block) == orxSTATUS_FAILURE))
+          {
+            /* Invalidates cache */
+            pstFile->u32CachedBlock = orxU32_UNDEFINED;
+            break;
+          }
+
+          /* Updates cache */
+          pstFile->u32CachedBlock = u32Block;
+        }
+
+        /* Reads from cache */
+        pu8Source = pstFile->pu8Block;
+      }
+
+      /* Copies data */
+      orxMemory_Copy(pu8Buffer, pu8Source + u32BlockOffset, u32CopySize);
+
+      /* Updates cursors */
+      pu8Buffer          += u32CopySize;
+      pstFile->s64Cursor += (orxS64)u32CopySize;
+      u64Remaining       -= u32CopySize;
+    }
+  }
+
+  /* Done! */
+  return (orxS64)(pu8Buffer - (orxU8 *)_pBuffer);
+}
+
+static const void *orxFASTCALL orxResource_Archive_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
+{
+  orxRESOURCE_ARCHIVE_FILE *pstFile;
+  const void               *pResult = orxNULL;
+
+  /* Gets file */
+  pstFile = (orxRESOURCE_ARCHIVE_FILE *)_hResource;
+
+  /* Mapped archive and entry stored uncompressed (contiguous)? */
+  if((pstFile->pstArchive->pu8Map != orxNULL) && (pstFile->bIsRaw != orxFALSE) && (pstFile->pstEntry->u64Size != 0))
+  {
+    /* Updates result */
+    pResult     = pstFile->pstArchive->pu8Map + pstFile->au64BlockOffsetList[0];
+    *_ps64Size  = (orxS64)pstFile->pstEntry->u64Size;
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+static void orxFASTCALL orxResource_Archive_Unmap(orxHANDLE _hResource, const void *_pMap, orxS64 _s64Size)
+{
+  /* Nothing to do, the archive stays mapped */
+  return;
+}
+
+static orxINLINE void orxResource_ReleaseMap(orxRESOURCE_OPEN_INFO *_pstOpenInfo)
+{
+  /* Is mapped? */
+  if(_pstOpenInfo->pMap != orxNULL)
+  {
+    /* Unmaps it */
+    _pstOpenInfo->pstTypeInfo->pfnUnmap(_pstOpenInfo->hResource, _pstOpenInfo->pMap, _pstOpenInfo->s64MapSize);
+
+    /* Clears mapping */
+    _pstOpenInfo->pMap        = orxNULL;
+    _pstOpenInfo->s64MapSize  = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
+{
+  orxRESOURCE_INFO *pstResourceInfo;
+  orxHANDLE         hIterator;
+
+  /* For all cached resources */
+  for(hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+      hIterator != orxHANDLE_UNDEFINED;
+      hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+  {
+    /* Deletes its location */
+    orxMemory_Free(pstResourceInfo->zLocation);
+
+    /* Frees it */
+    orxBank_Free(sstResource.pstResourceInfoBank, pstResourceInfo);
+  }
+
+  /* Deletes cache table */
+  orxHashTable_Delete(_pstGroup->pstCacheTable);
+
+  /* Deletes storage bank */
+  orxBank_Delete(_pstGroup->pstStorageBank);
+
+  /* Deletes it */
+  orxBank_Free(sstResource.pstGroupBank, _pstGroup);
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxRESOURCE_GROUP *orxResource_CreateGroup(orxSTRINGID _stGroupID)
+{
+  orxRESOURCE_GROUP *pstResult;
+
+  /* Creates group */
+  pstResult = (orxRESOURCE_GROUP *)orxBank_Allocate(sstResource.pstGroupBank);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    orxRESOURCE_STORAGE *pstStorage;
+
+    /* Inits it */
+    pstResult->stID           = _stGroupID;
+    pstResult->pstStorageBank = orxBank_Create(orxRESOURCE_KU32_STORAGE_BANK_SIZE, sizeof(orxRESOURCE_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    pstResult->pstCacheTable  = orxHashTable_Create(orxRESOURCE_KU32_CACHE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_MAIN);
+    orxMemory_Zero(&(pstResult->stStorageList), sizeof(orxLINKLIST));
+
+    /* Creates storage */
+    pstStorage = (orxRESOURCE_STORAGE *)orxBank_Allocate(pstResult->pstStorageBank);
+
+    /* Success? */
+    if(pstStorage != orxNULL)
+    {
+      /* Stores its content */
+      pstStorage->stID = orxString_GetID(orxRESOURCE_KZ_DEFAULT_STORAGE);
+
+      /* Clears node */
+      orxMemory_Zero(&(pstStorage->stNode), sizeof(orxLINKLIST_NODE));
+
+      /* Adds it first */
+      orxLinkList_AddStart(&(pstResult->stStorageList), &(pstStorage->stNode));
+    }
+    else
+    {
+      /* Deletes it */
+      orxResource_DeleteGroup(pstResult);
+
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE orxRESOURCE_GROUP *orxResource_FindGroup(orxSTRINGID _stGroupID)
+{
+  orxRESOURCE_GROUP *pstResult;
+
+  /* Gets group */
+  for(pstResult = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+      (pstResult != orxNULL) && (pstResult->stID != _stGroupID);
+      pstResult = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstResult))
+    ;
+
+  /* Done! */
+  return pstResult;
+}
+
+static void orxFASTCALL orxResource_NotifyRequest(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_NotifyRequest");
+
+  /* While there are processed requests */
+  while(sstResource.u32RequestOutIndex != sstResource.u32RequestProcessIndex)
+  {
+    volatile orxRESOURCE_REQUEST *pstRequest;
+
+    /* Gets request */
+    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestOutIndex]);
+
+    /* Decrements operation count */
+    if(pstRequest->pstResourceInfo != orxNULL)
+    {
+      pstRequest->pstResourceInfo->u32OpCount--;
+    }
+
+    /* Has callback? */
+    if(pstRequest->pfnCallback != orxNULL)
+    {
+      /* Notifies it */
+      pstRequest->pfnCallback((orxHANDLE)pstRequest->pstResourceInfo, pstRequest->s64Size, pstRequest->pBuffer, pstRequest->pContext);
+    }
+
+    /* Updates request out index */
+    orxMEMORY_BARRIER();
+    sstResource.u32RequestOutIndex = (sstResource.u32RequestOutIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxResource_ProcessRequests(void *_pContext)
+{
+  orxSTATUS eResult;
+
+  /* Waits for worker semaphore */
+  orxThread_WaitSemaphore(sstResource.pstWorkerSemaphore);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_ProcessRequests");
+
+  /* While there are pending requests */
+  while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex)
+  {
+    volatile orxRESOURCE_REQUEST *pstRequest;
+
+    /* Gets request */
+    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestProcessIndex]);
+
+    /* Depending on request type */
+    switch(pstRequest->eType)
+    {
+      case orxRESOURCE_REQUEST_TYPE_READ:
+      {
+        /* Services it */
+        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnRead(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_WRITE:
+      {
+        /* Services it */
+        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnWrite(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_CLOSE:
+      {
+        /* Releases mapping */
+        orxResource_ReleaseMap(pstRequest->pstResourceInfo);
+
+        /* Services it */
+        pstRequest->pstResourceInfo->pstTypeInfo->pfnClose(pstRequest->pstResourceInfo->hResource);
+
+        /* Deletes location */
+        orxString_Delete(pstRequest->pstResourceInfo->zLocation);
+
+        /* Frees open info */
+        orxBank_Free(sstResource.pstOpenInfoBank, pstRequest->pstResourceInfo);
+        pstRequest->pstResourceInfo = orxNULL;
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_GET_TIME:
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+
+        /* Gets resource info */
+        pstResourceInfo = (orxRESOURCE_INFO *)pstRequest->pContext;
+
+        /* Gets its modification time (cheating for the storage) */
+        pstRequest->s64Size = pstResourceInfo->pstTypeInfo->pfnGetTime(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1);
+
+        /* Updates its status */
+        pstResourceInfo->bPendingWatch = orxFALSE;
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+
+    /* Updates request process index */
+    orxMEMORY_BARRIER();
+    sstResource.u32RequestProcessIndex = (sstResource.u32RequestProcessIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Updates result */
+  eResult = sstResource.eThreadResult;
+
+  /* Done! */
+  return eResult;
+}
+
+static orxBOOL orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64Size, void *_pBuffer, orxRESOURCE_OP_FUNCTION _pfnCallback, void *_pContext, orxRESOURCE_OPEN_INFO *_pstResourceInfo)
+{
+  orxU32  u32NextRequestIndex;
+  orxBOOL bAdd = orxTRUE;
+
+  /* Checks */
+  orxASSERT((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID) || (_eType == orxRESOURCE_REQUEST_TYPE_WATCH_NOTIFY));
+
+  /* Waits for semaphore */
+  orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+  /* Gets next request index */
+  u32NextRequestIndex = (sstResource.u32RequestInIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+
+  /* Time request? */
+  if(_eType == orxRESOURCE_REQUEST_TYPE_GET_TIME)
+  {
+    orxU32 u32InIndex, u32ProcessIndex, u32FreeSlots;
+
+    /* Gets indices */
+    u32InIndex      = sstResource.u32RequestInIndex;
+    u32ProcessIndex = sstResource.u32RequestProcessIndex;
+
+    /* Gets number of free slots */
+    u32FreeSlots = (u32InIndex >= u32ProcessIndex) ? orxRESOURCE_KU32_REQUEST_LIST_SIZE - u32InIndex + u32ProcessIndex : u32ProcessIndex - u32InIndex;
+
+    /* More than a quarter of the slots are free? */
+    if(u32FreeSlots >= orxRESOURCE_KU32_REQUEST_LIST_SIZE / 4)
+    {
+      /* Process addition */
       bAdd = orxTRUE;
     }
     else
@@ -644,6 +1677,12 @@ static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64S
       bAdd = orxFALSE;
     }
   }
+  /* Watch notification? */
+  else if(_eType == orxRESOURCE_REQUEST_TYPE_WATCH_NOTIFY)
+  {
+    /* Only adds it if there's a free slot, as the watch thread can't pump notifications */
+    bAdd = (u32NextRequestIndex != sstResource.u32RequestOutIndex) ? orxTRUE : orxFALSE;
+  }
   else
   {
     /* Waits for a free slot */
@@ -691,6 +1730,9 @@ static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64S
 
   /* Signals semaphore */
   orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+
+  /* Done! */
+  return bAdd;
 }
 
 static void orxFASTCALL orxResource_NotifyUpdateChange(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
@@ -761,22 +1803,408 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
           orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_ADD, orxNULL, orxNULL, &stPayload);
         }
       }
-      else
-      {
-        /* Stores its new modification time */
-        pstResourceInfo->s64Time = _s64Size;
+      else
+      {
+        /* Stores its new modification time */
+        pstResourceInfo->s64Time = _s64Size;
+
+        /* Removes potential pending update notification */
+        orxClock_RemoveGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, _pContext);
+
+        /* Defers update notification to cope with potential slow external resource writes */
+        orxClock_AddGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, 1, _pContext);
+      }
+    }
+    else
+    {
+      /* Stores its new modification time */
+      pstResourceInfo->s64Time = _s64Size;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  static orxS32 ss32GroupIndex = 0;
+  orxS32        s32ListCount;
+  orxU32        u32WatchCount = 0;
+  orxBOOL       bAbort = orxFALSE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_Watch");
+
+  /* Pushes config section */
+  orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+
+  /* For all watched groups */
+  for(s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); ss32GroupIndex < s32ListCount; ss32GroupIndex++)
+  {
+    orxRESOURCE_GROUP  *pstGroup;
+    orxSTRINGID         stGroupID;
+
+    /* Gets its ID */
+    stGroupID = orxString_Hash(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, ss32GroupIndex));
+
+    /* Gets group */
+    pstGroup = orxResource_FindGroup(stGroupID);
+
+    /* Found? */
+    if(pstGroup != orxNULL)
+    {
+      static orxHANDLE  shIterator;
+      orxRESOURCE_INFO *pstResourceInfo;
+
+      /* New group? */
+      if(stGroupID != sstResource.stLastWatchedGroupID)
+      {
+        /* Resets iterator */
+        shIterator = orxHANDLE_UNDEFINED;
+
+        /* Stores group ID */
+        sstResource.stLastWatchedGroupID = stGroupID;
+      }
+
+      /* For all its cached resources */
+      for(shIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, shIterator, orxNULL, (void **)&pstResourceInfo);
+          shIterator != orxHANDLE_UNDEFINED;
+          shIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, shIterator, orxNULL, (void **)&pstResourceInfo))
+      {
+        /* Does its type support time? */
+        if(pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
+        {
+          /* Not already queued? */
+          if(pstResourceInfo->bPendingWatch == orxFALSE)
+          {
+            /* Updates its status */
+            pstResourceInfo->bPendingWatch = orxTRUE;
+
+            /* Adds request */
+            if(orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL) == orxFALSE)
+            {
+              /* Dropped, will retry next time */
+              pstResourceInfo->bPendingWatch = orxFALSE;
+            }
+          }
+
+          /* Updates watch count */
+          u32WatchCount++;
+
+          /* Reached limit? */
+          if(u32WatchCount >= orxRESOURCE_KU32_WATCH_ITERATION_LIMIT)
+          {
+            /* Aborts */
+            bAbort = orxTRUE;
+
+            break;
+          }
+        }
+      }
+
+      /* Abort? */
+      if(bAbort != orxFALSE)
+      {
+        /* Stops */
+        break;
+      }
+    }
+  }
+
+  /* Watched all resources? */
+  if(ss32GroupIndex >= s32ListCount)
+  {
+    /* Reset */
+    ss32GroupIndex = 0;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return;
+}
+
+#if defined(__orxLINUX__) && !defined(__orxANDROID__)
+
+static void orxFASTCALL orxResource_NotifyWatch(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+{
+  const orxSTRING zDirectory;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_NotifyWatch");
+
+  /* Gets watched directory */
+  zDirectory = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)_s64Size);
+
+  /* Valid? */
+  if(zDirectory != orxNULL)
+  {
+    orxCHAR acPath[orxRESOURCE_KU32_BUFFER_SIZE];
+    orxS32  s32ListCount, i;
+
+    /* Composes path, as it was located */
+    if(*zDirectory != orxCHAR_NULL)
+    {
+      orxString_NPrint(acPath, sizeof(acPath), "%s%c%s", zDirectory, orxCHAR_DIRECTORY_SEPARATOR_LINUX, (const orxSTRING)_pBuffer);
+    }
+    else
+    {
+      orxString_NPrint(acPath, sizeof(acPath), "%s", (const orxSTRING)_pBuffer);
+    }
+
+    /* Pushes config section */
+    orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+
+    /* For all watched groups */
+    for(i = 0, s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); i < s32ListCount; i++)
+    {
+      orxRESOURCE_GROUP *pstGroup;
+
+      /* Gets group */
+      pstGroup = orxResource_FindGroup(orxString_Hash(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, i)));
+
+      /* Found? */
+      if(pstGroup != orxNULL)
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+        orxHANDLE         hIterator;
+
+        /* For all its cached resources */
+        for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+            hIterator != orxHANDLE_UNDEFINED;
+            hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+        {
+          /* File matching the notification and not already queued? */
+          if((pstResourceInfo->pstTypeInfo->pfnGetTime == &orxResource_File_GetTime)
+          && (pstResourceInfo->bPendingWatch == orxFALSE)
+          && (orxString_Compare(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1, acPath) == 0))
+          {
+            /* Marks it (its time request will be queued by orxResource_QueueWatch, as requests can't be added from within a notification) */
+            pstResourceInfo->bNotifiedWatch = orxTRUE;
+
+            /* Updates flags */
+            orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFIED, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+          }
+        }
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Deletes name */
+  orxString_Delete((orxSTRING)_pBuffer);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_QueueWatch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Has notified resources? */
+  if(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFIED))
+  {
+    orxRESOURCE_GROUP  *pstGroup;
+    orxBOOL             bRetry = orxFALSE;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxResource_QueueWatch");
+
+    /* For all groups */
+    for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+        pstGroup != orxNULL;
+        pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+    {
+      orxRESOURCE_INFO *pstResourceInfo;
+      orxHANDLE         hIterator;
+
+      /* For all its cached resources */
+      for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+      {
+        /* Notified? */
+        if(pstResourceInfo->bNotifiedWatch != orxFALSE)
+        {
+          /* Not already queued? */
+          if(pstResourceInfo->bPendingWatch == orxFALSE)
+          {
+            /* Updates its status */
+            pstResourceInfo->bPendingWatch = orxTRUE;
+
+            /* Adds request */
+            if(orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL) == orxFALSE)
+            {
+              /* Dropped, will retry next time */
+              pstResourceInfo->bPendingWatch = orxFALSE;
+              bRetry = orxTRUE;
+
+              continue;
+            }
+          }
+
+          /* Updates its status */
+          pstResourceInfo->bNotifiedWatch = orxFALSE;
+        }
+      }
+    }
+
+    /* Nothing left to queue? */
+    if(bRetry == orxFALSE)
+    {
+      /* Updates flags */
+      orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_NONE, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFIED);
+    }
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxResource_ProcessWatch(void *_pContext)
+{
+  struct pollfd stPollFD;
+
+  /* Inits poll info */
+  stPollFD.fd       = (int)sstResource.s32WatchFD;
+  stPollFD.events   = POLLIN;
+  stPollFD.revents  = 0;
+
+  /* Has pending events? */
+  if(poll(&stPollFD, 1, orxRESOURCE_KS32_WATCH_POLL_TIMEOUT) > 0)
+  {
+    union
+    {
+      struct inotify_event  stEvent;
+      orxCHAR               acBuffer[orxRESOURCE_KU32_WATCH_EVENT_BUFFER_SIZE];
+    } uBuffer;
+    ssize_t s;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxResource_ProcessWatch");
+
+    /* While there are events to read */
+    while((s = read(stPollFD.fd, uBuffer.acBuffer, sizeof(uBuffer))) > 0)
+    {
+      const struct inotify_event *pstEvent, *pstPreviousEvent;
+      const orxCHAR              *pc;
+
+      /* For all events */
+      for(pc = uBuffer.acBuffer, pstPreviousEvent = orxNULL; pc < uBuffer.acBuffer + s; pc += sizeof(struct inotify_event) + pstEvent->len)
+      {
+        /* Gets it */
+        pstEvent = (const struct inotify_event *)pc;
+
+        /* Is about a file and not a repeat of the previous one? */
+        if((pstEvent->len != 0)
+        && !(pstEvent->mask & IN_ISDIR)
+        && ((pstPreviousEvent == orxNULL)
+         || (pstPreviousEvent->wd != pstEvent->wd)
+         || (orxString_Compare(pstPreviousEvent->name, pstEvent->name) != 0)))
+        {
+          orxSTRING zName;
+
+          /* Duplicates its name */
+          zName = orxString_Duplicate(pstEvent->name);
+
+          /* Posts it, waiting for a free slot */
+          while((orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_WATCH_NOTIFY, (orxS64)pstEvent->wd, zName, &orxResource_NotifyWatch, orxNULL, orxNULL) == orxFALSE)
+             && (sstResource.bStopWatch == orxFALSE))
+          {
+            orxSystem_Delay(orxRESOURCE_KF_WATCH_RETRY_DELAY);
+          }
+
+          /* Stopping? */
+          if(sstResource.bStopWatch != orxFALSE)
+          {
+            /* Deletes name */
+            orxString_Delete(zName);
+
+            break;
+          }
+
+          /* Updates previous event */
+          pstPreviousEvent = pstEvent;
+        }
+      }
+    }
 
-        /* Removes potential pending update notification */
-        orxClock_RemoveGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, _pContext);
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
 
-        /* Defers update notification to cope with potential slow external resource writes */
-        orxClock_AddGlobalTimer(orxResource_NotifyUpdateChange, orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY, 1, _pContext);
+  /* Done! */
+  return (sstResource.bStopWatch == orxFALSE) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+}
+
+static void orxResource_AddWatch(orxRESOURCE_INFO *_pstResourceInfo)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY));
+
+  /* Is a file? */
+  if(_pstResourceInfo->pstTypeInfo->pfnGetTime == &orxResource_File_GetTime)
+  {
+    const orxSTRING zPath;
+    orxCHAR         acDirectory[orxRESOURCE_KU32_BUFFER_SIZE];
+    orxS32          s32Index, s32NextIndex;
+    int             iWD;
+
+    /* Gets path */
+    zPath = _pstResourceInfo->zLocation + orxString_GetLength(_pstResourceInfo->pstTypeInfo->zTag) + 1;
+
+    /* Finds last directory separator */
+    for(s32Index = orxString_SearchCharIndex(zPath, orxCHAR_DIRECTORY_SEPARATOR_LINUX, 0);
+        (s32Index >= 0) && ((s32NextIndex = orxString_SearchCharIndex(zPath, orxCHAR_DIRECTORY_SEPARATOR_LINUX, s32Index + 1)) > 0);
+        s32Index = s32NextIndex)
+      ;
+
+    /* Gets directory */
+    if(s32Index >= 0)
+    {
+      orxString_NPrint(acDirectory, orxMIN(s32Index + 1, (orxS32)sizeof(acDirectory)), "%s", zPath);
+    }
+    else
+    {
+      acDirectory[0] = orxCHAR_NULL;
+    }
+
+    /* Watches it */
+    iWD = inotify_add_watch((int)sstResource.s32WatchFD, (acDirectory[0] != orxCHAR_NULL) ? acDirectory : ".", IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+
+    /* Success? */
+    if(iWD >= 0)
+    {
+      /* New directory? */
+      if(orxHashTable_Get(sstResource.pstWatchTable, (orxU64)iWD) == orxNULL)
+      {
+        /* Stores it */
+        orxHashTable_Add(sstResource.pstWatchTable, (orxU64)iWD, orxString_Duplicate(acDirectory));
       }
     }
     else
     {
-      /* Stores its new modification time */
-      pstResourceInfo->s64Time = _s64Size;
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't watch directory of resource <%s> (errno %d), changes to it won't be detected.", _pstResourceInfo->zLocation, errno);
+    }
+
+    /* First inspection? */
+    if(_pstResourceInfo->s64Time == orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED)
+    {
+      /* Stores its modification time, as no polling will do it */
+      _pstResourceInfo->s64Time = _pstResourceInfo->pstTypeInfo->pfnGetTime(zPath);
     }
   }
 
@@ -784,105 +2212,126 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
   return;
 }
 
-static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+static void orxResource_StopWatchNotify()
 {
-  static orxS32 ss32GroupIndex = 0;
-  orxS32        s32ListCount;
-  orxU32        u32WatchCount = 0;
-  orxBOOL       bAbort = orxFALSE;
+  /* Active? */
+  if(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY))
+  {
+    orxHANDLE hIterator;
+    orxSTRING zDirectory;
 
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxResource_Watch");
+    /* Has thread? */
+    if(sstResource.u32WatchThreadID != orxU32_UNDEFINED)
+    {
+      /* Stops it */
+      sstResource.bStopWatch = orxTRUE;
+      orxMEMORY_BARRIER();
+      orxThread_Enable(orxTHREAD_GET_FLAG_FROM_ID(sstResource.u32WatchThreadID), orxTHREAD_KU32_FLAG_NONE);
+      orxThread_Join(sstResource.u32WatchThreadID);
+      sstResource.u32WatchThreadID = orxU32_UNDEFINED;
+    }
 
-  /* Pushes config section */
-  orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+    /* Closes file descriptor */
+    close((int)sstResource.s32WatchFD);
+    sstResource.s32WatchFD = -1;
 
-  /* For all watched groups */
-  for(s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); ss32GroupIndex < s32ListCount; ss32GroupIndex++)
-  {
-    orxRESOURCE_GROUP  *pstGroup;
-    orxSTRINGID         stGroupID;
+    /* For all watched directories */
+    for(hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&zDirectory);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, hIterator, orxNULL, (void **)&zDirectory))
+    {
+      /* Deletes it */
+      orxString_Delete(zDirectory);
+    }
 
-    /* Gets its ID */
-    stGroupID = orxString_Hash(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, ss32GroupIndex));
+    /* Deletes table */
+    orxHashTable_Delete(sstResource.pstWatchTable);
+    sstResource.pstWatchTable = orxNULL;
 
-    /* Gets group */
-    pstGroup = orxResource_FindGroup(stGroupID);
+    /* Updates flags */
+    orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_NONE, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY);
+  }
 
-    /* Found? */
-    if(pstGroup != orxNULL)
-    {
-      static orxHANDLE  shIterator;
-      orxRESOURCE_INFO *pstResourceInfo;
+  /* Done! */
+  return;
+}
 
-      /* New group? */
-      if(stGroupID != sstResource.stLastWatchedGroupID)
-      {
-        /* Resets iterator */
-        shIterator = orxHANDLE_UNDEFINED;
+static orxSTATUS orxResource_StartWatchNotify()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
 
-        /* Stores group ID */
-        sstResource.stLastWatchedGroupID = stGroupID;
-      }
+  /* Creates inotify instance */
+  sstResource.s32WatchFD = (orxS32)inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
 
-      /* For all its cached resources */
-      for(shIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, shIterator, orxNULL, (void **)&pstResourceInfo);
-          shIterator != orxHANDLE_UNDEFINED;
-          shIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, shIterator, orxNULL, (void **)&pstResourceInfo))
-      {
-        /* Does its type support time? */
-        if(pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
-        {
-          /* Not already queued? */
-          if(pstResourceInfo->bPendingWatch == orxFALSE)
-          {
-            /* Updates its status */
-            pstResourceInfo->bPendingWatch = orxTRUE;
+  /* Success? */
+  if(sstResource.s32WatchFD >= 0)
+  {
+    /* Creates watch table */
+    sstResource.pstWatchTable = orxHashTable_Create(orxRESOURCE_KU32_WATCH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
-            /* Adds request */
-            orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL);
-          }
+    /* Success? */
+    if(sstResource.pstWatchTable != orxNULL)
+    {
+      orxRESOURCE_GROUP *pstGroup;
 
-          /* Updates watch count */
-          u32WatchCount++;
+      /* Updates flags */
+      orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY, orxRESOURCE_KU32_STATIC_FLAG_NONE);
 
-          /* Reached limit? */
-          if(u32WatchCount >= orxRESOURCE_KU32_WATCH_ITERATION_LIMIT)
-          {
-            /* Aborts */
-            bAbort = orxTRUE;
+      /* For all groups */
+      for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+          pstGroup != orxNULL;
+          pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+        orxHANDLE         hIterator;
 
-            break;
-          }
+        /* For all its cached resources */
+        for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+            hIterator != orxHANDLE_UNDEFINED;
+            hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+        {
+          /* Watches it */
+          orxResource_AddWatch(pstResourceInfo);
         }
       }
 
-      /* Abort? */
-      if(bAbort != orxFALSE)
+      /* Starts watch thread */
+      sstResource.bStopWatch        = orxFALSE;
+      sstResource.u32WatchThreadID  = orxThread_Start(&orxResource_ProcessWatch, orxRESOURCE_KZ_WATCH_THREAD_NAME, orxNULL);
+
+      /* Success? */
+      if(sstResource.u32WatchThreadID != orxU32_UNDEFINED)
       {
-        /* Stops */
-        break;
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Stops watching */
+        orxResource_StopWatchNotify();
       }
     }
+    else
+    {
+      /* Closes file descriptor */
+      close((int)sstResource.s32WatchFD);
+      sstResource.s32WatchFD = -1;
+    }
   }
 
-  /* Watched all resources? */
-  if(ss32GroupIndex >= s32ListCount)
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
   {
-    /* Reset */
-    ss32GroupIndex = 0;
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't use inotify to watch resources, falling back to polling.");
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
-
-  /* Pops config section */
-  orxConfig_PopSection();
-
   /* Done! */
-  return;
+  return eResult;
 }
 
+#endif /* __orxLINUX__ && !__orxANDROID__ */
+
 static void orxResource_UpdatePostInit()
 {
   /* Isn't request notification callback set? */
@@ -932,11 +2381,34 @@ static void orxResource_UpdatePostInit()
         /* Has watch list? */
         if(orxConfig_HasValue(orxRESOURCE_KZ_CONFIG_WATCH_LIST) != orxFALSE)
         {
-          /* Registers watch callbacks */
-          orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxResource_Watch, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST);
+#if defined(__orxLINUX__) && !defined(__orxANDROID__)
+
+          /* Should use change notifications? */
+          if((orxConfig_HasValue(orxRESOURCE_KZ_CONFIG_WATCH_NOTIFY) == orxFALSE)
+          || (orxConfig_GetBool(orxRESOURCE_KZ_CONFIG_WATCH_NOTIFY) != orxFALSE))
+          {
+            /* Starts watching */
+            if(orxResource_StartWatchNotify() != orxSTATUS_FAILURE)
+            {
+              /* Registers queue callback */
+              orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxResource_QueueWatch, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST);
+
+              /* Updates flags */
+              orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_QUEUE_REGISTERED, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+            }
+          }
 
-          /* Updates flags */
-          orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_REGISTERED, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+#endif /* __orxLINUX__ && !__orxANDROID__ */
+
+          /* Not using change notifications? */
+          if(!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY))
+          {
+            /* Registers watch callbacks */
+            orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxResource_Watch, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST);
+
+            /* Updates flags */
+            orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_REGISTERED, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+          }
         }
 
         /* Pops config section */
@@ -1150,12 +2622,15 @@ orxSTATUS orxFASTCALL orxResource_Init()
     /* Creates semaphores */
     sstResource.pstRequestSemaphore = orxThread_CreateSemaphore(1);
     sstResource.pstWorkerSemaphore  = orxThread_CreateSemaphore(1);
+    sstResource.pstArchiveSemaphore = orxThread_CreateSemaphore(1);
 
     /* Valid? */
-    if((sstResource.pstRequestSemaphore != orxNULL) && (sstResource.pstWorkerSemaphore != orxNULL))
+    if((sstResource.pstRequestSemaphore != orxNULL) && (sstResource.pstWorkerSemaphore != orxNULL) && (sstResource.pstArchiveSemaphore != orxNULL))
     {
-      /* Inits request thread ID */
-      sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+      /* Inits request & watch thread IDs */
+      sstResource.u32RequestThreadID  = orxU32_UNDEFINED;
+      sstResource.u32WatchThreadID    = orxU32_UNDEFINED;
+      sstResource.s32WatchFD          = -1;
 
       /* Creates resource info bank */
       sstResource.pstResourceInfoBank = orxBank_Create(orxRESOURCE_KU32_RESOURCE_INFO_BANK_SIZE, sizeof(orxRESOURCE_INFO), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
@@ -1189,10 +2664,34 @@ orxSTATUS orxFASTCALL orxResource_Init()
         stTypeInfo.pfnRead    = orxResource_File_Read;
         stTypeInfo.pfnWrite   = orxResource_File_Write;
         stTypeInfo.pfnDelete  = orxResource_File_Delete;
+        stTypeInfo.pfnMap     = orxResource_File_Map;
+        stTypeInfo.pfnUnmap   = orxResource_File_Unmap;
 
         /* Registers it */
         eResult = orxResource_RegisterType(&stTypeInfo);
 
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Inits archive type */
+          stTypeInfo.zTag       = orxRESOURCE_KZ_TYPE_TAG_ARCHIVE;
+          stTypeInfo.pfnLocate  = orxResource_Archive_Locate;
+          stTypeInfo.pfnGetTime = orxNULL;
+          stTypeInfo.pfnOpen    = orxResource_Archive_Open;
+          stTypeInfo.pfnClose   = orxResource_Archive_Close;
+          stTypeInfo.pfnGetSize = orxResource_Archive_GetSize;
+          stTypeInfo.pfnSeek    = orxResource_Archive_Seek;
+          stTypeInfo.pfnTell    = orxResource_Archive_Tell;
+          stTypeInfo.pfnRead    = orxResource_Archive_Read;
+          stTypeInfo.pfnWrite   = orxNULL;
+          stTypeInfo.pfnDelete  = orxNULL;
+          stTypeInfo.pfnMap     = orxResource_Archive_Map;
+          stTypeInfo.pfnUnmap   = orxResource_Archive_Unmap;
+
+          /* Registers it */
+          eResult = orxResource_RegisterType(&stTypeInfo);
+        }
+
         /* Success? */
         if(eResult != orxSTATUS_FAILURE)
         {
@@ -1240,6 +2739,10 @@ orxSTATUS orxFASTCALL orxResource_Init()
       {
         orxThread_DeleteSemaphore(sstResource.pstWorkerSemaphore);
       }
+      if(sstResource.pstArchiveSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(sstResource.pstArchiveSemaphore);
+      }
 
       /* Deletes info bank */
       if(sstResource.pstResourceInfoBank != orxNULL)
@@ -1303,6 +2806,13 @@ void orxFASTCALL orxResource_Exit()
     /* Unregisters commands */
     orxResource_UnregisterCommands();
 
+#if defined(__orxLINUX__) && !defined(__orxANDROID__)
+
+    /* Stops watching */
+    orxResource_StopWatchNotify();
+
+#endif /* __orxLINUX__ && !__orxANDROID__ */
+
     /* Makes sure resource thread is enabled */
     orxThread_Enable(orxTHREAD_GET_FLAG_FROM_ID(sstResource.u32RequestThreadID), orxTHREAD_KU32_FLAG_NONE);
 
@@ -1320,6 +2830,17 @@ void orxFASTCALL orxResource_Exit()
     orxThread_Join(sstResource.u32RequestThreadID);
     sstResource.u32RequestThreadID = orxU32_UNDEFINED;
 
+    /* For all un-notified requests */
+    for(; sstResource.u32RequestOutIndex != sstResource.u32RequestProcessIndex; sstResource.u32RequestOutIndex = (sstResource.u32RequestOutIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1))
+    {
+      /* Watch notification? */
+      if(sstResource.astRequestList[sstResource.u32RequestOutIndex].eType == orxRESOURCE_REQUEST_TYPE_WATCH_NOTIFY)
+      {
+        /* Deletes its name */
+        orxString_Delete((orxSTRING)sstResource.astRequestList[sstResource.u32RequestOutIndex].pBuffer);
+      }
+    }
+
     /* Delete semaphores */
     orxThread_DeleteSemaphore(sstResource.pstRequestSemaphore);
     orxThread_DeleteSemaphore(sstResource.pstWorkerSemaphore);
@@ -1336,6 +2857,17 @@ void orxFASTCALL orxResource_Exit()
         /* Registers watch callbacks */
         orxClock_Unregister(orxClock_Get(orxCLOCK_KZ_CORE), orxResource_Watch);
       }
+
+#if defined(__orxLINUX__) && !defined(__orxANDROID__)
+
+      /* Has queue callback? */
+      if(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_QUEUE_REGISTERED))
+      {
+        /* Unregisters it */
+        orxClock_Unregister(orxClock_Get(orxCLOCK_KZ_CORE), orxResource_QueueWatch);
+      }
+
+#endif /* __orxLINUX__ && !__orxANDROID__ */
     }
 
     /* Has uncached location? */
@@ -1370,6 +2902,29 @@ void orxFASTCALL orxResource_Exit()
     /* Deletes open info bank */
     orxBank_Delete(sstResource.pstOpenInfoBank);
 
+    /* Has archives? */
+    if(sstResource.pstArchiveTable != orxNULL)
+    {
+      orxRESOURCE_ARCHIVE  *pstArchive;
+      orxHANDLE             hIterator;
+
+      /* For all archives */
+      for(hIterator = orxHashTable_GetNext(sstResource.pstArchiveTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstArchive);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstResource.pstArchiveTable, hIterator, orxNULL, (void **)&pstArchive))
+      {
+        /* Deletes it */
+        orxResource_Archive_Delete(pstArchive);
+      }
+
+      /* Deletes archive table */
+      orxHashTable_Delete(sstResource.pstArchiveTable);
+      sstResource.pstArchiveTable = orxNULL;
+    }
+
+    /* Deletes archive semaphore */
+    orxThread_DeleteSemaphore(sstResource.pstArchiveSemaphore);
+
     /* Checks */
     orxASSERT(orxBank_GetCount(sstResource.pstResourceInfoBank) == 0);
 
@@ -1870,11 +3425,24 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
               pstResourceInfo->stGroupID    = stGroupID;
               pstResourceInfo->stStorageID  = pstStorage->stID;
               pstResourceInfo->stNameID     = stKey;
+              pstResourceInfo->bPendingWatch  = orxFALSE;
+              pstResourceInfo->bNotifiedWatch = orxFALSE;
               orxMEMORY_BARRIER();
 
               /* Adds it to cache */
               orxHashTable_Add(pstGroup->pstCacheTable, stKey, pstResourceInfo);
 
+#if defined(__orxLINUX__) && !defined(__orxANDROID__)
+
+              /* Watching with change notifications? */
+              if(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_NOTIFY))
+              {
+                /* Watches it */
+                orxResource_AddWatch(pstResourceInfo);
+              }
+
+#endif /* __orxLINUX__ && !__orxANDROID__ */
+
               /* Updates result */
               zResult = pstResourceInfo->zLocation;
 
@@ -2201,8 +3769,10 @@ orxHANDLE orxFASTCALL orxResource_Open(const orxSTRING _zLocation, orxBOOL _bEra
       orxASSERT(pstOpenInfo != orxNULL);
 
       /* Inits it */
-      pstOpenInfo->pstTypeInfo = &(pstType->stInfo);
-      pstOpenInfo->u32OpCount = 0;
+      pstOpenInfo->pstTypeInfo  = &(pstType->stInfo);
+      pstOpenInfo->pMap         = orxNULL;
+      pstOpenInfo->s64MapSize   = 0;
+      pstOpenInfo->u32OpCount   = 0;
 
       /* Opens it */
       pstOpenInfo->hResource = pstType->stInfo.pfnOpen(_zLocation + u32TagLength + 1, _bEraseMode);
@@ -2266,6 +3836,9 @@ void orxFASTCALL orxResource_Close(orxHANDLE _hResource)
     }
     else
     {
+      /* Releases mapping */
+      orxResource_ReleaseMap(pstOpenInfo);
+
       /* Closes resource */
       pstOpenInfo->pstTypeInfo->pfnClose(pstOpenInfo->hResource);
 
@@ -2347,6 +3920,94 @@ orxS64 orxFASTCALL orxResource_GetSize(orxHANDLE _hResource)
   return s64Result;
 }
 
+/** Maps the whole content of a resource in memory, read-only, without copying it; the mapping stays valid until orxResource_Unmap or orxResource_Close is called
+ * If the resource type doesn't support mapping, orxNULL is returned and the content should be retrieved with orxResource_Read instead
+ * @param[in] _hResource        Concerned resource
+ * @param[out] _ps64Size        Size of the mapped content, in bytes
+ * @return Read-only address of the resource's content if successful, orxNULL otherwise
+ */
+const void *orxFASTCALL orxResource_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
+{
+  const void *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_ps64Size != orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_Map");
+
+  /* Clears size */
+  *_ps64Size = 0;
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Checks */
+    orxASSERT(pstOpenInfo->u32OpCount == 0);
+
+    /* Not already mapped? */
+    if(pstOpenInfo->pMap == orxNULL)
+    {
+      /* Supports mapping? */
+      if(pstOpenInfo->pstTypeInfo->pfnMap != orxNULL)
+      {
+        /* Maps it */
+        pstOpenInfo->pMap = pstOpenInfo->pstTypeInfo->pfnMap(pstOpenInfo->hResource, &(pstOpenInfo->s64MapSize));
+
+        /* Failure? */
+        if(pstOpenInfo->pMap == orxNULL)
+        {
+          /* Clears size */
+          pstOpenInfo->s64MapSize = 0;
+        }
+      }
+    }
+
+    /* Updates result */
+    pResult     = pstOpenInfo->pMap;
+    *_ps64Size  = pstOpenInfo->s64MapSize;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pResult;
+}
+
+/** Unmaps the content of a resource previously mapped with orxResource_Map
+ * @param[in] _hResource        Concerned resource
+ */
+void orxFASTCALL orxResource_Unmap(orxHANDLE _hResource)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Checks */
+    orxASSERT(pstOpenInfo->u32OpCount == 0);
+
+    /* Releases mapping */
+    orxResource_ReleaseMap(pstOpenInfo);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Seeks a position in a given resource (moves cursor)
  * @param[in] _hResource        Concerned resource
  * @param[in] _s64Offset        Number of bytes to offset from 'origin'
@@ -2693,6 +4354,14 @@ orxSTATUS orxFASTCALL orxResource_RegisterType(const orxRESOURCE_TYPE_INFO *_pst
       orxMemory_Copy(&(pstType->stInfo), _pstInfo, sizeof(orxRESOURCE_TYPE_INFO));
       pstType->stInfo.zTag = orxString_Store(_pstInfo->zTag);
 
+      /* Incomplete mapping support? */
+      if((pstType->stInfo.pfnMap == orxNULL) || (pstType->stInfo.pfnUnmap == orxNULL))
+      {
+        /* Disables it */
+        pstType->stInfo.pfnMap    = orxNULL;
+        pstType->stInfo.pfnUnmap  = orxNULL;
+      }
+
       /* Checks */
       orxASSERT(pstType->stInfo.zTag != orxNULL);
 
@@ -54,6 +54,12 @@
   #include <unistd.h>
   #include <sys/time.h>
 
+  #ifdef __orxLINUX__
+
+    #include <errno.h>
+
+  #endif /* __orxLINUX__ */
+
 #endif /* __orxWINDOWS__ */
 
 
@@ -369,9 +375,25 @@ void orxFASTCALL orxSystem_Delay(orxFLOAT _fSeconds)
 
 #else /* __orxWINDOWS__ */
 
+  #if defined(__orxLINUX__) && defined(CLOCK_MONOTONIC)
+
+  struct timespec stDelay;
+
+  /* Gets delay */
+  stDelay.tv_sec  = (time_t)_fSeconds;
+  stDelay.tv_nsec = (long)((_fSeconds - (orxFLOAT)stDelay.tv_sec) * orx2F(1000000000.0f));
+
+  /* Sleeps on the monotonic clock, resuming after interruptions */
+  while(clock_nanosleep(CLOCK_MONOTONIC, 0, &stDelay, &stDelay) == EINTR)
+    ;
+
+  #else /* __orxLINUX__ && CLOCK_MONOTONIC */
+
   /* Sleeps */
   usleep(orxF2U(_fSeconds * orx2F(1000000.0f)));
 
+  #endif /* __orxLINUX__ && CLOCK_MONOTONIC */
+
 #endif /* __orxWINDOWS__ */
 
   /* Done! */
@@ -32,6 +32,7 @@
 #include "core/orxThread.h"
 
 #include "core/orxClock.h"
+#include "core/orxConfig.h"
 #include "core/orxSystem.h"
 #include "debug/orxDebug.h"
 #include "memory/orxMemory.h"
@@ -79,6 +80,7 @@
  */
 #define orxTHREAD_KU32_STATIC_FLAG_NONE               0x00000000  /**< No flags have been set */
 #define orxTHREAD_KU32_STATIC_FLAG_READY              0x00000001  /**< Static flag */
+#define orxTHREAD_KU32_STATIC_FLAG_WORKERS            0x40000000  /**< Workers flag */
 #define orxTHREAD_KU32_STATIC_FLAG_REGISTERED         0x80000000  /**< Registered flag */
 #define orxTHREAD_KU32_STATIC_MASK_ALL                0xFFFFFFFF  /**< The module has been initialized */
 
@@ -88,14 +90,27 @@
 #define orxTHREAD_KU32_INFO_FLAG_ENABLED              0x20000000  /**< Enabled flag */
 #define orxTHREAD_KU32_INFO_MASK_ALL                  0xFFFFFFFF  /**< The module has been initialized */
 
+#define orxTHREAD_KU32_JOB_FLAG_NONE                  0x00000000  /**< No flags have been set */
+#define orxTHREAD_KU32_JOB_FLAG_SUBMITTED             0x00000001  /**< Submitted flag */
+#define orxTHREAD_KU32_JOB_FLAG_DONE                  0x00000002  /**< Done flag */
+#define orxTHREAD_KU32_JOB_MASK_ALL                   0xFFFFFFFF  /**< All mask */
+
 
 /** Misc
  */
 #define orxTHREAD_KU32_TASK_LIST_SIZE                 256
+#define orxTHREAD_KU32_MAX_WORKER_NUMBER              12          /**< Leaves some thread slots for the other modules/plugins */
+#define orxTHREAD_KU32_JOB_DEPENDENT_NUMBER           16          /**< Max number of jobs that can depend on a single job */
+#define orxTHREAD_KU32_RANGE_CHUNK_PER_THREAD         4           /**< Default number of chunks per thread for parallel for loops */
 
 #define orxTHREAD_KZ_THREAD_NAME_MAIN                 "Main"
 #define orxTHREAD_KZ_THREAD_NAME_WORKER               "Task Runner"
 
+#define orxTHREAD_KZ_CONFIG_SECTION                   "Thread"
+#define orxTHREAD_KZ_CONFIG_WORKER_COUNT              "WorkerCount"
+
+#define orxTHREAD_KZ_AUTO                             "auto"
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -134,25 +149,82 @@ typedef struct __orxTHREAD_TASK_t
   orxTHREAD_FUNCTION      pfnElse;
   void                   *pContext;
   orxSTATUS               eResult;
+  orxBOOL                 bDone;
+  orxBOOL                 bNotified;
 
 } orxTHREAD_TASK;
 
+/** Task queue (holds task list indices, oldest at head, newest at tail)
+ */
+typedef struct __orxTHREAD_QUEUE_t
+{
+  orxTHREAD_SEMAPHORE    *pstSemaphore;
+  volatile orxU32         u32Head;
+  volatile orxU32         u32Tail;
+  volatile orxU32         u32StealCount;
+  volatile orxU32         au32TaskList[orxTHREAD_KU32_TASK_LIST_SIZE];
+
+} orxTHREAD_QUEUE;
+
+/** Worker
+ */
+typedef struct __orxTHREAD_WORKER_t
+{
+  orxTHREAD_QUEUE         stQueue;
+  orxTHREAD_SEMAPHORE    *pstWakeSemaphore;
+  orxU32                  u32ThreadID;
+  volatile orxBOOL        bIdle;
+
+} orxTHREAD_WORKER;
+
+/** Job
+ */
+struct __orxTHREAD_JOB_t
+{
+  orxTHREAD_FUNCTION      pfnRun;
+  void                   *pContext;
+  orxTHREAD_JOB          *pstNext;
+  orxTHREAD_JOB          *apstDependentList[orxTHREAD_KU32_JOB_DEPENDENT_NUMBER];
+  orxU32                  u32DependentCount;
+  orxU32                  u32PendingCount;
+  orxSTATUS               eResult;
+  volatile orxU32         u32Flags;
+};
+
+/** Range (parallel for)
+ */
+typedef struct __orxTHREAD_RANGE_t
+{
+  orxTHREAD_RANGE_FUNCTION  pfnRun;
+  void                     *pContext;
+  orxU32                    u32Count;
+  orxU32                    u32Grain;
+  orxU32                    u32Next;
+  volatile orxSTATUS        eResult;
+
+} orxTHREAD_RANGE;
+
 /** Static structure
  */
 typedef struct __orxTHREAD_STATIC_t
 {
   orxTHREAD_SEMAPHORE    *pstThreadSemaphore;
   orxTHREAD_SEMAPHORE    *pstTaskSemaphore;
-  orxTHREAD_SEMAPHORE    *pstWorkerSemaphore;
+  orxTHREAD_SEMAPHORE    *pstJobSemaphore;
+  orxTHREAD_JOB          *pstJobHead;
+  orxTHREAD_JOB          *pstJobTail;
   void                   *pThreadContext;
   orxTHREAD_FUNCTION      pfnThreadStart;
   orxTHREAD_FUNCTION      pfnThreadStop;
-  orxU32                  u32WorkerID;
+  orxU32                  u32WorkerCount;
+  orxU32                  u32NextWorker;
+  volatile orxBOOL        bSerialBusy;
   volatile orxU32         u32TaskInIndex;
-  volatile orxU32         u32TaskProcessIndex;
   volatile orxU32         u32TaskOutIndex;
   volatile orxTHREAD_INFO astThreadInfoList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
   volatile orxTHREAD_TASK astTaskList[orxTHREAD_KU32_TASK_LIST_SIZE];
+  orxTHREAD_QUEUE         stSerialQueue;
+  orxTHREAD_WORKER        astWorkerList[orxTHREAD_KU32_MAX_WORKER_NUMBER];
 
   orxU32                  u32Flags;
 
@@ -238,64 +310,704 @@ static void *orxThread_Execute(void *_pContext)
 
 static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
-  /* While there are processed tasks */
-  while(sstThread.u32TaskOutIndex != sstThread.u32TaskProcessIndex)
+  orxU32 u32Index;
+
+  /* For all submitted tasks, in submission order */
+  for(u32Index = sstThread.u32TaskOutIndex; u32Index != sstThread.u32TaskInIndex; u32Index = (u32Index + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1))
   {
     volatile orxTHREAD_TASK *pstTask;
 
     /* Gets Task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskOutIndex]);
+    pstTask = &(sstThread.astTaskList[u32Index]);
 
-    /* Succeeded? */
-    if(pstTask->eResult != orxSTATUS_FAILURE)
+    /* Processed and not notified yet? */
+    if((pstTask->bDone != orxFALSE) && (pstTask->bNotified == orxFALSE))
     {
-      /* Has THEN callback? */
-      if(pstTask->pfnThen != orxNULL)
+      /* Marks it as notified (callbacks might pump notifications) */
+      pstTask->bNotified = orxTRUE;
+
+      /* Succeeded? */
+      if(pstTask->eResult != orxSTATUS_FAILURE)
       {
-        /* Calls it */
-        pstTask->pfnThen(pstTask->pContext);
+        /* Has THEN callback? */
+        if(pstTask->pfnThen != orxNULL)
+        {
+          /* Calls it */
+          pstTask->pfnThen(pstTask->pContext);
+        }
+      }
+      else
+      {
+        /* Has ELSE callback? */
+        if(pstTask->pfnElse != orxNULL)
+        {
+          /* Calls it */
+          pstTask->pfnElse(pstTask->pContext);
+        }
       }
     }
-    else
+
+    /* Oldest task notified? */
+    if((u32Index == sstThread.u32TaskOutIndex) && (pstTask->bNotified != orxFALSE))
     {
-      /* Has ELSE callback? */
-      if(pstTask->pfnElse != orxNULL)
+      /* Updates task out index */
+      orxMEMORY_BARRIER();
+      sstThread.u32TaskOutIndex = (sstThread.u32TaskOutIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxU32 orxThread_GetQueueSize(const orxTHREAD_QUEUE *_pstQueue)
+{
+  /* Done! */
+  return (_pstQueue->u32Tail - _pstQueue->u32Head) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+}
+
+static void orxFASTCALL orxThread_PushQueue(orxTHREAD_QUEUE *_pstQueue, orxU32 _u32TaskIndex)
+{
+  /* Locks queue */
+  orxThread_WaitSemaphore(_pstQueue->pstSemaphore);
+
+  /* Stores task as newest entry (never full as there can't be more tasks in flight than the task list size) */
+  _pstQueue->au32TaskList[_pstQueue->u32Tail] = _u32TaskIndex;
+  orxMEMORY_BARRIER();
+  _pstQueue->u32Tail = (_pstQueue->u32Tail + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+
+  /* Unlocks queue */
+  orxThread_SignalSemaphore(_pstQueue->pstSemaphore);
+
+  /* Done! */
+  return;
+}
+
+static orxU32 orxFASTCALL orxThread_PopQueue(orxTHREAD_QUEUE *_pstQueue, orxBOOL _bSteal)
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Not empty? */
+  if(_pstQueue->u32Head != _pstQueue->u32Tail)
+  {
+    /* Locks queue */
+    orxThread_WaitSemaphore(_pstQueue->pstSemaphore);
+
+    /* Still not empty? */
+    if(_pstQueue->u32Head != _pstQueue->u32Tail)
+    {
+      /* Steal? */
+      if(_bSteal != orxFALSE)
+      {
+        /* Takes newest entry, leaving the oldest ones to the owner */
+        _pstQueue->u32Tail = (_pstQueue->u32Tail - 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+        u32Result = _pstQueue->au32TaskList[_pstQueue->u32Tail];
+
+        /* Updates steal count */
+        _pstQueue->u32StealCount++;
+      }
+      else
       {
-        /* Calls it */
-        pstTask->pfnElse(pstTask->pContext);
+        /* Takes oldest entry */
+        u32Result = _pstQueue->au32TaskList[_pstQueue->u32Head];
+        _pstQueue->u32Head = (_pstQueue->u32Head + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
       }
     }
 
-    /* Updates task out index */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskOutIndex = (sstThread.u32TaskOutIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+    /* Unlocks queue */
+    orxThread_SignalSemaphore(_pstQueue->pstSemaphore);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxU32 orxFASTCALL orxThread_PopSerialTask()
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* No serial task in progress and queue not empty? */
+  if((sstThread.bSerialBusy == orxFALSE)
+  && (sstThread.stSerialQueue.u32Head != sstThread.stSerialQueue.u32Tail))
+  {
+    /* Locks queue */
+    orxThread_WaitSemaphore(sstThread.stSerialQueue.pstSemaphore);
+
+    /* Still available? */
+    if((sstThread.bSerialBusy == orxFALSE)
+    && (sstThread.stSerialQueue.u32Head != sstThread.stSerialQueue.u32Tail))
+    {
+      /* Takes oldest entry */
+      u32Result = sstThread.stSerialQueue.au32TaskList[sstThread.stSerialQueue.u32Head];
+      sstThread.stSerialQueue.u32Head = (sstThread.stSerialQueue.u32Head + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+
+      /* Updates status */
+      sstThread.bSerialBusy = orxTRUE;
+    }
+
+    /* Unlocks queue */
+    orxThread_SignalSemaphore(sstThread.stSerialQueue.pstSemaphore);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxU32 orxFASTCALL orxThread_GetNextTask(orxTHREAD_WORKER *_pstWorker, orxBOOL *_pbSerial)
+{
+  orxU32 u32Result;
+
+  /* Gets next serial task */
+  u32Result = orxThread_PopSerialTask();
+
+  /* Found? */
+  if(u32Result != orxU32_UNDEFINED)
+  {
+    /* Updates status */
+    *_pbSerial = orxTRUE;
+  }
+  else
+  {
+    /* Updates status */
+    *_pbSerial = orxFALSE;
+
+    /* Gets next task from own queue */
+    u32Result = orxThread_PopQueue(&(_pstWorker->stQueue), orxFALSE);
+
+    /* None? */
+    if(u32Result == orxU32_UNDEFINED)
+    {
+      orxU32 u32WorkerIndex, i;
+
+      /* Gets own index */
+      u32WorkerIndex = (orxU32)(_pstWorker - sstThread.astWorkerList);
+
+      /* For all other workers */
+      for(i = 1; (i < sstThread.u32WorkerCount) && (u32Result == orxU32_UNDEFINED); i++)
+      {
+        /* Tries to steal from it */
+        u32Result = orxThread_PopQueue(&(sstThread.astWorkerList[(u32WorkerIndex + i) % sstThread.u32WorkerCount].stQueue), orxTRUE);
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static void orxFASTCALL orxThread_WakeWorkers(orxU32 _u32Count)
+{
+  orxU32 i;
+
+  /* Makes sure pushed jobs are visible before checking idle status */
+  orxMEMORY_BARRIER();
+
+  /* For all workers */
+  for(i = 0; (i < sstThread.u32WorkerCount) && (_u32Count > 0); i++)
+  {
+    /* Is idle? */
+    if(sstThread.astWorkerList[i].bIdle != orxFALSE)
+    {
+      /* Wakes it up */
+      orxThread_SignalSemaphore(sstThread.astWorkerList[i].pstWakeSemaphore);
+
+      /* Updates count */
+      _u32Count--;
+    }
   }
 
   /* Done! */
   return;
 }
 
-static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
+static orxINLINE void orxThread_PushJob(orxTHREAD_JOB *_pstJob)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  /* Appends it to the ready list (job semaphore has to be held) */
+  _pstJob->pstNext = orxNULL;
+  if(sstThread.pstJobTail != orxNULL)
+  {
+    sstThread.pstJobTail->pstNext = _pstJob;
+  }
+  else
+  {
+    sstThread.pstJobHead = _pstJob;
+  }
+  sstThread.pstJobTail = _pstJob;
+
+  /* Done! */
+  return;
+}
 
-  /* Waits for worker semaphore */
-  orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
+static orxTHREAD_JOB *orxFASTCALL orxThread_PopJob()
+{
+  orxTHREAD_JOB *pstResult = orxNULL;
 
-  /* While there are pending requests */
-  while(sstThread.u32TaskProcessIndex != sstThread.u32TaskInIndex)
+  /* Has ready jobs? */
+  if(sstThread.pstJobHead != orxNULL)
   {
-    volatile orxTHREAD_TASK *pstTask;
+    /* Locks jobs */
+    orxThread_WaitSemaphore(sstThread.pstJobSemaphore);
+
+    /* Still has ready jobs? */
+    if(sstThread.pstJobHead != orxNULL)
+    {
+      /* Removes first one */
+      pstResult             = sstThread.pstJobHead;
+      sstThread.pstJobHead  = pstResult->pstNext;
+      if(sstThread.pstJobHead == orxNULL)
+      {
+        sstThread.pstJobTail = orxNULL;
+      }
+    }
+
+    /* Unlocks jobs */
+    orxThread_SignalSemaphore(sstThread.pstJobSemaphore);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static void orxFASTCALL orxThread_RunJob(orxTHREAD_JOB *_pstJob)
+{
+  orxU32 i, u32ReadyCount;
+
+  /* Runs it */
+  _pstJob->eResult = (_pstJob->pfnRun != orxNULL) ? _pstJob->pfnRun(_pstJob->pContext) : orxSTATUS_SUCCESS;
+
+  /* Locks jobs */
+  orxThread_WaitSemaphore(sstThread.pstJobSemaphore);
+
+  /* For all dependent jobs */
+  for(i = 0, u32ReadyCount = 0; i < _pstJob->u32DependentCount; i++)
+  {
+    orxTHREAD_JOB *pstDependent;
+
+    /* Gets it */
+    pstDependent = _pstJob->apstDependentList[i];
+
+    /* Updates its pending count */
+    orxASSERT(pstDependent->u32PendingCount > 0);
+    pstDependent->u32PendingCount--;
+
+    /* Ready and submitted? */
+    if((pstDependent->u32PendingCount == 0)
+    && (orxFLAG_TEST(pstDependent->u32Flags, orxTHREAD_KU32_JOB_FLAG_SUBMITTED)))
+    {
+      /* Pushes it */
+      orxThread_PushJob(pstDependent);
+      u32ReadyCount++;
+    }
+  }
+
+  /* Marks it as done */
+  orxMEMORY_BARRIER();
+  orxFLAG_SET(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_DONE, orxTHREAD_KU32_JOB_FLAG_NONE);
 
-    /* Gets task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskProcessIndex]);
+  /* Unlocks jobs */
+  orxThread_SignalSemaphore(sstThread.pstJobSemaphore);
+
+  /* Wakes workers for newly ready jobs (this thread will handle one of them) */
+  if(u32ReadyCount > 1)
+  {
+    orxThread_WakeWorkers(u32ReadyCount - 1);
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxThread_RunRange(void *_pContext)
+{
+  orxTHREAD_RANGE  *pstRange;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Gets range */
+  pstRange = (orxTHREAD_RANGE *)_pContext;
+
+  /* Until all chunks have been processed */
+  for(;;)
+  {
+    orxU32 u32Start;
+
+    /* Grabs next chunk */
+    orxThread_WaitSemaphore(sstThread.pstJobSemaphore);
+    u32Start = pstRange->u32Next;
+    pstRange->u32Next = (u32Start < pstRange->u32Count) ? u32Start + orxMIN(pstRange->u32Grain, pstRange->u32Count - u32Start) : u32Start;
+    orxThread_SignalSemaphore(sstThread.pstJobSemaphore);
+
+    /* Nothing left? */
+    if(u32Start >= pstRange->u32Count)
+    {
+      break;
+    }
 
     /* Runs it */
-    pstTask->eResult = (pstTask->pfnRun != orxNULL) ? pstTask->pfnRun(pstTask->pContext) : orxSTATUS_SUCCESS;
+    if(pstRange->pfnRun(u32Start, u32Start + orxMIN(pstRange->u32Grain, pstRange->u32Count - u32Start), pstRange->pContext) == orxSTATUS_FAILURE)
+    {
+      /* Updates results */
+      pstRange->eResult = orxSTATUS_FAILURE;
+      eResult           = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
+{
+  orxTHREAD_WORKER *pstWorker;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Gets worker */
+  pstWorker = (orxTHREAD_WORKER *)_pContext;
+
+  /* Updates status */
+  pstWorker->bIdle = orxTRUE;
+  orxMEMORY_BARRIER();
+
+  /* No ready jobs? */
+  if(sstThread.pstJobHead == orxNULL)
+  {
+    /* Waits for wake semaphore */
+    orxThread_WaitSemaphore(pstWorker->pstWakeSemaphore);
+  }
+
+  /* Updates status */
+  pstWorker->bIdle = orxFALSE;
 
-    /* Updates task process index */
+  /* Until there's nothing left to do */
+  for(;;)
+  {
+    orxTHREAD_JOB  *pstJob;
+    orxU32          u32TaskIndex;
+    orxBOOL         bSerial;
+
+    /* Gets next ready job (someone might be waiting on it) */
+    pstJob = orxThread_PopJob();
+
+    /* Found? */
+    if(pstJob != orxNULL)
+    {
+      /* Runs it */
+      orxThread_RunJob(pstJob);
+    }
+    /* Gets next task (own, serial or stolen) */
+    else if((u32TaskIndex = orxThread_GetNextTask(pstWorker, &bSerial)) != orxU32_UNDEFINED)
+    {
+      volatile orxTHREAD_TASK *pstTask;
+
+      /* Gets task */
+      pstTask = &(sstThread.astTaskList[u32TaskIndex]);
+
+      /* Runs it */
+      pstTask->eResult = (pstTask->pfnRun != orxNULL) ? pstTask->pfnRun(pstTask->pContext) : orxSTATUS_SUCCESS;
+
+      /* Marks it as done */
+      orxMEMORY_BARRIER();
+      pstTask->bDone = orxTRUE;
+
+      /* Was serial? */
+      if(bSerial != orxFALSE)
+      {
+        /* Releases serial lane */
+        orxMEMORY_BARRIER();
+        sstThread.bSerialBusy = orxFALSE;
+      }
+    }
+    else
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxU32 orxFASTCALL orxThread_GetCoreCount()
+{
+  orxU32 u32Result;
+
+#ifdef __orxWINDOWS__
+
+  SYSTEM_INFO stInfo;
+
+  /* Gets system info */
+  GetSystemInfo(&stInfo);
+
+  /* Updates result */
+  u32Result = (orxU32)stInfo.dwNumberOfProcessors;
+
+#else /* __orxWINDOWS__ */
+
+  long lCount;
+
+  /* Gets online processor count */
+  lCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+  /* Updates result */
+  u32Result = (lCount > 0) ? (orxU32)lCount : 1;
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxSTATUS orxFASTCALL orxThread_StartWorkers()
+{
+  orxU32    u32WorkerCount, u32CoreCount, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Gets core count */
+  u32CoreCount = orxThread_GetCoreCount();
+
+  /* Defaults to one worker per core, minus the main thread */
+  u32WorkerCount = u32CoreCount - 1;
+
+  /* Is config module initialized? */
+  if(orxModule_IsInitialized(orxMODULE_ID_CONFIG) != orxFALSE)
+  {
+    /* Pushes config section */
+    orxConfig_PushSection(orxTHREAD_KZ_CONFIG_SECTION);
+
+    /* Has explicit worker count? */
+    if((orxConfig_HasValue(orxTHREAD_KZ_CONFIG_WORKER_COUNT) != orxFALSE)
+    && (orxString_ICompare(orxConfig_GetString(orxTHREAD_KZ_CONFIG_WORKER_COUNT), orxTHREAD_KZ_AUTO) != 0))
+    {
+      /* Gets it */
+      u32WorkerCount = orxConfig_GetU32(orxTHREAD_KZ_CONFIG_WORKER_COUNT);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Clamps it */
+  u32WorkerCount = orxCLAMP(u32WorkerCount, 1, orxTHREAD_KU32_MAX_WORKER_NUMBER);
+
+  /* For all workers */
+  for(i = 0; i < u32WorkerCount; i++)
+  {
+    orxTHREAD_WORKER *pstWorker;
+
+    /* Gets it */
+    pstWorker = &(sstThread.astWorkerList[i]);
+
+    /* Creates its semaphores */
+    pstWorker->stQueue.pstSemaphore = orxThread_CreateSemaphore(1);
+    pstWorker->pstWakeSemaphore     = orxThread_CreateSemaphore(1);
+
+    /* Success? */
+    if((pstWorker->stQueue.pstSemaphore != orxNULL) && (pstWorker->pstWakeSemaphore != orxNULL))
+    {
+      /* Waits for wake semaphore */
+      orxThread_WaitSemaphore(pstWorker->pstWakeSemaphore);
+
+      /* Starts worker thread */
+      pstWorker->u32ThreadID = orxThread_Start(orxThread_Work, orxTHREAD_KZ_THREAD_NAME_WORKER, pstWorker);
+    }
+    else
+    {
+      /* Updates worker */
+      pstWorker->u32ThreadID = orxU32_UNDEFINED;
+    }
+
+    /* Failure? */
+    if(pstWorker->u32ThreadID == orxU32_UNDEFINED)
+    {
+      /* Deletes its semaphores */
+      if(pstWorker->stQueue.pstSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(pstWorker->stQueue.pstSemaphore);
+      }
+      if(pstWorker->pstWakeSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(pstWorker->pstWakeSemaphore);
+      }
+
+      /* Cleans it */
+      orxMemory_Zero(pstWorker, sizeof(orxTHREAD_WORKER));
+
+      /* Stops here */
+      break;
+    }
+
+#ifdef __orxLINUX__
+
+    {
+      cpu_set_t stSet;
+      orxU32    j;
+
+      /* Sets CPU affinity mask to all cores (would otherwise be inherited from the main thread) */
+      CPU_ZERO(&stSet);
+      for(j = 0; j < u32CoreCount; j++)
+      {
+        CPU_SET(j, &stSet);
+      }
+
+      /* Applies it */
+      pthread_setaffinity_np(sstThread.astThreadInfoList[pstWorker->u32ThreadID].hThread, sizeof(cpu_set_t), &stSet);
+    }
+
+#endif /* __orxLINUX__ */
+  }
+
+  /* Stores worker count */
+  sstThread.u32WorkerCount = i;
+
+  /* Success? */
+  if(i != 0)
+  {
+    /* Updates status */
+    orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_WORKERS, orxTHREAD_KU32_STATIC_FLAG_NONE);
+
+    /* Partial? */
+    if(i != u32WorkerCount)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start all task workers: %u/%u running.", i, u32WorkerCount);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start internal worker thread.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxThread_AddTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext, orxBOOL _bSerial)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+
+  /* Is notify callback not registered? */
+  if(!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED))
+  {
+    /* Are we on main thread, is clock module initialized, are workers running and did we register callback? */
+    if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+    && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
+    && ((orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_WORKERS)) || (orxThread_StartWorkers() != orxSTATUS_FAILURE))
+    && (orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxThread_NotifyTask, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST) != orxSTATUS_FAILURE))
+    {
+      /* Updates status */
+      orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED, orxTHREAD_KU32_STATIC_FLAG_NONE);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    volatile orxTHREAD_TASK  *pstTask;
+    orxTHREAD_WORKER         *pstWorker;
+    orxU32                    u32TaskIndex, u32NextTaskIndex, u32ThreadID, i;
+
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Gets next task index */
+    u32NextTaskIndex = (sstThread.u32TaskInIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+
+    /* Waits for a free slot */
+    while(u32NextTaskIndex == sstThread.u32TaskOutIndex)
+    {
+      /* On main thread? */
+      if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+      {
+        /* Manually pumps some task notifications */
+        orxThread_NotifyTask(orxNULL, orxNULL);
+      }
+    }
+    /* Gets current task */
+    u32TaskIndex  = sstThread.u32TaskInIndex;
+    pstTask       = &(sstThread.astTaskList[u32TaskIndex]);
+
+    /* Inits it */
+    pstTask->pfnRun     = _pfnRun;
+    pstTask->pfnThen    = _pfnThen;
+    pstTask->pfnElse    = _pfnElse;
+    pstTask->pContext   = _pContext;
+    pstTask->bDone      = orxFALSE;
+    pstTask->bNotified  = orxFALSE;
+
+    /* Commits Task */
     orxMEMORY_BARRIER();
-    sstThread.u32TaskProcessIndex = (sstThread.u32TaskProcessIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+    sstThread.u32TaskInIndex = u32NextTaskIndex;
+
+    /* Gets current thread */
+    u32ThreadID = orxThread_GetCurrent();
+
+    /* Finds its worker, if any */
+    for(i = 0; (i < sstThread.u32WorkerCount) && (sstThread.astWorkerList[i].u32ThreadID != u32ThreadID); i++)
+      ;
+
+    /* Not a worker? */
+    if(i == sstThread.u32WorkerCount)
+    {
+      /* Picks the next one */
+      i = sstThread.u32NextWorker;
+      sstThread.u32NextWorker = (sstThread.u32NextWorker + 1) % sstThread.u32WorkerCount;
+    }
+
+    /* Gets worker */
+    pstWorker = &(sstThread.astWorkerList[i]);
+
+    /* Queues task */
+    orxThread_PushQueue((_bSerial != orxFALSE) ? &(sstThread.stSerialQueue) : &(pstWorker->stQueue), u32TaskIndex);
+
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Wakes worker */
+    orxThread_SignalSemaphore(pstWorker->pstWakeSemaphore);
+
+    /* Has a backlog? */
+    if(orxThread_GetQueueSize(&(pstWorker->stQueue)) > 1)
+    {
+      orxU32 j;
+
+      /* For all other workers */
+      for(j = 1; j < sstThread.u32WorkerCount; j++)
+      {
+        orxTHREAD_WORKER *pstOther;
+
+        /* Gets it */
+        pstOther = &(sstThread.astWorkerList[(i + j) % sstThread.u32WorkerCount]);
+
+        /* Is idle? */
+        if(pstOther->bIdle != orxFALSE)
+        {
+          /* Wakes it up so that it can steal some work */
+          orxThread_SignalSemaphore(pstOther->pstWakeSemaphore);
+
+          break;
+        }
+      }
+    }
   }
 
   /* Done! */
@@ -352,12 +1064,13 @@ orxSTATUS orxFASTCALL orxThread_Init()
     sstThread.u32Flags |= orxTHREAD_KU32_STATIC_FLAG_READY;
 
     /* Creates semaphores */
-    sstThread.pstThreadSemaphore  = orxThread_CreateSemaphore(1);
-    sstThread.pstTaskSemaphore    = orxThread_CreateSemaphore(1);
-    sstThread.pstWorkerSemaphore  = orxThread_CreateSemaphore(1);
+    sstThread.pstThreadSemaphore          = orxThread_CreateSemaphore(1);
+    sstThread.pstTaskSemaphore            = orxThread_CreateSemaphore(1);
+    sstThread.pstJobSemaphore             = orxThread_CreateSemaphore(1);
+    sstThread.stSerialQueue.pstSemaphore  = orxThread_CreateSemaphore(1);
 
     /* Success? */
-    if((sstThread.pstThreadSemaphore != orxNULL) && (sstThread.pstTaskSemaphore != orxNULL) && (sstThread.pstWorkerSemaphore != orxNULL))
+    if((sstThread.pstThreadSemaphore != orxNULL) && (sstThread.pstTaskSemaphore != orxNULL) && (sstThread.pstJobSemaphore != orxNULL) && (sstThread.stSerialQueue.pstSemaphore != orxNULL))
     {
 #ifdef __orxWINDOWS__
 
@@ -386,49 +1099,19 @@ orxSTATUS orxFASTCALL orxThread_Init()
         cpu_set_t stSet;
 
         /* Sets CPU affinity mask */
-        CPU_ZERO(&stSet);
-        CPU_SET(0, &stSet);
-
-        /* Applies it */
-        pthread_setaffinity_np(sstThread.astThreadInfoList[orxTHREAD_KU32_MAIN_THREAD_ID].hThread, sizeof(cpu_set_t), &stSet);
-      }
-
-  #endif /* __orxLINUX__ */
-
-#endif /* __orxWINDOWS__ */
-
-      /* Waits for worker semaphore */
-      orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
-
-      /* Creates worker thread */
-      sstThread.u32WorkerID = orxThread_Start(orxThread_Work, orxTHREAD_KZ_THREAD_NAME_WORKER, orxNULL);
-
-      /* Success? */
-      if(sstThread.u32WorkerID != orxU32_UNDEFINED)
-      {
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-      }
-      else
-      {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start internal worker thread.");
-
-        /* Deletes semaphores */
-        orxThread_DeleteSemaphore(sstThread.pstThreadSemaphore);
-        orxThread_DeleteSemaphore(sstThread.pstTaskSemaphore);
-        orxThread_DeleteSemaphore(sstThread.pstWorkerSemaphore);
+        CPU_ZERO(&stSet);
+        CPU_SET(0, &stSet);
 
-#ifdef __orxWINDOWS__
+        /* Applies it */
+        pthread_setaffinity_np(sstThread.astThreadInfoList[orxTHREAD_KU32_MAIN_THREAD_ID].hThread, sizeof(cpu_set_t), &stSet);
+      }
 
-        /* Asks for small time slices */
-        timeEndPeriod(1);
+  #endif /* __orxLINUX__ */
 
 #endif /* __orxWINDOWS__ */
 
-        /* Updates status */
-        sstThread.u32Flags &= ~orxTHREAD_KU32_STATIC_FLAG_READY;
-      }
+      /* Updates result (workers will be started along with the first task, once config is available) */
+      eResult = orxSTATUS_SUCCESS;
     }
     else
     {
@@ -444,9 +1127,13 @@ orxSTATUS orxFASTCALL orxThread_Init()
       {
         orxThread_DeleteSemaphore(sstThread.pstTaskSemaphore);
       }
-      if(sstThread.pstWorkerSemaphore != orxNULL)
+      if(sstThread.pstJobSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(sstThread.pstJobSemaphore);
+      }
+      if(sstThread.stSerialQueue.pstSemaphore != orxNULL)
       {
-        orxThread_DeleteSemaphore(sstThread.pstWorkerSemaphore);
+        orxThread_DeleteSemaphore(sstThread.stSerialQueue.pstSemaphore);
       }
 
       /* Updates status */
@@ -462,6 +1149,8 @@ orxSTATUS orxFASTCALL orxThread_Init()
  */
 void orxFASTCALL orxThread_Exit()
 {
+  orxU32 i;
+
   /* Checks */
   if((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY)
   {
@@ -476,19 +1165,35 @@ void orxFASTCALL orxThread_Exit()
       }
     }
 
-    /* Updates worker thread stop flag */
-    orxFLAG_SET(sstThread.astThreadInfoList[sstThread.u32WorkerID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      /* Updates worker thread stop flag */
+      orxFLAG_SET(sstThread.astThreadInfoList[sstThread.astWorkerList[i].u32ThreadID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    }
     orxMEMORY_BARRIER();
 
     /* Re-enables all threads */
     orxThread_Enable(orxTHREAD_KU32_MASK_ALL, orxTHREAD_KU32_FLAG_NONE);
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      /* Signals its wake semaphore */
+      orxThread_SignalSemaphore(sstThread.astWorkerList[i].pstWakeSemaphore);
+    }
 
     /* Joins all remaining threads */
     orxThread_JoinAll();
 
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      /* Deletes its semaphores */
+      orxThread_DeleteSemaphore(sstThread.astWorkerList[i].stQueue.pstSemaphore);
+      orxThread_DeleteSemaphore(sstThread.astWorkerList[i].pstWakeSemaphore);
+    }
+
 #ifdef __orxWINDOWS__
 
     /* Resets time slices */
@@ -499,7 +1204,8 @@ void orxFASTCALL orxThread_Exit()
     /* Deletes semaphores */
     orxThread_DeleteSemaphore(sstThread.pstThreadSemaphore);
     orxThread_DeleteSemaphore(sstThread.pstTaskSemaphore);
-    orxThread_DeleteSemaphore(sstThread.pstWorkerSemaphore);
+    orxThread_DeleteSemaphore(sstThread.pstJobSemaphore);
+    orxThread_DeleteSemaphore(sstThread.stSerialQueue.pstSemaphore);
 
     /* Cleans static controller */
     orxMemory_Zero(&sstThread, sizeof(orxTHREAD_STATIC));
@@ -1050,8 +1756,8 @@ orxSTATUS orxFASTCALL orxThread_SignalSemaphore(orxTHREAD_SEMAPHORE *_pstSemapho
   return eResult;
 }
 
-/** Runs an asynchronous task and optional follow-ups
- * @param[in]   _pfnRun                               Asynchronous task to run, executed on a different thread dedicated to tasks
+/** Runs an asynchronous task and optional follow-ups, serialized with all the other non-parallel tasks
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on one of the task worker threads, only after all the previously submitted non-parallel tasks have completed
  * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pContext                             Context that will be transmitted to all the task functions
@@ -1061,107 +1767,403 @@ orxSTATUS orxFASTCALL orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const
 {
   orxSTATUS eResult;
 
+  /* Adds task */
+  eResult = orxThread_AddTask(_pfnRun, _pfnThen, _pfnElse, _pContext, orxTRUE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Runs an asynchronous task and optional follow-ups, concurrently with any other tasks
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on one of the task worker threads, with no ordering guarantee
+ * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL, might be called before the follow-ups of previously submitted tasks
+ * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL, might be called before the follow-ups of previously submitted tasks
+ * @param[in]   _pContext                             Context that will be transmitted to all the task functions
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_RunParallelTask(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext)
+{
+  orxSTATUS eResult;
+
+  /* Adds task */
+  eResult = orxThread_AddTask(_pfnRun, _pfnThen, _pfnElse, _pContext, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
+ * @return      Number of pending asynchronous tasks
+ */
+orxU32 orxFASTCALL orxThread_GetTaskCount()
+{
+  orxU32 u32TaskInIndex, u32TaskOutIndex, u32Result;
+
   /* Checks */
   orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
 
-  /* Is notify callback not registered? */
-  if(!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED))
+  /* On main thread? */
+  if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
   {
-    /* Are we on main thread, is clock module initialized and did we register callback? */
-    if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-    && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
-    && (orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), orxThread_NotifyTask, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST) != orxSTATUS_FAILURE))
+    /* Manually pumps some task notifications */
+    orxThread_NotifyTask(orxNULL, orxNULL);
+  }
+
+  /* Gets indices */
+  u32TaskInIndex  = sstThread.u32TaskInIndex;
+  u32TaskOutIndex = sstThread.u32TaskOutIndex;
+
+  /* Updates result */
+  u32Result = (u32TaskInIndex >= u32TaskOutIndex) ? u32TaskInIndex - u32TaskOutIndex : u32TaskInIndex + orxTHREAD_KU32_TASK_LIST_SIZE - u32TaskOutIndex;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets number of task worker threads
+ * @return      Number of task worker threads, 0 if they haven't been started yet
+ */
+orxU32 orxFASTCALL orxThread_GetWorkerCount()
+{
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstThread.u32WorkerCount;
+}
+
+/** Gets number of asynchronous tasks queued and not yet picked up by a worker
+ * @return      Number of queued asynchronous tasks
+ */
+orxU32 orxFASTCALL orxThread_GetQueuedTaskCount()
+{
+  orxU32 i, u32Result;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+
+  /* For all queues */
+  for(i = 0, u32Result = orxThread_GetQueueSize(&(sstThread.stSerialQueue)); i < sstThread.u32WorkerCount; i++)
+  {
+    /* Updates result */
+    u32Result += orxThread_GetQueueSize(&(sstThread.astWorkerList[i].stQueue));
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets number of asynchronous tasks that have been stolen by a worker from another worker's queue, since the module was initialized
+ * @return      Number of stolen tasks
+ */
+orxU32 orxFASTCALL orxThread_GetTaskStealCount()
+{
+  orxU32 i, u32Result;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+
+  /* For all workers */
+  for(i = 0, u32Result = 0; i < sstThread.u32WorkerCount; i++)
+  {
+    /* Updates result */
+    u32Result += sstThread.astWorkerList[i].stQueue.u32StealCount;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Creates a job, to be submitted with orxThread_SubmitJob once all its dependencies have been added
+ * @param[in]   _pfnRun                               Function to run, on any worker thread or on a thread waiting for a job, if orxNULL defaults to an empty job that always succeeds
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxTHREAD_JOB / orxNULL
+ */
+orxTHREAD_JOB *orxFASTCALL orxThread_CreateJob(const orxTHREAD_FUNCTION _pfnRun, void *_pContext)
+{
+  orxTHREAD_JOB *pstResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+
+  /* Allocates it */
+  pstResult = (orxTHREAD_JOB *)orxMemory_Allocate(sizeof(orxTHREAD_JOB), orxMEMORY_TYPE_MAIN);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxTHREAD_JOB));
+    pstResult->pfnRun   = _pfnRun;
+    pstResult->pContext = _pContext;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a job, which should either be done or have never been submitted nor used as a dependency
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_DeleteJob(orxTHREAD_JOB *_pstJob)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+
+  /* Not in progress? */
+  if((orxFLAG_TEST(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_DONE))
+  || (!orxFLAG_TEST(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_SUBMITTED)))
+  {
+    /* Frees it */
+    orxMemory_Free(_pstJob);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't delete job <%p>: it's still in progress.", _pstJob);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a dependency to a job: it will only run once the dependency is done
+ * @param[in]   _pstJob                               Concerned job, must not have been submitted yet
+ * @param[in]   _pstDependency                        Job to wait for
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_AddJobDependency(orxTHREAD_JOB *_pstJob, orxTHREAD_JOB *_pstDependency)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+  orxASSERT(_pstDependency != orxNULL);
+  orxASSERT(_pstJob != _pstDependency);
+  orxASSERT(!orxFLAG_TEST(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_SUBMITTED));
+
+  /* Locks jobs */
+  orxThread_WaitSemaphore(sstThread.pstJobSemaphore);
+
+  /* Dependency not done yet? */
+  if(!orxFLAG_TEST(_pstDependency->u32Flags, orxTHREAD_KU32_JOB_FLAG_DONE))
+  {
+    /* Has room? */
+    if(_pstDependency->u32DependentCount < orxTHREAD_KU32_JOB_DEPENDENT_NUMBER)
     {
-      /* Updates status */
-      orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED, orxTHREAD_KU32_STATIC_FLAG_NONE);
+      /* Adds job to its dependents */
+      _pstDependency->apstDependentList[_pstDependency->u32DependentCount++] = _pstJob;
 
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
+      /* Updates job's pending count */
+      _pstJob->u32PendingCount++;
     }
     else
     {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't add dependency to job <%p>: job <%p> already has %u dependents.", _pstJob, _pstDependency, orxTHREAD_KU32_JOB_DEPENDENT_NUMBER);
+
       /* Updates result */
       eResult = orxSTATUS_FAILURE;
     }
   }
-  else
+
+  /* Unlocks jobs */
+  orxThread_SignalSemaphore(sstThread.pstJobSemaphore);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Submits a job: it will run as soon as all its dependencies are done
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_SubmitJob(orxTHREAD_JOB *_pstJob)
+{
+  orxBOOL   bReady;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+  orxASSERT(!orxFLAG_TEST(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_SUBMITTED));
+
+  /* Workers not started yet and on main thread? */
+  if((!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_WORKERS))
+  && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
   {
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
+    /* Starts them (jobs will otherwise run on waiting threads) */
+    orxThread_StartWorkers();
   }
 
-  /* Valid? */
-  if(eResult != orxSTATUS_FAILURE)
+  /* Locks jobs */
+  orxThread_WaitSemaphore(sstThread.pstJobSemaphore);
+
+  /* Updates status */
+  orxFLAG_SET(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_SUBMITTED, orxTHREAD_KU32_JOB_FLAG_NONE);
+
+  /* Ready? */
+  bReady = (_pstJob->u32PendingCount == 0) ? orxTRUE : orxFALSE;
+  if(bReady != orxFALSE)
   {
-    volatile orxTHREAD_TASK  *pstTask;
-    orxU32                    u32NextTaskIndex;
+    /* Pushes it */
+    orxThread_PushJob(_pstJob);
+  }
 
-    /* Waits for task semaphore */
-    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+  /* Unlocks jobs */
+  orxThread_SignalSemaphore(sstThread.pstJobSemaphore);
 
-    /* Gets next task index */
-    u32NextTaskIndex = (sstThread.u32TaskInIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+  /* Was ready? */
+  if(bReady != orxFALSE)
+  {
+    /* Wakes a worker */
+    orxThread_WakeWorkers(1);
+  }
 
-    /* Waits for a free slot */
-    while(u32NextTaskIndex == sstThread.u32TaskOutIndex)
-    {
-      /* On main thread? */
-      if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-      {
-        /* Manually pumps some task notifications */
-        orxThread_NotifyTask(orxNULL, orxNULL);
-      }
-    }
-    /* Gets current task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskInIndex]);
+  /* Done! */
+  return eResult;
+}
 
-    /* Inits it */
-    pstTask->pfnRun   = _pfnRun;
-    pstTask->pfnThen  = _pfnThen;
-    pstTask->pfnElse  = _pfnElse;
-    pstTask->pContext = _pContext;
+/** Waits for a job to be done, running ready jobs on the calling thread in the meantime
+ * @param[in]   _pstJob                               Concerned job, must have been submitted
+ * @return      Job's result: orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_WaitJob(orxTHREAD_JOB *_pstJob)
+{
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+  orxASSERT(orxFLAG_TEST(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_SUBMITTED));
 
-    /* Commits Task */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskInIndex = u32NextTaskIndex;
+  /* While not done */
+  while(!orxFLAG_TEST(_pstJob->u32Flags, orxTHREAD_KU32_JOB_FLAG_DONE))
+  {
+    orxTHREAD_JOB *pstJob;
 
-    /* Signals task semaphore */
-    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+    /* Gets next ready job */
+    pstJob = orxThread_PopJob();
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    /* Found? */
+    if(pstJob != orxNULL)
+    {
+      /* Helps running it */
+      orxThread_RunJob(pstJob);
+    }
+    else
+    {
+      /* Yields */
+      orxThread_Yield();
+    }
   }
+  orxMEMORY_BARRIER();
 
   /* Done! */
-  return eResult;
+  return _pstJob->eResult;
 }
 
-/** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
- * @return      Number of pending asynchronous tasks
+/** Runs a function over a range of indices, split in chunks processed in parallel by the worker threads and the calling thread, and waits for completion
+ * @param[in]   _u32Count                             Number of indices, [0, _u32Count[
+ * @param[in]   _u32Grain                             Max number of indices per chunk, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run for each chunk, can be called concurrently from different threads
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxSTATUS_SUCCESS if all chunks succeeded, orxSTATUS_FAILURE otherwise
  */
-orxU32 orxFASTCALL orxThread_GetTaskCount()
+orxSTATUS orxFASTCALL orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_RANGE_FUNCTION _pfnRun, void *_pContext)
 {
-  orxU32 u32TaskInIndex, u32TaskOutIndex, u32Result;
+  orxTHREAD_RANGE stRange;
+  orxU32          u32ThreadCount, u32ChunkCount, u32JobCount;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
   orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnRun != orxNULL);
 
-  /* On main thread? */
-  if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+  /* Workers not started yet and on main thread? */
+  if((!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_WORKERS))
+  && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
   {
-    /* Manually pumps some task notifications */
-    orxThread_NotifyTask(orxNULL, orxNULL);
+    /* Starts them */
+    orxThread_StartWorkers();
   }
 
-  /* Gets indices */
-  u32TaskInIndex  = sstThread.u32TaskInIndex;
-  u32TaskOutIndex = sstThread.u32TaskOutIndex;
+  /* Gets number of threads (workers + caller) */
+  u32ThreadCount = sstThread.u32WorkerCount + 1;
 
-  /* Updates result */
-  u32Result = (u32TaskInIndex >= u32TaskOutIndex) ? u32TaskInIndex - u32TaskOutIndex : u32TaskInIndex + orxTHREAD_KU32_TASK_LIST_SIZE - u32TaskOutIndex;
+  /* Gets grain */
+  if(_u32Grain == 0)
+  {
+    _u32Grain = orxMAX(_u32Count / (u32ThreadCount * orxTHREAD_KU32_RANGE_CHUNK_PER_THREAD), 1);
+  }
+
+  /* Gets number of chunks & jobs */
+  u32ChunkCount = (_u32Count + _u32Grain - 1) / _u32Grain;
+  u32JobCount   = orxMIN(u32ChunkCount, u32ThreadCount);
+
+  /* Inits range */
+  stRange.pfnRun    = _pfnRun;
+  stRange.pContext  = _pContext;
+  stRange.u32Count  = _u32Count;
+  stRange.u32Grain  = _u32Grain;
+  stRange.u32Next   = 0;
+  stRange.eResult   = orxSTATUS_SUCCESS;
+
+  /* Single job? */
+  if(u32JobCount <= 1)
+  {
+    /* Runs it inline */
+    if(_u32Count > 0)
+    {
+      eResult = _pfnRun(0, _u32Count, _pContext);
+    }
+  }
+  else
+  {
+    orxTHREAD_JOB astJobList[orxTHREAD_KU32_MAX_WORKER_NUMBER + 1];
+    orxU32        i;
+
+    /* Locks jobs */
+    orxThread_WaitSemaphore(sstThread.pstJobSemaphore);
+
+    /* For all jobs */
+    for(i = 0; i < u32JobCount; i++)
+    {
+      /* Inits it (each job will grab chunks until none are left) */
+      orxMemory_Zero(&(astJobList[i]), sizeof(orxTHREAD_JOB));
+      astJobList[i].pfnRun    = orxThread_RunRange;
+      astJobList[i].pContext  = &stRange;
+      astJobList[i].u32Flags  = orxTHREAD_KU32_JOB_FLAG_SUBMITTED;
+
+      /* Pushes it */
+      orxThread_PushJob(&(astJobList[i]));
+    }
+
+    /* Unlocks jobs */
+    orxThread_SignalSemaphore(sstThread.pstJobSemaphore);
+
+    /* Wakes workers */
+    orxThread_WakeWorkers(u32JobCount - 1);
+
+    /* For all jobs */
+    for(i = 0; i < u32JobCount; i++)
+    {
+      /* Waits for it */
+      orxThread_WaitJob(&(astJobList[i]));
+    }
+
+    /* Updates result */
+    eResult = stRange.eResult;
+  }
 
   /* Done! */
-  return u32Result;
+  return eResult;
 }
 
 /** Sets callbacks to run when starting and stopping new threads
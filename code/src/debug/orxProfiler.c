@@ -35,6 +35,7 @@
 #include "memory/orxMemory.h"
 #include "core/orxSystem.h"
 #include "core/orxThread.h"
+#include "io/orxFile.h"
 #include "utils/orxString.h"
 
 
@@ -50,6 +51,7 @@
 #define orxPROFILER_KU32_STATIC_FLAG_READY        0x00000001
 #define orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS   0x10000000
 #define orxPROFILER_KU32_STATIC_FLAG_PAUSED       0x20000000
+#define orxPROFILER_KU32_STATIC_FLAG_TRACE        0x40000000
 
 #define orxPROFILER_KU32_STATIC_MASK_ALL          0xFFFFFFFF
 
@@ -68,11 +70,20 @@
 /** Misc defines
  */
 #define orxPROFILER_KU32_MAX_MARKER_NUMBER        (orxPROFILER_KU32_MASK_MARKER_ID + 1)
-#define orxPROFILER_KU32_SHIFT_MARKER_ID          7
-#define orxPROFILER_KU32_MASK_MARKER_ID           0x7F
+#define orxPROFILER_KU32_SHIFT_MARKER_ID          12
+#define orxPROFILER_KU32_MASK_MARKER_ID           0xFFF
 #define orxPROFILER_KS32_MARKER_ID_ROOT           -2
 #define orxPROFILER_KU32_MARKER_DATA_NUMBER       orxTHREAD_KU32_MAX_THREAD_NUMBER
 
+#define orxPROFILER_KU32_MARKER_CHUNK_NUMBER      (orxPROFILER_KU32_MAX_MARKER_NUMBER >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK)
+#define orxPROFILER_KU32_MARKER_CHUNK_SIZE        (orxPROFILER_KU32_MASK_MARKER_CHUNK + 1)
+#define orxPROFILER_KU32_SHIFT_MARKER_CHUNK       7
+#define orxPROFILER_KU32_MASK_MARKER_CHUNK        0x7F
+
+#define orxPROFILER_KU32_TRACE_EVENT_NUMBER       65536
+#define orxPROFILER_KU32_TRACE_EVENT_PUSH         0
+#define orxPROFILER_KU32_TRACE_EVENT_POP          1
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -109,13 +120,41 @@ typedef struct __orxPROFILER_MARKER_INFO_t
 
 } orxPROFILER_MARKER_INFO;
 
+/** Internal marker chunk structure
+ */
+typedef struct __orxPROFILER_MARKER_CHUNK_t
+{
+  orxPROFILER_HISTORY_ENTRY aastHistory[orxPROFILER_KU32_HISTORY_LENGTH][orxPROFILER_KU32_MARKER_CHUNK_SIZE];
+  orxPROFILER_MARKER_INFO astMarkerInfoList[orxPROFILER_KU32_MARKER_CHUNK_SIZE];
+
+} orxPROFILER_MARKER_CHUNK;
+
+/** Internal trace event structure
+ */
+typedef struct __orxPROFILER_TRACE_EVENT_t
+{
+  orxDOUBLE               dTimeStamp;
+  orxS32                  s32MarkerID;
+  orxU32                  u32Type;
+
+} orxPROFILER_TRACE_EVENT;
+
+/** Internal trace structure (ring buffer, written only by its owner thread)
+ */
+typedef struct __orxPROFILER_TRACE_t
+{
+  orxPROFILER_TRACE_EVENT astEventList[orxPROFILER_KU32_TRACE_EVENT_NUMBER];
+  volatile orxU32         u32Count;
+
+} orxPROFILER_TRACE;
+
 /** Internal marker data structure
  */
 typedef struct __orxPROFILER_MARKER_DATA_t
 {
-  orxPROFILER_HISTORY_ENTRY aastHistory[orxPROFILER_KU32_HISTORY_LENGTH][orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxPROFILER_MARKER_CHUNK *apstChunkList[orxPROFILER_KU32_MARKER_CHUNK_NUMBER];
+  orxPROFILER_TRACE      *pstTrace;
   orxDOUBLE               adTimeStampHistory[orxPROFILER_KU32_HISTORY_LENGTH];
-  orxPROFILER_MARKER_INFO astMarkerInfoList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
   orxS32                  s32MarkerCount;
   orxS32                  s32CurrentMarker;
   orxU32                  u32MarkerPopToSkip;
@@ -136,7 +175,7 @@ typedef struct __orxPROFILER_STATIC_t
   orxU32                  u32QueryDataIndex;
   orxS32                  s32MarkerCount;
   orxTHREAD_SEMAPHORE    *pstSemaphore;
-  orxPROFILER_MARKER      astMarkerList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxPROFILER_MARKER     *apstMarkerChunkList[orxPROFILER_KU32_MARKER_CHUNK_NUMBER];
   orxU32                  u32Flags;
 
   orxPROFILER_MARKER_DATA *apstMarkerDataList[orxPROFILER_KU32_MARKER_DATA_NUMBER];
@@ -170,8 +209,6 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
   /* Not yet created? */
   if((pstResult == orxNULL) && (_bReadOnly == orxFALSE))
   {
-    orxU32 i;
-
     /* Allocates it */
     pstResult = (orxPROFILER_MARKER_DATA *)orxMemory_Allocate(sizeof(orxPROFILER_MARKER_DATA), orxMEMORY_TYPE_DEBUG);
 
@@ -183,14 +220,6 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
     pstResult->adTimeStampHistory[pstResult->u32HistoryIndex] = orxSystem_GetTime();
     pstResult->s32CurrentMarker = orxPROFILER_KS32_MARKER_ID_ROOT;
 
-    /* Inits all marker info */
-    for(i = 0; i < orxPROFILER_KU32_MAX_MARKER_NUMBER; i++)
-    {
-      pstResult->astMarkerInfoList[i].dTimeStamp  = orxDOUBLE_0;
-      pstResult->astMarkerInfoList[i].s32ParentID = orxPROFILER_KS32_MARKER_ID_NONE;
-      pstResult->astMarkerInfoList[i].u32Flags    = orxPROFILER_KU32_FLAG_UNIQUE;
-    }
-
     /* Stores it */
     orxMEMORY_BARRIER();
     sstProfiler.apstMarkerDataList[_u32ID] = pstResult;
@@ -200,6 +229,158 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
   return pstResult;
 }
 
+static orxINLINE orxPROFILER_MARKER_CHUNK *orxProfiler_GetMarkerChunk(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID, orxBOOL _bReadOnly)
+{
+  orxPROFILER_MARKER_CHUNK *pstResult;
+  orxU32                    u32ChunkIndex;
+
+  /* Checks */
+  orxASSERT((_s32ID >= 0) && (_s32ID < orxPROFILER_KU32_MAX_MARKER_NUMBER));
+
+  /* Gets chunk index */
+  u32ChunkIndex = (orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK;
+
+  /* Gets chunk */
+  pstResult = _pstData->apstChunkList[u32ChunkIndex];
+
+  /* Not yet created? */
+  if((pstResult == orxNULL) && (_bReadOnly == orxFALSE))
+  {
+    /* Allocates it */
+    pstResult = (orxPROFILER_MARKER_CHUNK *)orxMemory_Allocate(sizeof(orxPROFILER_MARKER_CHUNK), orxMEMORY_TYPE_DEBUG);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      orxU32 i;
+
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxPROFILER_MARKER_CHUNK));
+
+      /* Inits all marker info */
+      for(i = 0; i < orxPROFILER_KU32_MARKER_CHUNK_SIZE; i++)
+      {
+        pstResult->astMarkerInfoList[i].dTimeStamp  = orxDOUBLE_0;
+        pstResult->astMarkerInfoList[i].s32ParentID = orxPROFILER_KS32_MARKER_ID_NONE;
+        pstResult->astMarkerInfoList[i].u32Flags    = orxPROFILER_KU32_FLAG_UNIQUE;
+      }
+
+      /* Stores it */
+      orxMEMORY_BARRIER();
+      _pstData->apstChunkList[u32ChunkIndex] = pstResult;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE orxPROFILER_MARKER_INFO *orxProfiler_GetMarkerInfo(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID)
+{
+  /* Checks */
+  orxASSERT(_pstData->apstChunkList[(orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK] != orxNULL);
+
+  /* Done! */
+  return &(_pstData->apstChunkList[(orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK]->astMarkerInfoList[_s32ID & orxPROFILER_KU32_MASK_MARKER_CHUNK]);
+}
+
+static orxINLINE orxPROFILER_HISTORY_ENTRY *orxProfiler_GetHistoryEntry(orxPROFILER_MARKER_DATA *_pstData, orxU32 _u32HistoryIndex, orxS32 _s32ID)
+{
+  /* Checks */
+  orxASSERT(_pstData->apstChunkList[(orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK] != orxNULL);
+
+  /* Done! */
+  return &(_pstData->apstChunkList[(orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK]->aastHistory[_u32HistoryIndex][_s32ID & orxPROFILER_KU32_MASK_MARKER_CHUNK]);
+}
+
+static orxINLINE orxBOOL orxProfiler_IsMarkerDefined(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID)
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = ((_s32ID < sstProfiler.s32MarkerCount)
+          && (orxProfiler_GetMarkerChunk(_pstData, _s32ID, orxTRUE) != orxNULL)
+          && (orxFLAG_TEST(orxProfiler_GetMarkerInfo(_pstData, _s32ID)->u32Flags, orxPROFILER_KU32_FLAG_DEFINED))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+static orxINLINE orxPROFILER_MARKER *orxProfiler_GetMarker(orxS32 _s32ID)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.apstMarkerChunkList[(orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK] != orxNULL);
+
+  /* Done! */
+  return &(sstProfiler.apstMarkerChunkList[(orxU32)_s32ID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK][_s32ID & orxPROFILER_KU32_MASK_MARKER_CHUNK]);
+}
+
+static orxINLINE void orxProfiler_AddTraceEvent(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID, orxU32 _u32Type, orxDOUBLE _dTimeStamp)
+{
+  /* No trace yet? */
+  if(_pstData->pstTrace == orxNULL)
+  {
+    orxPROFILER_TRACE *pstTrace;
+
+    /* Allocates it */
+    pstTrace = (orxPROFILER_TRACE *)orxMemory_Allocate(sizeof(orxPROFILER_TRACE), orxMEMORY_TYPE_DEBUG);
+
+    /* Success? */
+    if(pstTrace != orxNULL)
+    {
+      /* Inits it */
+      pstTrace->u32Count = 0;
+
+      /* Stores it */
+      orxMEMORY_BARRIER();
+      _pstData->pstTrace = pstTrace;
+    }
+  }
+
+  /* Valid? */
+  if(_pstData->pstTrace != orxNULL)
+  {
+    orxPROFILER_TRACE_EVENT *pstEvent;
+
+    /* Gets next event slot */
+    pstEvent = &(_pstData->pstTrace->astEventList[_pstData->pstTrace->u32Count & (orxPROFILER_KU32_TRACE_EVENT_NUMBER - 1)]);
+
+    /* Stores event */
+    pstEvent->dTimeStamp  = _dTimeStamp;
+    pstEvent->s32MarkerID = _s32ID;
+    pstEvent->u32Type     = _u32Type;
+
+    /* Publishes it */
+    orxMEMORY_BARRIER();
+    _pstData->pstTrace->u32Count++;
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxProfiler_PrintTraceString(orxFILE *_pstFile, const orxSTRING _zString)
+{
+  const orxCHAR *pc;
+
+  /* For all characters */
+  for(pc = _zString; *pc != orxCHAR_NULL; pc++)
+  {
+    /* Needs escaping? */
+    if((*pc == '"') || (*pc == '\\'))
+    {
+      orxFile_Print(_pstFile, "\\%c", *pc);
+    }
+    else
+    {
+      orxFile_Print(_pstFile, "%c", *pc);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetCurrentMarkerData()
 {
   orxU32                    u32ThreadID;
@@ -226,21 +407,37 @@ static orxINLINE void orxProfiler_ResetData(orxPROFILER_MARKER_DATA *_pstData)
   /* For all markers */
   for(i = 0; i < sstProfiler.s32MarkerCount; i++)
   {
-    orxPROFILER_HISTORY_ENTRY *pstEntry;
+    orxPROFILER_MARKER_CHUNK *pstChunk;
 
-    /* Gets its info */
-    pstEntry = &(_pstData->aastHistory[u32NextIndex][i]);
+    /* Gets its chunk */
+    pstChunk = orxProfiler_GetMarkerChunk(_pstData, i, orxTRUE);
 
-    /* Inits it */
-    pstEntry->dFirstTimeStamp   = orxDOUBLE_0;
-    pstEntry->dCumulatedTime    = orxDOUBLE_0;
-    pstEntry->dMaxCumulatedTime = _pstData->aastHistory[_pstData->u32HistoryIndex][i].dMaxCumulatedTime;
-    pstEntry->u32PushCount      = 0;
-    pstEntry->u32Depth          = 0;
-
-    /* Resets marker */
-    _pstData->astMarkerInfoList[i].dTimeStamp = orxDOUBLE_0;
-    orxFLAG_SET(_pstData->astMarkerInfoList[i].u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT);
+    /* Valid? */
+    if(pstChunk != orxNULL)
+    {
+      orxPROFILER_HISTORY_ENTRY *pstEntry;
+      orxPROFILER_MARKER_INFO   *pstMarkerInfo;
+
+      /* Gets its info */
+      pstEntry      = orxProfiler_GetHistoryEntry(_pstData, u32NextIndex, i);
+      pstMarkerInfo = orxProfiler_GetMarkerInfo(_pstData, i);
+
+      /* Inits it */
+      pstEntry->dFirstTimeStamp   = orxDOUBLE_0;
+      pstEntry->dCumulatedTime    = orxDOUBLE_0;
+      pstEntry->dMaxCumulatedTime = orxProfiler_GetHistoryEntry(_pstData, _pstData->u32HistoryIndex, i)->dMaxCumulatedTime;
+      pstEntry->u32PushCount      = 0;
+      pstEntry->u32Depth          = 0;
+
+      /* Resets marker */
+      pstMarkerInfo->dTimeStamp = orxDOUBLE_0;
+      orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT);
+    }
+    else
+    {
+      /* Skips the whole chunk */
+      i |= orxPROFILER_KU32_MASK_MARKER_CHUNK;
+    }
   }
 
   /* Updates new time stamps */
@@ -349,6 +546,26 @@ void orxFASTCALL orxProfiler_Exit()
       /* Valid? */
       if(pstData != orxNULL)
       {
+        orxU32 j;
+
+        /* For all chunks */
+        for(j = 0; j < orxPROFILER_KU32_MARKER_CHUNK_NUMBER; j++)
+        {
+          /* Valid? */
+          if(pstData->apstChunkList[j] != orxNULL)
+          {
+            /* Deletes it */
+            orxMemory_Free(pstData->apstChunkList[j]);
+          }
+        }
+
+        /* Has trace? */
+        if(pstData->pstTrace != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(pstData->pstTrace);
+        }
+
         /* Deletes data */
         orxMemory_Free(pstData);
         sstProfiler.apstMarkerDataList[i] = orxNULL;
@@ -359,7 +576,18 @@ void orxFASTCALL orxProfiler_Exit()
     for(i = 0; i < (orxU32)sstProfiler.s32MarkerCount; i++)
     {
       /* Deletes its name */
-      orxString_Delete(sstProfiler.astMarkerList[i].zName);
+      orxString_Delete(orxProfiler_GetMarker(i)->zName);
+    }
+
+    /* For all marker chunks */
+    for(i = 0; i < orxPROFILER_KU32_MARKER_CHUNK_NUMBER; i++)
+    {
+      /* Valid? */
+      if(sstProfiler.apstMarkerChunkList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstProfiler.apstMarkerChunkList[i]);
+      }
     }
 
     /* Deletes semaphore */
@@ -401,7 +629,7 @@ orxS32 orxFASTCALL orxProfiler_GetIDFromName(const orxSTRING _zName)
   for(s32MarkerID = 0; s32MarkerID < sstProfiler.s32MarkerCount; s32MarkerID++)
   {
     /* Matches? */
-    if(stNameID == sstProfiler.astMarkerList[s32MarkerID].stNameID)
+    if(stNameID == orxProfiler_GetMarker(s32MarkerID)->stNameID)
     {
       /* Stops */
       break;
@@ -411,16 +639,42 @@ orxS32 orxFASTCALL orxProfiler_GetIDFromName(const orxSTRING _zName)
   /* Not found? */
   if(s32MarkerID >= sstProfiler.s32MarkerCount)
   {
+    orxU32 u32ChunkIndex;
+
+    /* Gets chunk index */
+    u32ChunkIndex = (orxU32)s32MarkerID >> orxPROFILER_KU32_SHIFT_MARKER_CHUNK;
+
+    /* Needs a new chunk? */
+    if((s32MarkerID < orxPROFILER_KU32_MAX_MARKER_NUMBER) && (sstProfiler.apstMarkerChunkList[u32ChunkIndex] == orxNULL))
+    {
+      orxPROFILER_MARKER *astMarkerList;
+
+      /* Allocates it */
+      astMarkerList = (orxPROFILER_MARKER *)orxMemory_Allocate(orxPROFILER_KU32_MARKER_CHUNK_SIZE * sizeof(orxPROFILER_MARKER), orxMEMORY_TYPE_DEBUG);
+
+      /* Success? */
+      if(astMarkerList != orxNULL)
+      {
+        /* Cleans it */
+        orxMemory_Zero(astMarkerList, orxPROFILER_KU32_MARKER_CHUNK_SIZE * sizeof(orxPROFILER_MARKER));
+
+        /* Stores it */
+        orxMEMORY_BARRIER();
+        sstProfiler.apstMarkerChunkList[u32ChunkIndex] = astMarkerList;
+      }
+    }
+
     /* Has free marker IDs? */
-    if(sstProfiler.s32MarkerCount < orxPROFILER_KU32_MAX_MARKER_NUMBER)
+    if((s32MarkerID < orxPROFILER_KU32_MAX_MARKER_NUMBER) && (sstProfiler.apstMarkerChunkList[u32ChunkIndex] != orxNULL))
     {
+      /* Inits it */
+      orxProfiler_GetMarker(s32MarkerID)->stNameID = stNameID;
+      orxProfiler_GetMarker(s32MarkerID)->zName    = orxString_Duplicate(_zName);
+
       /* Updates marker count */
+      orxMEMORY_BARRIER();
       sstProfiler.s32MarkerCount++;
 
-      /* Inits it */
-      sstProfiler.astMarkerList[s32MarkerID].stNameID = stNameID;
-      sstProfiler.astMarkerList[s32MarkerID].zName    = orxString_Duplicate(_zName);
-
       /* Stamps result */
       s32MarkerID |= sstProfiler.s32WaterStamp;
     }
@@ -499,14 +753,14 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
       s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
       /* Valid marker ID? */
-      if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount))
+      if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxProfiler_GetMarkerChunk(pstData, s32ID, orxFALSE) != orxNULL))
       {
         orxPROFILER_MARKER_INFO    *pstMarkerInfo;
         orxPROFILER_HISTORY_ENTRY  *pstEntry;
 
         /* Gets marker & current info */
-        pstMarkerInfo = &(pstData->astMarkerInfoList[s32ID]);
-        pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][s32ID]);
+        pstMarkerInfo = orxProfiler_GetMarkerInfo(pstData, s32ID);
+        pstEntry      = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryIndex, s32ID);
 
         /* Not already pushed? */
         if(!orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED))
@@ -538,21 +792,16 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
               /* For all markers */
               for(i = 0; i < sstProfiler.s32MarkerCount; i++)
               {
-                orxPROFILER_MARKER_INFO *pstTestMarkerInfo;
-
-                /* Gets it */
-                pstTestMarkerInfo = &(pstData->astMarkerInfoList[i]);
-
                 /* Is child of current marker? */
-                if(pstTestMarkerInfo->s32ParentID == s32ID)
+                if((orxProfiler_IsMarkerDefined(pstData, i) != orxFALSE) && (orxProfiler_GetMarkerInfo(pstData, i)->s32ParentID == s32ID))
                 {
                   /* Updates its depth */
-                  pstData->aastHistory[pstData->u32HistoryIndex][i].u32Depth--;
+                  orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryIndex, i)->u32Depth--;
                 }
               }
             }
             /* Is parent non-unique? */
-            else if((pstData->s32CurrentMarker >= 0) && (!orxFLAG_TEST(pstData->astMarkerInfoList[pstData->s32CurrentMarker].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE)))
+            else if((pstData->s32CurrentMarker >= 0) && (!orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, pstData->s32CurrentMarker)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE)))
             {
               /* Updates flags */
               orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT|orxPROFILER_KU32_FLAG_DEFINED, orxPROFILER_KU32_FLAG_UNIQUE);
@@ -602,6 +851,13 @@ void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
 
           /* Stores time stamp */
           pstMarkerInfo->dTimeStamp = dTimeStamp;
+
+          /* Is tracing? */
+          if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE))
+          {
+            /* Adds push event */
+            orxProfiler_AddTraceEvent(pstData, s32ID, orxPROFILER_KU32_TRACE_EVENT_PUSH, dTimeStamp);
+          }
         }
         else
         {
@@ -654,13 +910,24 @@ void orxFASTCALL orxProfiler_PopMarker()
         {
           orxPROFILER_MARKER_INFO    *pstMarkerInfo;
           orxPROFILER_HISTORY_ENTRY  *pstEntry;
+          orxDOUBLE                   dTimeStamp;
 
           /* Gets marker & current info */
-          pstMarkerInfo = &(pstData->astMarkerInfoList[pstData->s32CurrentMarker]);
-          pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][pstData->s32CurrentMarker]);
+          pstMarkerInfo = orxProfiler_GetMarkerInfo(pstData, pstData->s32CurrentMarker);
+          pstEntry      = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryIndex, pstData->s32CurrentMarker);
+
+          /* Gets time stamp */
+          dTimeStamp = orxSystem_GetTime();
+
+          /* Is tracing? */
+          if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE))
+          {
+            /* Adds pop event */
+            orxProfiler_AddTraceEvent(pstData, pstData->s32CurrentMarker, orxPROFILER_KU32_TRACE_EVENT_POP, dTimeStamp);
+          }
 
           /* Updates cumulated time */
-          pstEntry->dCumulatedTime += orxSystem_GetTime() - pstMarkerInfo->dTimeStamp;
+          pstEntry->dCumulatedTime += dTimeStamp - pstMarkerInfo->dTimeStamp;
 
           /* Updates max cumulated time */
           if(pstEntry->dCumulatedTime > pstEntry->dMaxCumulatedTime)
@@ -829,8 +1096,17 @@ void orxFASTCALL orxProfiler_ResetAllMaxima()
         /* For all markers */
         for(j = 0; j < sstProfiler.s32MarkerCount; j++)
         {
-          /* Resets its maximum */
-          pstData->aastHistory[u32Index][j].dMaxCumulatedTime = pstData->aastHistory[u32Index][j].dCumulatedTime;
+          /* Has data? */
+          if(orxProfiler_GetMarkerChunk(pstData, j, orxTRUE) != orxNULL)
+          {
+            /* Resets its maximum */
+            orxProfiler_GetHistoryEntry(pstData, u32Index, j)->dMaxCumulatedTime = orxProfiler_GetHistoryEntry(pstData, u32Index, j)->dCumulatedTime;
+          }
+          else
+          {
+            /* Skips the whole chunk */
+            j |= orxPROFILER_KU32_MASK_MARKER_CHUNK;
+          }
         }
 
       }
@@ -958,7 +1234,7 @@ orxS32 orxFASTCALL orxProfiler_GetNextMarkerID(orxS32 _s32MarkerID)
         /* Prepares ID for next potential iteration */
         _s32MarkerID = s32Result;
       }
-    } while((s32Result != orxPROFILER_KS32_MARKER_ID_NONE) && (!orxFLAG_TEST(pstData->astMarkerInfoList[s32Result & orxPROFILER_KU32_MASK_MARKER_ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)));
+    } while((s32Result != orxPROFILER_KS32_MARKER_ID_NONE) && (orxProfiler_IsMarkerDefined(pstData, s32Result & orxPROFILER_KU32_MASK_MARKER_ID) == orxFALSE));
   }
   else
   {
@@ -999,7 +1275,7 @@ orxS32 orxFASTCALL orxProfiler_GetNextSortedMarkerID(orxS32 _s32MarkerID)
       s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
       /* Get previous marker's time stamp */
-      dPreviousTime = ((s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED))) ? pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dFirstTimeStamp : orxDOUBLE_0;
+      dPreviousTime = (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE) ? orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dFirstTimeStamp : orxDOUBLE_0;
     }
     else
     {
@@ -1014,12 +1290,12 @@ orxS32 orxFASTCALL orxProfiler_GetNextSortedMarkerID(orxS32 _s32MarkerID)
     for(i = 0, dBestTime = orxSystem_GetTime(); i < sstProfiler.s32MarkerCount; i++)
     {
       // Defined?
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[i].u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
+      if(orxProfiler_IsMarkerDefined(pstData, i) != orxFALSE)
       {
         orxDOUBLE dTime;
 
         /* Gets its time */
-        dTime = pstData->aastHistory[pstData->u32HistoryQueryIndex][i].dFirstTimeStamp;
+        dTime = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, i)->dFirstTimeStamp;
 
         /* Is better candidate? */
         if((((dTime == dPreviousTime)
@@ -1101,10 +1377,10 @@ orxDOUBLE orxFASTCALL orxProfiler_GetMarkerTime(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE))
     {
       /* Updates result */
-      dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dCumulatedTime;
+      dResult = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dCumulatedTime;
     }
     else
     {
@@ -1150,10 +1426,10 @@ orxDOUBLE orxFASTCALL orxProfiler_GetMarkerMaxTime(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE))
     {
       /* Updates result */
-      dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dMaxCumulatedTime;
+      dResult = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dMaxCumulatedTime;
     }
     else
     {
@@ -1194,7 +1470,7 @@ const orxSTRING orxFASTCALL orxProfiler_GetMarkerName(orxS32 _s32MarkerID)
   if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount))
   {
     /* Updates result */
-    zResult = sstProfiler.astMarkerList[s32ID].zName;
+    zResult = orxProfiler_GetMarker(s32ID)->zName;
   }
   else
   {
@@ -1234,10 +1510,10 @@ orxU32 orxFASTCALL orxProfiler_GetMarkerPushCount(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE))
     {
       /* Updates result */
-      u32Result = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].u32PushCount;
+      u32Result = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->u32PushCount;
     }
     else
     {
@@ -1283,10 +1559,10 @@ orxBOOL orxFASTCALL orxProfiler_IsUniqueMarker(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE))
     {
       /* Updates result */
-      bResult = orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE) ? orxTRUE : orxFALSE;
+      bResult = orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE) ? orxTRUE : orxFALSE;
     }
     else
     {
@@ -1332,18 +1608,18 @@ orxDOUBLE orxFASTCALL orxProfiler_GetUniqueMarkerStartTime(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE))
     {
       /* Is unique? */
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+      if(orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
       {
         /* Updates result */
-        dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dFirstTimeStamp;
+        dResult = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->dFirstTimeStamp;
       }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get start time of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", sstProfiler.astMarkerList[s32ID].zName, _s32MarkerID);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get start time of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", orxProfiler_GetMarker(s32ID)->zName, _s32MarkerID);
 
         /* Updates result */
         dResult = orxDOUBLE_0;
@@ -1393,18 +1669,18 @@ orxU32 orxFASTCALL orxProfiler_GetUniqueMarkerDepth(orxS32 _s32MarkerID)
     s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
     /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
+    if((s32ID >= 0) && (orxProfiler_IsMarkerDefined(pstData, s32ID) != orxFALSE))
     {
       /* Is unique? */
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+      if(orxFLAG_TEST(orxProfiler_GetMarkerInfo(pstData, s32ID)->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
       {
         /* Updates result */
-        u32Result = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].u32Depth;
+        u32Result = orxProfiler_GetHistoryEntry(pstData, pstData->u32HistoryQueryIndex, s32ID)->u32Depth;
       }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get push depth of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", sstProfiler.astMarkerList[s32ID].zName, _s32MarkerID);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get push depth of marker <%s> [ID: %d] as it hasn't been uniquely pushed.", orxProfiler_GetMarker(s32ID)->zName, _s32MarkerID);
 
         /* Updates result */
         u32Result = 0;
@@ -1429,6 +1705,163 @@ orxU32 orxFASTCALL orxProfiler_GetUniqueMarkerDepth(orxS32 _s32MarkerID)
   return u32Result;
 }
 
+/** Enables/disables event tracing: when enabled, every marker push/pop is recorded, with its time stamp, in a per-thread ring buffer
+ * @param[in] _bEnable          Enable
+ */
+void orxFASTCALL orxProfiler_EnableTrace(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE, orxPROFILER_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_TRACE);
+  }
+}
+
+/** Is event tracing enabled?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsTraceEnabled()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE) ? orxTRUE : orxFALSE;
+}
+
+/** Exports all the recorded trace events to a file, using the Chrome Trace Event JSON format (can be opened with chrome://tracing or Perfetto)
+ * @param[in] _zFileName        Name of the file to write
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_ExportTrace(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Is file module initialized? */
+  if(orxModule_IsInitialized(orxMODULE_ID_FILE) != orxFALSE)
+  {
+    orxPROFILER_TRACE_EVENT *astEventList;
+
+    /* Allocates event copy buffer */
+    astEventList = (orxPROFILER_TRACE_EVENT *)orxMemory_Allocate(orxPROFILER_KU32_TRACE_EVENT_NUMBER * sizeof(orxPROFILER_TRACE_EVENT), orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(astEventList != orxNULL)
+    {
+      orxFILE *pstFile;
+
+      /* Opens file */
+      pstFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+      /* Success? */
+      if(pstFile != orxNULL)
+      {
+        orxBOOL bWritten = orxFALSE;
+        orxU32  i;
+
+        /* Writes header */
+        orxFile_Print(pstFile, "{\"traceEvents\":[\n");
+
+        /* For all marker data */
+        for(i = 0; i < orxPROFILER_KU32_MARKER_DATA_NUMBER; i++)
+        {
+          orxPROFILER_MARKER_DATA *pstData;
+
+          /* Gets it */
+          pstData = sstProfiler.apstMarkerDataList[i];
+
+          /* Valid? */
+          if(pstData != orxNULL)
+          {
+            orxPROFILER_TRACE *pstTrace;
+
+            /* Writes thread name, separated from previous events if any */
+            orxFile_Print(pstFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"", (bWritten != orxFALSE) ? ",\n" : orxSTRING_EMPTY, i);
+            orxProfiler_PrintTraceString(pstFile, orxThread_GetName(i));
+            orxFile_Print(pstFile, "\"}}");
+
+            /* Updates status */
+            bWritten = orxTRUE;
+
+            /* Gets its trace */
+            pstTrace = pstData->pstTrace;
+
+            /* Valid? */
+            if(pstTrace != orxNULL)
+            {
+              orxU32 u32Start, u32End, u32Count, u32Skip, j;
+
+              /* Gets available event range */
+              u32End = pstTrace->u32Count;
+              orxMEMORY_BARRIER();
+              u32Start = (u32End > orxPROFILER_KU32_TRACE_EVENT_NUMBER) ? u32End - orxPROFILER_KU32_TRACE_EVENT_NUMBER : 0;
+              u32Count = u32End - u32Start;
+
+              /* Copies events */
+              for(j = 0; j < u32Count; j++)
+              {
+                astEventList[j] = pstTrace->astEventList[(u32Start + j) & (orxPROFILER_KU32_TRACE_EVENT_NUMBER - 1)];
+              }
+
+              /* Gets number of events that might have been overwritten by their thread while copying */
+              orxMEMORY_BARRIER();
+              u32Skip = pstTrace->u32Count - u32Start;
+              u32Skip = (u32Skip > orxPROFILER_KU32_TRACE_EVENT_NUMBER) ? orxMIN(u32Skip - orxPROFILER_KU32_TRACE_EVENT_NUMBER, u32Count) : 0;
+
+              /* For all valid events */
+              for(j = u32Skip; j < u32Count; j++)
+              {
+                /* Writes it */
+                orxFile_Print(pstFile, ",\n{\"name\":\"");
+                orxProfiler_PrintTraceString(pstFile, orxProfiler_GetMarker(astEventList[j].s32MarkerID)->zName);
+                orxFile_Print(pstFile, "\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%u}", (astEventList[j].u32Type == orxPROFILER_KU32_TRACE_EVENT_PUSH) ? 'B' : 'E', astEventList[j].dTimeStamp * 1e6, i);
+              }
+            }
+          }
+        }
+
+        /* Writes footer */
+        orxFile_Print(pstFile, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+        /* Closes file */
+        orxFile_Close(pstFile);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't export trace: couldn't open file <%s>.", _zFileName);
+      }
+
+      /* Frees event copy buffer */
+      orxMemory_Free(astEventList);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't export trace to <%s>: file module isn't initialized.", _zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 #ifdef __orxMSVC__
   #pragma warning(default : 4244)
 #endif /* __orxMSVC__ */
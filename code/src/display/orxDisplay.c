@@ -144,6 +144,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetBitmapID, orxU32, const orxBITMAP *
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_TransformBitmap, orxSTATUS, const orxBITMAP *, const orxDISPLAY_TRANSFORM *, orxRGBA, orxDISPLAY_SMOOTHING, orxDISPLAY_BLEND_MODE);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_TransformText, orxSTATUS, const orxSTRING, const orxBITMAP *, const orxCHARACTER_MAP *, const orxDISPLAY_TRANSFORM *, orxRGBA, orxDISPLAY_SMOOTHING, orxDISPLAY_BLEND_MODE);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_TransformCharacterList, orxSTATUS, const orxCHARACTER_QUAD *, orxU32, const orxBITMAP *, const orxCHARACTER_MAP *, const orxDISPLAY_TRANSFORM *, orxRGBA, orxDISPLAY_SMOOTHING, orxDISPLAY_BLEND_MODE);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawLine, orxSTATUS, const orxVECTOR *, const orxVECTOR *, orxRGBA);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawPolyline, orxSTATUS, const orxVECTOR *, orxU32, orxRGBA);
@@ -161,6 +162,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetParameterID, orxS32, const orxHANDL
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetShaderBitmap, orxSTATUS, orxHANDLE, orxS32, const orxBITMAP *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetShaderFloat, orxSTATUS, orxHANDLE, orxS32, orxFLOAT);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetShaderVector, orxSTATUS, orxHANDLE, orxS32, const orxVECTOR *);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetShaderParamBlock, orxSTATUS, orxHANDLE, orxU32, const orxS32 *, const orxU32 *, const orxFLOAT *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetShaderID, orxU32, const orxHANDLE);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_EnableVSync, orxSTATUS, orxBOOL);
@@ -239,6 +241,8 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_VIDEO_MODE_COUNT, orxDisplay_GetV
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_VIDEO_MODE, orxDisplay_GetVideoMode)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SET_VIDEO_MODE, orxDisplay_SetVideoMode)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, IS_VIDEO_MODE_AVAILABLE, orxDisplay_IsVideoModeAvailable)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, TRANSFORM_CHARACTER_LIST, orxDisplay_TransformCharacterList)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SET_SHADER_PARAM_BLOCK, orxDisplay_SetShaderParamBlock)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(DISPLAY)
 
@@ -265,6 +269,11 @@ orxSTATUS orxFASTCALL orxDisplay_TransformText(const orxSTRING _zString, const o
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_TransformText)(_zString, _pstFont, _pstMap, _pstTransform, _stColor, _eSmoothing, _eBlendMode);
 }
 
+orxSTATUS orxFASTCALL orxDisplay_TransformCharacterList(const orxCHARACTER_QUAD *_astQuadList, orxU32 _u32QuadNumber, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_TransformCharacterList)(_astQuadList, _u32QuadNumber, _pstFont, _pstMap, _pstTransform, _stColor, _eSmoothing, _eBlendMode);
+}
+
 orxSTATUS orxFASTCALL orxDisplay_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_DrawLine)(_pvStart, _pvEnd, _stColor);
@@ -430,6 +439,11 @@ orxSTATUS orxFASTCALL orxDisplay_SetShaderVector(orxHANDLE _hShader, orxS32 _s32
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_SetShaderVector)(_hShader, _s32ID, _pvValue);
 }
 
+orxSTATUS orxFASTCALL orxDisplay_SetShaderParamBlock(orxHANDLE _hShader, orxU32 _u32ParamNumber, const orxS32 *_as32IDList, const orxU32 *_au32SizeList, const orxFLOAT *_afValueList)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_SetShaderParamBlock)(_hShader, _u32ParamNumber, _as32IDList, _au32SizeList, _afValueList);
+}
+
 orxU32 orxFASTCALL orxDisplay_GetShaderID(const orxHANDLE _hShader)
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_GetShaderID)(_hShader);
@@ -65,6 +65,7 @@
 #define orxFONT_KU32_REFERENCE_TABLE_SIZE       4           /**< Reference table size */
 #define orxFONT_KU32_CHARACTER_BANK_SIZE        256         /**< Character bank size */
 #define orxFONT_KU32_CHARACTER_TABLE_SIZE       256         /**< Character table size */
+#define orxFONT_KU32_GLYPH_LIST_MAX_SIZE        1024        /**< Direct-index glyph list max size */
 
 #define orxFONT_KU32_BANK_SIZE                  16          /**< Bank size */
 
@@ -141,6 +142,21 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
   /* Clears UTF-8 bank */
   orxBank_Clear(_pstFont->pstMap->pstCharacterBank);
 
+  /* Has direct-index glyph list? */
+  if(_pstFont->pstMap->apstGlyphList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstFont->pstMap->apstGlyphList);
+    _pstFont->pstMap->apstGlyphList = orxNULL;
+  }
+
+  /* Clears direct-index range */
+  _pstFont->pstMap->u32GlyphListBase  = 0;
+  _pstFont->pstMap->u32GlyphListSize  = 0;
+
+  /* Updates revision */
+  _pstFont->pstMap->u32Revision++;
+
   /* Has texture, texture size, character size and character list? */
   if((_pstFont->pstTexture != orxNULL)
   && (_pstFont->fWidth > orxFLOAT_0)
@@ -150,7 +166,7 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
   && (_pstFont->zCharacterList != orxSTRING_EMPTY))
   {
     const orxCHAR  *pc;
-    orxU32          u32CharacterCodePoint;
+    orxU32          u32CharacterCodePoint, u32MinCodePoint = orxU32_UNDEFINED, u32MaxCodePoint = 0;
     orxS32          s32Index;
     orxVECTOR       vOrigin;
 
@@ -205,11 +221,55 @@ static void orxFASTCALL orxFont_UpdateMap(orxFONT *_pstFont)
 
       /* Updates current origin X value */
       vOrigin.fX += pstGlyph->fWidth + _pstFont->vCharacterSpacing.fX;
+
+      /* Updates code point range */
+      u32MinCodePoint = orxMIN(u32MinCodePoint, u32CharacterCodePoint);
+      u32MaxCodePoint = orxMAX(u32MaxCodePoint, u32CharacterCodePoint);
     }
 
     /* Optimizes character table */
     orxHashTable_Optimize(_pstFont->pstMap->pstCharacterTable);
 
+    /* Has mapped characters? */
+    if(u32MinCodePoint <= u32MaxCodePoint)
+    {
+      orxU32 u32Size;
+
+      /* Gets direct-index list size, covering the beginning of the font's range if it's too sparse */
+      u32Size = orxMIN(u32MaxCodePoint - u32MinCodePoint + 1, orxFONT_KU32_GLYPH_LIST_MAX_SIZE);
+
+      /* Allocates it */
+      _pstFont->pstMap->apstGlyphList = (orxCHARACTER_GLYPH **)orxMemory_Allocate(u32Size * sizeof(orxCHARACTER_GLYPH *), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(_pstFont->pstMap->apstGlyphList != orxNULL)
+      {
+        orxHANDLE           hIterator;
+        orxU64              u64CodePoint;
+        orxCHARACTER_GLYPH *pstGlyph;
+
+        /* Clears it */
+        orxMemory_Zero(_pstFont->pstMap->apstGlyphList, u32Size * sizeof(orxCHARACTER_GLYPH *));
+
+        /* For all mapped characters */
+        for(hIterator = orxHashTable_GetNext(_pstFont->pstMap->pstCharacterTable, orxHANDLE_UNDEFINED, &u64CodePoint, (void **)&pstGlyph);
+            hIterator != orxHANDLE_UNDEFINED;
+            hIterator = orxHashTable_GetNext(_pstFont->pstMap->pstCharacterTable, hIterator, &u64CodePoint, (void **)&pstGlyph))
+        {
+          /* Inside direct-index range? */
+          if((orxU32)u64CodePoint - u32MinCodePoint < u32Size)
+          {
+            /* Stores it */
+            _pstFont->pstMap->apstGlyphList[(orxU32)u64CodePoint - u32MinCodePoint] = pstGlyph;
+          }
+        }
+
+        /* Stores direct-index range */
+        _pstFont->pstMap->u32GlyphListBase  = u32MinCodePoint;
+        _pstFont->pstMap->u32GlyphListSize  = u32Size;
+      }
+    }
+
     /* Stores character height */
     _pstFont->pstMap->fCharacterHeight = _pstFont->fCharacterHeight;
 
@@ -812,7 +872,13 @@ orxFONT *orxFASTCALL orxFont_Create()
       if(pstResult->pstMap->pstCharacterBank != orxNULL)
       {
         /* Creates its character table */
-        pstResult->pstMap->pstCharacterTable = orxHashTable_Create(orxFONT_KU32_CHARACTER_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+        pstResult->pstMap->pstCharacterTable = orxHashTable_Create(orxFONT_KU32_CHARACTER_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_MAIN);
+
+        /* Clears its direct-index glyph list */
+        pstResult->pstMap->apstGlyphList    = orxNULL;
+        pstResult->pstMap->u32GlyphListBase = 0;
+        pstResult->pstMap->u32GlyphListSize = 0;
+        pstResult->pstMap->u32Revision      = 0;
 
         /* Valid? */
         if(pstResult->pstMap->pstCharacterTable != orxNULL)
@@ -973,6 +1039,13 @@ orxSTATUS orxFASTCALL orxFont_Delete(orxFONT *_pstFont)
     /* Deletes character table */
     orxHashTable_Delete(_pstFont->pstMap->pstCharacterTable);
 
+    /* Has direct-index glyph list? */
+    if(_pstFont->pstMap->apstGlyphList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(_pstFont->pstMap->apstGlyphList);
+    }
+
     /* Deletes character bank */
     orxBank_Delete(_pstFont->pstMap->pstCharacterBank);
 
@@ -1374,7 +1447,7 @@ orxFLOAT orxFASTCALL orxFont_GetCharacterHeight(const orxFONT *_pstFont)
  */
 orxFLOAT orxFASTCALL orxFont_GetCharacterWidth(const orxFONT *_pstFont, orxU32 _u32CharacterCodePoint)
 {
-  orxCHARACTER_GLYPH *pstGlyph;
+  const orxCHARACTER_GLYPH *pstGlyph;
   orxFLOAT fResult = orxFLOAT_0;
 
   /* Checks */
@@ -1382,7 +1455,7 @@ orxFLOAT orxFASTCALL orxFont_GetCharacterWidth(const orxFONT *_pstFont, orxU32 _
   orxSTRUCTURE_ASSERT(_pstFont);
 
   /* Gets glyph */
-  pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstFont->pstMap->pstCharacterTable, _u32CharacterCodePoint);
+  pstGlyph = orxCharacterMap_GetGlyph(_pstFont->pstMap, _u32CharacterCodePoint);
 
   /* Valid? */
   if(pstGlyph != orxNULL)
@@ -57,6 +57,7 @@
 #define orxTEXT_KU32_FLAG_INTERNAL            0x10000000  /**< Internal structure handling flag */
 #define orxTEXT_KU32_FLAG_FIXED_WIDTH         0x00000001  /**< Fixed width flag */
 #define orxTEXT_KU32_FLAG_FIXED_HEIGHT        0x00000002  /**< Fixed height flag */
+#define orxTEXT_KU32_FLAG_QUAD_LIST           0x00000004  /**< Quad list flag */
 
 #define orxTEXT_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
@@ -88,6 +89,11 @@ struct __orxTEXT_t
   orxFLOAT          fHeight;                    /**< Height : 72 / 104 */
   const orxSTRING   zReference;                 /**< Config reference : 76 / 112 */
   orxSTRING         zOriginalString;            /**< Original string : 80 / 120 */
+  orxCHARACTER_QUAD *astQuadList;               /**< Cached character quad list : 84 / 128 */
+  const orxCHARACTER_MAP *pstQuadMap;           /**< Character map used for the cached quads : 88 / 136 */
+  orxU32            u32QuadCount;               /**< Cached character quad count : 92 / 140 */
+  orxU32            u32QuadSize;                /**< Cached character quad list size : 96 / 144 */
+  orxU32            u32QuadRevision;            /**< Character map revision used for the cached quads : 100 / 148 */
 };
 
 /** Static structure
@@ -332,6 +338,133 @@ static orxSTATUS orxFASTCALL orxText_EventHandler(const orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** Updates text's cached character quad list
+ * @param[in]   _pstText      Concerned text
+ */
+static void orxFASTCALL orxText_UpdateQuadList(orxTEXT *_pstText)
+{
+  /* Checks */
+  orxSTRUCTURE_ASSERT(_pstText);
+
+  /* Clears quad list */
+  _pstText->u32QuadCount = 0;
+  _pstText->pstQuadMap   = orxNULL;
+  orxStructure_SetFlags(_pstText, orxTEXT_KU32_FLAG_NONE, orxTEXT_KU32_FLAG_QUAD_LIST);
+
+  /* Has string and font? */
+  if((_pstText->zString != orxNULL) && (_pstText->zString != orxSTRING_EMPTY) && (_pstText->pstFont != orxNULL))
+  {
+    const orxCHARACTER_MAP *pstMap;
+    const orxCHAR          *pc;
+    orxU32                  u32CharacterCodePoint, u32Size;
+    orxFLOAT                fX, fY;
+
+    /* Gets character map */
+    pstMap = orxFont_GetMap(_pstText->pstFont);
+
+    /* Gets upper bound for quad count (one byte at least per character) */
+    u32Size = orxString_GetLength(_pstText->zString);
+
+    /* Needs to grow list? */
+    if(u32Size > _pstText->u32QuadSize)
+    {
+      orxCHARACTER_QUAD *astQuadList;
+
+      /* Reallocates it */
+      astQuadList = (orxCHARACTER_QUAD *)orxMemory_Reallocate(_pstText->astQuadList, u32Size * sizeof(orxCHARACTER_QUAD), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(astQuadList != orxNULL)
+      {
+        /* Stores it */
+        _pstText->astQuadList = astQuadList;
+        _pstText->u32QuadSize = u32Size;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s] Couldn't allocate quad list for <%u> characters: text will be rendered from its string.", (_pstText->zReference != orxNULL) ? _pstText->zReference : orxSTRING_EMPTY, u32Size);
+
+        /* Done! */
+        return;
+      }
+    }
+
+    /* For all characters */
+    for(u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(_pstText->zString, &pc), fX = fY = orxFLOAT_0;
+        u32CharacterCodePoint != orxCHAR_NULL;
+        u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(pc, &pc))
+    {
+      /* Depending on character */
+      switch(u32CharacterCodePoint)
+      {
+        case orxCHAR_CR:
+        {
+          /* Half EOL? */
+          if(*pc == orxCHAR_LF)
+          {
+            /* Updates pointer */
+            pc++;
+          }
+
+          /* Fall through */
+        }
+
+        case orxCHAR_LF:
+        {
+          /* Updates Y position */
+          fY += pstMap->fCharacterHeight;
+
+          /* Resets X position */
+          fX = orxFLOAT_0;
+
+          break;
+        }
+
+        default:
+        {
+          const orxCHARACTER_GLYPH *pstGlyph;
+
+          /* Gets glyph */
+          pstGlyph = orxCharacterMap_GetGlyph(pstMap, u32CharacterCodePoint);
+
+          /* Valid? */
+          if(pstGlyph != orxNULL)
+          {
+            orxCHARACTER_QUAD *pstQuad;
+
+            /* Stores quad */
+            pstQuad         = &(_pstText->astQuadList[_pstText->u32QuadCount++]);
+            orxMemory_Copy(&(pstQuad->stGlyph), pstGlyph, sizeof(orxCHARACTER_GLYPH));
+            pstQuad->fX     = fX;
+            pstQuad->fY     = fY;
+
+            /* Updates X position */
+            fX += pstGlyph->fWidth;
+          }
+          else
+          {
+            /* Updates X position with default width */
+            fX += pstMap->fCharacterHeight;
+          }
+
+          break;
+        }
+      }
+    }
+
+    /* Stores map & its revision */
+    _pstText->pstQuadMap      = pstMap;
+    _pstText->u32QuadRevision = pstMap->u32Revision;
+  }
+
+  /* Updates status */
+  orxStructure_SetFlags(_pstText, orxTEXT_KU32_FLAG_QUAD_LIST, orxTEXT_KU32_FLAG_NONE);
+
+  /* Done! */
+  return;
+}
+
 /** Updates text size
  * @param[in]   _pstText      Concerned text
  */
@@ -555,6 +688,9 @@ static void orxFASTCALL orxText_UpdateSize(orxTEXT *_pstText)
     }
   }
 
+  /* Updates quad list */
+  orxText_UpdateQuadList(_pstText);
+
   /* Done! */
   return;
 }
@@ -715,6 +851,11 @@ orxTEXT *orxFASTCALL orxText_Create()
     pstResult->zString          = orxNULL;
     pstResult->pstFont          = orxNULL;
     pstResult->zOriginalString  = orxNULL;
+    pstResult->astQuadList      = orxNULL;
+    pstResult->pstQuadMap       = orxNULL;
+    pstResult->u32QuadCount     = 0;
+    pstResult->u32QuadSize      = 0;
+    pstResult->u32QuadRevision  = 0;
 
     /* Inits flags */
     orxStructure_SetFlags(pstResult, orxTEXT_KU32_FLAG_NONE, orxTEXT_KU32_MASK_ALL);
@@ -811,6 +952,13 @@ orxSTATUS orxFASTCALL orxText_Delete(orxTEXT *_pstText)
     /* Removes font */
     orxText_SetFont(_pstText, orxNULL);
 
+    /* Has quad list? */
+    if(_pstText->astQuadList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(_pstText->astQuadList);
+    }
+
     /* Deletes structure */
     orxStructure_Delete(_pstText);
   }
@@ -1092,6 +1240,52 @@ orxFONT *orxFASTCALL orxText_GetFont(const orxTEXT *_pstText)
   return pstResult;
 }
 
+/** Gets text's cached character quad list, rebuilt if its font's character map has changed since last update
+ * @param[in]   _pstText      Concerned text
+ * @param[out]  _pu32Count    Number of character quads
+ * @return      Character quad list / orxNULL if not available (render from string instead)
+ */
+const orxCHARACTER_QUAD *orxFASTCALL orxText_GetCharacterList(const orxTEXT *_pstText, orxU32 *_pu32Count)
+{
+  const orxCHARACTER_QUAD *astResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstText.u32Flags & orxTEXT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstText);
+  orxASSERT(_pu32Count != orxNULL);
+
+  /* Has quad list? */
+  if(orxStructure_TestFlags(_pstText, orxTEXT_KU32_FLAG_QUAD_LIST) != orxFALSE)
+  {
+    /* Has font? */
+    if(_pstText->pstFont != orxNULL)
+    {
+      const orxCHARACTER_MAP *pstMap;
+
+      /* Gets its map */
+      pstMap = orxFont_GetMap(_pstText->pstFont);
+
+      /* Outdated? */
+      if((pstMap != _pstText->pstQuadMap) || (pstMap->u32Revision != _pstText->u32QuadRevision))
+      {
+        /* Updates it */
+        orxText_UpdateQuadList((orxTEXT *)_pstText);
+      }
+    }
+
+    /* Still valid? */
+    if(orxStructure_TestFlags(_pstText, orxTEXT_KU32_FLAG_QUAD_LIST) != orxFALSE)
+    {
+      /* Updates result */
+      astResult   = _pstText->astQuadList;
+      *_pu32Count = _pstText->u32QuadCount;
+    }
+  }
+
+  /* Done! */
+  return astResult;
+}
+
 /** Sets text's size, will lead to reformatting if text doesn't fit (pass width = -1.0f to restore text's original size, ie. unconstrained)
  * @param[in]   _pstText      Concerned text
  * @param[in]   _fWidth       Max width for the text, remove any size constraint if negative
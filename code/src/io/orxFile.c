@@ -45,6 +45,7 @@
   #include <windows.h>
   #undef WIN32_LEAN_AND_MEAN
   #include <Shlobj.h>
+  #include <io.h>
 
   #ifdef __orxMSVC__
 
@@ -70,6 +71,7 @@
   #include <stdlib.h>
   #include <stdio.h>
   #include <pwd.h>
+  #include <sys/mman.h>
 
 #endif /* __orxWINDOWS__ */
 
@@ -1254,6 +1256,128 @@ orxS64 orxFASTCALL orxFile_GetTime(const orxFILE *_pstFile)
   return s64Result;
 }
 
+/** Maps a file's content in memory, read-only
+ * @param[in] _pstFile              Concerned file
+ * @param[out] _ps64Size            Size of the mapped content
+ * @return Address of the mapped content if successful, orxNULL otherwise
+ */
+const void *orxFASTCALL orxFile_Map(orxFILE *_pstFile, orxS64 *_ps64Size)
+{
+  const void *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_ps64Size != orxNULL);
+
+  /* Clears size */
+  *_ps64Size = 0;
+
+  /* Valid? */
+  if(_pstFile != orxNULL)
+  {
+    orxS64 s64Size;
+
+    /* Gets its size */
+    s64Size = orxFile_GetSize(_pstFile);
+
+    /* Not empty and addressable? */
+    if((s64Size > 0) && ((orxU64)s64Size <= (orxU64)((size_t)-1)))
+    {
+#ifdef __orxWINDOWS__
+
+      HANDLE hFile;
+
+      /* Gets native handle */
+      hFile = (HANDLE)_get_osfhandle(_fileno((FILE *)_pstFile));
+
+      /* Valid? */
+      if(hFile != INVALID_HANDLE_VALUE)
+      {
+        HANDLE hMapping;
+
+        /* Creates mapping */
+        hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        /* Success? */
+        if(hMapping != NULL)
+        {
+          /* Maps view */
+          pResult = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, (SIZE_T)s64Size);
+
+          /* Closes mapping handle (the view keeps it alive) */
+          CloseHandle(hMapping);
+        }
+      }
+
+#else /* __orxWINDOWS__ */
+
+      void *pMap;
+
+      /* Maps file */
+      pMap = mmap(NULL, (size_t)s64Size, PROT_READ, MAP_PRIVATE, fileno((FILE *)_pstFile), 0);
+
+      /* Success? */
+      if(pMap != MAP_FAILED)
+      {
+        /* Updates result */
+        pResult = pMap;
+      }
+
+#endif /* __orxWINDOWS__ */
+
+      /* Success? */
+      if(pResult != orxNULL)
+      {
+        /* Stores size */
+        *_ps64Size = s64Size;
+      }
+    }
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Unmaps a file's content previously mapped with orxFile_Map
+ * @param[in] _pMap                 Address of the mapped content
+ * @param[in] _s64Size              Size of the mapped content
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxFile_Unmap(const void *_pMap, orxS64 _s64Size)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Valid? */
+  if(_pMap != orxNULL)
+  {
+#ifdef __orxWINDOWS__
+
+    /* Unmaps view */
+    if(UnmapViewOfFile(_pMap) != FALSE)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+
+#else /* __orxWINDOWS__ */
+
+    /* Unmaps file */
+    if(munmap((void *)_pMap, (size_t)_s64Size) == 0)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+
+#endif /* __orxWINDOWS__ */
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Prints a formatted string to a file
  * @param[in] _pstFile             Pointer to the file descriptor
  * @param[in] _zString             Formatted string
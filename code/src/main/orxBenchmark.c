@@ -0,0 +1,935 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2022 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBenchmark.c
+ *
+ * Benchmark executable
+ *
+ * Runs the scenarios listed in Benchmark.ScenarioList, each one after reseeding the random generator with Benchmark.Seed,
+ * and saves their results (ns/op, memory operations & peak memory above the scenario's starting usage) as JSON in Benchmark.Output.
+ * Memory usage is only tracked in profile builds, it's reported as null otherwise.
+ * The core clock should be fixed in config (see orxBenchmark.ini) so that all runs simulate the exact same frames.
+ *
+ */
+
+
+/** Includes
+ */
+#include "orx.h"
+
+/** Flags
+ */
+#define orxBENCHMARK_KU32_STATIC_FLAG_NONE      0x00000000  /**< No flags */
+
+#define orxBENCHMARK_KU32_STATIC_FLAG_READY     0x00000001  /**< Ready flag */
+
+#define orxBENCHMARK_KU32_STATIC_MASK_ALL       0xFFFFFFFF  /**< All mask */
+
+/** Misc defines
+ */
+#define orxBENCHMARK_KZ_CONFIG_SECTION          "Benchmark"
+#define orxBENCHMARK_KZ_CONFIG_SEED             "Seed"
+#define orxBENCHMARK_KZ_CONFIG_OUTPUT           "Output"
+#define orxBENCHMARK_KZ_CONFIG_SCENARIO_LIST    "ScenarioList"
+#define orxBENCHMARK_KZ_CONFIG_COUNT            "Count"
+#define orxBENCHMARK_KZ_CONFIG_ITERATIONS       "Iterations"
+#define orxBENCHMARK_KZ_CONFIG_OBJECT           "Object"
+#define orxBENCHMARK_KZ_CONFIG_VIEWPORT         "Viewport"
+#define orxBENCHMARK_KZ_CONFIG_SIZE             "Size"
+#define orxBENCHMARK_KZ_CONFIG_FILE             "File"
+#define orxBENCHMARK_KZ_CONFIG_ROOT_COUNT       "RootCount"
+#define orxBENCHMARK_KZ_CONFIG_BATCH_COUNT      "BatchCount"
+
+#define orxBENCHMARK_KZ_DEFAULT_OUTPUT          "orxBenchmark.json"
+#define orxBENCHMARK_KZ_DEFAULT_CONFIG_FILE     "orxBenchmarkConfig.ini"
+#define orxBENCHMARK_KZ_CONFIG_SECTION_PREFIX   "BenchmarkConfig"
+
+#define orxBENCHMARK_KU32_DEFAULT_SEED          0x2A
+#define orxBENCHMARK_KU32_DEFAULT_COUNT         1000
+#define orxBENCHMARK_KU32_DEFAULT_ITERATIONS    1
+#define orxBENCHMARK_KU32_DEFAULT_ROOT_COUNT    64
+#define orxBENCHMARK_KU32_DEFAULT_SIZE          (5 * 1024 * 1024)
+#define orxBENCHMARK_KU32_BANK_CELL_SIZE        64
+#define orxBENCHMARK_KU32_BANK_SEGMENT_SIZE     1024
+#define orxBENCHMARK_KU32_CONFIG_KEY_NUMBER     16
+
+#define orxBENCHMARK_KU32_MAX_SCENARIO_NUMBER   32
+
+#if defined(__orxDEBUG__)
+  #define orxBENCHMARK_KZ_BUILD                 "debug"
+#elif defined(__orxPROFILER__)
+  #define orxBENCHMARK_KZ_BUILD                 "profile"
+#else
+  #define orxBENCHMARK_KZ_BUILD                 "release"
+#endif
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Scenario function: runs a scenario, calling orxBenchmark_Start/orxBenchmark_Stop around its measured part, and returns the number of measured operations
+ */
+typedef orxU64 (orxFASTCALL *orxBENCHMARK_FUNCTION)();
+
+/** Scenario info
+ */
+typedef struct __orxBENCHMARK_SCENARIO_t
+{
+  const orxSTRING         zName;                /**< Name */
+  orxBENCHMARK_FUNCTION   pfnRun;               /**< Run function */
+
+} orxBENCHMARK_SCENARIO;
+
+/** Scenario result
+ */
+typedef struct __orxBENCHMARK_RESULT_t
+{
+  const orxSTRING         zName;                /**< Name */
+  orxU64                  u64OperationCount;    /**< Operation count */
+  orxDOUBLE               dTime;                /**< Measured time (s) */
+  orxU64                  u64MemoryOperations;  /**< Memory operations during measure */
+  orxU64                  u64PeakMemory;        /**< Peak memory usage, above usage at measure start */
+  orxU32                  u32BatchCount;        /**< Last frame's batch count, orxU32_UNDEFINED if not available */
+
+} orxBENCHMARK_RESULT;
+
+/** Static structure
+ */
+typedef struct __orxBENCHMARK_STATIC_t
+{
+  orxBENCHMARK_RESULT     astResultList[orxBENCHMARK_KU32_MAX_SCENARIO_NUMBER]; /**< Results */
+  orxBENCHMARK_RESULT    *pstCurrentResult;     /**< Current result */
+  orxDOUBLE               dStartTime;           /**< Current measure start time */
+  orxU64                  u64StartMemoryOperations; /**< Current measure memory operations */
+  orxU64                  u64StartMemorySize;   /**< Current measure memory size */
+  orxU64                  u64EventCount;        /**< Received event count */
+  orxU32                  u32ResultCount;       /**< Result count */
+  orxU32                  u32Seed;              /**< Random seed */
+  orxU32                  u32Flags;             /**< Control flags */
+
+} orxBENCHMARK_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxBENCHMARK_STATIC sstBenchmark;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Gets memory usage, summed over all memory types
+ * @param[out]  _pu64OperationCount           Total number of memory operations
+ * @param[out]  _pu64Size                     Sum of current sizes
+ * @param[out]  _pu64PeakSize                 Sum of peak sizes
+ */
+static void orxFASTCALL orxBenchmark_GetMemoryUsage(orxU64 *_pu64OperationCount, orxU64 *_pu64Size, orxU64 *_pu64PeakSize)
+{
+  /* Clears values */
+  *_pu64OperationCount  = 0;
+  *_pu64Size            = 0;
+  *_pu64PeakSize        = 0;
+
+#ifdef __orxPROFILER__
+  {
+    orxU32 i;
+
+    /* For all memory types */
+    for(i = 0; i < orxMEMORY_TYPE_NUMBER; i++)
+    {
+      orxU64 u64OperationCount, u64Size, u64PeakSize;
+
+      /* Gets its usage */
+      if(orxMemory_GetUsage((orxMEMORY_TYPE)i, orxNULL, orxNULL, &u64Size, &u64PeakSize, &u64OperationCount) != orxSTATUS_FAILURE)
+      {
+        /* Updates values */
+        *_pu64OperationCount += u64OperationCount;
+        *_pu64Size           += u64Size;
+        *_pu64PeakSize       += u64PeakSize;
+      }
+    }
+  }
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return;
+}
+
+/** Starts measuring current scenario
+ */
+static void orxFASTCALL orxBenchmark_Start()
+{
+  orxU64 u64PeakSize;
+
+#ifdef __orxPROFILER__
+  {
+    orxU32 i;
+
+    /* For all memory types */
+    for(i = 0; i < orxMEMORY_TYPE_NUMBER; i++)
+    {
+      /* Resets its peak, so as to only measure this scenario */
+      orxMemory_ResetPeakUsage((orxMEMORY_TYPE)i);
+    }
+  }
+#endif /* __orxPROFILER__ */
+
+  /* Gets memory usage */
+  orxBenchmark_GetMemoryUsage(&(sstBenchmark.u64StartMemoryOperations), &(sstBenchmark.u64StartMemorySize), &u64PeakSize);
+
+  /* Stores start time (last, to not measure the above) */
+  sstBenchmark.dStartTime = orxSystem_GetTime();
+
+  /* Done! */
+  return;
+}
+
+/** Stops measuring current scenario
+ */
+static void orxFASTCALL orxBenchmark_Stop()
+{
+  orxDOUBLE dTime;
+  orxU64    u64MemoryOperations, u64Size, u64PeakSize;
+
+  /* Gets elapsed time (first, to not measure the below) */
+  dTime = orxSystem_GetTime() - sstBenchmark.dStartTime;
+
+  /* Gets memory usage */
+  orxBenchmark_GetMemoryUsage(&u64MemoryOperations, &u64Size, &u64PeakSize);
+
+  /* Gets peak above usage at measure start */
+  u64PeakSize = (u64PeakSize > sstBenchmark.u64StartMemorySize) ? u64PeakSize - sstBenchmark.u64StartMemorySize : 0;
+
+  /* Updates result (measures can be cumulated) */
+  sstBenchmark.pstCurrentResult->dTime               += dTime;
+  sstBenchmark.pstCurrentResult->u64MemoryOperations += u64MemoryOperations - sstBenchmark.u64StartMemoryOperations;
+  sstBenchmark.pstCurrentResult->u64PeakMemory        = orxMAX(sstBenchmark.pstCurrentResult->u64PeakMemory, u64PeakSize);
+
+  /* Done! */
+  return;
+}
+
+/** Gets a scenario's count, from its config section
+ * @param[in]   _zKey                         Key to get
+ * @param[in]   _u32Default                   Default value
+ * @return      Count
+ */
+static orxU32 orxFASTCALL orxBenchmark_GetCount(const orxSTRING _zKey, orxU32 _u32Default)
+{
+  /* Done! */
+  return (orxConfig_HasValue(_zKey) != orxFALSE) ? orxConfig_GetU32(_zKey) : _u32Default;
+}
+
+/** Benchmark event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxBenchmark_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Updates count */
+  sstBenchmark.u64EventCount++;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Scenario: creates objects from config
+ */
+static orxU64 orxFASTCALL orxBenchmark_ObjectSpawn()
+{
+  orxOBJECT     **apstObjectList;
+  const orxSTRING zObject;
+  orxU32          i, u32Count;
+  orxU64          u64Result = 0;
+
+  /* Gets parameters */
+  u32Count  = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_COUNT, orxBENCHMARK_KU32_DEFAULT_COUNT);
+  zObject   = orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_OBJECT);
+
+  /* Allocates object list */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(u32Count * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(apstObjectList != orxNULL)
+  {
+    /* Starts measure */
+    orxBenchmark_Start();
+
+    /* For all objects */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Creates it */
+      apstObjectList[i] = orxObject_CreateFromConfig(zObject);
+    }
+
+    /* Stops measure */
+    orxBenchmark_Stop();
+
+    /* For all objects */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Valid? */
+      if(apstObjectList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxObject_Delete(apstObjectList[i]);
+      }
+    }
+
+    /* Frees object list */
+    orxMemory_Free(apstObjectList);
+
+    /* Updates result */
+    u64Result = (orxU64)u32Count;
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Scenario: sends events to a single handler
+ */
+static orxU64 orxFASTCALL orxBenchmark_EventSend()
+{
+  orxU32 i, u32Count;
+  orxU64 u64Result = 0;
+
+  /* Gets parameters */
+  u32Count = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_COUNT, orxBENCHMARK_KU32_DEFAULT_COUNT);
+
+  /* Adds event handler */
+  if(orxEvent_AddHandler(orxEVENT_TYPE_USER_DEFINED, orxBenchmark_EventHandler) != orxSTATUS_FAILURE)
+  {
+    /* Clears event count */
+    sstBenchmark.u64EventCount = 0;
+
+    /* Starts measure */
+    orxBenchmark_Start();
+
+    /* For all events */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Sends it */
+      orxEVENT_SEND(orxEVENT_TYPE_USER_DEFINED, 0, orxNULL, orxNULL, orxNULL);
+    }
+
+    /* Stops measure */
+    orxBenchmark_Stop();
+
+    /* Removes event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_USER_DEFINED, orxBenchmark_EventHandler);
+
+    /* Updates result */
+    u64Result = sstBenchmark.u64EventCount;
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Scenario: loads a large generated config file
+ */
+static orxU64 orxFASTCALL orxBenchmark_ConfigLoad()
+{
+  const orxSTRING zFileName;
+  orxFILE        *pstFile;
+  orxU32          u32Size, u32Iterations, u32SectionCount = 0;
+  orxU64          u64Result = 0;
+
+  /* Gets parameters */
+  u32Size       = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_SIZE, orxBENCHMARK_KU32_DEFAULT_SIZE);
+  u32Iterations = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_ITERATIONS, orxBENCHMARK_KU32_DEFAULT_ITERATIONS);
+  zFileName     = (orxConfig_HasValue(orxBENCHMARK_KZ_CONFIG_FILE) != orxFALSE) ? orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_FILE) : orxBENCHMARK_KZ_DEFAULT_CONFIG_FILE;
+
+  /* Creates file */
+  pstFile = orxFile_Open(zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxU32 u32Written;
+
+    /* Until requested size is reached */
+    for(u32Written = 0; u32Written < u32Size; u32SectionCount++)
+    {
+      orxU32 i;
+
+      /* Writes section (inheriting from the previous one, if any) */
+      if(u32SectionCount != 0)
+      {
+        u32Written += (orxU32)orxFile_Print(pstFile, "[" orxBENCHMARK_KZ_CONFIG_SECTION_PREFIX "%u@" orxBENCHMARK_KZ_CONFIG_SECTION_PREFIX "%u]\n", u32SectionCount, u32SectionCount - 1);
+      }
+      else
+      {
+        u32Written += (orxU32)orxFile_Print(pstFile, "[" orxBENCHMARK_KZ_CONFIG_SECTION_PREFIX "%u]\n", u32SectionCount);
+      }
+
+      /* For all keys */
+      for(i = 0; i < orxBENCHMARK_KU32_CONFIG_KEY_NUMBER; i++)
+      {
+        /* Depending on key index */
+        switch(i & 3)
+        {
+          case 0:
+          {
+            /* Writes integer */
+            u32Written += (orxU32)orxFile_Print(pstFile, "Int%u = %u\n", i, orxMath_GetRandomU32(0, 100000));
+            break;
+          }
+
+          case 1:
+          {
+            /* Writes float */
+            u32Written += (orxU32)orxFile_Print(pstFile, "Float%u = %g\n", i, (double)orxMath_GetRandomFloat(-orx2F(1000.0f), orx2F(1000.0f)));
+            break;
+          }
+
+          case 2:
+          {
+            /* Writes vector */
+            u32Written += (orxU32)orxFile_Print(pstFile, "Vector%u = (%g, %g, %g) ~ (%g, %g, %g)\n", i, (double)orxMath_GetRandomFloat(-orx2F(100.0f), orxFLOAT_0), (double)orxMath_GetRandomFloat(-orx2F(100.0f), orxFLOAT_0), orxFLOAT_0, (double)orxMath_GetRandomFloat(orxFLOAT_0, orx2F(100.0f)), (double)orxMath_GetRandomFloat(orxFLOAT_0, orx2F(100.0f)), orxFLOAT_0);
+            break;
+          }
+
+          default:
+          {
+            /* Writes string list */
+            u32Written += (orxU32)orxFile_Print(pstFile, "List%u = Value%u # Value%u # Value%u ; Comment\n", i, orxMath_GetRandomU32(0, 1000), orxMath_GetRandomU32(0, 1000), orxMath_GetRandomU32(0, 1000));
+            break;
+          }
+        }
+      }
+    }
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+
+    /* For all iterations */
+    for(u64Result = 0; u64Result < (orxU64)u32Iterations; u64Result++)
+    {
+      orxCHAR acBuffer[64];
+      orxU32  i;
+
+      /* Starts measure */
+      orxBenchmark_Start();
+
+      /* Loads file */
+      if(orxConfig_Load(zFileName) == orxSTATUS_FAILURE)
+      {
+        /* Logs message */
+        orxLOG("[BENCHMARK] Couldn't load generated config file <%s>, aborting scenario.", zFileName);
+
+        /* Stops measure */
+        orxBenchmark_Stop();
+
+        /* Stops */
+        break;
+      }
+
+      /* Stops measure */
+      orxBenchmark_Stop();
+
+      /* For all generated sections */
+      for(i = 0; i < u32SectionCount; i++)
+      {
+        /* Clears it */
+        orxString_NPrint(acBuffer, sizeof(acBuffer), orxBENCHMARK_KZ_CONFIG_SECTION_PREFIX "%u", i);
+        orxConfig_ClearSection(acBuffer);
+      }
+    }
+
+    /* Deletes file */
+    orxFile_Delete(zFileName);
+  }
+  else
+  {
+    /* Logs message */
+    orxLOG("[BENCHMARK] Couldn't create config file <%s>, aborting scenario.", zFileName);
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Scenario: updates a frame hierarchy
+ */
+static orxU64 orxFASTCALL orxBenchmark_FrameUpdate()
+{
+  orxFRAME  **apstFrameList;
+  orxU32      i, u32Count, u32RootCount, u32Iterations;
+  orxU64      u64Result = 0;
+
+  /* Gets parameters */
+  u32Count      = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_COUNT, orxBENCHMARK_KU32_DEFAULT_COUNT);
+  u32RootCount  = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_ROOT_COUNT, orxBENCHMARK_KU32_DEFAULT_ROOT_COUNT);
+  u32Iterations = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_ITERATIONS, orxBENCHMARK_KU32_DEFAULT_ITERATIONS);
+  u32RootCount  = orxCLAMP(u32RootCount, 1, u32Count);
+
+  /* Allocates frame list */
+  apstFrameList = (orxFRAME **)orxMemory_Allocate(u32Count * sizeof(orxFRAME *), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(apstFrameList != orxNULL)
+  {
+    orxVECTOR vPos;
+    orxU32    j;
+
+    /* For all frames */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Creates it */
+      apstFrameList[i] = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
+
+      /* Not a root? */
+      if(i >= u32RootCount)
+      {
+        /* Attaches it to a random previous frame */
+        orxFrame_SetParent(apstFrameList[i], apstFrameList[orxMath_GetRandomU32(0, i - 1)]);
+      }
+
+      /* Inits it */
+      orxFrame_SetPosition(apstFrameList[i], orxFRAME_SPACE_LOCAL, orxVector_Set(&vPos, orxMath_GetRandomFloat(-orx2F(100.0f), orx2F(100.0f)), orxMath_GetRandomFloat(-orx2F(100.0f), orx2F(100.0f)), orxFLOAT_0));
+      orxFrame_SetRotation(apstFrameList[i], orxFRAME_SPACE_LOCAL, orxMath_GetRandomFloat(orxFLOAT_0, orxMATH_KF_2_PI));
+    }
+
+    /* Starts measure */
+    orxBenchmark_Start();
+
+    /* For all iterations */
+    for(j = 0; j < u32Iterations; j++)
+    {
+      /* For all roots */
+      for(i = 0; i < u32RootCount; i++)
+      {
+        /* Moves it */
+        orxFrame_SetPosition(apstFrameList[i], orxFRAME_SPACE_LOCAL, orxVector_Set(&vPos, orxU2F(j), orxU2F(i), orxFLOAT_0));
+      }
+
+      /* For all frames */
+      for(i = 0; i < u32Count; i++)
+      {
+        /* Gets its global position */
+        orxFrame_GetPosition(apstFrameList[i], orxFRAME_SPACE_GLOBAL, &vPos);
+      }
+    }
+
+    /* Stops measure */
+    orxBenchmark_Stop();
+
+    /* For all frames, children first */
+    for(i = u32Count; i > 0; i--)
+    {
+      /* Deletes it */
+      orxFrame_Delete(apstFrameList[i - 1]);
+    }
+
+    /* Frees frame list */
+    orxMemory_Free(apstFrameList);
+
+    /* Updates result */
+    u64Result = (orxU64)u32Count * (orxU64)u32Iterations;
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Scenario: runs full frames (object update & render collection) with many visible objects
+ */
+static orxU64 orxFASTCALL orxBenchmark_Render()
+{
+  orxOBJECT     **apstObjectList;
+  orxVIEWPORT    *pstViewport;
+  const orxSTRING zObject;
+  orxU32          i, u32Count, u32Iterations;
+  orxU64          u64Result = 0;
+
+  /* Gets parameters */
+  u32Count      = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_COUNT, orxBENCHMARK_KU32_DEFAULT_COUNT);
+  u32Iterations = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_ITERATIONS, orxBENCHMARK_KU32_DEFAULT_ITERATIONS);
+  zObject       = orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_OBJECT);
+
+  /* Creates viewport */
+  pstViewport = orxViewport_CreateFromConfig(orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_VIEWPORT));
+
+  /* Allocates object list */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(u32Count * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if((pstViewport != orxNULL) && (apstObjectList != orxNULL))
+  {
+    /* For all objects */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Creates it */
+      apstObjectList[i] = orxObject_CreateFromConfig(zObject);
+    }
+
+    /* Runs a first frame, outside of measure, to get all resources ready */
+    orxClock_Update();
+
+    /* Starts measure */
+    orxBenchmark_Start();
+
+    /* For all frames */
+    for(u64Result = 0; u64Result < (orxU64)u32Iterations; u64Result++)
+    {
+      /* Updates clocks (and thus objects, render & display) */
+      if(orxClock_Update() == orxSTATUS_FAILURE)
+      {
+        /* Stops */
+        break;
+      }
+    }
+
+    /* Stops measure */
+    orxBenchmark_Stop();
+
+    /* Pushes display section */
+    orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+    /* Has batch count (headless display only)? */
+    if(orxConfig_HasValue(orxBENCHMARK_KZ_CONFIG_BATCH_COUNT) != orxFALSE)
+    {
+      /* Stores it */
+      sstBenchmark.pstCurrentResult->u32BatchCount = orxConfig_GetU32(orxBENCHMARK_KZ_CONFIG_BATCH_COUNT);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+
+    /* For all objects */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Valid? */
+      if(apstObjectList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxObject_Delete(apstObjectList[i]);
+      }
+    }
+  }
+
+  /* Has object list? */
+  if(apstObjectList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(apstObjectList);
+  }
+
+  /* Has viewport? */
+  if(pstViewport != orxNULL)
+  {
+    /* Deletes it */
+    orxViewport_Delete(pstViewport);
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Scenario: allocates & frees bank cells
+ */
+static orxU64 orxFASTCALL orxBenchmark_BankAllocation()
+{
+  orxBANK  *pstBank;
+  void    **apCellList;
+  orxU32    i, u32Count;
+  orxU64    u64Result = 0;
+
+  /* Gets parameters */
+  u32Count = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_COUNT, orxBENCHMARK_KU32_DEFAULT_COUNT);
+
+  /* Creates bank */
+  pstBank = orxBank_Create(orxBENCHMARK_KU32_BANK_SEGMENT_SIZE, orxBENCHMARK_KU32_BANK_CELL_SIZE, orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+  /* Allocates cell list */
+  apCellList = (void **)orxMemory_Allocate(u32Count * sizeof(void *), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if((pstBank != orxNULL) && (apCellList != orxNULL) && (u32Count != 0))
+  {
+    /* Starts measure */
+    orxBenchmark_Start();
+
+    /* For all cells */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Allocates it */
+      apCellList[i] = orxBank_Allocate(pstBank);
+    }
+
+    /* Stops measure */
+    orxBenchmark_Stop();
+
+    /* Shuffles cells, outside of measure */
+    for(i = u32Count - 1; i > 0; i--)
+    {
+      void   *pTemp;
+      orxU32  u32Index;
+
+      /* Swaps with a random previous cell */
+      u32Index              = orxMath_GetRandomU32(0, i);
+      pTemp                 = apCellList[i];
+      apCellList[i]         = apCellList[u32Index];
+      apCellList[u32Index]  = pTemp;
+    }
+
+    /* Starts measure */
+    orxBenchmark_Start();
+
+    /* For all cells, in random order */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Frees it */
+      orxBank_Free(pstBank, apCellList[i]);
+    }
+
+    /* Stops measure */
+    orxBenchmark_Stop();
+
+    /* Updates result */
+    u64Result = 2 * (orxU64)u32Count;
+  }
+
+  /* Has cell list? */
+  if(apCellList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(apCellList);
+  }
+
+  /* Has bank? */
+  if(pstBank != orxNULL)
+  {
+    /* Deletes it */
+    orxBank_Delete(pstBank);
+  }
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Saves all results as JSON
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxBenchmark_Save()
+{
+  const orxSTRING zFileName;
+  orxFILE        *pstFile;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Gets output file name */
+  zFileName = (orxConfig_HasValue(orxBENCHMARK_KZ_CONFIG_OUTPUT) != orxFALSE) ? orxConfig_GetString(orxBENCHMARK_KZ_CONFIG_OUTPUT) : orxBENCHMARK_KZ_DEFAULT_OUTPUT;
+
+  /* Opens it */
+  pstFile = orxFile_Open(zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxU32 i;
+
+    /* Writes header */
+    orxFile_Print(pstFile, "{\n  \"version\": \"%s\",\n  \"build\": \"" orxBENCHMARK_KZ_BUILD "\",\n  \"seed\": %u,\n  \"scenarios\":\n  [\n", orxSystem_GetVersionFullString(), sstBenchmark.u32Seed);
+
+    /* For all results */
+    for(i = 0; i < sstBenchmark.u32ResultCount; i++)
+    {
+      const orxBENCHMARK_RESULT *pstResult;
+
+      /* Gets it */
+      pstResult = &(sstBenchmark.astResultList[i]);
+
+      /* Writes it */
+      orxFile_Print(pstFile, "    {\"name\": \"%s\", \"operations\": %llu, \"total_ms\": %.3f, \"ns_per_op\": %.3f", pstResult->zName, pstResult->u64OperationCount, pstResult->dTime * 1000.0, (pstResult->u64OperationCount != 0) ? (pstResult->dTime * 1000000000.0) / (orxDOUBLE)pstResult->u64OperationCount : 0.0);
+#ifdef __orxPROFILER__
+      orxFile_Print(pstFile, ", \"memory_operations\": %llu, \"peak_memory\": %llu", pstResult->u64MemoryOperations, pstResult->u64PeakMemory);
+#else /* __orxPROFILER__ */
+      orxFile_Print(pstFile, ", \"memory_operations\": null, \"peak_memory\": null");
+#endif /* __orxPROFILER__ */
+      if(pstResult->u32BatchCount != orxU32_UNDEFINED)
+      {
+        orxFile_Print(pstFile, ", \"batch_count\": %u", pstResult->u32BatchCount);
+      }
+      orxFile_Print(pstFile, "}%s\n", (i + 1 < sstBenchmark.u32ResultCount) ? "," : orxSTRING_EMPTY);
+    }
+
+    /* Writes footer */
+    orxFile_Print(pstFile, "  ]\n}\n");
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+
+    /* Logs message */
+    orxLOG("[BENCHMARK] Results saved to <%s>.", zFileName);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxLOG("[BENCHMARK] Couldn't save results to <%s>.", zFileName);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Inits the benchmark module
+ */
+orxSTATUS orxFASTCALL orxBenchmark_Init()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Clears static controller */
+  orxMemory_Zero(&sstBenchmark, sizeof(orxBENCHMARK_STATIC));
+
+  /* Pushes benchmark section */
+  orxConfig_PushSection(orxBENCHMARK_KZ_CONFIG_SECTION);
+
+  /* Gets seed */
+  sstBenchmark.u32Seed = orxBenchmark_GetCount(orxBENCHMARK_KZ_CONFIG_SEED, orxBENCHMARK_KU32_DEFAULT_SEED);
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Updates status */
+  orxFLAG_SET(sstBenchmark.u32Flags, orxBENCHMARK_KU32_STATIC_FLAG_READY, orxBENCHMARK_KU32_STATIC_MASK_ALL);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from the benchmark module
+ */
+void orxFASTCALL orxBenchmark_Exit()
+{
+  /* Clears static controller */
+  orxMemory_Zero(&sstBenchmark, sizeof(orxBENCHMARK_STATIC));
+
+  /* Done! */
+  return;
+}
+
+/** Runs all the scenarios, then exits
+ */
+orxSTATUS orxFASTCALL orxBenchmark_Run()
+{
+  static const orxBENCHMARK_SCENARIO sastScenarioList[] =
+  {
+    {"ObjectSpawn", orxBenchmark_ObjectSpawn},
+    {"EventSend", orxBenchmark_EventSend},
+    {"ConfigLoad", orxBenchmark_ConfigLoad},
+    {"FrameUpdate", orxBenchmark_FrameUpdate},
+    {"Render", orxBenchmark_Render},
+    {"BankAllocation", orxBenchmark_BankAllocation}
+  };
+  orxU32 i, u32Count;
+
+  /* Pushes benchmark section */
+  orxConfig_PushSection(orxBENCHMARK_KZ_CONFIG_SECTION);
+
+  /* Gets scenario count */
+  u32Count = orxMIN(orxConfig_GetListCount(orxBENCHMARK_KZ_CONFIG_SCENARIO_LIST), orxBENCHMARK_KU32_MAX_SCENARIO_NUMBER);
+
+  /* For all requested scenarios */
+  for(i = 0; i < u32Count; i++)
+  {
+    const orxSTRING zScenario;
+    orxU32          j;
+
+    /* Gets its name */
+    zScenario = orxConfig_GetListString(orxBENCHMARK_KZ_CONFIG_SCENARIO_LIST, i);
+
+    /* Finds it */
+    for(j = 0; (j < orxARRAY_GET_ITEM_COUNT(sastScenarioList)) && (orxString_ICompare(sastScenarioList[j].zName, zScenario) != 0); j++)
+      ;
+
+    /* Found? */
+    if(j < orxARRAY_GET_ITEM_COUNT(sastScenarioList))
+    {
+      orxBENCHMARK_RESULT *pstResult;
+
+      /* Inits its result */
+      pstResult                 = &(sstBenchmark.astResultList[sstBenchmark.u32ResultCount++]);
+      pstResult->zName          = sastScenarioList[j].zName;
+      pstResult->u32BatchCount  = orxU32_UNDEFINED;
+
+      /* Stores it */
+      sstBenchmark.pstCurrentResult = pstResult;
+
+      /* Resets random seed */
+      orxMath_InitRandom(sstBenchmark.u32Seed);
+
+      /* Pushes its section */
+      orxConfig_PushSection(pstResult->zName);
+
+      /* Runs it */
+      pstResult->u64OperationCount = sastScenarioList[j].pfnRun();
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Logs result */
+      orxLOG("[BENCHMARK] %-16s %10llu ops %12.3f ms %10.3f ns/op", pstResult->zName, pstResult->u64OperationCount, pstResult->dTime * 1000.0, (pstResult->u64OperationCount != 0) ? (pstResult->dTime * 1000000000.0) / (orxDOUBLE)pstResult->u64OperationCount : 0.0);
+    }
+    else
+    {
+      /* Logs message */
+      orxLOG("[BENCHMARK] Unknown scenario <%s>, skipping.", zScenario);
+    }
+  }
+
+  /* Saves results */
+  orxBenchmark_Save();
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done, exits! */
+  return orxSTATUS_FAILURE;
+}
+
+/** Main entry point
+ * @param[in] argc                            Number of parameters
+ * @param[in] argv                            List of parameters
+ * @return    EXIT_SUCCESS / EXIT_FAILURE
+ */
+int main(int argc, char **argv)
+{
+  /* Executes orx */
+  orx_Execute(argc, argv, orxBenchmark_Init, orxBenchmark_Run, orxBenchmark_Exit);
+
+  /* Done! */
+  return EXIT_SUCCESS;
+}
@@ -608,4 +608,32 @@ orxSTATUS orxFASTCALL orxMemory_Track(orxMEMORY_TYPE _eMemType, orxU32 _u32Size,
   return eResult;
 }
 
+/** Resets peak memory usage for a given type to its current usage
+ * @param[in] _eMemType               Concerned memory type
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_ResetPeakUsage(orxMEMORY_TYPE _eMemType)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Valid? */
+  if(_eMemType < orxMEMORY_TYPE_NUMBER)
+  {
+    /* Updates peaks */
+    sstMemory.astMemoryTrackerList[_eMemType].u64PeakCount  = sstMemory.astMemoryTrackerList[_eMemType].u64Count;
+    sstMemory.astMemoryTrackerList[_eMemType].u64PeakSize   = sstMemory.astMemoryTrackerList[_eMemType].u64Size;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 #endif /* __orxPROFILER__ */
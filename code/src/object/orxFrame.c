@@ -46,6 +46,7 @@
 
 #define orxFRAME_KU32_STATIC_FLAG_READY                       0x00000001  /**< Ready flag */
 #define orxFRAME_KU32_STATIC_FLAG_DATA_2D                     0x00000010  /**< 2D flag */
+#define orxFRAME_KU32_STATIC_FLAG_LAZY_UPDATE                 0x00000020  /**< Lazy update flag */
 
 #define orxFRAME_KU32_STATIC_MASK_DEFAULT                     0x00000010  /**< Default flag */
 
@@ -57,6 +58,8 @@
 #define orxFRAME_KU32_FLAG_NONE                               0x00000000  /**< No flags */
 
 #define orxFRAME_KU32_FLAG_DATA_2D                            0x10000000  /**< 2D ID flag */
+#define orxFRAME_KU32_FLAG_CHANGED                            0x20000000  /**< Changed flag */
+#define orxFRAME_KU32_FLAG_DIRTY                              0x40000000  /**< Dirty flag (global data of the whole subtree is outdated) */
 
 #define orxFRAME_KU32_MASK_ALL                                0xFFFFFFFF  /**< All mask */
 
@@ -64,6 +67,7 @@
 /** Misc defines
  */
 #define orxFRAME_KU32_BANK_SIZE                               2048        /**< Bank size */
+#define orxFRAME_KU32_PROCESS_LIST_SIZE                       256         /**< Initial process list size */
 #define orxFRAME_KU32_RESULT_BUFFER_SIZE                      128
 
 #define orxFRAME_KZ_NONE                                      "none"
@@ -80,6 +84,22 @@
 #define orxFRAME_KU32_POSITION_LENGTH                         8
 
 
+/** Data accessors
+ */
+#define orxFRAME_GLOBAL_POS_X(F)                              (F)->stData.vGlobalPos.fX
+#define orxFRAME_GLOBAL_POS_Y(F)                              (F)->stData.vGlobalPos.fY
+#define orxFRAME_GLOBAL_POS_Z(F)                              (F)->stData.vGlobalPos.fZ
+#define orxFRAME_GLOBAL_ROTATION(F)                           (F)->stData.fGlobalRotation
+#define orxFRAME_GLOBAL_SCALE_X(F)                            (F)->stData.fGlobalScaleX
+#define orxFRAME_GLOBAL_SCALE_Y(F)                            (F)->stData.fGlobalScaleY
+#define orxFRAME_LOCAL_POS_X(F)                               (F)->stData.vLocalPos.fX
+#define orxFRAME_LOCAL_POS_Y(F)                               (F)->stData.vLocalPos.fY
+#define orxFRAME_LOCAL_POS_Z(F)                               (F)->stData.vLocalPos.fZ
+#define orxFRAME_LOCAL_ROTATION(F)                            (F)->stData.fLocalRotation
+#define orxFRAME_LOCAL_SCALE_X(F)                             (F)->stData.fLocalScaleX
+#define orxFRAME_LOCAL_SCALE_Y(F)                             (F)->stData.fLocalScaleY
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
@@ -105,7 +125,9 @@ typedef struct __orxFRAME_DATA_2D_t
 struct __orxFRAME_t
 {
   orxSTRUCTURE      stStructure;                              /**< Public structure, first structure member : 32 */
-  orxFRAME_DATA_2D  stData;                                   /**< Frame data : 64 */
+  orxFRAME_DATA_2D  stData;                                   /**< Frame data : 80 */
+  orxLINKLIST_NODE  stChangeNode;                             /**< Change node : 92 */
+  orxLINKLIST_NODE  stDirtyNode;                              /**< Dirty node : 104 */
 };
 
 /** Static structure
@@ -115,6 +137,10 @@ typedef struct __orxFRAME_STATIC_t
   orxU32    u32Flags;                                         /**< Control flags */
   orxFRAME *pstRoot;                                          /**< Frame root */
   orxBANK  *pst2DDataBank;                                    /**< 2D Data bank */
+  orxLINKLIST stChangeList;                                   /**< Changed frame list */
+  orxLINKLIST stDirtyList;                                    /**< Dirty frame list */
+  orxFRAME **apstProcessList;                                 /**< Process list (level-ordered scratch buffer) */
+  orxU32    u32ProcessListSize;                               /**< Process list size */
   orxCHAR   acResultBuffer[orxFRAME_KU32_RESULT_BUFFER_SIZE]; /**< Result buffer */
 
 } orxFRAME_STATIC;
@@ -147,12 +173,14 @@ static orxINLINE orxBOOL _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVEC
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
     /* Different? */
-    if((_pvPos->fX != _pstFrame->stData.vGlobalPos.fX)
-    || (_pvPos->fY != _pstFrame->stData.vGlobalPos.fY)
-    || (_pvPos->fZ != _pstFrame->stData.vGlobalPos.fZ))
+    if((_pvPos->fX != orxFRAME_GLOBAL_POS_X(_pstFrame))
+    || (_pvPos->fY != orxFRAME_GLOBAL_POS_Y(_pstFrame))
+    || (_pvPos->fZ != orxFRAME_GLOBAL_POS_Z(_pstFrame)))
     {
       /* Stores it */
-      orxVector_Copy(&(_pstFrame->stData.vGlobalPos), _pvPos);
+      orxFRAME_GLOBAL_POS_X(_pstFrame) = _pvPos->fX;
+      orxFRAME_GLOBAL_POS_Y(_pstFrame) = _pvPos->fY;
+      orxFRAME_GLOBAL_POS_Z(_pstFrame) = _pvPos->fZ;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -161,12 +189,14 @@ static orxINLINE orxBOOL _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVEC
   else
   {
     /* Different? */
-    if((_pvPos->fX != _pstFrame->stData.vLocalPos.fX)
-    || (_pvPos->fY != _pstFrame->stData.vLocalPos.fY)
-    || (_pvPos->fZ != _pstFrame->stData.vLocalPos.fZ))
+    if((_pvPos->fX != orxFRAME_LOCAL_POS_X(_pstFrame))
+    || (_pvPos->fY != orxFRAME_LOCAL_POS_Y(_pstFrame))
+    || (_pvPos->fZ != orxFRAME_LOCAL_POS_Z(_pstFrame)))
     {
       /* Stores it */
-      orxVector_Copy(&(_pstFrame->stData.vLocalPos), _pvPos);
+      orxFRAME_LOCAL_POS_X(_pstFrame) = _pvPos->fX;
+      orxFRAME_LOCAL_POS_Y(_pstFrame) = _pvPos->fY;
+      orxFRAME_LOCAL_POS_Z(_pstFrame) = _pvPos->fZ;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -191,10 +221,10 @@ static orxINLINE orxBOOL _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fR
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
     /* Different? */
-    if(_fRotation != _pstFrame->stData.fGlobalRotation)
+    if(_fRotation != orxFRAME_GLOBAL_ROTATION(_pstFrame))
     {
       /* Stores it */
-      _pstFrame->stData.fGlobalRotation = _fRotation;
+      orxFRAME_GLOBAL_ROTATION(_pstFrame) = _fRotation;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -203,10 +233,10 @@ static orxINLINE orxBOOL _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fR
   else
   {
     /* Different? */
-    if(_fRotation != _pstFrame->stData.fLocalRotation)
+    if(_fRotation != orxFRAME_LOCAL_ROTATION(_pstFrame))
     {
       /* Stores it */
-      _pstFrame->stData.fLocalRotation = _fRotation;
+      orxFRAME_LOCAL_ROTATION(_pstFrame) = _fRotation;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -231,12 +261,12 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
     /* Different? */
-    if((_pvScale->fX != _pstFrame->stData.fGlobalScaleX)
-    || (_pvScale->fY != _pstFrame->stData.fGlobalScaleY))
+    if((_pvScale->fX != orxFRAME_GLOBAL_SCALE_X(_pstFrame))
+    || (_pvScale->fY != orxFRAME_GLOBAL_SCALE_Y(_pstFrame)))
     {
       /* Stores it */
-      _pstFrame->stData.fGlobalScaleX = _pvScale->fX;
-      _pstFrame->stData.fGlobalScaleY = _pvScale->fY;
+      orxFRAME_GLOBAL_SCALE_X(_pstFrame) = _pvScale->fX;
+      orxFRAME_GLOBAL_SCALE_Y(_pstFrame) = _pvScale->fY;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -245,12 +275,12 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
   else
   {
     /* Different? */
-    if((_pvScale->fX != _pstFrame->stData.fLocalScaleX)
-    || (_pvScale->fY != _pstFrame->stData.fLocalScaleY))
+    if((_pvScale->fX != orxFRAME_LOCAL_SCALE_X(_pstFrame))
+    || (_pvScale->fY != orxFRAME_LOCAL_SCALE_Y(_pstFrame)))
     {
       /* Stores it */
-      _pstFrame->stData.fLocalScaleX = _pvScale->fX;
-      _pstFrame->stData.fLocalScaleY = _pvScale->fY;
+      orxFRAME_LOCAL_SCALE_X(_pstFrame) = _pvScale->fX;
+      orxFRAME_LOCAL_SCALE_Y(_pstFrame) = _pvScale->fY;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -264,24 +294,23 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
 /** Gets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
+ * @param[out]  _pvPos          Position of the given frame
  * @return orxVECTOR / orxNULL
  */
-static orxINLINE const orxVECTOR *_orxFrame_GetPosition(const orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace)
+static orxINLINE orxVECTOR *_orxFrame_GetPosition(const orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace, orxVECTOR *_pvPos)
 {
-  const orxVECTOR *pvResult = orxNULL;
-
   /* Updates result */
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
-    pvResult = &(_pstFrame->stData.vGlobalPos);
+    orxVector_Set(_pvPos, orxFRAME_GLOBAL_POS_X(_pstFrame), orxFRAME_GLOBAL_POS_Y(_pstFrame), orxFRAME_GLOBAL_POS_Z(_pstFrame));
   }
   else
   {
-    pvResult = &(_pstFrame->stData.vLocalPos);
+    orxVector_Set(_pvPos, orxFRAME_LOCAL_POS_X(_pstFrame), orxFRAME_LOCAL_POS_Y(_pstFrame), orxFRAME_LOCAL_POS_Z(_pstFrame));
   }
 
   /* Done */
-  return pvResult;
+  return _pvPos;
 }
 
 /** Gets frame rotation
@@ -296,11 +325,11 @@ static orxINLINE orxFLOAT _orxFrame_GetRotation(const orxFRAME *_pstFrame, orxFR
   /* Updates result */
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
-    fRotation = _pstFrame->stData.fGlobalRotation;
+    fRotation = orxFRAME_GLOBAL_ROTATION(_pstFrame);
   }
   else
   {
-    fRotation = _pstFrame->stData.fLocalRotation;
+    fRotation = orxFRAME_LOCAL_ROTATION(_pstFrame);
   }
 
   /* Done */
@@ -320,13 +349,13 @@ static orxINLINE orxVECTOR *_orxFrame_GetScale(const orxFRAME *_pstFrame, orxFRA
   /* Updates result */
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
-    _pvScale->fX = _pstFrame->stData.fGlobalScaleX;
-    _pvScale->fY = _pstFrame->stData.fGlobalScaleY;
+    _pvScale->fX = orxFRAME_GLOBAL_SCALE_X(_pstFrame);
+    _pvScale->fY = orxFRAME_GLOBAL_SCALE_Y(_pstFrame);
   }
   else
   {
-    _pvScale->fX = _pstFrame->stData.fLocalScaleX;
-    _pvScale->fY = _pstFrame->stData.fLocalScaleY;
+    _pvScale->fX = orxFRAME_LOCAL_SCALE_X(_pstFrame);
+    _pvScale->fY = orxFRAME_LOCAL_SCALE_Y(_pstFrame);
   }
 
   /* No z scale */
@@ -353,7 +382,7 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalScale(const orxFRAME *_ps
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_X|orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Z:
     {
       _pvScale->fX = orxFLOAT_1;
-      _pvScale->fY = _pstFrame->stData.fGlobalScaleY;
+      _pvScale->fY = orxFRAME_GLOBAL_SCALE_Y(_pstFrame);
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_SCALE_Y:
@@ -361,7 +390,7 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalScale(const orxFRAME *_ps
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Y:
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Y|orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Z:
     {
-      _pvScale->fX = _pstFrame->stData.fGlobalScaleX;
+      _pvScale->fX = orxFRAME_GLOBAL_SCALE_X(_pstFrame);
       _pvScale->fY = orxFLOAT_1;
       break;
     }
@@ -378,8 +407,8 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalScale(const orxFRAME *_ps
     case orxFRAME_KU32_FLAG_IGNORE_SCALE_Z:
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Z:
     {
-      _pvScale->fX = _pstFrame->stData.fGlobalScaleX;
-      _pvScale->fY = _pstFrame->stData.fGlobalScaleY;
+      _pvScale->fX = orxFRAME_GLOBAL_SCALE_X(_pstFrame);
+      _pvScale->fY = orxFRAME_GLOBAL_SCALE_Y(_pstFrame);
       break;
     }
   }
@@ -403,21 +432,21 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalPosition(const orxFRAME *
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_X:
     {
       _pvPos->fX = orxFLOAT_0;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fY = orxFRAME_GLOBAL_POS_Y(_pstFrame);
+      _pvPos->fZ = orxFRAME_GLOBAL_POS_Z(_pstFrame);
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Y:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
+      _pvPos->fX = orxFRAME_GLOBAL_POS_X(_pstFrame);
       _pvPos->fY = orxFLOAT_0;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fZ = orxFRAME_GLOBAL_POS_Z(_pstFrame);
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
+      _pvPos->fX = orxFRAME_GLOBAL_POS_X(_pstFrame);
+      _pvPos->fY = orxFRAME_GLOBAL_POS_Y(_pstFrame);
       _pvPos->fZ = orxFLOAT_0;
       break;
     }
@@ -425,19 +454,19 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalPosition(const orxFRAME *
     {
       _pvPos->fX = orxFLOAT_0;
       _pvPos->fY = orxFLOAT_0;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fZ = orxFRAME_GLOBAL_POS_Z(_pstFrame);
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_X|orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z:
     {
       _pvPos->fX = orxFLOAT_0;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
+      _pvPos->fY = orxFRAME_GLOBAL_POS_Y(_pstFrame);
       _pvPos->fZ = orxFLOAT_0;
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Y|orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
+      _pvPos->fX = orxFRAME_GLOBAL_POS_X(_pstFrame);
       _pvPos->fY = orxFLOAT_0;
       _pvPos->fZ = orxFLOAT_0;
       break;
@@ -451,9 +480,9 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalPosition(const orxFRAME *
     }
     default:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fX = orxFRAME_GLOBAL_POS_X(_pstFrame);
+      _pvPos->fY = orxFRAME_GLOBAL_POS_Y(_pstFrame);
+      _pvPos->fZ = orxFRAME_GLOBAL_POS_Z(_pstFrame);
       break;
     }
   }
@@ -603,6 +632,25 @@ static orxINLINE orxVECTOR *orxFrame_FromGlobalToLocalScale(const orxFRAME *_pst
   return pvResult;
 }
 
+/** Marks a frame as changed, if tracked
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_MarkChanged(orxFRAME *_pstFrame)
+{
+  /* Tracked and not already in change list? */
+  if(orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_FLAG_TRACK_CHANGES | orxFRAME_KU32_FLAG_CHANGED) == orxFRAME_KU32_FLAG_TRACK_CHANGES)
+  {
+    /* Adds it to the change list */
+    orxLinkList_AddEnd(&(sstFrame.stChangeList), &(_pstFrame->stChangeNode));
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_CHANGED, orxFRAME_KU32_FLAG_NONE);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Updates frame global data using parent's global and frame local ones
  * @param[out]  _pstFrame       Frame to update
  * @param[in]   _pstParent Parent frame to use for update
@@ -615,7 +663,7 @@ static orxINLINE void orxFrame_UpdateData(orxFRAME *_pstFrame, const orxFRAME *_
   /* Gets frame's local data */
   _orxFrame_GetScale(_pstFrame, orxFRAME_SPACE_LOCAL, &vScale);
   fRotation = _orxFrame_GetRotation(_pstFrame, orxFRAME_SPACE_LOCAL);
-  orxVector_Copy(&vPos, _orxFrame_GetPosition(_pstFrame, orxFRAME_SPACE_LOCAL));
+  _orxFrame_GetPosition(_pstFrame, orxFRAME_SPACE_LOCAL, &vPos);
 
   /* Is not root? */
   if(_pstParent != sstFrame.pstRoot)
@@ -630,9 +678,11 @@ static orxINLINE void orxFrame_UpdateData(orxFRAME *_pstFrame, const orxFRAME *_
   }
 
   /* Stores them */
-  _orxFrame_SetRotation(_pstFrame, fRotation, orxFRAME_SPACE_GLOBAL);
-  _orxFrame_SetScale(_pstFrame, &vScale, orxFRAME_SPACE_GLOBAL);
-  _orxFrame_SetPosition(_pstFrame, &vPos, orxFRAME_SPACE_GLOBAL);
+  if((_orxFrame_SetRotation(_pstFrame, fRotation, orxFRAME_SPACE_GLOBAL) | _orxFrame_SetScale(_pstFrame, &vScale, orxFRAME_SPACE_GLOBAL) | _orxFrame_SetPosition(_pstFrame, &vPos, orxFRAME_SPACE_GLOBAL)) != orxFALSE)
+  {
+    /* Marks it as changed */
+    orxFrame_MarkChanged(_pstFrame);
+  }
 
   /* Done! */
   return;
@@ -642,10 +692,20 @@ static orxINLINE void orxFrame_UpdateData(orxFRAME *_pstFrame, const orxFRAME *_
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _pstParent      Parent frame
  */
-static void orxFASTCALL orxFrame_ProcessInternal(orxFRAME *_pstFrame, const orxFRAME *_pstParent)
+static void orxFASTCALL orxFrame_ProcessRecursive(orxFRAME *_pstFrame, const orxFRAME *_pstParent)
 {
   orxFRAME *pstChild;
 
+  /* Is dirty? */
+  if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+  {
+    /* Removes it from dirty list */
+    orxLinkList_Remove(&(_pstFrame->stDirtyNode));
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_DIRTY);
+  }
+
   /* Updates frame's data */
   orxFrame_UpdateData(_pstFrame, _pstParent);
 
@@ -655,7 +715,98 @@ static void orxFASTCALL orxFrame_ProcessInternal(orxFRAME *_pstFrame, const orxF
       pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
   {
     /* Processes it */
-    orxFrame_ProcessInternal(pstChild, _pstFrame);
+    orxFrame_ProcessRecursive(pstChild, _pstFrame);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Internally processes a frame and its whole subtree, in level order
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _pstParent      Parent frame
+ */
+static void orxFASTCALL orxFrame_ProcessInternal(orxFRAME *_pstFrame, const orxFRAME *_pstParent)
+{
+  orxU32 u32Count, i;
+
+  /* No process list yet? */
+  if(sstFrame.u32ProcessListSize == 0)
+  {
+    /* Allocates it */
+    sstFrame.apstProcessList = (orxFRAME **)orxMemory_Allocate(orxFRAME_KU32_PROCESS_LIST_SIZE * sizeof(orxFRAME *), orxMEMORY_TYPE_MAIN);
+
+    /* Failed? */
+    if(sstFrame.apstProcessList == orxNULL)
+    {
+      /* Processes it recursively */
+      orxFrame_ProcessRecursive(_pstFrame, _pstParent);
+
+      /* Done! */
+      return;
+    }
+
+    /* Stores its size */
+    sstFrame.u32ProcessListSize = orxFRAME_KU32_PROCESS_LIST_SIZE;
+  }
+
+  /* Adds frame to the process list */
+  sstFrame.apstProcessList[0] = _pstFrame;
+  u32Count = 1;
+
+  /* For all listed frames: as children are appended after their parent, every parent is up-to-date before its children get processed */
+  for(i = 0; i < u32Count; i++)
+  {
+    orxFRAME *pstFrame, *pstChild;
+
+    /* Gets it */
+    pstFrame = sstFrame.apstProcessList[i];
+
+    /* Is dirty? */
+    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+    {
+      /* Removes it from dirty list */
+      orxLinkList_Remove(&(pstFrame->stDirtyNode));
+
+      /* Updates status */
+      orxStructure_SetFlags(pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_DIRTY);
+    }
+
+    /* Updates frame's data */
+    orxFrame_UpdateData(pstFrame, (i == 0) ? _pstParent : orxFRAME(orxStructure_GetParent(pstFrame)));
+
+    /* For all children */
+    for(pstChild = orxFRAME(orxStructure_GetChild(pstFrame));
+        pstChild != orxNULL;
+        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+    {
+      /* Process list full? */
+      if(u32Count == sstFrame.u32ProcessListSize)
+      {
+        orxFRAME **apstProcessList;
+
+        /* Grows it */
+        apstProcessList = (orxFRAME **)orxMemory_Reallocate(sstFrame.apstProcessList, (sstFrame.u32ProcessListSize << 1) * sizeof(orxFRAME *), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(apstProcessList != orxNULL)
+        {
+          /* Stores it */
+          sstFrame.apstProcessList    = apstProcessList;
+          sstFrame.u32ProcessListSize = sstFrame.u32ProcessListSize << 1;
+        }
+        else
+        {
+          /* Processes child recursively */
+          orxFrame_ProcessRecursive(pstChild, pstFrame);
+
+          continue;
+        }
+      }
+
+      /* Adds it to the process list */
+      sstFrame.apstProcessList[u32Count++] = pstChild;
+    }
   }
 
   /* Done! */
@@ -681,6 +832,89 @@ static orxINLINE void orxFrame_Process(orxFRAME *_pstFrame, const orxFRAME *_pst
   return;
 }
 
+/** Invalidates a frame: processes it right away or, when using lazy update, marks its subtree as dirty
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_Invalidate(orxFRAME *_pstFrame)
+{
+  /* Lazy update? */
+  if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY_UPDATE))
+  {
+    /* Not already dirty? */
+    if(!orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+    {
+      /* Adds it to the dirty list */
+      orxLinkList_AddEnd(&(sstFrame.stDirtyList), &(_pstFrame->stDirtyNode));
+
+      /* Updates status */
+      orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY, orxFRAME_KU32_FLAG_NONE);
+    }
+  }
+  else
+  {
+    /* Processes frame */
+    orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Resolves a frame: makes sure its global data (and its ancestors' ones) are up-to-date
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_Resolve(orxFRAME *_pstFrame)
+{
+  /* Has dirty frames? */
+  if(orxLinkList_GetCount(&(sstFrame.stDirtyList)) != 0)
+  {
+    orxFRAME *pstFrame, *pstDirty = orxNULL;
+
+    /* Finds topmost dirty frame in its ancestry */
+    for(pstFrame = _pstFrame;
+        (pstFrame != orxNULL) && (pstFrame != sstFrame.pstRoot);
+        pstFrame = orxFRAME(orxStructure_GetParent(pstFrame)))
+    {
+      /* Is dirty? */
+      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+      {
+        /* Stores it */
+        pstDirty = pstFrame;
+      }
+    }
+
+    /* Found? */
+    if(pstDirty != orxNULL)
+    {
+      /* Processes its whole subtree */
+      orxFrame_Process(pstDirty, orxFRAME(orxStructure_GetParent(pstDirty)));
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Invalidates all the children of a frame
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_InvalidateChildren(orxFRAME *_pstFrame)
+{
+  orxFRAME *pstChild;
+
+  /* For all children */
+  for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
+      pstChild != orxNULL;
+      pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+  {
+    /* Invalidates it */
+    orxFrame_Invalidate(pstChild);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes all frames
  */
 static orxINLINE void orxFrame_DeleteAll()
@@ -1093,6 +1327,15 @@ void orxFASTCALL orxFrame_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_FRAME);
 
+    /* Has process list? */
+    if(sstFrame.apstProcessList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstFrame.apstProcessList);
+      sstFrame.apstProcessList    = orxNULL;
+      sstFrame.u32ProcessListSize = 0;
+    }
+
     /* Updates flags */
     sstFrame.u32Flags &= ~orxFRAME_KU32_STATIC_FLAG_READY;
   }
@@ -1131,10 +1374,10 @@ orxFRAME *orxFASTCALL orxFrame_Create(orxU32 _u32Flags)
     orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_DATA_2D);
 
     /* Inits values */
-    pstFrame->stData.fGlobalScaleX  = orxFLOAT_1;
-    pstFrame->stData.fGlobalScaleY  = orxFLOAT_1;
-    pstFrame->stData.fLocalScaleX   = orxFLOAT_1;
-    pstFrame->stData.fLocalScaleY   = orxFLOAT_1;
+    orxFRAME_GLOBAL_SCALE_X(pstFrame) = orxFLOAT_1;
+    orxFRAME_GLOBAL_SCALE_Y(pstFrame) = orxFLOAT_1;
+    orxFRAME_LOCAL_SCALE_X(pstFrame)  = orxFLOAT_1;
+    orxFRAME_LOCAL_SCALE_Y(pstFrame)  = orxFLOAT_1;
 
     /* Has already a root? */
     if(sstFrame.pstRoot != orxNULL)
@@ -1176,6 +1419,9 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
   {
     orxFRAME *pstParent;
 
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
@@ -1185,12 +1431,12 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
       orxFRAME *pstChild;
 
       /* Resets global values to parent's */
-      _pstFrame->stData.vGlobalPos.fX   = pstParent->stData.vGlobalPos.fX;
-      _pstFrame->stData.vGlobalPos.fY   = pstParent->stData.vGlobalPos.fY;
-      _pstFrame->stData.vGlobalPos.fZ   = pstParent->stData.vGlobalPos.fZ;
-      _pstFrame->stData.fGlobalRotation = pstParent->stData.fGlobalRotation;
-      _pstFrame->stData.fGlobalScaleX   = pstParent->stData.fGlobalScaleX;
-      _pstFrame->stData.fGlobalScaleY   = pstParent->stData.fGlobalScaleY;
+      orxFRAME_GLOBAL_POS_X(_pstFrame)    = orxFRAME_GLOBAL_POS_X(pstParent);
+      orxFRAME_GLOBAL_POS_Y(_pstFrame)    = orxFRAME_GLOBAL_POS_Y(pstParent);
+      orxFRAME_GLOBAL_POS_Z(_pstFrame)    = orxFRAME_GLOBAL_POS_Z(pstParent);
+      orxFRAME_GLOBAL_ROTATION(_pstFrame) = orxFRAME_GLOBAL_ROTATION(pstParent);
+      orxFRAME_GLOBAL_SCALE_X(_pstFrame)  = orxFRAME_GLOBAL_SCALE_X(pstParent);
+      orxFRAME_GLOBAL_SCALE_Y(_pstFrame)  = orxFRAME_GLOBAL_SCALE_Y(pstParent);
 
       /* For all children */
       for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
@@ -1202,6 +1448,20 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
       }
     }
 
+    /* Is in change list? */
+    if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_CHANGED))
+    {
+      /* Removes it */
+      orxLinkList_Remove(&(_pstFrame->stChangeNode));
+    }
+
+    /* Is in dirty list? */
+    if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+    {
+      /* Removes it */
+      orxLinkList_Remove(&(_pstFrame->stDirtyNode));
+    }
+
     /* Deletes structure */
     orxStructure_Delete(_pstFrame);
   }
@@ -1234,8 +1494,8 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Set root as parent */
       orxStructure_SetParent(_pstFrame, sstFrame.pstRoot);
 
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, sstFrame.pstRoot);
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
@@ -1246,8 +1506,8 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Sets parent */
       orxStructure_SetParent(_pstFrame, _pstParent);
 
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, _pstParent);
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
 
@@ -1338,6 +1598,111 @@ orxBOOL orxFASTCALL orxFrame_IsRootChild(const orxFRAME *_pstFrame)
   return bResult;
 }
 
+/** Enables / disables lazy update: when enabled, setters only mark frames as dirty and global data gets updated on demand (or by orxFrame_UpdateAll)
+ * @param[in]   _bEnable        Enable / disable
+ */
+void orxFASTCALL orxFrame_EnableLazyUpdate(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates status */
+    orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY_UPDATE, orxFRAME_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates all dirty frames */
+    orxFrame_UpdateAll();
+
+    /* Updates status */
+    orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_NONE, orxFRAME_KU32_STATIC_FLAG_LAZY_UPDATE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Is lazy update enabled?
+ * @return orxTRUE if enabled, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxFrame_IsLazyUpdateEnabled()
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  bResult = orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY_UPDATE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Updates global data of all dirty frames (only needed when lazy update is enabled)
+ */
+void orxFASTCALL orxFrame_UpdateAll()
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Has dirty frames? */
+  if(orxLinkList_GetCount(&(sstFrame.stDirtyList)) != 0)
+  {
+    orxLINKLIST_NODE *pstNode;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxFrame_UpdateAll");
+
+    /* While there are dirty frames */
+    while((pstNode = orxLinkList_GetFirst(&(sstFrame.stDirtyList))) != orxNULL)
+    {
+      /* Resolves it (will remove it and all its dirty descendants from the list) */
+      orxFrame_Resolve(orxSTRUCT_GET_FROM_FIELD(orxFRAME, stDirtyNode, pstNode));
+    }
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Pops the next changed frame: only frames flagged with orxFRAME_KU32_FLAG_TRACK_CHANGES are considered, each of them being reported once after its global data changed, until popped
+ * @return orxFRAME / orxNULL if no tracked frame changed since last call
+ */
+orxFRAME *orxFASTCALL orxFrame_PopChanged()
+{
+  orxLINKLIST_NODE *pstNode;
+  orxFRAME         *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Updates all dirty frames first */
+  orxFrame_UpdateAll();
+
+  /* Gets first changed frame */
+  if((pstNode = orxLinkList_GetFirst(&(sstFrame.stChangeList))) != orxNULL)
+  {
+    /* Gets frame */
+    pstResult = orxSTRUCT_GET_FROM_FIELD(orxFRAME, stChangeNode, pstNode);
+
+    /* Removes it from list */
+    orxLinkList_Remove(pstNode);
+
+    /* Updates status */
+    orxStructure_SetFlags(pstResult, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_CHANGED);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
@@ -1356,35 +1721,36 @@ void orxFASTCALL orxFrame_SetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* Updates coord values */
     if(_orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
   {
     orxVECTOR vPos;
-    orxFRAME *pstParent, *pstChild;
+    orxFRAME *pstParent;
 
     /* Checks */
     orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+    /* Resolves frame */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
     /* Stores global position */
-    _orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_GLOBAL);
+    if(_orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_GLOBAL) != orxFALSE)
+    {
+      /* Marks it as changed */
+      orxFrame_MarkChanged(_pstFrame);
+    }
 
     /* Computes & stores local position */
     _orxFrame_SetPosition(_pstFrame, orxFrame_FromGlobalToLocalPosition(pstParent, _pvPos, &vPos, orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_MASK_IGNORE_POSITION)), orxFRAME_SPACE_LOCAL);
 
-    /* For all children */
-    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-        pstChild != orxNULL;
-        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-    {
-      /* Processes it */
-      orxFrame_Process(pstChild, _pstFrame);
-    }
+    /* Invalidates children */
+    orxFrame_InvalidateChildren(_pstFrame);
   }
 
   /* Done! */
@@ -1408,34 +1774,35 @@ void orxFASTCALL orxFrame_SetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* Updates rotation value */
     if(_orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
   {
-    orxFRAME *pstParent, *pstChild;
+    orxFRAME *pstParent;
 
     /* Checks */
     orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+    /* Resolves frame */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
     /* Stores global rotation */
-    _orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_GLOBAL);
+    if(_orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_GLOBAL) != orxFALSE)
+    {
+      /* Marks it as changed */
+      orxFrame_MarkChanged(_pstFrame);
+    }
 
     /* Computes & stores local rotation */
     _orxFrame_SetRotation(_pstFrame, orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_IGNORE_ROTATION) ? _fRotation : orxFrame_FromGlobalToLocalRotation(pstParent, _fRotation), orxFRAME_SPACE_LOCAL);
 
-    /* For all children */
-    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-        pstChild != orxNULL;
-        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-    {
-      /* Processes it */
-      orxFrame_Process(pstChild, _pstFrame);
-    }
+    /* Invalidates children */
+    orxFrame_InvalidateChildren(_pstFrame);
   }
 
   /* Done! */
@@ -1460,35 +1827,36 @@ void orxFASTCALL orxFrame_SetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace,
     /* Updates scale value */
     if(_orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
   {
     orxVECTOR vScale;
-    orxFRAME *pstParent, *pstChild;
+    orxFRAME *pstParent;
 
     /* Checks */
     orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+    /* Resolves frame */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
     /* Stores global scale */
-    _orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_GLOBAL);
+    if(_orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_GLOBAL) != orxFALSE)
+    {
+      /* Marks it as changed */
+      orxFrame_MarkChanged(_pstFrame);
+    }
 
     /* Computes & stores local scale */
     _orxFrame_SetScale(_pstFrame, orxFrame_FromGlobalToLocalScale(pstParent, _pvScale, &vScale, orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_MASK_IGNORE_SCALE)), orxFRAME_SPACE_LOCAL);
 
-    /* For all children */
-    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-        pstChild != orxNULL;
-        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-    {
-      /* Processes it */
-      orxFrame_Process(pstChild, _pstFrame);
-    }
+    /* Invalidates children */
+    orxFrame_InvalidateChildren(_pstFrame);
   }
 
   /* Done! */
@@ -1512,9 +1880,15 @@ orxVECTOR *orxFASTCALL orxFrame_GetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+  /* Global? */
+  if(_eSpace == orxFRAME_SPACE_GLOBAL)
+  {
+    /* Resolves frame */
+    orxFrame_Resolve(_pstFrame);
+  }
+
   /* Updates result */
-  orxVector_Copy(_pvPos, _orxFrame_GetPosition(_pstFrame, _eSpace));
-  pvResult = _pvPos;
+  pvResult = _orxFrame_GetPosition(_pstFrame, _eSpace, _pvPos);
 
   /* Done! */
   return pvResult;
@@ -1535,6 +1909,13 @@ orxFLOAT orxFASTCALL orxFrame_GetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _e
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+  /* Global? */
+  if(_eSpace == orxFRAME_SPACE_GLOBAL)
+  {
+    /* Resolves frame */
+    orxFrame_Resolve(_pstFrame);
+  }
+
   /* Updates result */
   fRotation = _orxFrame_GetRotation(_pstFrame, _eSpace);
 
@@ -1559,6 +1940,13 @@ orxVECTOR *orxFASTCALL orxFrame_GetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eS
   orxASSERT(_pvScale != orxNULL);
   orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+  /* Global? */
+  if(_eSpace == orxFRAME_SPACE_GLOBAL)
+  {
+    /* Resolves frame */
+    orxFrame_Resolve(_pstFrame);
+  }
+
   /* Updates result */
   pvResult = _orxFrame_GetScale(_pstFrame, _eSpace, _pvScale);
 
@@ -1582,6 +1970,9 @@ orxVECTOR *orxFASTCALL orxFrame_TransformPosition(orxFRAME *_pstFrame, orxFRAME_
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(_pvPos != orxNULL);
 
+  /* Resolves frame */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   pvResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalPosition(_pstFrame, _pvPos, orxFRAME_KU32_FLAG_IGNORE_NONE) : orxFrame_FromGlobalToLocalPosition(_pstFrame, _pvPos, _pvPos, orxFRAME_KU32_FLAG_IGNORE_NONE);
 
@@ -1604,6 +1995,9 @@ orxFLOAT orxFASTCALL orxFrame_TransformRotation(orxFRAME *_pstFrame, orxFRAME_SP
   orxSTRUCTURE_ASSERT(_pstFrame);
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
 
+  /* Resolves frame */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   fResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalRotation(_pstFrame, _fRotation) : orxFrame_FromGlobalToLocalRotation(_pstFrame, _fRotation);
 
@@ -1627,6 +2021,9 @@ orxVECTOR *orxFASTCALL orxFrame_TransformScale(orxFRAME *_pstFrame, orxFRAME_SPA
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(_pvScale != orxNULL);
 
+  /* Resolves frame */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   pvResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalScale(_pstFrame, _pvScale, orxFRAME_KU32_FLAG_IGNORE_NONE) : orxFrame_FromGlobalToLocalScale(_pstFrame, _pvScale, _pvScale, orxFRAME_KU32_FLAG_IGNORE_NONE);
 
@@ -90,6 +90,23 @@
 #define orxOBJECT_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
 
+/** Template flags
+ */
+#define orxOBJECT_KU32_TEMPLATE_FLAG_NONE       0x00000000  /**< No flags */
+
+#define orxOBJECT_KU32_TEMPLATE_FLAG_READY      0x00000001  /**< Ready flag */
+
+
+
+/** Template value flags
+ */
+#define orxOBJECT_KU32_VALUE_FLAG_NONE          0x00000000  /**< No flags */
+
+#define orxOBJECT_KU32_VALUE_FLAG_HAS           0x00000001  /**< Has value flag */
+#define orxOBJECT_KU32_VALUE_FLAG_CACHED        0x00000002  /**< Cached value flag */
+#define orxOBJECT_KU32_VALUE_FLAG_VECTOR        0x00000004  /**< Valid vector flag */
+
+
 /** Misc defines
  */
 #define orxOBJECT_KU32_NEIGHBOR_LIST_SIZE       128
@@ -100,6 +117,16 @@
 #define orxOBJECT_KU32_GROUP_BANK_SIZE          64
 #define orxOBJECT_KU32_GROUP_TABLE_SIZE         64
 
+#define orxOBJECT_KU32_GRID_TABLE_SIZE          1024
+#define orxOBJECT_KU32_GRID_CELL_BANK_SIZE      256
+#define orxOBJECT_KU32_GRID_RESULT_SIZE         256
+#define orxOBJECT_KU32_GRID_KEY_MULTIPLIER      0x9E3779B1
+#define orxOBJECT_KU32_GRID_NEAREST_STEP_NUMBER 32
+#define orxOBJECT_KF_GRID_MAX_COORD             orx2F(1073741824.0f)
+
+#define orxOBJECT_KU32_TEMPLATE_BANK_SIZE       64
+#define orxOBJECT_KU32_TEMPLATE_TABLE_SIZE      64
+
 #define orxOBJECT_KU32_OVERRIDE_MARKER_LENGTH   2
 
 #define orxOBJECT_KU32_STACK_SIZE               64
@@ -152,6 +179,16 @@
 #define orxOBJECT_KZ_CONFIG_ON_PREPARE          "OnPrepare"
 #define orxOBJECT_KZ_CONFIG_ON_CREATE           "OnCreate"
 #define orxOBJECT_KZ_CONFIG_ON_DELETE           "OnDelete"
+#define orxOBJECT_KZ_CONFIG_BATCH_BEGIN         "Begin"
+#define orxOBJECT_KZ_CONFIG_BATCH_END           "End"
+#define orxOBJECT_KZ_CONFIG_BATCH_TOP_LEFT      "TopLeft"
+#define orxOBJECT_KZ_CONFIG_BATCH_BOTTOM_RIGHT  "BottomRight"
+#define orxOBJECT_KZ_CONFIG_BATCH_SELF_FLAGS    "SelfFlags"
+#define orxOBJECT_KZ_CONFIG_BATCH_CHECK_MASK    "CheckMask"
+#define orxOBJECT_KZ_CONFIG_BATCH_EARLY_EXIT    "EarlyExit"
+#define orxOBJECT_KZ_CONFIG_BATCH_NUMBER        "Number"
+#define orxOBJECT_KZ_CONFIG_BATCH_RESULT        "Result"
+#define orxOBJECT_KZ_CONFIG_BATCH_COUNT         "Count"
 #define orxOBJECT_KZ_OVERRIDE_MARKER            "->"
 #define orxOBJECT_KZ_CENTERED_PIVOT             "center"
 #define orxOBJECT_KZ_TRUNCATE_PIVOT             "truncate"
@@ -207,12 +244,126 @@ void orxFASTCALL orxObject_##FUNCTION##Recursive(orxOBJECT *_pstObject, PARAM_TY
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Object template value types
+ */
+typedef enum __orxOBJECT_TEMPLATE_TYPE_t
+{
+  orxOBJECT_TEMPLATE_TYPE_STRING = 0,
+  orxOBJECT_TEMPLATE_TYPE_FLOAT,
+  orxOBJECT_TEMPLATE_TYPE_BOOL,
+  orxOBJECT_TEMPLATE_TYPE_VECTOR,
+  orxOBJECT_TEMPLATE_TYPE_COLOR,
+  orxOBJECT_TEMPLATE_TYPE_LIST,
+
+  orxOBJECT_TEMPLATE_TYPE_NUMBER,
+
+  orxOBJECT_TEMPLATE_TYPE_NONE = orxENUM_NONE
+
+} orxOBJECT_TEMPLATE_TYPE;
+
+/** Object template keys, in sastObjectTemplateKeyList's order
+ */
+typedef enum __orxOBJECT_TEMPLATE_KEY_t
+{
+  orxOBJECT_TEMPLATE_KEY_AGE = 0,
+  orxOBJECT_TEMPLATE_KEY_GROUP,
+  orxOBJECT_TEMPLATE_KEY_POSITION,
+  orxOBJECT_TEMPLATE_KEY_AUTO_SCROLL,
+  orxOBJECT_TEMPLATE_KEY_FLIP,
+  orxOBJECT_TEMPLATE_KEY_DEPTH_SCALE,
+  orxOBJECT_TEMPLATE_KEY_IGNORE_FROM_PARENT,
+  orxOBJECT_TEMPLATE_KEY_PARENT_CAMERA,
+  orxOBJECT_TEMPLATE_KEY_USE_PARENT_SPACE,
+  orxOBJECT_TEMPLATE_KEY_GRAPHIC_NAME,
+  orxOBJECT_TEMPLATE_KEY_ANIMPOINTER_NAME,
+  orxOBJECT_TEMPLATE_KEY_ANIM_FREQUENCY,
+  orxOBJECT_TEMPLATE_KEY_SIZE,
+  orxOBJECT_TEMPLATE_KEY_PIVOT,
+  orxOBJECT_TEMPLATE_KEY_SCALE,
+  orxOBJECT_TEMPLATE_KEY_COLOR,
+  orxOBJECT_TEMPLATE_KEY_RGB,
+  orxOBJECT_TEMPLATE_KEY_HSL,
+  orxOBJECT_TEMPLATE_KEY_HSV,
+  orxOBJECT_TEMPLATE_KEY_ALPHA,
+  orxOBJECT_TEMPLATE_KEY_BODY,
+  orxOBJECT_TEMPLATE_KEY_CLOCK,
+  orxOBJECT_TEMPLATE_KEY_ROTATION,
+  orxOBJECT_TEMPLATE_KEY_SPHERICAL_POSITION,
+  orxOBJECT_TEMPLATE_KEY_CHILD_LIST,
+  orxOBJECT_TEMPLATE_KEY_CHILD_JOINT_LIST,
+  orxOBJECT_TEMPLATE_KEY_SPEED,
+  orxOBJECT_TEMPLATE_KEY_USE_RELATIVE_SPEED,
+  orxOBJECT_TEMPLATE_KEY_ANGULAR_VELOCITY,
+  orxOBJECT_TEMPLATE_KEY_FX_LIST,
+  orxOBJECT_TEMPLATE_KEY_FX_RECURSIVE_LIST,
+  orxOBJECT_TEMPLATE_KEY_FX_FREQUENCY,
+  orxOBJECT_TEMPLATE_KEY_SPAWNER,
+  orxOBJECT_TEMPLATE_KEY_SOUND_LIST,
+  orxOBJECT_TEMPLATE_KEY_SHADER_LIST,
+  orxOBJECT_TEMPLATE_KEY_TRACK_LIST,
+  orxOBJECT_TEMPLATE_KEY_SMOOTHING,
+  orxOBJECT_TEMPLATE_KEY_BLEND_MODE,
+  orxOBJECT_TEMPLATE_KEY_REPEAT,
+  orxOBJECT_TEMPLATE_KEY_LIFETIME,
+  orxOBJECT_TEMPLATE_KEY_ON_DELETE,
+  orxOBJECT_TEMPLATE_KEY_ON_CREATE,
+
+  orxOBJECT_TEMPLATE_KEY_NUMBER,
+
+  orxOBJECT_TEMPLATE_KEY_NONE = orxENUM_NONE
+
+} orxOBJECT_TEMPLATE_KEY;
+
+/** Object template value
+ */
+typedef struct __orxOBJECT_TEMPLATE_VALUE_t
+{
+  orxVECTOR         vValue;                     /**< Vector value : 12 / 12 */
+  const orxSTRING   zValue;                     /**< String value : 16 / 24 */
+  const orxSTRING  *azListValue;                /**< List values : 20 / 32 */
+  orxFLOAT          fValue;                     /**< Float value : 24 / 36 */
+  orxBOOL           bValue;                     /**< Bool value : 28 / 40 */
+  orxS32            s32ListCount;               /**< List count : 32 / 44 */
+  orxU32            u32Flags;                   /**< Flags : 36 / 48 */
+} orxOBJECT_TEMPLATE_VALUE;
+
+/** Object template: config values of a section, snapshot on instantiation
+ */
+typedef struct __orxOBJECT_TEMPLATE_t
+{
+  orxOBJECT_TEMPLATE_VALUE astValueList[orxOBJECT_TEMPLATE_KEY_NUMBER]; /**< Values */
+  const orxSTRING   zSection;                   /**< Section */
+  const orxSTRING  *azListBuffer;               /**< List value buffer */
+  struct __orxOBJECT_TEMPLATE_t *pstNext;       /**< Next template with the same key (hash collision) */
+  orxU64            u64Key;                     /**< Table key */
+  orxU32            u32Revision;                /**< Config revision */
+  orxU32            u32Flags;                   /**< Flags */
+} orxOBJECT_TEMPLATE;
+
+/** Object grid
+ */
+typedef struct __orxOBJECT_GRID_t
+{
+  orxHASHTABLE     *pstCellTable;               /**< Cell table : 4 / 8 */
+  orxBANK          *pstCellBank;                /**< Cell bank : 8 / 16 */
+  orxLINKLIST       stUnboundList;              /**< Unbound list : 20 / 40 */
+  orxFLOAT          fCellSize;                  /**< Cell size : 24 / 44 */
+  orxFLOAT          fRecCellSize;               /**< Reciprocal cell size : 28 / 48 */
+  orxU32            u32MoveCount;               /**< Move count : 32 / 52 */
+  orxU32            u32QueryCount;              /**< Query count : 36 / 56 */
+} orxOBJECT_GRID;
+
+/** Object grid query result (same storage as public box queries)
+ */
+typedef orxOBJECT_BOX_QUERY orxOBJECT_GRID_RESULT;
+
 /** Object lists
  */
 typedef struct __orxOBJECT_LISTS_t
 {
   orxLINKLIST       stList;                     /**< List : 12 / 24 */
   orxLINKLIST       stEnableList;               /**< Enable list : 24 / 48 */
+  orxOBJECT_GRID   *pstGrid;                    /**< Grid : 28 / 56 */
 } orxOBJECT_LISTS;
 
 /** Object structure
@@ -235,7 +386,10 @@ struct __orxOBJECT_t
   orxLINKLIST_NODE  stGroupNode;                /**< Group node: 172 / 256 */
   orxLINKLIST_NODE  stEnableNode;               /**< Enable node: 184 / 280 */
   orxLINKLIST_NODE  stEnableGroupNode;          /**< Enable group node: 196 / 304 */
-  const orxSTRING   zOnDelete;                  /**< On Delete command : 200 / 312 */
+  orxLINKLIST_NODE  stGridNode;                 /**< Grid node: 208 / 328 */
+  orxU64            u64GridCell;                /**< Grid cell : 216 / 336 */
+  orxU64            u64EnableOrder;             /**< Enable order, in its group : 224 / 344 */
+  const orxSTRING   zOnDelete;                  /**< On Delete command : 228 / 352 */
 };
 
 /** Static structure
@@ -245,14 +399,19 @@ typedef struct __orxOBJECT_STATIC_t
   orxCLOCK         *pstClock;                   /**< Clock */
   orxBANK          *pstGroupBank;               /**< Group bank */
   orxBANK          *pstAgeBank;                 /**< Age bank */
+  orxBANK          *pstTemplateBank;            /**< Template bank */
+  orxHASHTABLE     *pstTemplateTable;           /**< Template table */
   orxHASHTABLE     *pstGroupTable;              /**< Group table */
   orxOBJECT_LISTS  *pstCachedGroupLists;        /**< Cached group lists */
   orxOBJECT        *pstCurrentParent;           /**< Current parent */
   orxFRAME         *pstFrame;                   /**< Conversion frame */
+  orxOBJECT_GRID_RESULT stQueryResult;         /**< Grid query result (picking) */
   orxLINKLIST       stEnableList;               /**< Enabled objects list */
   orxSTRINGID       stDefaultGroupID;           /**< Default group ID */
   orxSTRINGID       stCurrentGroupID;           /**< Current group ID */
   orxSTRINGID       stCachedGroupID;            /**< Cached group ID */
+  orxU64            u64EnableCount;             /**< Enable count (used for enable orders) */
+  orxU32            u32TemplateRevision;        /**< Config revision of the last template sweep */
   orxU32            u32Flags;                   /**< Control flags */
 
 #ifdef __orxDEBUG__
@@ -271,6 +430,60 @@ typedef struct __orxOBJECT_STATIC_t
 static orxOBJECT_STATIC sstObject;
 
 
+/** Template keys
+ */
+static const struct __orxOBJECT_TEMPLATE_KEY_DEFINITION_t
+{
+  const orxSTRING         zKey;
+  orxOBJECT_TEMPLATE_TYPE eType;
+  orxCOLORSPACE           eColorSpace;
+} sastObjectTemplateKeyList[orxOBJECT_TEMPLATE_KEY_NUMBER] =
+{
+  {orxOBJECT_KZ_CONFIG_AGE,                 orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_GROUP,               orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_POSITION,            orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_AUTO_SCROLL,         orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_FLIP,                orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_DEPTH_SCALE,         orxOBJECT_TEMPLATE_TYPE_BOOL,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT,  orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_PARENT_CAMERA,       orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE,    orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_GRAPHIC_NAME,        orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME,    orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_ANIM_FREQUENCY,      orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SIZE,                orxOBJECT_TEMPLATE_TYPE_VECTOR, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_PIVOT,               orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SCALE,               orxOBJECT_TEMPLATE_TYPE_VECTOR, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_COLOR,               orxOBJECT_TEMPLATE_TYPE_COLOR,  orxCOLORSPACE_COMPONENT},
+  {orxOBJECT_KZ_CONFIG_RGB,                 orxOBJECT_TEMPLATE_TYPE_COLOR,  orxCOLORSPACE_RGB},
+  {orxOBJECT_KZ_CONFIG_HSL,                 orxOBJECT_TEMPLATE_TYPE_COLOR,  orxCOLORSPACE_HSL},
+  {orxOBJECT_KZ_CONFIG_HSV,                 orxOBJECT_TEMPLATE_TYPE_COLOR,  orxCOLORSPACE_HSV},
+  {orxOBJECT_KZ_CONFIG_ALPHA,               orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_BODY,                orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_CLOCK,               orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_ROTATION,            orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION,  orxOBJECT_TEMPLATE_TYPE_VECTOR, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_CHILD_LIST,          orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST,    orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SPEED,               orxOBJECT_TEMPLATE_TYPE_VECTOR, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED,  orxOBJECT_TEMPLATE_TYPE_BOOL,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY,    orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_FX_LIST,             orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_FX_RECURSIVE_LIST,   orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_FX_FREQUENCY,        orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SPAWNER,             orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SOUND_LIST,          orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SHADER_LIST,         orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_TRACK_LIST,          orxOBJECT_TEMPLATE_TYPE_LIST,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_SMOOTHING,           orxOBJECT_TEMPLATE_TYPE_BOOL,   orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_BLEND_MODE,          orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_REPEAT,              orxOBJECT_TEMPLATE_TYPE_VECTOR, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_LIFETIME,            orxOBJECT_TEMPLATE_TYPE_FLOAT,  orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_ON_DELETE,           orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE},
+  {orxOBJECT_KZ_CONFIG_ON_CREATE,           orxOBJECT_TEMPLATE_TYPE_STRING, orxCOLORSPACE_NONE}
+};
+
+
 /***************************************************************************
  * Private functions                                                       *
  ***************************************************************************/
@@ -3536,6 +3749,237 @@ void orxFASTCALL orxObject_CommandGetPivot(orxU32 _u32ArgNumber, const orxCOMMAN
   return;
 }
 
+/** Stores a list of bodies in config (current section), as their owners' GUIDs
+ * @param[in]   _zKey           Key to use
+ * @param[in]   _apstBodyList   List of bodies, orxNULL/orxHANDLE_UNDEFINED for none
+ * @param[in]   _u32Number      Number of bodies
+ */
+static void orxFASTCALL orxObject_SetBatchBodyList(const orxSTRING _zKey, orxBODY *const *_apstBodyList, orxU32 _u32Number)
+{
+  /* Has bodies? */
+  if(_u32Number != 0)
+  {
+    const orxSTRING  *azValueList;
+    orxCHAR          *acBuffer;
+    orxU32            i;
+
+    /* Allocates value & buffer lists */
+    azValueList = (const orxSTRING *)orxMemory_Allocate(_u32Number * (sizeof(orxSTRING) + 20 * sizeof(orxCHAR)), orxMEMORY_TYPE_TEMP);
+    orxASSERT(azValueList != orxNULL);
+    acBuffer    = (orxCHAR *)(azValueList + _u32Number);
+
+    /* For all bodies */
+    for(i = 0; i < _u32Number; i++)
+    {
+      orxOBJECT *pstObject;
+
+      /* Gets its owner */
+      pstObject = ((_apstBodyList[i] != orxNULL) && (_apstBodyList[i] != (orxBODY *)orxHANDLE_UNDEFINED)) ? orxOBJECT(orxStructure_GetOwner(_apstBodyList[i])) : orxNULL;
+
+      /* Prints its GUID */
+      orxString_NPrint(acBuffer + 20 * i, 20, "0x%016llX", (pstObject != orxNULL) ? orxStructure_GetGUID(pstObject) : 0);
+      azValueList[i] = acBuffer + 20 * i;
+    }
+
+    /* Stores them */
+    orxConfig_SetListString(_zKey, azValueList, _u32Number);
+
+    /* Frees lists */
+    orxMemory_Free((void *)azValueList);
+  }
+  else
+  {
+    /* Clears value */
+    orxConfig_ClearValue(_zKey);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Command: RaycastBatch
+ */
+void orxFASTCALL orxObject_CommandRaycastBatch(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxU32 u32Result = 0;
+
+  /* Pushes batch section */
+  if(orxConfig_PushSection(_astArgList[0].zValue) != orxSTATUS_FAILURE)
+  {
+    orxS32 s32Count;
+
+    /* Gets query count */
+    s32Count = orxMIN(orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_BATCH_BEGIN), orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_BATCH_END));
+
+    /* Valid? */
+    if(s32Count > 0)
+    {
+      orxPHYSICS_RAYCAST        *astRaycastList;
+      orxPHYSICS_RAYCAST_RESULT *astResultList;
+      orxBODY                  **apstBodyList;
+      orxU16                     u16SelfFlags, u16CheckMask;
+      orxBOOL                    bEarlyExit;
+      orxS32                     i;
+
+      /* Allocates query, result & body lists */
+      astRaycastList  = (orxPHYSICS_RAYCAST *)orxMemory_Allocate((orxU32)s32Count * sizeof(orxPHYSICS_RAYCAST), orxMEMORY_TYPE_TEMP);
+      astResultList   = (orxPHYSICS_RAYCAST_RESULT *)orxMemory_Allocate((orxU32)s32Count * sizeof(orxPHYSICS_RAYCAST_RESULT), orxMEMORY_TYPE_TEMP);
+      apstBodyList    = (orxBODY **)orxMemory_Allocate((orxU32)s32Count * sizeof(orxBODY *), orxMEMORY_TYPE_TEMP);
+      orxASSERT(astRaycastList != orxNULL);
+      orxASSERT(astResultList != orxNULL);
+      orxASSERT(apstBodyList != orxNULL);
+
+      /* Gets filter & early exit status */
+      u16SelfFlags  = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BATCH_SELF_FLAGS) != orxFALSE) ? (orxU16)orxConfig_GetU32(orxOBJECT_KZ_CONFIG_BATCH_SELF_FLAGS) : 0xFFFF;
+      u16CheckMask  = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BATCH_CHECK_MASK) != orxFALSE) ? (orxU16)orxConfig_GetU32(orxOBJECT_KZ_CONFIG_BATCH_CHECK_MASK) : 0xFFFF;
+      bEarlyExit    = orxConfig_GetBool(orxOBJECT_KZ_CONFIG_BATCH_EARLY_EXIT);
+
+      /* For all queries */
+      for(i = 0; i < s32Count; i++)
+      {
+        /* Inits it */
+        orxConfig_GetListVector(orxOBJECT_KZ_CONFIG_BATCH_BEGIN, i, &(astRaycastList[i].vBegin));
+        orxConfig_GetListVector(orxOBJECT_KZ_CONFIG_BATCH_END, i, &(astRaycastList[i].vEnd));
+        astRaycastList[i].u16SelfFlags = u16SelfFlags;
+        astRaycastList[i].u16CheckMask = u16CheckMask;
+        astRaycastList[i].bEarlyExit   = bEarlyExit;
+      }
+
+      /* Issues raycasts */
+      u32Result = orxBody_RaycastBatch(astRaycastList, (orxU32)s32Count, astResultList, (_u32ArgNumber > 1) ? _astArgList[1].bValue : orxTRUE);
+
+      /* For all results */
+      for(i = 0; i < s32Count; i++)
+      {
+        /* Gets its body */
+        apstBodyList[i] = (orxBODY *)astResultList[i].hUserData;
+      }
+
+      /* Stores results */
+      orxObject_SetBatchBodyList(orxOBJECT_KZ_CONFIG_BATCH_RESULT, apstBodyList, (orxU32)s32Count);
+
+      /* Frees lists */
+      orxMemory_Free(apstBodyList);
+      orxMemory_Free(astResultList);
+      orxMemory_Free(astRaycastList);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Updates result */
+  _pstResult->u32Value = u32Result;
+
+  /* Done! */
+  return;
+}
+
+/** Command: BoxPickBatch
+ */
+void orxFASTCALL orxObject_CommandBoxPickBatch(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxU32 u32Result = 0;
+
+  /* Pushes batch section */
+  if(orxConfig_PushSection(_astArgList[0].zValue) != orxSTATUS_FAILURE)
+  {
+    orxS32 s32Count;
+
+    /* Gets query count */
+    s32Count = orxMIN(orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_BATCH_TOP_LEFT), orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_BATCH_BOTTOM_RIGHT));
+
+    /* Valid? */
+    if(s32Count > 0)
+    {
+      orxPHYSICS_BOX_PICK  *astBoxPickList;
+      orxBODY             **apstBodyList;
+      orxU32               *au32CountList;
+      const orxSTRING      *azCountList;
+      orxCHAR              *acBuffer;
+      orxU32                u32Number, u32BodyCount;
+      orxU16                u16SelfFlags, u16CheckMask;
+      orxS32                i;
+
+      /* Gets number of bodies per query */
+      u32Number = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BATCH_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxOBJECT_KZ_CONFIG_BATCH_NUMBER) : 16;
+
+      /* Allocates query, body & count lists */
+      astBoxPickList  = (orxPHYSICS_BOX_PICK *)orxMemory_Allocate((orxU32)s32Count * sizeof(orxPHYSICS_BOX_PICK), orxMEMORY_TYPE_TEMP);
+      apstBodyList    = (u32Number != 0) ? (orxBODY **)orxMemory_Allocate((orxU32)s32Count * u32Number * sizeof(orxBODY *), orxMEMORY_TYPE_TEMP) : orxNULL;
+      au32CountList   = (orxU32 *)orxMemory_Allocate((orxU32)s32Count * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+      azCountList     = (const orxSTRING *)orxMemory_Allocate((orxU32)s32Count * (sizeof(orxSTRING) + 12 * sizeof(orxCHAR)), orxMEMORY_TYPE_TEMP);
+      orxASSERT(astBoxPickList != orxNULL);
+      orxASSERT((apstBodyList != orxNULL) || (u32Number == 0));
+      orxASSERT(au32CountList != orxNULL);
+      orxASSERT(azCountList != orxNULL);
+      acBuffer        = (orxCHAR *)(azCountList + s32Count);
+
+      /* Gets filter */
+      u16SelfFlags  = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BATCH_SELF_FLAGS) != orxFALSE) ? (orxU16)orxConfig_GetU32(orxOBJECT_KZ_CONFIG_BATCH_SELF_FLAGS) : 0xFFFF;
+      u16CheckMask  = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BATCH_CHECK_MASK) != orxFALSE) ? (orxU16)orxConfig_GetU32(orxOBJECT_KZ_CONFIG_BATCH_CHECK_MASK) : 0xFFFF;
+
+      /* For all queries */
+      for(i = 0; i < s32Count; i++)
+      {
+        orxVECTOR vTL, vBR;
+
+        /* Inits it */
+        orxConfig_GetListVector(orxOBJECT_KZ_CONFIG_BATCH_TOP_LEFT, i, &vTL);
+        orxConfig_GetListVector(orxOBJECT_KZ_CONFIG_BATCH_BOTTOM_RIGHT, i, &vBR);
+        orxAABox_Set(&(astBoxPickList[i].stBox), &vTL, &vBR);
+        astBoxPickList[i].u16SelfFlags = u16SelfFlags;
+        astBoxPickList[i].u16CheckMask = u16CheckMask;
+      }
+
+      /* Issues queries */
+      u32Result = orxBody_BoxPickBatch(astBoxPickList, (orxU32)s32Count, apstBodyList, u32Number, au32CountList, (_u32ArgNumber > 1) ? _astArgList[1].bValue : orxTRUE);
+
+      /* For all queries */
+      for(i = 0, u32BodyCount = 0; i < s32Count; i++)
+      {
+        orxU32 u32Count;
+
+        /* Gets its stored count */
+        u32Count = orxMIN(au32CountList[i], u32Number);
+
+        /* Packs its bodies */
+        if((u32Count != 0) && (u32BodyCount != (orxU32)i * u32Number))
+        {
+          orxMemory_Move(apstBodyList + u32BodyCount, apstBodyList + i * u32Number, u32Count * sizeof(orxBODY *));
+        }
+        u32BodyCount += u32Count;
+
+        /* Prints its count */
+        orxString_NPrint(acBuffer + 12 * i, 12, "%u", u32Count);
+        azCountList[i] = acBuffer + 12 * i;
+      }
+
+      /* Stores results */
+      orxConfig_SetListString(orxOBJECT_KZ_CONFIG_BATCH_COUNT, azCountList, (orxU32)s32Count);
+      orxObject_SetBatchBodyList(orxOBJECT_KZ_CONFIG_BATCH_RESULT, apstBodyList, u32BodyCount);
+
+      /* Frees lists */
+      orxMemory_Free((void *)azCountList);
+      orxMemory_Free(au32CountList);
+      if(apstBodyList != orxNULL)
+      {
+        orxMemory_Free(apstBodyList);
+      }
+      orxMemory_Free(astBoxPickList);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Updates result */
+  _pstResult->u32Value = u32Result;
+
+  /* Done! */
+  return;
+}
+
 /** Registers all the object commands
  */
 static orxINLINE void orxObject_RegisterCommands()
@@ -3761,6 +4205,11 @@ static orxINLINE void orxObject_RegisterCommands()
   orxCOMMAND_REGISTER_CORE_COMMAND(Object, SetPivot, "Object", orxCOMMAND_VAR_TYPE_U64, 2, 0, {"Object", orxCOMMAND_VAR_TYPE_U64}, {"Pivot", orxCOMMAND_VAR_TYPE_STRING});
   /* Command: GetPivot */
   orxCOMMAND_REGISTER_CORE_COMMAND(Object, GetPivot, "Pivot", orxCOMMAND_VAR_TYPE_VECTOR, 1, 0, {"Object", orxCOMMAND_VAR_TYPE_U64});
+
+  /* Command: RaycastBatch */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Object, RaycastBatch, "Hits", orxCOMMAND_VAR_TYPE_U32, 1, 1, {"Section", orxCOMMAND_VAR_TYPE_STRING}, {"Parallel = true", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: BoxPickBatch */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Object, BoxPickBatch, "Count", orxCOMMAND_VAR_TYPE_U32, 1, 1, {"Section", orxCOMMAND_VAR_TYPE_STRING}, {"Parallel = true", orxCOMMAND_VAR_TYPE_BOOL});
 }
 
 /** Unregisters all the object commands
@@ -3988,6 +4437,11 @@ static orxINLINE void orxObject_UnregisterCommands()
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Object, SetPivot);
   /* Command: GetPivot */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Object, GetPivot);
+
+  /* Command: RaycastBatch */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Object, RaycastBatch);
+  /* Command: BoxPickBatch */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Object, BoxPickBatch);
 }
 
 /** Adds a delayed FX using its config ID.
@@ -4323,402 +4777,1747 @@ static orxINLINE orxOBJECT *orxObject_CreateInternal()
   return pstResult;
 }
 
-/** Deletes an object
+/** Gets group lists
+ * @param[in]   _stGroupID      Concerned group ID
+ * @return      orxOBJECT_LISTS / orxNULL
  */
-static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject, orxBOOL _bNoCommand, orxOBJECT **_ppstNextObject)
+static orxINLINE orxOBJECT_LISTS *orxObject_GetGroupLists(orxSTRINGID _stGroupID)
 {
-  orxBOOL   bSelectedNext = orxFALSE;
-  orxSTATUS eResult       = orxSTATUS_FAILURE;
-
-  /* Decreases count */
-  orxStructure_DecreaseCount(_pstObject);
+  orxOBJECT_LISTS *pstResult;
 
-  /* Not referenced? */
-  if(orxStructure_GetRefCount(_pstObject) == 0)
+  /* Is cached one? */
+  if(_stGroupID == sstObject.stCachedGroupID)
   {
-    orxCOMMAND_VAR  stCommandResult;
-    const orxSTRING zCommand;
+    /* Gets it */
+    pstResult = sstObject.pstCachedGroupLists;
+  }
+  else
+  {
+    /* Gets group lists */
+    pstResult = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
 
-    /* Retrieves and clear on-delete command */
-    zCommand = _pstObject->zOnDelete;
-    _pstObject->zOnDelete = orxNULL;
+    /* Found? */
+    if(pstResult != orxNULL)
+    {
+      /* Caches it */
+      sstObject.pstCachedGroupLists = pstResult;
+      sstObject.stCachedGroupID     = _stGroupID;
+    }
+  }
 
-    /* Should continue? */
-    if((_bNoCommand != orxFALSE)
-    || (zCommand == orxNULL)
-    || (orxCommand_EvaluateWithGUID(zCommand, orxStructure_GetGUID(_pstObject), &stCommandResult) == orxNULL)
-    || ((stCommandResult.eType != orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.eType != orxCOMMAND_VAR_TYPE_STRING))
-    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_STRING) && (*stCommandResult.zValue != orxNULL) && (orxString_ICompare(stCommandResult.zValue, orxSTRING_FALSE) != 0))
-    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.bValue != orxFALSE)))
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets grid coordinate
+ * @param[in]   _pstGrid        Concerned grid
+ * @param[in]   _fValue         World value
+ * @return      Grid coordinate
+ */
+static orxINLINE orxS32 orxObject_GetGridCoord(const orxOBJECT_GRID *_pstGrid, orxFLOAT _fValue)
+{
+  orxFLOAT fCoord;
+
+  /* Gets clamped coordinate */
+  fCoord = orxMath_Floor(_fValue * _pstGrid->fRecCellSize);
+  fCoord = orxCLAMP(fCoord, -orxOBJECT_KF_GRID_MAX_COORD, orxOBJECT_KF_GRID_MAX_COORD);
+
+  /* Done! */
+  return orxF2S(fCoord);
+}
+
+/** Gets grid cell key: Y is kept in the high part, X is mixed with it in the low part so as to spread cells over the table buckets
+ * @param[in]   _s32X           X coordinate
+ * @param[in]   _s32Y           Y coordinate
+ * @return      Cell key
+ */
+static orxINLINE orxU64 orxObject_GetGridKey(orxS32 _s32X, orxS32 _s32Y)
+{
+  /* Done! */
+  return ((orxU64)(orxU32)_s32Y << 32) | (orxU64)((orxU32)_s32X ^ ((orxU32)_s32Y * orxOBJECT_KU32_GRID_KEY_MULTIPLIER));
+}
+
+/** Removes an object from its grid
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstGrid        Concerned grid
+ */
+static orxINLINE void orxObject_RemoveFromGrid(orxOBJECT *_pstObject, orxOBJECT_GRID *_pstGrid)
+{
+  orxLINKLIST *pstList;
+
+  /* Gets its current list */
+  pstList = orxLinkList_GetList(&(_pstObject->stGridNode));
+
+  /* Valid? */
+  if(pstList != orxNULL)
+  {
+    /* Removes it */
+    orxLinkList_Remove(&(_pstObject->stGridNode));
+
+    /* Empty cell? */
+    if((pstList != &(_pstGrid->stUnboundList))
+    && (orxLinkList_GetCount(pstList) == 0))
     {
-      orxEVENT stEvent;
+      /* Removes it from table */
+      orxHashTable_Remove(_pstGrid->pstCellTable, _pstObject->u64GridCell);
 
-      /* Inits event */
-      orxEVENT_INIT(stEvent, orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_DELETE, _pstObject, orxNULL, orxNULL);
+      /* Frees it */
+      orxBank_Free(_pstGrid->pstCellBank, pstList);
+    }
+  }
 
-      /* Sends event */
-      if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
-      {
-        orxU32 i;
+  /* Done! */
+  return;
+}
 
-        /* Removes parent */
-        orxObject_SetParent(_pstObject, orxNULL);
+/** Updates an object's grid cell
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstGrid        Concerned grid
+ */
+static void orxFASTCALL orxObject_UpdateGridCell(orxOBJECT *_pstObject, orxOBJECT_GRID *_pstGrid)
+{
+  orxFRAME     *pstFrame;
+  orxLINKLIST  *pstList, *pstCurrentList;
+  orxU64        u64Cell = 0;
 
-        /* Has children? */
-        if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN))
-        {
-          orxOBJECT *pstChild;
+  /* Defaults to unbound list */
+  pstList = &(_pstGrid->stUnboundList);
 
-          /* For all children */
-          for(pstChild = _pstObject->pstChild;
-              pstChild != orxNULL;
-              pstChild = _pstObject->pstChild)
-          {
-            /* Deletes it */
-            orxObject_DeleteInternal(pstChild, _bNoCommand, orxNULL);
-          }
-        }
+  /* Gets frame */
+  pstFrame = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
 
-        /* Unlinks all structures, frame last */
-        for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
-        {
-          if((i != orxSTRUCTURE_ID_FRAME) && (_pstObject->apstStructureList[i] != orxNULL))
-          {
-            orxObject_UnlinkStructure(_pstObject, (orxSTRUCTURE_ID)i);
-          }
-        }
-        orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_FRAME);
+  /* Owned frame without differential scrolling nor depth scaling? */
+  if((pstFrame != orxNULL)
+  && (orxStructure_GetOwner(pstFrame) == (orxSTRUCTURE *)_pstObject)
+  && (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH | orxFRAME_KU32_FLAG_DEPTH_SCALE) == orxFALSE))
+  {
+    orxGRAPHIC *pstGraphic;
+    orxVECTOR   vCenter;
+    orxFLOAT    fRadius = orxFLOAT_0;
 
-        /* Requested next object? */
-        if(_ppstNextObject != orxNULL)
-        {
-          orxLINKLIST_NODE *pstNode;
+    /* Tracks its changes */
+    orxStructure_SetFlags(pstFrame, orxFRAME_KU32_FLAG_TRACK_CHANGES, orxFRAME_KU32_FLAG_NONE);
 
-          /* Gets next enabled object */
-          pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+    /* Gets its position */
+    orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vCenter);
 
-          /* Stores it */
-          *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
+    /* Gets working graphic */
+    pstGraphic = orxObject_GetWorkingGraphic(_pstObject);
 
-          /* Updates status */
-          bSelectedNext = orxTRUE;
-        }
+    /* Valid? */
+    if(pstGraphic != orxNULL)
+    {
+      orxVECTOR vSize, vScale, vOffset;
 
-        /* Removes owner */
-        orxObject_SetOwner(_pstObject, orxNULL);
+      /* Gets its scaled size */
+      orxGraphic_GetSize(pstGraphic, &vSize);
+      orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+      vSize.fX *= vScale.fX;
+      vSize.fY *= vScale.fY;
 
-        /* Removes object from its current group */
-        if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
-        {
-          orxLinkList_Remove(&(_pstObject->stGroupNode));
-        }
+      /* Gets center offset based on pivot, the same way render does */
+      orxGraphic_GetPivot(pstGraphic, &vOffset);
+      vOffset.fX = orx2F(0.5f) * vSize.fX - vScale.fX * vOffset.fX;
+      vOffset.fY = orx2F(0.5f) * vSize.fY - vScale.fY * vOffset.fY;
+      vOffset.fZ = orxFLOAT_0;
+      orxVector_2DRotate(&vOffset, &vOffset, orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL));
 
-        /* Removes object from the enable lists */
-        if(orxLinkList_GetList(&(_pstObject->stEnableNode)) != orxNULL)
-        {
-          orxLinkList_Remove(&(_pstObject->stEnableNode));
-        }
-        if(orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) != orxNULL)
-        {
-          orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
-        }
+      /* Updates center */
+      orxVector_Add(&vCenter, &vCenter, &vOffset);
 
-        /* Deletes structure */
-        orxStructure_Delete(_pstObject);
+      /* Gets bounding radius */
+      fRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+    }
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-      }
-      else
-      {
-        /* Increases count */
-        orxStructure_IncreaseCount(_pstObject);
+    /* Working graphic isn't its own graphic (animation / no graphic)? */
+    if(pstGraphic != orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC))
+    {
+      orxOBOX   stBox;
+      orxVECTOR vBoxCenter;
+      orxFLOAT  fDX, fDY, fBoxRadius;
 
-        /* Resets its active time: going undead */
-        _pstObject->fActiveTime = orxFLOAT_0;
+      /* Gets its bounding box, as used for picking */
+      orxObject_GetBoundingBox(_pstObject, &stBox);
+      orxOBox_GetCenter(&stBox, &vBoxCenter);
 
-        /* Disables it */
-        orxObject_Enable(_pstObject, orxFALSE);
-      }
+      /* Gets radius enclosing both boxes */
+      fDX         = vBoxCenter.fX - vCenter.fX;
+      fDY         = vBoxCenter.fY - vCenter.fY;
+      fBoxRadius  = orxMath_Sqrt((fDX * fDX) + (fDY * fDY));
+      fDX         = stBox.vX.fX + stBox.vY.fX;
+      fDY         = stBox.vX.fY + stBox.vY.fY;
+      fBoxRadius += orx2F(0.5f) * orxMath_Sqrt((fDX * fDX) + (fDY * fDY));
+      fRadius     = orxMAX(fRadius, fBoxRadius);
     }
-    else
+
+    /* Fits in a cell? */
+    if(fRadius <= _pstGrid->fCellSize)
     {
-      /* Increases count */
-      orxStructure_IncreaseCount(_pstObject);
+      /* Gets its cell */
+      u64Cell = orxObject_GetGridKey(orxObject_GetGridCoord(_pstGrid, vCenter.fX), orxObject_GetGridCoord(_pstGrid, vCenter.fY));
+      pstList = orxNULL;
     }
   }
 
-  /* Requested next object and not already selected? */
-  if((_ppstNextObject != orxNULL) && (bSelectedNext == orxFALSE))
+  /* Gets current list */
+  pstCurrentList = orxLinkList_GetList(&(_pstObject->stGridNode));
+
+  /* Needs to move? */
+  if((pstCurrentList == orxNULL)
+  || ((pstList != orxNULL)
+    ? (pstCurrentList != pstList)
+    : ((pstCurrentList == &(_pstGrid->stUnboundList)) || (_pstObject->u64GridCell != u64Cell))))
   {
-    orxLINKLIST_NODE *pstNode;
+    /* Removes it from its current list */
+    orxObject_RemoveFromGrid(_pstObject, _pstGrid);
 
-    /* Gets next enabled object */
-    pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+    /* Is in a cell? */
+    if(pstList == orxNULL)
+    {
+      orxLINKLIST **ppstBucket;
 
-    /* Stores it */
-    *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
-  }
+      /* Gets cell bucket */
+      ppstBucket = (orxLINKLIST **)orxHashTable_Retrieve(_pstGrid->pstCellTable, u64Cell);
 
-  /* Done! */
-  return eResult;
+      /* Valid? */
+      if(ppstBucket != orxNULL)
+      {
+        /* New cell? */
+        if(*ppstBucket == orxNULL)
+        {
+          /* Allocates it */
+          *ppstBucket = (orxLINKLIST *)orxBank_Allocate(_pstGrid->pstCellBank);
+
+          /* Success? */
+          if(*ppstBucket != orxNULL)
+          {
+            /* Clears it */
+            orxMemory_Zero(*ppstBucket, sizeof(orxLINKLIST));
+          }
+          else
+          {
+            /* Removes bucket */
+            orxHashTable_Remove(_pstGrid->pstCellTable, u64Cell);
+          }
+        }
+      }
+
+      /* Valid cell? */
+      if((ppstBucket != orxNULL) && (*ppstBucket != orxNULL))
+      {
+        /* Uses it */
+        pstList = *ppstBucket;
+        _pstObject->u64GridCell = u64Cell;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Couldn't allocate grid cell, object will be considered unbound.", orxObject_GetName(_pstObject));
+
+        /* Uses unbound list */
+        pstList = &(_pstGrid->stUnboundList);
+      }
+    }
+
+    /* Adds it */
+    orxLinkList_AddEnd(pstList, &(_pstObject->stGridNode));
+
+    /* Updates move count */
+    _pstGrid->u32MoveCount++;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Refreshes an object's grid cell, if in a grid
+ * @param[in]   _pstObject      Concerned object
+ */
+static orxINLINE void orxObject_RefreshGridCell(orxOBJECT *_pstObject)
+{
+  /* Is in a grid? */
+  if(orxLinkList_GetList(&(_pstObject->stGridNode)) != orxNULL)
+  {
+    orxOBJECT_LISTS *pstGroupLists;
+
+    /* Gets its group lists */
+    pstGroupLists = orxObject_GetGroupLists(_pstObject->stGroupID);
+
+    /* Checks */
+    orxASSERT((pstGroupLists != orxNULL) && (pstGroupLists->pstGrid != orxNULL));
+
+    /* Updates its cell */
+    orxObject_UpdateGridCell(_pstObject, pstGroupLists->pstGrid);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Deletes a group grid
+ * @param[in]   _pstGroupLists  Concerned group lists
+ * @param[in]   _bUntrack       Stops tracking frame changes
+ */
+static void orxFASTCALL orxObject_DeleteGrid(orxOBJECT_LISTS *_pstGroupLists, orxBOOL _bUntrack)
+{
+  orxLINKLIST_NODE *pstNode;
+
+  /* Checks */
+  orxASSERT(_pstGroupLists->pstGrid != orxNULL);
+
+  /* For all objects in group */
+  for(pstNode = orxLinkList_GetFirst(&(_pstGroupLists->stList));
+      pstNode != orxNULL;
+      pstNode = orxLinkList_GetNext(pstNode))
+  {
+    orxOBJECT *pstObject;
+
+    /* Gets object */
+    pstObject = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGroupNode, pstNode);
+
+    /* In grid? */
+    if(orxLinkList_GetList(&(pstObject->stGridNode)) != orxNULL)
+    {
+      /* Removes it */
+      orxLinkList_Remove(&(pstObject->stGridNode));
+
+      /* Should untrack? */
+      if(_bUntrack != orxFALSE)
+      {
+        orxFRAME *pstFrame;
+
+        /* Gets its frame */
+        pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+
+        /* Owned? */
+        if((pstFrame != orxNULL) && (orxStructure_GetOwner(pstFrame) == (orxSTRUCTURE *)pstObject))
+        {
+          /* Stops tracking its changes */
+          orxStructure_SetFlags(pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_TRACK_CHANGES);
+        }
+      }
+    }
+  }
+
+  /* Deletes cell table & bank */
+  orxHashTable_Delete(_pstGroupLists->pstGrid->pstCellTable);
+  orxBank_Delete(_pstGroupLists->pstGrid->pstCellBank);
+
+  /* Frees grid */
+  orxMemory_Free(_pstGroupLists->pstGrid);
+  _pstGroupLists->pstGrid = orxNULL;
+
+  /* Done! */
+  return;
+}
+
+/** Adds an object to a grid query result list
+ * @param[in]   _pstResult      Concerned result list
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _bEnabledOnly   Only adds the object if it's part of the enable lists
+ */
+static orxINLINE void orxObject_AddGridResult(orxOBJECT_GRID_RESULT *_pstResult, orxOBJECT *_pstObject, orxBOOL _bEnabledOnly)
+{
+  /* Should add it? */
+  if((_bEnabledOnly == orxFALSE)
+  || (orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) != orxNULL))
+  {
+    /* Is list full? */
+    if(_pstResult->u32Count == _pstResult->u32Size)
+    {
+      orxOBJECT **apstNewList;
+      orxU32      u32NewSize;
+
+      /* Gets new size */
+      u32NewSize = (_pstResult->u32Size != 0) ? _pstResult->u32Size << 1 : orxOBJECT_KU32_GRID_RESULT_SIZE;
+
+      /* Grows list */
+      apstNewList = (orxOBJECT **)orxMemory_Reallocate(_pstResult->apstObjectList, u32NewSize * sizeof(orxOBJECT *), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(apstNewList != orxNULL)
+      {
+        /* Stores it */
+        _pstResult->apstObjectList  = apstNewList;
+        _pstResult->u32Size         = u32NewSize;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't grow grid query result list to %u entries, ignoring object [%s].", u32NewSize, orxObject_GetName(_pstObject));
+      }
+    }
+
+    /* Has room? */
+    if(_pstResult->u32Count < _pstResult->u32Size)
+    {
+      /* Stores object */
+      _pstResult->apstObjectList[_pstResult->u32Count++] = _pstObject;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Adds all objects of a grid list to a query result list
+ * @param[in]   _pstResult      Concerned result list
+ * @param[in]   _pstList        Concerned list
+ * @param[in]   _bEnabledOnly   Only adds objects that are part of the enable lists
+ */
+static orxINLINE void orxObject_AddGridResultList(orxOBJECT_GRID_RESULT *_pstResult, const orxLINKLIST *_pstList, orxBOOL _bEnabledOnly)
+{
+  orxLINKLIST_NODE *pstNode;
+
+  /* For all objects */
+  for(pstNode = orxLinkList_GetFirst(_pstList);
+      pstNode != orxNULL;
+      pstNode = orxLinkList_GetNext(pstNode))
+  {
+    /* Adds it */
+    orxObject_AddGridResult(_pstResult, orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGridNode, pstNode), _bEnabledOnly);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Refreshes the grid cells of all the objects that moved since last refresh
+ */
+static void orxFASTCALL orxObject_RefreshGrids()
+{
+  orxFRAME *pstFrame;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_RefreshGrids");
+
+  /* For all changed frames */
+  for(pstFrame = orxFrame_PopChanged();
+      pstFrame != orxNULL;
+      pstFrame = orxFrame_PopChanged())
+  {
+    orxOBJECT *pstObject;
+
+    /* Gets its owner object */
+    pstObject = orxOBJECT(orxStructure_GetOwner(pstFrame));
+
+    /* Valid? */
+    if(pstObject != orxNULL)
+    {
+      /* Refreshes its grid cell */
+      orxObject_RefreshGridCell(pstObject);
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Queries a grid: gathers all the objects that potentially intersect a box (grids need to be refreshed beforehand)
+ * @param[in]   _pstGrid        Concerned grid
+ * @param[in]   _pstBox         Box to consider, in world space (Z is ignored)
+ * @param[in]   _bEnabledOnly   Only gathers objects that are part of the enable lists
+ * @param[out]  _pstResult      Result list, cleared beforehand
+ */
+static void orxFASTCALL orxObject_QueryGrid(orxOBJECT_GRID *_pstGrid, const orxAABOX *_pstBox, orxBOOL _bEnabledOnly, orxOBJECT_GRID_RESULT *_pstResult)
+{
+  orxS32 s32MinX, s32MinY, s32MaxX, s32MaxY;
+
+  /* Clears results */
+  _pstResult->u32Count = 0;
+
+  /* Updates query count */
+  _pstGrid->u32QueryCount++;
+
+  /* Adds all unbound objects */
+  orxObject_AddGridResultList(_pstResult, &(_pstGrid->stUnboundList), _bEnabledOnly);
+
+  /* Gets cell range, extended by one cell as objects are binned by their center */
+  s32MinX = orxObject_GetGridCoord(_pstGrid, _pstBox->vTL.fX) - 1;
+  s32MinY = orxObject_GetGridCoord(_pstGrid, _pstBox->vTL.fY) - 1;
+  s32MaxX = orxObject_GetGridCoord(_pstGrid, _pstBox->vBR.fX) + 1;
+  s32MaxY = orxObject_GetGridCoord(_pstGrid, _pstBox->vBR.fY) + 1;
+
+  /* Valid? */
+  if((s32MinX <= s32MaxX) && (s32MinY <= s32MaxY))
+  {
+    /* Fewer cells in range than used ones? */
+    if((orxU64)(s32MaxX - s32MinX + 1) * (orxU64)(s32MaxY - s32MinY + 1) <= (orxU64)orxHashTable_GetCount(_pstGrid->pstCellTable))
+    {
+      orxS32 s32X, s32Y;
+
+      /* For all cells in range */
+      for(s32Y = s32MinY; s32Y <= s32MaxY; s32Y++)
+      {
+        for(s32X = s32MinX; s32X <= s32MaxX; s32X++)
+        {
+          orxLINKLIST *pstList;
+
+          /* Gets cell */
+          pstList = (orxLINKLIST *)orxHashTable_Get(_pstGrid->pstCellTable, orxObject_GetGridKey(s32X, s32Y));
+
+          /* Valid? */
+          if(pstList != orxNULL)
+          {
+            /* Adds its objects */
+            orxObject_AddGridResultList(_pstResult, pstList, _bEnabledOnly);
+          }
+        }
+      }
+    }
+    else
+    {
+      orxLINKLIST  *pstList;
+      orxHANDLE     hIterator;
+      orxU64        u64Key;
+
+      /* For all used cells */
+      for(hIterator = orxHashTable_GetNext(_pstGrid->pstCellTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstList);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(_pstGrid->pstCellTable, hIterator, &u64Key, (void **)&pstList))
+      {
+        orxS32 s32X, s32Y;
+
+        /* Gets its coordinates */
+        s32Y = (orxS32)(orxU32)(u64Key >> 32);
+        s32X = (orxS32)((orxU32)u64Key ^ ((orxU32)s32Y * orxOBJECT_KU32_GRID_KEY_MULTIPLIER));
+
+        /* In range? */
+        if((s32X >= s32MinX) && (s32X <= s32MaxX) && (s32Y >= s32MinY) && (s32Y <= s32MaxY))
+        {
+          /* Adds its objects */
+          orxObject_AddGridResultList(_pstResult, pstList, _bEnabledOnly);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Sifts down an entry of a grid query result heap, ordered by enable order
+ * @param[in,out] _apstList     Heap list
+ * @param[in]   _u32Index       Index of the entry to sift down
+ * @param[in]   _u32Count       Number of entries in the heap
+ */
+static orxINLINE void orxObject_SiftGridResult(orxOBJECT **_apstList, orxU32 _u32Index, orxU32 _u32Count)
+{
+  orxOBJECT  *pstObject;
+  orxU32      u32Child;
+
+  /* Gets entry */
+  pstObject = _apstList[_u32Index];
+
+  /* While it has children */
+  for(u32Child = (_u32Index << 1) + 1; u32Child < _u32Count; u32Child = (_u32Index << 1) + 1)
+  {
+    /* Gets latest enabled child */
+    if((u32Child + 1 < _u32Count) && (_apstList[u32Child + 1]->u64EnableOrder > _apstList[u32Child]->u64EnableOrder))
+    {
+      u32Child++;
+    }
+
+    /* Entry was enabled later? */
+    if(pstObject->u64EnableOrder >= _apstList[u32Child]->u64EnableOrder)
+    {
+      break;
+    }
+
+    /* Moves child up */
+    _apstList[_u32Index] = _apstList[u32Child];
+    _u32Index = u32Child;
+  }
+
+  /* Stores entry */
+  _apstList[_u32Index] = pstObject;
+
+  /* Done! */
+  return;
+}
+
+/** Sorts a grid query result list by enable order (in-place heap sort), so as to match the order of the enable group list
+ * @param[in,out] _pstResult    Concerned result list
+ */
+static void orxFASTCALL orxObject_SortGridResult(orxOBJECT_GRID_RESULT *_pstResult)
+{
+  orxOBJECT **apstList;
+  orxU32      u32Count, i;
+
+  /* Gets list */
+  apstList = _pstResult->apstObjectList;
+  u32Count = _pstResult->u32Count;
+
+  /* Finds first unordered entry */
+  for(i = 1; (i < u32Count) && (apstList[i - 1]->u64EnableOrder < apstList[i]->u64EnableOrder); i++);
+
+  /* Not already sorted? */
+  if(i < u32Count)
+  {
+    /* Builds heap */
+    for(i = u32Count >> 1; i > 0; i--)
+    {
+      orxObject_SiftGridResult(apstList, i - 1, u32Count);
+    }
+
+    /* For all entries, from the end */
+    for(i = u32Count - 1; i > 0; i--)
+    {
+      orxOBJECT *pstObject;
+
+      /* Moves latest enabled one there */
+      pstObject   = apstList[i];
+      apstList[i] = apstList[0];
+      apstList[0] = pstObject;
+
+      /* Restores heap */
+      orxObject_SiftGridResult(apstList, 0, i);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the axis-aligned box enclosing an oriented box (Z is ignored)
+ * @param[in]   _pstOBox        Concerned oriented box
+ * @param[out]  _pstAABox       Enclosing axis-aligned box
+ */
+static orxINLINE void orxObject_GetEnclosingBox(const orxOBOX *_pstOBox, orxAABOX *_pstAABox)
+{
+  orxFLOAT fOriginX, fOriginY;
+
+  /* Gets origin */
+  fOriginX = _pstOBox->vPosition.fX - _pstOBox->vPivot.fX;
+  fOriginY = _pstOBox->vPosition.fY - _pstOBox->vPivot.fY;
+
+  /* Gets extents, adding each axis' contribution where it goes */
+  _pstAABox->vTL.fX = fOriginX + orxMIN(_pstOBox->vX.fX, orxFLOAT_0) + orxMIN(_pstOBox->vY.fX, orxFLOAT_0);
+  _pstAABox->vTL.fY = fOriginY + orxMIN(_pstOBox->vX.fY, orxFLOAT_0) + orxMIN(_pstOBox->vY.fY, orxFLOAT_0);
+  _pstAABox->vBR.fX = fOriginX + orxMAX(_pstOBox->vX.fX, orxFLOAT_0) + orxMAX(_pstOBox->vY.fX, orxFLOAT_0);
+  _pstAABox->vBR.fY = fOriginY + orxMAX(_pstOBox->vX.fY, orxFLOAT_0) + orxMAX(_pstOBox->vY.fY, orxFLOAT_0);
+  _pstAABox->vTL.fZ = _pstAABox->vBR.fZ = orxFLOAT_0;
+
+  /* Done! */
+  return;
+}
+
+/** Gets the grid of a group, after refreshing all grids
+ * @param[in]   _stGroupID      Concerned group ID, orxSTRINGID_UNDEFINED for all
+ * @return      orxOBJECT_GRID / orxNULL if the group doesn't have a grid
+ */
+static orxINLINE orxOBJECT_GRID *orxObject_GetRefreshedGrid(orxSTRINGID _stGroupID)
+{
+  orxOBJECT_LISTS  *pstGroupLists;
+  orxOBJECT_GRID   *pstResult = orxNULL;
+
+  /* Gets group lists */
+  pstGroupLists = (_stGroupID != orxSTRINGID_UNDEFINED) ? orxObject_GetGroupLists(_stGroupID) : orxNULL;
+
+  /* Has grid? */
+  if((pstGroupLists != orxNULL) && (pstGroupLists->pstGrid != orxNULL))
+  {
+    /* Refreshes grids */
+    orxObject_RefreshGrids();
+
+    /* Updates result */
+    pstResult = pstGroupLists->pstGrid;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets next picking candidate: from the picking query result list when a grid was queried, from the whole group otherwise
+ * @param[in]   _pstObject      Current candidate, orxNULL to get the first one
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[in]   _pstGrid        Queried grid, orxNULL if none
+ * @param[in,out] _pu32Index    Index in the query result list
+ * @return      orxOBJECT / orxNULL
+ */
+static orxINLINE orxOBJECT *orxObject_GetNextCandidate(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID, const orxOBJECT_GRID *_pstGrid, orxU32 *_pu32Index)
+{
+  orxOBJECT *pstResult;
+
+  /* Has grid? */
+  if(_pstGrid != orxNULL)
+  {
+    /* Gets next query result */
+    pstResult = (*_pu32Index < sstObject.stQueryResult.u32Count) ? sstObject.stQueryResult.apstObjectList[(*_pu32Index)++] : orxNULL;
+  }
+  else
+  {
+    /* Gets next object */
+    pstResult = orxObject_GetNext(_pstObject, _stGroupID);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Inserts an object in a sorted nearest list, if enabled and near enough
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pvPosition     Reference position (Z is ignored)
+ * @param[in]   _u32Number      Size of the nearest list
+ * @param[in,out] _apstObjectList Nearest object list
+ * @param[in,out] _afDistanceList Nearest square distance list
+ * @param[in,out] _pu32Count    Number of objects in the nearest list
+ * @return      Object's square distance / -orxFLOAT_1 if not enabled
+ */
+static orxINLINE orxFLOAT orxObject_InsertNearest(orxOBJECT *_pstObject, const orxVECTOR *_pvPosition, orxU32 _u32Number, orxOBJECT **_apstObjectList, orxFLOAT *_afDistanceList, orxU32 *_pu32Count)
+{
+  orxFLOAT fResult = -orxFLOAT_1;
+
+  /* Is enabled? */
+  if(orxObject_IsEnabled(_pstObject) != orxFALSE)
+  {
+    orxOBOX   stBox;
+    orxVECTOR vCenter;
+
+    /* Gets its bounding box center */
+    orxObject_GetBoundingBox(_pstObject, &stBox);
+    orxOBox_GetCenter(&stBox, &vCenter);
+
+    /* Gets its square distance */
+    fResult = ((vCenter.fX - _pvPosition->fX) * (vCenter.fX - _pvPosition->fX)) + ((vCenter.fY - _pvPosition->fY) * (vCenter.fY - _pvPosition->fY));
+
+    /* Should be inserted? */
+    if((*_pu32Count < _u32Number) || (fResult < _afDistanceList[_u32Number - 1]))
+    {
+      orxU32 i;
+
+      /* Gets insertion index, after any object at the same distance */
+      for(i = (*_pu32Count < _u32Number) ? (*_pu32Count)++ : _u32Number - 1;
+          (i > 0) && (_afDistanceList[i - 1] > fResult);
+          i--)
+      {
+        /* Shifts farther object */
+        _apstObjectList[i]  = _apstObjectList[i - 1];
+        _afDistanceList[i]  = _afDistanceList[i - 1];
+      }
+
+      /* Stores object */
+      _apstObjectList[i]  = _pstObject;
+      _afDistanceList[i]  = fResult;
+    }
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Deletes an object
+ */
+static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject, orxBOOL _bNoCommand, orxOBJECT **_ppstNextObject)
+{
+  orxBOOL   bSelectedNext = orxFALSE;
+  orxSTATUS eResult       = orxSTATUS_FAILURE;
+
+  /* Decreases count */
+  orxStructure_DecreaseCount(_pstObject);
+
+  /* Not referenced? */
+  if(orxStructure_GetRefCount(_pstObject) == 0)
+  {
+    orxCOMMAND_VAR  stCommandResult;
+    const orxSTRING zCommand;
+
+    /* Retrieves and clear on-delete command */
+    zCommand = _pstObject->zOnDelete;
+    _pstObject->zOnDelete = orxNULL;
+
+    /* Should continue? */
+    if((_bNoCommand != orxFALSE)
+    || (zCommand == orxNULL)
+    || (orxCommand_EvaluateWithGUID(zCommand, orxStructure_GetGUID(_pstObject), &stCommandResult) == orxNULL)
+    || ((stCommandResult.eType != orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.eType != orxCOMMAND_VAR_TYPE_STRING))
+    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_STRING) && (*stCommandResult.zValue != orxNULL) && (orxString_ICompare(stCommandResult.zValue, orxSTRING_FALSE) != 0))
+    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.bValue != orxFALSE)))
+    {
+      orxEVENT stEvent;
+
+      /* Inits event */
+      orxEVENT_INIT(stEvent, orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_DELETE, _pstObject, orxNULL, orxNULL);
+
+      /* Sends event */
+      if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
+      {
+        orxU32 i;
+
+        /* Removes parent */
+        orxObject_SetParent(_pstObject, orxNULL);
+
+        /* Has children? */
+        if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN))
+        {
+          orxOBJECT *pstChild;
+
+          /* For all children */
+          for(pstChild = _pstObject->pstChild;
+              pstChild != orxNULL;
+              pstChild = _pstObject->pstChild)
+          {
+            /* Deletes it */
+            orxObject_DeleteInternal(pstChild, _bNoCommand, orxNULL);
+          }
+        }
+
+        /* Is in a grid? */
+        if(orxLinkList_GetList(&(_pstObject->stGridNode)) != orxNULL)
+        {
+          /* Removes it */
+          orxObject_RemoveFromGrid(_pstObject, orxObject_GetGroupLists(_pstObject->stGroupID)->pstGrid);
+        }
+
+        /* Unlinks all structures, frame last */
+        for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+        {
+          if((i != orxSTRUCTURE_ID_FRAME) && (_pstObject->apstStructureList[i] != orxNULL))
+          {
+            orxObject_UnlinkStructure(_pstObject, (orxSTRUCTURE_ID)i);
+          }
+        }
+        orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_FRAME);
+
+        /* Requested next object? */
+        if(_ppstNextObject != orxNULL)
+        {
+          orxLINKLIST_NODE *pstNode;
+
+          /* Gets next enabled object */
+          pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+
+          /* Stores it */
+          *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
+
+          /* Updates status */
+          bSelectedNext = orxTRUE;
+        }
+
+        /* Removes owner */
+        orxObject_SetOwner(_pstObject, orxNULL);
+
+        /* Removes object from its current group */
+        if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
+        {
+          orxLinkList_Remove(&(_pstObject->stGroupNode));
+        }
+
+        /* Removes object from the enable lists */
+        if(orxLinkList_GetList(&(_pstObject->stEnableNode)) != orxNULL)
+        {
+          orxLinkList_Remove(&(_pstObject->stEnableNode));
+        }
+        if(orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) != orxNULL)
+        {
+          orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
+        }
+
+        /* Deletes structure */
+        orxStructure_Delete(_pstObject);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Increases count */
+        orxStructure_IncreaseCount(_pstObject);
+
+        /* Resets its active time: going undead */
+        _pstObject->fActiveTime = orxFLOAT_0;
+
+        /* Disables it */
+        orxObject_Enable(_pstObject, orxFALSE);
+      }
+    }
+    else
+    {
+      /* Increases count */
+      orxStructure_IncreaseCount(_pstObject);
+    }
+  }
+
+  /* Requested next object and not already selected? */
+  if((_ppstNextObject != orxNULL) && (bSelectedNext == orxFALSE))
+  {
+    orxLINKLIST_NODE *pstNode;
+
+    /* Gets next enabled object */
+    pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+
+    /* Stores it */
+    *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxObject_EventHandler(const orxEVENT *_pstEvent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_OBJECT);
+  orxASSERT(_pstEvent->eID == orxOBJECT_EVENT_PREPARE);
+
+  /* Has current parent? */
+  if(sstObject.pstCurrentParent != orxNULL)
+  {
+    /* Stores current parent as temporary parent in payload */
+    *((orxOBJECT **)_pstEvent->pstPayload) = sstObject.pstCurrentParent;
+
+    /* Sets it as owner */
+    orxObject_SetOwner(orxOBJECT(_pstEvent->hSender), sstObject.pstCurrentParent);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Deletes all the objects
+ */
+static orxINLINE void orxObject_DeleteAll()
+{
+  orxOBJECT *pstObject;
+
+  /* Gets first object */
+  pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+
+  /* Non empty? */
+  while(pstObject != orxNULL)
+  {
+    /* Deletes object */
+    orxObject_DeleteInternal(pstObject, orxTRUE, orxNULL);
+
+    /* Gets first object */
+    pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates an object
+ * @param[int] _pstObject         Concerned object
+ * @param[in] _pstClockInfo       Clock information where this callback has been registered
+ * @return Next object/orxNULL
+ */
+static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, const orxCLOCK_INFO *_pstClockInfo)
+{
+  orxU32        u32UpdateFlags;
+  orxSTRUCTURE *pstStructure;
+  orxBOOL       bDeleted = orxFALSE;
+  orxOBJECT    *pstResult = orxNULL;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_Update");
+
+  /* Gets object's structure */
+  pstStructure = (orxSTRUCTURE *)_pstObject;
+
+  /* Gets object's enabled, paused and death row flags */
+  u32UpdateFlags = orxFLAG_GET(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_ENABLED | orxOBJECT_KU32_FLAG_PAUSED | orxOBJECT_KU32_FLAG_DEATH_ROW);
+
+  /* Is object enabled and not paused or in death row? */
+  if((u32UpdateFlags == orxOBJECT_KU32_FLAG_ENABLED)
+  || (u32UpdateFlags & orxOBJECT_KU32_FLAG_DEATH_ROW))
+  {
+    orxCLOCK_INFO stClockInfo;
+
+    /* Has clock? */
+    if(_pstObject->apstStructureList[orxSTRUCTURE_ID_CLOCK] != orxNULL)
+    {
+      orxCLOCK *pstClock;
+
+      /* Uses it */
+      pstClock = (orxCLOCK *)_pstObject->apstStructureList[orxSTRUCTURE_ID_CLOCK];
+
+      /* Copies its info */
+      orxMemory_Copy(&stClockInfo, orxClock_GetInfo(pstClock), sizeof(orxCLOCK_INFO));
+
+      /* Computes its DT */
+      stClockInfo.fDT = orxClock_ComputeDT(_pstClockInfo->fDT, pstClock);
+    }
+    else
+    {
+      /* Copies its info */
+      orxMemory_Copy(&stClockInfo, _pstClockInfo, sizeof(orxCLOCK_INFO));
+    }
+
+    /* Updates its active time */
+    _pstObject->fActiveTime += stClockInfo.fDT;
+
+    /* Has life time? */
+    if(orxFLAG_TEST(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_HAS_LIFETIME))
+    {
+      /* Updates its life time */
+      _pstObject->fLifeTime -= stClockInfo.fDT;
+
+      /* Should die? */
+      if(_pstObject->fLifeTime <= orxFLOAT_0)
+      {
+        /* Deletes it */
+        orxObject_DeleteInternal(_pstObject, orxFALSE, &pstResult);
+
+        /* Marks as deleted */
+        bDeleted = orxTRUE;
+      }
+    }
+
+    /* !!! TODO !!! */
+    /* Updates culling info before calling update sub-functions */
+
+    /* Wasn't object deleted? */
+    if(bDeleted == orxFALSE)
+    {
+      /* Has DT? */
+      if(stClockInfo.fDT > orxFLOAT_0)
+      {
+        orxU32 u32LifeTimeFlags, i;
+
+        /* For all linked structures */
+        for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+        {
+          /* Is structure linked? */
+          if(_pstObject->apstStructureList[i] != orxNULL)
+          {
+            /* Updates it */
+            if(orxStructure_Update(_pstObject->apstStructureList[i], _pstObject, &stClockInfo) == orxSTATUS_FAILURE)
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to update structure [%s] for object <%s>.", orxStructure_GetIDString((orxSTRUCTURE_ID)i), orxObject_GetName(_pstObject));
+            }
+          }
+        }
+
+        /* Has animation? */
+        if(_pstObject->apstStructureList[orxSTRUCTURE_ID_ANIMPOINTER] != orxNULL)
+        {
+          /* Refreshes its grid cell as its working graphic might have changed */
+          orxObject_RefreshGridCell(_pstObject);
+        }
+
+        /* Has no body or local update? */
+        if((_pstObject->apstStructureList[orxSTRUCTURE_ID_BODY] == orxNULL)
+        || orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_LOCAL_UPDATE))
+        {
+          /* Has speed? */
+          if(orxVector_IsNull(&(_pstObject->vSpeed)) == orxFALSE)
+          {
+            orxVECTOR vPosition, vMove;
+
+            /* Gets its position */
+            orxObject_GetPosition(_pstObject, &vPosition);
+
+            /* Computes its move */
+            orxVector_Mulf(&vMove, &(_pstObject->vSpeed), stClockInfo.fDT);
+
+            /* Gets its new position */
+            orxVector_Add(&vPosition, &vPosition, &vMove);
+
+            /* Stores it */
+            orxObject_SetPosition(_pstObject, &vPosition);
+          }
+
+          /* Has angular velocity? */
+          if(_pstObject->fAngularVelocity != orxFLOAT_0)
+          {
+            /* Updates its rotation */
+            orxObject_SetRotation(_pstObject, orxObject_GetRotation(_pstObject) + (_pstObject->fAngularVelocity * stClockInfo.fDT));
+          }
+        }
+        else
+        {
+          /* Should detach? */
+          if(orxFLAG_TEST(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD))
+          {
+            /* Detaches it */
+            orxObject_Detach(_pstObject);
+
+            /* Updates status */
+            orxFLAG_SET(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD);
+          }
+        }
+
+        /* Has structure-bound lifetime? */
+        if((u32LifeTimeFlags = orxStructure_GetFlags(_pstObject, orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME)) != 0)
+        {
+          /* Not checking FX or no FX left? */
+          if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_FX_LIFETIME))
+          || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_FXPOINTER] != orxNULL)
+           && (orxFXPointer_GetCount(orxFXPOINTER(_pstObject->apstStructureList[orxSTRUCTURE_ID_FXPOINTER])) == 0)))
+          {
+            /* Not checking sound or no sound left? */
+            if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_SOUND_LIFETIME))
+            || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_SOUNDPOINTER] != orxNULL)
+             && (orxSoundPointer_GetCount(orxSOUNDPOINTER(_pstObject->apstStructureList[orxSTRUCTURE_ID_SOUNDPOINTER])) == 0)))
+            {
+              orxSPAWNER *pstSpawner;
+
+              /* Not checking spawner or no object left to spawn? */
+              if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_SPAWNER_LIFETIME))
+              || (((pstSpawner = orxSPAWNER(_pstObject->apstStructureList[orxSTRUCTURE_ID_SPAWNER])) != orxNULL)
+               && (orxSpawner_GetTotalObjectCount(pstSpawner) == orxSpawner_GetTotalObjectLimit(pstSpawner))))
+              {
+                /* Not checking timeline or no track left? */
+                if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_TIMELINE_LIFETIME))
+                || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_TIMELINE] != orxNULL)
+                 && (orxTimeLine_GetCount(orxTIMELINE(_pstObject->apstStructureList[orxSTRUCTURE_ID_TIMELINE])) == 0)))
+                {
+                  /* Not checking children or no child left? */
+                  if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_CHILDREN_LIFETIME))
+                  || (!orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN)))
+                  {
+                    /* Not checking anim or no current anim? */
+                    if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_ANIM_LIFETIME))
+                    || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_ANIMPOINTER] != orxNULL)
+                     && (orxAnimPointer_GetCurrentAnim(orxANIMPOINTER(_pstObject->apstStructureList[orxSTRUCTURE_ID_ANIMPOINTER])) == orxU32_UNDEFINED)))
+                    {
+                      /* Schedules object's deletion */
+                      orxObject_SetLifeTime(_pstObject, orxFLOAT_0);
+
+                      /* Disables it */
+                      orxObject_Enable(_pstObject, orxFALSE);
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Wasn't object deleted? */
+  if(bDeleted == orxFALSE)
+  {
+    orxLINKLIST_NODE *pstNode;
+
+    /* Gets next enabled object */
+    pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+
+    /* Valid? */
+    if(pstNode != orxNULL)
+    {
+      /* Updates result */
+      pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode);
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pstResult;
 }
 
-/** Event handler
- * @param[in]   _pstEvent                     Sent event
- * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+/** Is template valid? (ie. snapshot and config not modified since)
+ * @param[in]   _pstTemplate    Concerned template
+ * @return      orxTRUE / orxFALSE
  */
-static orxSTATUS orxFASTCALL orxObject_EventHandler(const orxEVENT *_pstEvent)
+static orxINLINE orxBOOL orxObject_IsTemplateValid(const orxOBJECT_TEMPLATE *_pstTemplate)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  /* Done! */
+  return ((_pstTemplate != orxNULL)
+       && (orxFLAG_TEST(_pstTemplate->u32Flags, orxOBJECT_KU32_TEMPLATE_FLAG_READY))
+       && (_pstTemplate->u32Revision == orxConfig_GetRevision())) ? orxTRUE : orxFALSE;
+}
+
+/** Gets a cached template value
+ * @param[in]   _pstTemplate    Concerned template
+ * @param[in]   _eKey           Concerned key
+ * @return      orxOBJECT_TEMPLATE_VALUE / orxNULL if it has to be read from config
+ */
+static orxINLINE const orxOBJECT_TEMPLATE_VALUE *orxObject_GetTemplateValue(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstResult = orxNULL;
 
   /* Checks */
-  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_OBJECT);
-  orxASSERT(_pstEvent->eID == orxOBJECT_EVENT_PREPARE);
+  orxASSERT(_eKey < orxOBJECT_TEMPLATE_KEY_NUMBER);
 
-  /* Has current parent? */
-  if(sstObject.pstCurrentParent != orxNULL)
+  /* Is template valid and value cached? */
+  if((orxObject_IsTemplateValid(_pstTemplate) != orxFALSE)
+  && (orxFLAG_TEST(_pstTemplate->astValueList[_eKey].u32Flags, orxOBJECT_KU32_VALUE_FLAG_CACHED)))
   {
-    /* Stores current parent as temporary parent in payload */
-    *((orxOBJECT **)_pstEvent->pstPayload) = sstObject.pstCurrentParent;
+    /* Updates result */
+    pstResult = &(_pstTemplate->astValueList[_eKey]);
+  }
 
-    /* Sets it as owner */
-    orxObject_SetOwner(orxOBJECT(_pstEvent->hSender), sstObject.pstCurrentParent);
+  /* Done! */
+  return pstResult;
+}
+
+/** Has template value? (mirrors orxConfig_HasValue())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxObject_HasTemplateValue(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey)
+{
+  /* Done! */
+  return (orxObject_IsTemplateValid(_pstTemplate) != orxFALSE)
+         ? (orxFLAG_TEST(_pstTemplate->astValueList[_eKey].u32Flags, orxOBJECT_KU32_VALUE_FLAG_HAS) ? orxTRUE : orxFALSE)
+         : orxConfig_HasValue(sastObjectTemplateKeyList[_eKey].zKey);
+}
+
+/** Gets template string value (mirrors orxConfig_GetString())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @return      orxSTRING
+ */
+static orxINLINE const orxSTRING orxObject_GetTemplateString(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Done! */
+  return (pstValue != orxNULL) ? pstValue->zValue : orxConfig_GetString(sastObjectTemplateKeyList[_eKey].zKey);
+}
+
+/** Gets template float value (mirrors orxConfig_GetFloat())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @return      orxFLOAT
+ */
+static orxINLINE orxFLOAT orxObject_GetTemplateFloat(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+
+  /* Checks */
+  orxASSERT((sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_FLOAT) || (sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_VECTOR));
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Done! */
+  return (pstValue != orxNULL) ? pstValue->fValue : orxConfig_GetFloat(sastObjectTemplateKeyList[_eKey].zKey);
+}
+
+/** Gets template bool value (mirrors orxConfig_GetBool())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @return      orxBOOL
+ */
+static orxINLINE orxBOOL orxObject_GetTemplateBool(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+
+  /* Checks */
+  orxASSERT(sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_BOOL);
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Done! */
+  return (pstValue != orxNULL) ? pstValue->bValue : orxConfig_GetBool(sastObjectTemplateKeyList[_eKey].zKey);
+}
+
+/** Gets template vector value (mirrors orxConfig_GetVector() & orxConfig_GetColorVector())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @param[out]  _pvVector       Storage for vector value
+ * @return      Stored vector / orxNULL
+ */
+static orxINLINE orxVECTOR *orxObject_GetTemplateVector(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey, orxVECTOR *_pvVector)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+  orxVECTOR                      *pvResult;
+
+  /* Checks */
+  orxASSERT((sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_VECTOR) || (sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_COLOR));
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Cached? */
+  if(pstValue != orxNULL)
+  {
+    /* Is a vector? */
+    if(orxFLAG_TEST(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_VECTOR))
+    {
+      /* Updates result */
+      pvResult = orxVector_Copy(_pvVector, &(pstValue->vValue));
+    }
+    else
+    {
+      /* Updates result */
+      pvResult = orxNULL;
+    }
+  }
+  else
+  {
+    /* Updates result */
+    pvResult = (sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_COLOR)
+               ? orxConfig_GetColorVector(sastObjectTemplateKeyList[_eKey].zKey, sastObjectTemplateKeyList[_eKey].eColorSpace, _pvVector)
+               : orxConfig_GetVector(sastObjectTemplateKeyList[_eKey].zKey, _pvVector);
   }
 
   /* Done! */
-  return eResult;
+  return pvResult;
 }
 
-/** Deletes all the objects
+/** Gets template list count (mirrors orxConfig_GetListCount())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @return      List count
  */
-static orxINLINE void orxObject_DeleteAll()
+static orxINLINE orxS32 orxObject_GetTemplateListCount(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey)
 {
-  orxOBJECT *pstObject;
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+
+  /* Checks */
+  orxASSERT(sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_LIST);
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Done! */
+  return (pstValue != orxNULL) ? pstValue->s32ListCount : orxConfig_GetListCount(sastObjectTemplateKeyList[_eKey].zKey);
+}
+
+/** Gets template list string value (mirrors orxConfig_GetListString())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @param[in]   _s32ListIndex   Index of the desired element
+ * @return      orxSTRING
+ */
+static orxINLINE const orxSTRING orxObject_GetTemplateListString(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey, orxS32 _s32ListIndex)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+
+  /* Checks */
+  orxASSERT(sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_LIST);
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Done! */
+  return ((pstValue != orxNULL) && (_s32ListIndex >= 0) && (_s32ListIndex < pstValue->s32ListCount)) ? pstValue->azListValue[_s32ListIndex] : orxConfig_GetListString(sastObjectTemplateKeyList[_eKey].zKey, _s32ListIndex);
+}
+
+/** Gets template list bool value (mirrors orxConfig_GetListBool())
+ * @param[in]   _pstTemplate    Concerned template, current section's one
+ * @param[in]   _eKey           Concerned key
+ * @param[in]   _s32ListIndex   Index of the desired element
+ * @return      orxBOOL
+ */
+static orxINLINE orxBOOL orxObject_GetTemplateListBool(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_KEY _eKey, orxS32 _s32ListIndex)
+{
+  const orxOBJECT_TEMPLATE_VALUE *pstValue;
+  orxBOOL                         bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(sastObjectTemplateKeyList[_eKey].eType == orxOBJECT_TEMPLATE_TYPE_LIST);
+
+  /* Gets cached value */
+  pstValue = orxObject_GetTemplateValue(_pstTemplate, _eKey);
+
+  /* Cached? */
+  if((pstValue != orxNULL) && (_s32ListIndex >= 0) && (_s32ListIndex < pstValue->s32ListCount))
+  {
+    /* Converts it */
+    orxString_ToBool(pstValue->azListValue[_s32ListIndex], &bResult, orxNULL);
+  }
+  else
+  {
+    /* Gets it from config */
+    bResult = orxConfig_GetListBool(sastObjectTemplateKeyList[_eKey].zKey, _s32ListIndex);
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Clears a template's snapshot
+ * @param[in]   _pstTemplate    Concerned template
+ */
+static void orxFASTCALL orxObject_ClearTemplate(orxOBJECT_TEMPLATE *_pstTemplate)
+{
+  /* Has list buffer? */
+  if(_pstTemplate->azListBuffer != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free((void *)_pstTemplate->azListBuffer);
+    _pstTemplate->azListBuffer = orxNULL;
+  }
+
+  /* Clears values */
+  orxMemory_Zero(_pstTemplate->astValueList, sizeof(_pstTemplate->astValueList));
+
+  /* Updates status */
+  orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_KU32_TEMPLATE_FLAG_NONE, orxOBJECT_KU32_TEMPLATE_FLAG_READY);
+
+  /* Done! */
+  return;
+}
+
+/** Snapshots a template's values from the current config section: random, command and (for single values) list values
+ * aren't cached and will still be read from config for each instance
+ * @param[in]   _pstTemplate    Concerned template
+ */
+static void orxFASTCALL orxObject_BuildTemplate(orxOBJECT_TEMPLATE *_pstTemplate)
+{
+  orxU32 i, u32ListSize;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_BuildTemplate");
+
+  /* Clears previous snapshot */
+  orxObject_ClearTemplate(_pstTemplate);
+
+  /* For all keys */
+  for(i = 0, u32ListSize = 0; i < orxOBJECT_TEMPLATE_KEY_NUMBER; i++)
+  {
+    orxOBJECT_TEMPLATE_VALUE *pstValue;
+    const orxSTRING           zKey;
+
+    /* Gets value & key */
+    pstValue  = &(_pstTemplate->astValueList[i]);
+    zKey      = sastObjectTemplateKeyList[i].zKey;
+
+    /* Has value? */
+    if(orxConfig_HasValue(zKey) != orxFALSE)
+    {
+      /* Updates status */
+      orxFLAG_SET(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_HAS, orxOBJECT_KU32_VALUE_FLAG_NONE);
+    }
+
+    /* List? */
+    if(sastObjectTemplateKeyList[i].eType == orxOBJECT_TEMPLATE_TYPE_LIST)
+    {
+      /* Not re-evaluated on access? */
+      if((orxConfig_IsRandomValue(zKey) == orxFALSE)
+      && (orxConfig_IsCommandValue(zKey) == orxFALSE))
+      {
+        /* Stores its count */
+        pstValue->s32ListCount = orxConfig_GetListCount(zKey);
+        u32ListSize += (orxU32)pstValue->s32ListCount;
+
+        /* Updates status */
+        orxFLAG_SET(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_CACHED, orxOBJECT_KU32_VALUE_FLAG_NONE);
+      }
+    }
+    /* Not re-evaluated on access? */
+    else if(orxConfig_IsDynamicValue(zKey) == orxFALSE)
+    {
+      /* Stores its literal value */
+      pstValue->zValue = orxConfig_GetString(zKey);
+
+      /* Depending on type */
+      switch(sastObjectTemplateKeyList[i].eType)
+      {
+        case orxOBJECT_TEMPLATE_TYPE_FLOAT:
+        {
+          /* Stores it */
+          pstValue->fValue = orxConfig_GetFloat(zKey);
+          break;
+        }
+
+        case orxOBJECT_TEMPLATE_TYPE_BOOL:
+        {
+          /* Stores it */
+          pstValue->bValue = orxConfig_GetBool(zKey);
+          break;
+        }
+
+        case orxOBJECT_TEMPLATE_TYPE_VECTOR:
+        {
+          /* Stores it */
+          if(orxConfig_GetVector(zKey, &(pstValue->vValue)) != orxNULL)
+          {
+            /* Updates status */
+            orxFLAG_SET(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_VECTOR, orxOBJECT_KU32_VALUE_FLAG_NONE);
+          }
+
+          /* Stores its uniform version */
+          pstValue->fValue = orxConfig_GetFloat(zKey);
+          break;
+        }
+
+        case orxOBJECT_TEMPLATE_TYPE_COLOR:
+        {
+          /* Stores it */
+          if(orxConfig_GetColorVector(zKey, sastObjectTemplateKeyList[i].eColorSpace, &(pstValue->vValue)) != orxNULL)
+          {
+            /* Updates status */
+            orxFLAG_SET(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_VECTOR, orxOBJECT_KU32_VALUE_FLAG_NONE);
+          }
+          break;
+        }
+
+        default:
+        {
+          break;
+        }
+      }
+
+      /* Updates status */
+      orxFLAG_SET(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_CACHED, orxOBJECT_KU32_VALUE_FLAG_NONE);
+    }
+  }
 
-  /* Gets first object */
-  pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+  /* Has list values? */
+  if(u32ListSize != 0)
+  {
+    /* Allocates list buffer */
+    _pstTemplate->azListBuffer = (const orxSTRING *)orxMemory_Allocate(u32ListSize * sizeof(orxSTRING), orxMEMORY_TYPE_MAIN);
+  }
 
-  /* Non empty? */
-  while(pstObject != orxNULL)
+  /* For all keys */
+  for(i = 0, u32ListSize = 0; i < orxOBJECT_TEMPLATE_KEY_NUMBER; i++)
   {
-    /* Deletes object */
-    orxObject_DeleteInternal(pstObject, orxTRUE, orxNULL);
+    orxOBJECT_TEMPLATE_VALUE *pstValue;
 
-    /* Gets first object */
-    pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+    /* Gets value */
+    pstValue = &(_pstTemplate->astValueList[i]);
+
+    /* Is a non-empty cached list? */
+    if((sastObjectTemplateKeyList[i].eType == orxOBJECT_TEMPLATE_TYPE_LIST)
+    && (orxFLAG_TEST(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_CACHED))
+    && (pstValue->s32ListCount > 0))
+    {
+      /* Has buffer? */
+      if(_pstTemplate->azListBuffer != orxNULL)
+      {
+        orxS32 j;
+
+        /* Stores its values */
+        pstValue->azListValue = _pstTemplate->azListBuffer + u32ListSize;
+        for(j = 0; j < pstValue->s32ListCount; j++)
+        {
+          pstValue->azListValue[j] = orxConfig_GetListString(sastObjectTemplateKeyList[i].zKey, j);
+        }
+        u32ListSize += (orxU32)pstValue->s32ListCount;
+      }
+      else
+      {
+        /* Reads it from config */
+        orxFLAG_SET(pstValue->u32Flags, orxOBJECT_KU32_VALUE_FLAG_NONE, orxOBJECT_KU32_VALUE_FLAG_CACHED);
+      }
+    }
   }
 
+  /* Stores revision */
+  _pstTemplate->u32Revision = orxConfig_GetRevision();
+
+  /* Updates status */
+  orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_KU32_TEMPLATE_FLAG_READY, orxOBJECT_KU32_TEMPLATE_FLAG_NONE);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
   /* Done! */
   return;
 }
 
-/** Updates an object
- * @param[int] _pstObject         Concerned object
- * @param[in] _pstClockInfo       Clock information where this callback has been registered
- * @return Next object/orxNULL
+/** Gets the template of the current config section. Templates are only snapshot once config has stayed unchanged between two
+ * instantiations of their section, so that sections modified for each instance don't pay for a snapshot they'd never use.
+ * @param[in]   _zSection       Current config section
+ * @return      orxOBJECT_TEMPLATE / orxNULL
  */
-static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, const orxCLOCK_INFO *_pstClockInfo)
+static orxOBJECT_TEMPLATE *orxFASTCALL orxObject_GetTemplate(const orxSTRING _zSection)
 {
-  orxU32        u32UpdateFlags;
-  orxSTRUCTURE *pstStructure;
-  orxBOOL       bDeleted = orxFALSE;
-  orxOBJECT    *pstResult = orxNULL;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxObject_Update");
+  orxOBJECT_TEMPLATE *pstResult = orxNULL;
 
-  /* Gets object's structure */
-  pstStructure = (orxSTRUCTURE *)_pstObject;
+  /* No template storage yet? */
+  if(sstObject.pstTemplateTable == orxNULL)
+  {
+    /* Creates it */
+    sstObject.pstTemplateBank   = orxBank_Create(orxOBJECT_KU32_TEMPLATE_BANK_SIZE, sizeof(orxOBJECT_TEMPLATE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstObject.pstTemplateTable  = (sstObject.pstTemplateBank != orxNULL) ? orxHashTable_Create(orxOBJECT_KU32_TEMPLATE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN) : orxNULL;
 
-  /* Gets object's enabled, paused and death row flags */
-  u32UpdateFlags = orxFLAG_GET(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_ENABLED | orxOBJECT_KU32_FLAG_PAUSED | orxOBJECT_KU32_FLAG_DEATH_ROW);
+    /* Failure? */
+    if((sstObject.pstTemplateTable == orxNULL) && (sstObject.pstTemplateBank != orxNULL))
+    {
+      /* Deletes bank */
+      orxBank_Delete(sstObject.pstTemplateBank);
+      sstObject.pstTemplateBank = orxNULL;
+    }
+  }
 
-  /* Is object enabled and not paused or in death row? */
-  if((u32UpdateFlags == orxOBJECT_KU32_FLAG_ENABLED)
-  || (u32UpdateFlags & orxOBJECT_KU32_FLAG_DEATH_ROW))
+  /* Valid? */
+  if(sstObject.pstTemplateTable != orxNULL)
   {
-    orxCLOCK_INFO stClockInfo;
+    orxOBJECT_TEMPLATE *pstFirstTemplate;
+    orxU64              u64Key;
 
-    /* Has clock? */
-    if(_pstObject->apstStructureList[orxSTRUCTURE_ID_CLOCK] != orxNULL)
-    {
-      orxCLOCK *pstClock;
+    /* Gets key */
+    u64Key = (orxU64)orxString_Hash(_zSection);
 
-      /* Uses it */
-      pstClock = (orxCLOCK *)_pstObject->apstStructureList[orxSTRUCTURE_ID_CLOCK];
+    /* Gets first template with this key */
+    pstFirstTemplate = (orxOBJECT_TEMPLATE *)orxHashTable_Get(sstObject.pstTemplateTable, u64Key);
 
-      /* Copies its info */
-      orxMemory_Copy(&stClockInfo, orxClock_GetInfo(pstClock), sizeof(orxCLOCK_INFO));
+    /* Finds section's template (sections with colliding keys are chained) */
+    for(pstResult = pstFirstTemplate; (pstResult != orxNULL) && (pstResult->zSection != _zSection); pstResult = pstResult->pstNext);
 
-      /* Computes its DT */
-      stClockInfo.fDT = orxClock_ComputeDT(_pstClockInfo->fDT, pstClock);
+    /* Found? */
+    if(pstResult != orxNULL)
+    {
+      /* Config unchanged since its last instantiation? */
+      if(pstResult->u32Revision == orxConfig_GetRevision())
+      {
+        /* Not snapshot yet? */
+        if(!orxFLAG_TEST(pstResult->u32Flags, orxOBJECT_KU32_TEMPLATE_FLAG_READY))
+        {
+          /* Builds it */
+          orxObject_BuildTemplate(pstResult);
+        }
+      }
+      else
+      {
+        /* Clears it */
+        orxObject_ClearTemplate(pstResult);
+
+        /* Stores revision */
+        pstResult->u32Revision = orxConfig_GetRevision();
+      }
     }
     else
     {
-      /* Copies its info */
-      orxMemory_Copy(&stClockInfo, _pstClockInfo, sizeof(orxCLOCK_INFO));
+      /* Allocates it */
+      pstResult = (orxOBJECT_TEMPLATE *)orxBank_Allocate(sstObject.pstTemplateBank);
+
+      /* Success? */
+      if(pstResult != orxNULL)
+      {
+        /* Inits it */
+        orxMemory_Zero(pstResult, sizeof(orxOBJECT_TEMPLATE));
+        pstResult->zSection     = _zSection;
+        pstResult->pstNext      = pstFirstTemplate;
+        pstResult->u64Key       = u64Key;
+        pstResult->u32Revision  = orxConfig_GetRevision();
+
+        /* Adds it to table, first in its chain */
+        if(orxHashTable_Set(sstObject.pstTemplateTable, u64Key, pstResult) == orxSTATUS_FAILURE)
+        {
+          /* Frees it */
+          orxBank_Free(sstObject.pstTemplateBank, pstResult);
+          pstResult = orxNULL;
+        }
+      }
     }
+  }
 
-    /* Updates its active time */
-    _pstObject->fActiveTime += stClockInfo.fDT;
+  /* Done! */
+  return pstResult;
+}
 
-    /* Has life time? */
-    if(orxFLAG_TEST(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_HAS_LIFETIME))
-    {
-      /* Updates its life time */
-      _pstObject->fLifeTime -= stClockInfo.fDT;
+/** Drops all the templates that haven't been instantiated since config was last modified, including the ones of removed
+ * sections (removing a section modifies config), so that only the templates of sections in use are kept
+ */
+static void orxFASTCALL orxObject_SweepTemplates()
+{
+  orxU32 u32Revision;
 
-      /* Should die? */
-      if(_pstObject->fLifeTime <= orxFLOAT_0)
-      {
-        /* Deletes it */
-        orxObject_DeleteInternal(_pstObject, orxFALSE, &pstResult);
+  /* Gets config revision */
+  u32Revision = orxConfig_GetRevision();
 
-        /* Marks as deleted */
-        bDeleted = orxTRUE;
-      }
-    }
+  /* Has templates and config was modified since last sweep? */
+  if((sstObject.pstTemplateTable != orxNULL) && (u32Revision != sstObject.u32TemplateRevision))
+  {
+    orxOBJECT_TEMPLATE *pstTemplate, *pstNextTemplate;
 
-    /* !!! TODO !!! */
-    /* Updates culling info before calling update sub-functions */
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxObject_SweepTemplates");
 
-    /* Wasn't object deleted? */
-    if(bDeleted == orxFALSE)
+    /* For all templates */
+    for(pstTemplate = (orxOBJECT_TEMPLATE *)orxBank_GetNext(sstObject.pstTemplateBank, orxNULL);
+        pstTemplate != orxNULL;
+        pstTemplate = pstNextTemplate)
     {
-      /* Has DT? */
-      if(stClockInfo.fDT > orxFLOAT_0)
+      /* Gets next template */
+      pstNextTemplate = (orxOBJECT_TEMPLATE *)orxBank_GetNext(sstObject.pstTemplateBank, pstTemplate);
+
+      /* Outdated? */
+      if(pstTemplate->u32Revision != u32Revision)
       {
-        orxU32 u32LifeTimeFlags, i;
+        orxOBJECT_TEMPLATE *pstPreviousTemplate;
 
-        /* For all linked structures */
-        for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
-        {
-          /* Is structure linked? */
-          if(_pstObject->apstStructureList[i] != orxNULL)
-          {
-            /* Updates it */
-            if(orxStructure_Update(_pstObject->apstStructureList[i], _pstObject, &stClockInfo) == orxSTATUS_FAILURE)
-            {
-              /* Logs message */
-              orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to update structure [%s] for object <%s>.", orxStructure_GetIDString((orxSTRUCTURE_ID)i), orxObject_GetName(_pstObject));
-            }
-          }
-        }
+        /* Gets first template with its key (its section might not exist anymore, hence the stored key) */
+        pstPreviousTemplate = (orxOBJECT_TEMPLATE *)orxHashTable_Get(sstObject.pstTemplateTable, pstTemplate->u64Key);
 
-        /* Has no body or local update? */
-        if((_pstObject->apstStructureList[orxSTRUCTURE_ID_BODY] == orxNULL)
-        || orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_LOCAL_UPDATE))
+        /* First in its chain? */
+        if(pstPreviousTemplate == pstTemplate)
         {
-          /* Has speed? */
-          if(orxVector_IsNull(&(_pstObject->vSpeed)) == orxFALSE)
+          /* Has next? */
+          if(pstTemplate->pstNext != orxNULL)
           {
-            orxVECTOR vPosition, vMove;
-
-            /* Gets its position */
-            orxObject_GetPosition(_pstObject, &vPosition);
-
-            /* Computes its move */
-            orxVector_Mulf(&vMove, &(_pstObject->vSpeed), stClockInfo.fDT);
-
-            /* Gets its new position */
-            orxVector_Add(&vPosition, &vPosition, &vMove);
-
-            /* Stores it */
-            orxObject_SetPosition(_pstObject, &vPosition);
+            /* Makes it first */
+            orxHashTable_Set(sstObject.pstTemplateTable, pstTemplate->u64Key, pstTemplate->pstNext);
           }
-
-          /* Has angular velocity? */
-          if(_pstObject->fAngularVelocity != orxFLOAT_0)
+          else
           {
-            /* Updates its rotation */
-            orxObject_SetRotation(_pstObject, orxObject_GetRotation(_pstObject) + (_pstObject->fAngularVelocity * stClockInfo.fDT));
+            /* Removes it from table */
+            orxHashTable_Remove(sstObject.pstTemplateTable, pstTemplate->u64Key);
           }
         }
         else
         {
-          /* Should detach? */
-          if(orxFLAG_TEST(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD))
-          {
-            /* Detaches it */
-            orxObject_Detach(_pstObject);
+          /* Finds previous template in chain */
+          for(; pstPreviousTemplate->pstNext != pstTemplate; pstPreviousTemplate = pstPreviousTemplate->pstNext);
 
-            /* Updates status */
-            orxFLAG_SET(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD);
-          }
+          /* Unlinks it */
+          pstPreviousTemplate->pstNext = pstTemplate->pstNext;
         }
 
-        /* Has structure-bound lifetime? */
-        if((u32LifeTimeFlags = orxStructure_GetFlags(_pstObject, orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME)) != 0)
-        {
-          /* Not checking FX or no FX left? */
-          if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_FX_LIFETIME))
-          || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_FXPOINTER] != orxNULL)
-           && (orxFXPointer_GetCount(orxFXPOINTER(_pstObject->apstStructureList[orxSTRUCTURE_ID_FXPOINTER])) == 0)))
-          {
-            /* Not checking sound or no sound left? */
-            if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_SOUND_LIFETIME))
-            || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_SOUNDPOINTER] != orxNULL)
-             && (orxSoundPointer_GetCount(orxSOUNDPOINTER(_pstObject->apstStructureList[orxSTRUCTURE_ID_SOUNDPOINTER])) == 0)))
-            {
-              orxSPAWNER *pstSpawner;
-
-              /* Not checking spawner or no object left to spawn? */
-              if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_SPAWNER_LIFETIME))
-              || (((pstSpawner = orxSPAWNER(_pstObject->apstStructureList[orxSTRUCTURE_ID_SPAWNER])) != orxNULL)
-               && (orxSpawner_GetTotalObjectCount(pstSpawner) == orxSpawner_GetTotalObjectLimit(pstSpawner))))
-              {
-                /* Not checking timeline or no track left? */
-                if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_TIMELINE_LIFETIME))
-                || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_TIMELINE] != orxNULL)
-                 && (orxTimeLine_GetCount(orxTIMELINE(_pstObject->apstStructureList[orxSTRUCTURE_ID_TIMELINE])) == 0)))
-                {
-                  /* Not checking children or no child left? */
-                  if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_CHILDREN_LIFETIME))
-                  || (!orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN)))
-                  {
-                    /* Not checking anim or no current anim? */
-                    if((!orxFLAG_TEST(u32LifeTimeFlags, orxOBJECT_KU32_FLAG_ANIM_LIFETIME))
-                    || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_ANIMPOINTER] != orxNULL)
-                     && (orxAnimPointer_GetCurrentAnim(orxANIMPOINTER(_pstObject->apstStructureList[orxSTRUCTURE_ID_ANIMPOINTER])) == orxU32_UNDEFINED)))
-                    {
-                      /* Schedules object's deletion */
-                      orxObject_SetLifeTime(_pstObject, orxFLOAT_0);
+        /* Clears it */
+        orxObject_ClearTemplate(pstTemplate);
 
-                      /* Disables it */
-                      orxObject_Enable(_pstObject, orxFALSE);
-                    }
-                  }
-                }
-              }
-            }
-          }
-        }
+        /* Frees it */
+        orxBank_Free(sstObject.pstTemplateBank, pstTemplate);
       }
     }
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
   }
 
-  /* Wasn't object deleted? */
-  if(bDeleted == orxFALSE)
-  {
-    orxLINKLIST_NODE *pstNode;
+  /* Stores revision */
+  sstObject.u32TemplateRevision = u32Revision;
 
-    /* Gets next enabled object */
-    pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+  /* Done! */
+  return;
+}
 
-    /* Valid? */
-    if(pstNode != orxNULL)
+/** Deletes all templates
+ */
+static void orxFASTCALL orxObject_DeleteTemplates()
+{
+  /* Has templates? */
+  if(sstObject.pstTemplateTable != orxNULL)
+  {
+    orxOBJECT_TEMPLATE *pstTemplate;
+
+    /* For all templates */
+    for(pstTemplate = (orxOBJECT_TEMPLATE *)orxBank_GetNext(sstObject.pstTemplateBank, orxNULL);
+        pstTemplate != orxNULL;
+        pstTemplate = (orxOBJECT_TEMPLATE *)orxBank_GetNext(sstObject.pstTemplateBank, pstTemplate))
     {
-      /* Updates result */
-      pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode);
+      /* Clears it */
+      orxObject_ClearTemplate(pstTemplate);
     }
-  }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
+    /* Deletes table & bank */
+    orxHashTable_Delete(sstObject.pstTemplateTable);
+    orxBank_Delete(sstObject.pstTemplateBank);
+    sstObject.pstTemplateTable  = orxNULL;
+    sstObject.pstTemplateBank   = orxNULL;
+  }
 
   /* Done! */
-  return pstResult;
+  return;
 }
 
 /** Updates all the objects
@@ -4733,6 +6532,9 @@ static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo,
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxObject_UpdateAll");
 
+  /* Drops outdated templates */
+  orxObject_SweepTemplates();
+
   /* Gets first enabled object */
   pstNode   = orxLinkList_GetFirst(&(sstObject.stEnableList));
   pstObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
@@ -4744,6 +6546,9 @@ static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo,
     pstObject = orxObject_UpdateInternal(pstObject, _pstClockInfo);
   }
 
+  /* Updates all dirty frames (lazy update), before physics & render */
+  orxFrame_UpdateAll();
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -4969,6 +6774,10 @@ void orxFASTCALL orxObject_Exit()
   /* Initialized? */
   if(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY)
   {
+    orxOBJECT_LISTS  *pstGroupLists;
+    orxHANDLE         hIterator;
+    orxU64            u64GroupID;
+
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxObject_EventHandler);
 
@@ -4994,6 +6803,30 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
+    /* For all groups */
+    for(hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, orxHANDLE_UNDEFINED, &u64GroupID, (void **)&pstGroupLists);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, hIterator, &u64GroupID, (void **)&pstGroupLists))
+    {
+      /* Has grid? */
+      if(pstGroupLists->pstGrid != orxNULL)
+      {
+        /* Deletes it */
+        orxObject_DeleteGrid(pstGroupLists, orxFALSE);
+      }
+    }
+
+    /* Has grid query result list? */
+    if(sstObject.stQueryResult.apstObjectList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstObject.stQueryResult.apstObjectList);
+      orxMemory_Zero(&(sstObject.stQueryResult), sizeof(orxOBJECT_GRID_RESULT));
+    }
+
+    /* Deletes templates */
+    orxObject_DeleteTemplates();
+
     /* Deletes group table */
     orxHashTable_Delete(sstObject.pstGroupTable);
 
@@ -5182,6 +7015,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxFRAME       *pstFrame;
         orxBODY        *pstBody;
         orxOBJECT      *pstPreviousObject;
+        orxOBJECT_TEMPLATE *pstTemplate;
         orxFLOAT        fAge, fRotation;
         orxU32          u32FrameFlags, u32Flags = orxOBJECT_KU32_FLAG_NONE;
         orxS32          s32Count;
@@ -5189,6 +7023,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxBOOL         bUseParentScale = orxFALSE, bUseParentPosition = orxFALSE, bHasColor = orxFALSE, bUseParentSpace = orxFALSE, bHasPosition = orxFALSE;
         orxCHAR         acPositionBuffer[128];
 
+        /* Gets template */
+        pstTemplate = orxObject_GetTemplate(pstResult->zReference);
+
         /* Backups current parent */
         pstPreviousObject = sstObject.pstCurrentParent;
 
@@ -5196,7 +7033,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         sstObject.pstCurrentParent = orxNULL;
 
         /* Gets age */
-        fAge = orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_AGE);
+        fAge = orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_AGE);
 
         /* Valid? */
         if(fAge > orxFLOAT_0)
@@ -5218,10 +7055,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Has group? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_GROUP) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_GROUP) != orxFALSE)
         {
           /* Sets it */
-          orxObject_SetGroupID(pstResult, orxString_GetID(orxConfig_GetString(orxOBJECT_KZ_CONFIG_GROUP)));
+          orxObject_SetGroupID(pstResult, orxString_GetID(orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_GROUP)));
         }
         /* Has current group ID? */
         else if(sstObject.stCurrentGroupID != sstObject.stDefaultGroupID)
@@ -5231,7 +7068,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Gets position literals */
-        orxString_NPrint(acPositionBuffer, sizeof(acPositionBuffer), "%s", orxConfig_GetString(orxOBJECT_KZ_CONFIG_POSITION));
+        orxString_NPrint(acPositionBuffer, sizeof(acPositionBuffer), "%s", orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_POSITION));
         zPosition = acPositionBuffer;
 
         /* Has pivot override? */
@@ -5258,7 +7095,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Frame *** */
 
         /* Gets auto scrolling value */
-        zAutoScrolling = orxConfig_GetString(orxOBJECT_KZ_CONFIG_AUTO_SCROLL);
+        zAutoScrolling = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_AUTO_SCROLL);
 
         /* X auto scrolling? */
         if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_X) == 0)
@@ -5285,7 +7122,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Gets flipping value */
-        zFlipping = orxConfig_GetString(orxOBJECT_KZ_CONFIG_FLIP);
+        zFlipping = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_FLIP);
 
         /* X flipping? */
         if(orxString_ICompare(zFlipping, orxOBJECT_KZ_X) == 0)
@@ -5307,14 +7144,14 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Depth scaling active? */
-        if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_DEPTH_SCALE) != orxFALSE)
+        if(orxObject_GetTemplateBool(pstTemplate, orxOBJECT_TEMPLATE_KEY_DEPTH_SCALE) != orxFALSE)
         {
           /* Updates frame flags */
           u32FrameFlags  |= orxFRAME_KU32_FLAG_DEPTH_SCALE;
         }
 
         /* Ignore from parent? */
-        zIgnoreFromParent = orxConfig_GetString(orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT);
+        zIgnoreFromParent = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_IGNORE_FROM_PARENT);
         if(*zIgnoreFromParent != orxCHAR_NULL)
         {
           /* Updates flags */
@@ -5335,6 +7172,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
             /* Updates its owner */
             orxStructure_SetOwner(pstFrame, pstResult);
+
+            /* Refreshes its grid cell now that its frame can be tracked */
+            orxObject_RefreshGridCell(pstResult);
           }
           else
           {
@@ -5350,7 +7190,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxMemory_Zero(&stParentBox, sizeof(orxAABOX));
 
         /* Gets camera file name */
-        zParentName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_PARENT_CAMERA);
+        zParentName = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_PARENT_CAMERA);
 
         /* Valid? */
         if((zParentName != orxNULL) && (*zParentName != orxCHAR_NULL))
@@ -5392,7 +7232,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           if(pstParent != orxNULL)
           {
             /* Updates parent space status */
-            bUseParentSpace = orxConfig_HasValue(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE);
+            bUseParentSpace = orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_USE_PARENT_SPACE);
 
             /* Is parent an object? */
             if(orxStructure_GetID(pstParent) == orxSTRUCTURE_ID_OBJECT)
@@ -5465,7 +7305,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           const orxSTRING zUseParentSpace;
 
           /* Gets its literal version */
-          zUseParentSpace = orxConfig_GetString(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE);
+          zUseParentSpace = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_USE_PARENT_SPACE);
 
           /* Defined? */
           if((zUseParentSpace != orxNULL) && (*zUseParentSpace != orxCHAR_NULL))
@@ -5513,7 +7353,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Graphic *** */
 
         /* Gets graphic file name */
-        zGraphicName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_GRAPHIC_NAME);
+        zGraphicName = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_GRAPHIC_NAME);
 
         /* Valid? */
         if((zGraphicName != orxNULL) && (*zGraphicName != orxCHAR_NULL))
@@ -5547,7 +7387,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Animation *** */
 
         /* Gets animation set name */
-        zAnimPointerName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME);
+        zAnimPointerName = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_ANIMPOINTER_NAME);
 
         /* Valid? */
         if((zAnimPointerName != orxNULL) && (*zAnimPointerName != orxCHAR_NULL))
@@ -5570,10 +7410,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
               orxStructure_SetOwner(pstAnimPointer, pstResult);
 
               /* Has frequency? */
-              if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ANIM_FREQUENCY) != orxFALSE)
+              if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_ANIM_FREQUENCY) != orxFALSE)
               {
                 /* Updates animation pointer frequency */
-                orxObject_SetAnimFrequency(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANIM_FREQUENCY));
+                orxObject_SetAnimFrequency(pstResult, orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_ANIM_FREQUENCY));
               }
 
               /* Doesn't have a graphic? */
@@ -5623,14 +7463,14 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Size/Pivot *** */
 
         /* Has size? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SIZE, &vValue) != orxNULL)
+        if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_SIZE, &vValue) != orxNULL)
         {
           /* Updates object size */
           orxObject_SetSize(pstResult, &vValue);
         }
 
         /* Gets pivot */
-        zPivot = orxString_SkipWhiteSpaces(orxConfig_GetString(orxOBJECT_KZ_CONFIG_PIVOT));
+        zPivot = orxString_SkipWhiteSpaces(orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_PIVOT));
 
         /* Valid? */
         if(*zPivot != orxCHAR_NULL)
@@ -5651,15 +7491,15 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Scale *** */
 
         /* Has scale? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SCALE) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_SCALE) != orxFALSE)
         {
           /* Is config scale not a vector? */
-          if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SCALE, &vScale) == orxNULL)
+          if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_SCALE, &vScale) == orxNULL)
           {
             orxFLOAT fScale;
 
             /* Gets config uniformed scale */
-            fScale = orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_SCALE);
+            fScale = orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_SCALE);
 
             /* Updates vector */
             orxVector_SetAll(&vScale, fScale);
@@ -5707,10 +7547,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxColor_Set(&stColor, &orxVECTOR_WHITE, orxFLOAT_1);
 
         /* Has color? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_COLOR) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_COLOR) != orxFALSE)
         {
           /* Gets its value? */
-          if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_COLOR, orxCOLORSPACE_COMPONENT, &(stColor.vRGB)) != orxNULL)
+          if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_COLOR, &(stColor.vRGB)) != orxNULL)
           {
             /* Normalizes it */
             orxVector_Mulf(&(stColor.vRGB), &(stColor.vRGB), orxCOLOR_NORMALIZER);
@@ -5720,20 +7560,20 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           }
         }
         /* Has RGB values? */
-        else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_RGB) != orxFALSE)
+        else if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_RGB) != orxFALSE)
         {
           /* Gets its value? */
-          if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_RGB, orxCOLORSPACE_RGB, &(stColor.vRGB)) != orxNULL)
+          if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_RGB, &(stColor.vRGB)) != orxNULL)
           {
             /* Updates status */
             bHasColor = orxTRUE;
           }
         }
         /* Has HSL values? */
-        else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_HSL) != orxFALSE)
+        else if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_HSL) != orxFALSE)
         {
           /* Gets its value? */
-          if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSL, orxCOLORSPACE_HSL, &(stColor.vHSL)) != orxNULL)
+          if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_HSL, &(stColor.vHSL)) != orxNULL)
           {
             /* Stores its RGB equivalent */
             orxColor_FromHSLToRGB(&stColor, &stColor);
@@ -5743,10 +7583,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           }
         }
         /* Has HSV values? */
-        else if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_HSV) != orxFALSE)
+        else if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_HSV) != orxFALSE)
         {
           /* Gets its value? */
-          if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSV, orxCOLORSPACE_HSV, &(stColor.vHSV)) != orxNULL)
+          if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_HSV, &(stColor.vHSV)) != orxNULL)
           {
             /* Stores its RGB equivalent */
             orxColor_FromHSVToRGB(&stColor, &stColor);
@@ -5757,7 +7597,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Has alpha? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ALPHA) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_ALPHA) != orxFALSE)
         {
           /* Doesn't have any color? */
           if(bHasColor == orxFALSE)
@@ -5780,7 +7620,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           }
 
           /* Applies it */
-          orxColor_SetAlpha(&stColor, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ALPHA));
+          orxColor_SetAlpha(&stColor, orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_ALPHA));
 
           /* Updates color */
           orxObject_SetColor(pstResult, &stColor);
@@ -5795,7 +7635,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Body *** */
 
         /* Gets body name */
-        zBodyName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_BODY);
+        zBodyName = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_BODY);
 
         /* Valid? */
         if((zBodyName != orxNULL) && (*zBodyName != orxCHAR_NULL))
@@ -5840,7 +7680,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Clock *** */
 
         /* Gets clock name */
-        zClockName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_CLOCK);
+        zClockName = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_CLOCK);
 
         /* Valid? */
         if((zClockName != orxNULL) && (*zClockName != orxCHAR_NULL))
@@ -5874,7 +7714,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Rotation & position */
 
         /* Updates object rotation */
-        fRotation = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ROTATION);
+        fRotation = orxMATH_KF_DEG_TO_RAD * orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_ROTATION);
         orxObject_SetRotation(pstResult, fRotation);
 
         /* Clears pivot override */
@@ -6031,7 +7871,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             bHasPosition = orxTRUE;
           }
           /* Has spherical position? */
-          else if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION, &vPosition) != orxNULL)
+          else if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_SPHERICAL_POSITION, &vPosition) != orxNULL)
           {
             /* Transforms it */
             vPosition.fTheta *= orxMATH_KF_DEG_TO_RAD;
@@ -6063,7 +7903,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Children *** */
 
         /* Has child list? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_CHILD_LIST)) > 0)
         {
           orxS32      i, s32JointNumber;
           orxOBJECT  *pstLastChild;
@@ -6072,7 +7912,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           sstObject.pstCurrentParent = pstResult;
 
           /* Gets child joint list number */
-          s32JointNumber = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST);
+          s32JointNumber = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_CHILD_JOINT_LIST);
 
           /* For all defined objects */
           for(i = 0, pstLastChild = orxNULL; i < s32Count; i++)
@@ -6080,7 +7920,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zChild;
 
             /* Gets its name */
-            zChild = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_LIST, i);
+            zChild = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_KEY_CHILD_LIST, i);
 
             /* Valid? */
             if(*zChild != orxCHAR_NULL)
@@ -6132,7 +7972,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
                   /* Valid joint can be added? */
                   if((pstBody != orxNULL)
                   && (i < s32JointNumber)
-                  && (orxBody_AddJointFromConfig(pstBody, pstChildBody, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST, i)) != orxNULL))
+                  && (orxBody_AddJointFromConfig(pstBody, pstChildBody, orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_KEY_CHILD_JOINT_LIST, i)) != orxNULL))
                   {
                     /* Marks it as a joint child */
                     orxStructure_SetFlags(pstChild, orxOBJECT_KU32_FLAG_IS_JOINT_CHILD | orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD, orxOBJECT_KU32_FLAG_NONE);
@@ -6159,10 +7999,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Speed *** */
 
         /* Has speed? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPEED, &vValue) != orxNULL)
+        if(orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_SPEED, &vValue) != orxNULL)
         {
           /* Uses relative speed? */
-          if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED) != orxFALSE)
+          if(orxObject_GetTemplateBool(pstTemplate, orxOBJECT_TEMPLATE_KEY_USE_RELATIVE_SPEED) != orxFALSE)
           {
             /* Updates object relative speed */
             orxObject_SetRelativeSpeed(pstResult, &vValue);
@@ -6177,19 +8017,19 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Angular velocity *** */
 
         /* Sets angular velocity? */
-        orxObject_SetAngularVelocity(pstResult, orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY));
+        orxObject_SetAngularVelocity(pstResult, orxMATH_KF_DEG_TO_RAD * orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_ANGULAR_VELOCITY));
 
         /* *** FX *** */
 
         /* Has FX? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_FX_LIST)) > 0)
         {
           orxCLOCK_INFO stClockInfo;
           orxS32        i, s32RecursiveCount;
           orxBOOL       bRecursive = orxFALSE;
 
           /* Gets number of recursive FXs */
-          s32RecursiveCount = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_RECURSIVE_LIST);
+          s32RecursiveCount = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_FX_RECURSIVE_LIST);
 
           /* For all defined FXs */
           for(i = 0; i < s32Count; i++)
@@ -6197,13 +8037,13 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zFX;
 
             /* Gets its name */
-            zFX = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_FX_LIST, i);
+            zFX = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_KEY_FX_LIST, i);
 
             /* Valid? */
             if(*zFX != orxCHAR_NULL)
             {
               /* Is recursive? */
-              if((i < s32RecursiveCount) && (orxConfig_GetListBool(orxOBJECT_KZ_CONFIG_FX_RECURSIVE_LIST, i) != orxFALSE))
+              if((i < s32RecursiveCount) && (orxObject_GetTemplateListBool(pstTemplate, orxOBJECT_TEMPLATE_KEY_FX_RECURSIVE_LIST, i) != orxFALSE))
               {
                 /* Adds it */
                 orxObject_AddFXRecursive(pstResult, zFX, orxFLOAT_0);
@@ -6220,10 +8060,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           }
 
           /* Has frequency? */
-          if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_FX_FREQUENCY) != orxFALSE)
+          if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_FX_FREQUENCY) != orxFALSE)
           {
             /* Updates FX pointer frequency */
-            orxObject_SetFXFrequency(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_FX_FREQUENCY));
+            orxObject_SetFXFrequency(pstResult, orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_FX_FREQUENCY));
           }
 
           /* Inits clock info */
@@ -6250,7 +8090,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Spawner *** */
 
         /* Gets spawner name */
-        zSpawnerName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_SPAWNER);
+        zSpawnerName = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_SPAWNER);
 
         /* Valid? */
         if((zSpawnerName != orxNULL) && (*zSpawnerName != orxCHAR_NULL))
@@ -6287,7 +8127,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Sound *** */
 
         /* Has sound? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SOUND_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_SOUND_LIST)) > 0)
         {
           orxS32 i;
 
@@ -6297,7 +8137,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zSound;
 
             /* Gets its name */
-            zSound = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_SOUND_LIST, i);
+            zSound = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_KEY_SOUND_LIST, i);
 
             /* Valid? */
             if(*zSound != orxCHAR_NULL)
@@ -6311,7 +8151,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Shader *** */
 
         /* Has shader? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SHADER_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_SHADER_LIST)) > 0)
         {
           orxS32 i;
 
@@ -6321,7 +8161,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zShader;
 
             /* Gets its name */
-            zShader = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_SHADER_LIST, i);
+            zShader = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_KEY_SHADER_LIST, i);
 
             /* Valid? */
             if(*zShader != orxCHAR_NULL)
@@ -6335,7 +8175,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Timeline *** */
 
         /* Has TimeLine tracks? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRACK_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_KEY_TRACK_LIST)) > 0)
         {
           orxS32 i;
 
@@ -6345,7 +8185,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zTrack;
 
             /* Gets its name */
-            zTrack = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_TRACK_LIST, i);
+            zTrack = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_KEY_TRACK_LIST, i);
 
             /* Valid? */
             if(*zTrack != orxCHAR_NULL)
@@ -6359,44 +8199,44 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Misc *** */
 
         /* Has smoothing value? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_SMOOTHING) != orxFALSE)
         {
           /* Updates flags */
-          u32Flags |= (orxConfig_GetBool(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE) ? orxOBJECT_KU32_FLAG_SMOOTHING_ON : orxOBJECT_KU32_FLAG_SMOOTHING_OFF;
+          u32Flags |= (orxObject_GetTemplateBool(pstTemplate, orxOBJECT_TEMPLATE_KEY_SMOOTHING) != orxFALSE) ? orxOBJECT_KU32_FLAG_SMOOTHING_ON : orxOBJECT_KU32_FLAG_SMOOTHING_OFF;
         }
 
         /* Has blend mode? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BLEND_MODE) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_BLEND_MODE) != orxFALSE)
         {
           const orxSTRING zBlendMode;
 
           /* Gets blend mode value */
-          zBlendMode = orxConfig_GetString(orxOBJECT_KZ_CONFIG_BLEND_MODE);
+          zBlendMode = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_BLEND_MODE);
 
           /* Updates object's blend mode */
           orxObject_SetBlendMode(pstResult, orxDisplay_GetBlendModeFromString(zBlendMode));
         }
 
         /* Should repeat? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_REPEAT) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_REPEAT) != orxFALSE)
         {
           orxVECTOR vRepeat;
 
           /* Gets its value */
-          orxConfig_GetVector(orxOBJECT_KZ_CONFIG_REPEAT, &vRepeat);
+          orxObject_GetTemplateVector(pstTemplate, orxOBJECT_TEMPLATE_KEY_REPEAT, &vRepeat);
 
           /* Stores it */
           orxObject_SetRepeat(pstResult, vRepeat.fX, vRepeat.fY);
         }
 
         /* Has life time? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_LIFETIME) != orxFALSE)
+        if(orxObject_HasTemplateValue(pstTemplate, orxOBJECT_TEMPLATE_KEY_LIFETIME) != orxFALSE)
         {
           /* Sets literal lifetime? */
-          if(orxObject_SetLiteralLifeTime(pstResult, orxConfig_GetString(orxOBJECT_KZ_CONFIG_LIFETIME)) == orxSTATUS_FAILURE)
+          if(orxObject_SetLiteralLifeTime(pstResult, orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_LIFETIME)) == orxSTATUS_FAILURE)
           {
             /* Stores lifetime's numerical value */
-            orxObject_SetLifeTime(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_LIFETIME));
+            orxObject_SetLifeTime(pstResult, orxObject_GetTemplateFloat(pstTemplate, orxOBJECT_TEMPLATE_KEY_LIFETIME));
           }
         }
 
@@ -6404,7 +8244,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxStructure_SetFlags(pstResult, u32Flags, orxOBJECT_KU32_FLAG_NONE);
 
         /* Gets on-delete command? */
-        zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_DELETE);
+        zCommand = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_ON_DELETE);
 
         /* Valid? */
         if(zCommand != orxSTRING_EMPTY)
@@ -6414,7 +8254,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Gets on-create command */
-        zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_CREATE);
+        zCommand = orxObject_GetTemplateString(pstTemplate, orxOBJECT_TEMPLATE_KEY_ON_CREATE);
 
         /* Valid? */
         if(zCommand != orxSTRING_EMPTY)
@@ -6605,6 +8445,15 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
 
     /* Links new structure to object */
     _pstObject->apstStructureList[eStructureID] = _pstStructure;
+
+    /* Affects grid cell? */
+    if((eStructureID == orxSTRUCTURE_ID_FRAME)
+    || (eStructureID == orxSTRUCTURE_ID_GRAPHIC)
+    || (eStructureID == orxSTRUCTURE_ID_ANIMPOINTER))
+    {
+      /* Refreshes it */
+      orxObject_RefreshGridCell(_pstObject);
+    }
   }
   else
   {
@@ -6726,6 +8575,15 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
 
     /* Removes it */
     _pstObject->apstStructureList[_eStructureID] = orxNULL;
+
+    /* Affects grid cell? */
+    if((_eStructureID == orxSTRUCTURE_ID_FRAME)
+    || (_eStructureID == orxSTRUCTURE_ID_GRAPHIC)
+    || (_eStructureID == orxSTRUCTURE_ID_ANIMPOINTER))
+    {
+      /* Refreshes it */
+      orxObject_RefreshGridCell(_pstObject);
+    }
   }
 
   /* Done! */
@@ -6812,6 +8670,7 @@ void orxFASTCALL orxObject_Enable(orxOBJECT *_pstObject, orxBOOL _bEnable)
 
         /* Adds object to enable group list */
         orxLinkList_AddEnd(&(pstGroupLists->stEnableList), &(_pstObject->stEnableGroupNode));
+        _pstObject->u64EnableOrder = sstObject.u64EnableCount++;
       }
     }
   }
@@ -7307,12 +9166,18 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
   {
     /* Sets object pivot */
     orxGraphic_SetPivot(pstGraphic, _pvPivot);
+
+    /* Refreshes its grid cell */
+    orxObject_RefreshGridCell(_pstObject);
   }
   else
   {
     /* Stores it */
     orxVector_Copy(&(_pstObject->vPivot), _pvPivot);
 
+    /* Refreshes its grid cell */
+    orxObject_RefreshGridCell(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -7343,6 +9208,9 @@ orxSTATUS orxFASTCALL orxObject_SetRelativePivot(orxOBJECT *_pstObject, orxU32 _
   {
     /* Updates its relative pivot */
     eResult = orxGraphic_SetRelativePivot(pstGraphic, _u32AlignFlags);
+
+    /* Refreshes its grid cell */
+    orxObject_RefreshGridCell(_pstObject);
   }
   else
   {
@@ -7437,12 +9305,18 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
   {
     /* Sets object size */
     orxGraphic_SetSize(pstGraphic, _pvSize);
+
+    /* Refreshes its grid cell */
+    orxObject_RefreshGridCell(_pstObject);
   }
   else
   {
     /* Stores it */
     orxVector_Copy(&(_pstObject->vSize), _pvSize);
 
+    /* Refreshes its grid cell */
+    orxObject_RefreshGridCell(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -9858,6 +11732,9 @@ orxSTATUS orxFASTCALL orxObject_SetTextString(orxOBJECT *_pstObject, const orxST
       {
         /* Updates graphic */
         orxGraphic_UpdateSize(pstGraphic);
+
+        /* Refreshes its grid cell */
+        orxObject_RefreshGridCell(_pstObject);
       }
     }
   }
@@ -10982,9 +12859,10 @@ const orxSTRING orxFASTCALL orxObject_GetName(const orxOBJECT *_pstObject)
  */
 orxBANK *orxFASTCALL orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox, orxSTRINGID _stGroupID)
 {
-  orxOBOX    stObjectBox;
-  orxOBJECT  *pstObject;
-  orxBANK    *pstResult;
+  orxOBOX         stObjectBox;
+  orxOBJECT_GRID *pstGrid;
+  orxOBJECT      *pstObject;
+  orxBANK        *pstResult;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
@@ -10996,12 +12874,25 @@ orxBANK *orxFASTCALL orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox, o
   /* Valid? */
   if(pstResult != orxNULL)
   {
-    orxU32 u32Count;
+    orxU32 u32Count, u32Index = 0;
+
+    /* Gets group grid */
+    pstGrid = orxObject_GetRefreshedGrid(_stGroupID);
+
+    /* Has grid? */
+    if(pstGrid != orxNULL)
+    {
+      orxAABOX stBox;
+
+      /* Queries it */
+      orxObject_GetEnclosingBox(_pstCheckBox, &stBox);
+      orxObject_QueryGrid(pstGrid, &stBox, orxFALSE, &(sstObject.stQueryResult));
+    }
 
     /* For all objects */
-    for(u32Count = 0, pstObject = orxObject_GetNext(orxNULL, _stGroupID);
+    for(u32Count = 0, pstObject = orxObject_GetNextCandidate(orxNULL, _stGroupID, pstGrid, &u32Index);
         (u32Count < orxOBJECT_KU32_NEIGHBOR_LIST_SIZE) && (pstObject != orxNULL);
-        pstObject = orxObject_GetNext(pstObject, _stGroupID))
+        pstObject = orxObject_GetNextCandidate(pstObject, _stGroupID, pstGrid, &u32Index))
     {
       /* Gets its bounding box */
       if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
@@ -11821,6 +13712,7 @@ orxSTATUS orxFASTCALL orxObject_SetLifeTime(orxOBJECT *_pstObject, orxFLOAT _fLi
 
       /* Adds object to enable group list */
       orxLinkList_AddEnd(&(pstGroupLists->stEnableList), &(_pstObject->stEnableGroupNode));
+      _pstObject->u64EnableOrder = sstObject.u64EnableCount++;
     }
   }
   else
@@ -11930,6 +13822,11 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
   orxSTRUCTURE_ASSERT(_pstObject);
   orxASSERT((_stGroupID != 0) && (_stGroupID != orxSTRINGID_UNDEFINED));
 
+  /* Removes object from its current grid */
+  if(orxLinkList_GetList(&(_pstObject->stGridNode)) != orxNULL)
+  {
+    orxObject_RemoveFromGrid(_pstObject, orxObject_GetGroupLists(_pstObject->stGroupID)->pstGrid);
+  }
   /* Removes object from its current group */
   if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
   {
@@ -11976,11 +13873,19 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
   {
     /* Adds object to end of enable group list */
     orxLinkList_AddEnd(&(pstGroupLists->stEnableList), &(_pstObject->stEnableGroupNode));
+    _pstObject->u64EnableOrder = sstObject.u64EnableCount++;
   }
 
   /* Stores group ID */
   _pstObject->stGroupID = _stGroupID;
 
+  /* Has grid? */
+  if(pstGroupLists->pstGrid != orxNULL)
+  {
+    /* Adds object to it */
+    orxObject_UpdateGridCell(_pstObject, pstGroupLists->pstGrid);
+  }
+
   /* Done! */
   return eResult;
 }
@@ -11996,155 +13901,465 @@ orxOBJECT_MAKE_RECURSIVE(SetGroupID, orxSTRINGID);
  * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
  * @return      orxOBJECT / orxNULL
  */
-extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+{
+  orxOBJECT *pstResult;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT((_pstObject == orxNULL) || (orxStructure_GetID((orxSTRUCTURE *)_pstObject) < orxSTRUCTURE_ID_NUMBER));
+  orxASSERT((_pstObject == orxNULL) || (_stGroupID == orxSTRINGID_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stGroupNode)) == &(((orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID))->stList)));
+
+  /* Has group? */
+  if(_stGroupID != orxSTRINGID_UNDEFINED)
+  {
+    orxOBJECT_LISTS *pstGroupLists;
+
+    /* Is cached one? */
+    if(_stGroupID == sstObject.stCachedGroupID)
+    {
+      /* Gets group list */
+      pstGroupLists = sstObject.pstCachedGroupLists;
+    }
+    else
+    {
+      /* Gets group list */
+      pstGroupLists = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
+    }
+
+    /* Valid? */
+    if(pstGroupLists != orxNULL)
+    {
+      orxLINKLIST_NODE *pstNode;
+
+      /* Gets node */
+      pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(&(pstGroupLists->stList)) : orxLinkList_GetNext(&(_pstObject->stGroupNode));
+
+      /* Valid? */
+      if(pstNode != orxNULL)
+      {
+        /* Updates result */
+        pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGroupNode, pstNode);
+      }
+      else
+      {
+        /* Updates result */
+        pstResult = orxNULL;
+      }
+
+      /* Caches group list */
+      sstObject.pstCachedGroupLists = pstGroupLists;
+      sstObject.stCachedGroupID     = _stGroupID;
+    }
+    else
+    {
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+  else
+  {
+    /* Updates result */
+    pstResult = (_pstObject == orxNULL) ? orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT)) : orxOBJECT(orxStructure_GetNext(_pstObject));
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets next enabled object.
+ * @param[in]   _pstObject      Concerned object, orxNULL to get the first one
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @return      orxOBJECT / orxNULL
+ */
+orxOBJECT *orxFASTCALL orxObject_GetNextEnabled(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+{
+  orxOBJECT *pstResult;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT((_pstObject == orxNULL) || (orxStructure_GetID((orxSTRUCTURE *)_pstObject) < orxSTRUCTURE_ID_NUMBER));
+  orxASSERT((_pstObject == orxNULL) || (_stGroupID == orxSTRINGID_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) == &(((orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID))->stEnableList)));
+
+  /* Has group? */
+  if(_stGroupID != orxSTRINGID_UNDEFINED)
+  {
+    orxOBJECT_LISTS *pstGroupLists;
+
+    /* Is cached one? */
+    if(_stGroupID == sstObject.stCachedGroupID)
+    {
+      /* Gets group list */
+      pstGroupLists = sstObject.pstCachedGroupLists;
+    }
+    else
+    {
+      /* Gets group list */
+      pstGroupLists = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
+    }
+
+    /* Valid? */
+    if(pstGroupLists != orxNULL)
+    {
+      orxLINKLIST_NODE *pstNode;
+
+      /* Gets node */
+      pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(&(pstGroupLists->stEnableList)) : orxLinkList_GetNext(&(_pstObject->stEnableGroupNode));
+
+      /* Valid? */
+      if(pstNode != orxNULL)
+      {
+        /* Updates result */
+        pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableGroupNode, pstNode);
+      }
+      else
+      {
+        /* Updates result */
+        pstResult = orxNULL;
+      }
+
+      /* Caches group list */
+      sstObject.pstCachedGroupLists = pstGroupLists;
+      sstObject.stCachedGroupID     = _stGroupID;
+    }
+    else
+    {
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+  else
+  {
+    orxLINKLIST_NODE *pstNode;
+
+    /* Gets node */
+    pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(&(sstObject.stEnableList)) : orxLinkList_GetNext(&(_pstObject->stEnableNode));
+
+    /* Valid? */
+    if(pstNode != orxNULL)
+    {
+      /* Updates result */
+      pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode);
+    }
+    else
+    {
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Sets a group's spatial grid cell size.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[in]   _fCellSize      Cell size, orxFLOAT_0 to remove the grid
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxObject_SetGroupIDCellSize(orxSTRINGID _stGroupID, orxFLOAT _fCellSize)
+{
+  orxOBJECT_LISTS **ppstBucket;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT((_stGroupID != 0) && (_stGroupID != orxSTRINGID_UNDEFINED));
+  orxASSERT(_fCellSize >= orxFLOAT_0);
+
+  /* Gets group list bucket */
+  ppstBucket = (orxOBJECT_LISTS **)orxHashTable_Retrieve(sstObject.pstGroupTable, _stGroupID);
+
+  /* Valid? */
+  if(ppstBucket != orxNULL)
+  {
+    orxOBJECT_LISTS *pstGroupLists;
+
+    /* Not found? */
+    if(*ppstBucket == orxNULL)
+    {
+      /* Allocates it */
+      pstGroupLists = (orxOBJECT_LISTS *)orxBank_Allocate(sstObject.pstGroupBank);
+
+      /* Checks */
+      orxASSERT(pstGroupLists != orxNULL);
+
+      /* Clears it */
+      orxMemory_Zero(pstGroupLists, sizeof(orxOBJECT_LISTS));
+
+      /* Stores it */
+      *ppstBucket = pstGroupLists;
+    }
+    else
+    {
+      /* Gets it */
+      pstGroupLists = *ppstBucket;
+    }
+
+    /* Same size? */
+    if((pstGroupLists->pstGrid != orxNULL) ? (pstGroupLists->pstGrid->fCellSize == _fCellSize) : (_fCellSize == orxFLOAT_0))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Has grid? */
+      if(pstGroupLists->pstGrid != orxNULL)
+      {
+        /* Deletes it */
+        orxObject_DeleteGrid(pstGroupLists, (_fCellSize == orxFLOAT_0) ? orxTRUE : orxFALSE);
+      }
+
+      /* Has new size? */
+      if(_fCellSize > orxFLOAT_0)
+      {
+        orxOBJECT_GRID *pstGrid;
+
+        /* Allocates grid */
+        pstGrid = (orxOBJECT_GRID *)orxMemory_Allocate(sizeof(orxOBJECT_GRID), orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstGrid != orxNULL)
+        {
+          /* Inits it */
+          orxMemory_Zero(pstGrid, sizeof(orxOBJECT_GRID));
+          pstGrid->fCellSize    = _fCellSize;
+          pstGrid->fRecCellSize = orxFLOAT_1 / _fCellSize;
+          pstGrid->pstCellTable = orxHashTable_Create(orxOBJECT_KU32_GRID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+          pstGrid->pstCellBank  = orxBank_Create(orxOBJECT_KU32_GRID_CELL_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+          /* Valid? */
+          if((pstGrid->pstCellTable != orxNULL) && (pstGrid->pstCellBank != orxNULL))
+          {
+            orxLINKLIST_NODE *pstNode;
+
+            /* Stores it */
+            pstGroupLists->pstGrid = pstGrid;
+
+            /* For all objects in group */
+            for(pstNode = orxLinkList_GetFirst(&(pstGroupLists->stList));
+                pstNode != orxNULL;
+                pstNode = orxLinkList_GetNext(pstNode))
+            {
+              /* Adds it to grid */
+              orxObject_UpdateGridCell(orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGroupNode, pstNode), pstGrid);
+            }
+
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't create grid for group [%s].", orxString_GetFromID(_stGroupID));
+
+            /* Deletes table & bank */
+            if(pstGrid->pstCellTable != orxNULL)
+            {
+              orxHashTable_Delete(pstGrid->pstCellTable);
+            }
+            if(pstGrid->pstCellBank != orxNULL)
+            {
+              orxBank_Delete(pstGrid->pstCellBank);
+            }
+
+            /* Frees grid */
+            orxMemory_Free(pstGrid);
+          }
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't allocate grid for group [%s].", orxString_GetFromID(_stGroupID));
+        }
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets a group's spatial grid cell size.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @return      Cell size / orxFLOAT_0 if the group doesn't have a grid
+ */
+orxFLOAT orxFASTCALL orxObject_GetGroupIDCellSize(orxSTRINGID _stGroupID)
+{
+  orxOBJECT_LISTS  *pstGroupLists;
+  orxFLOAT          fResult = orxFLOAT_0;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+
+  /* Gets group lists */
+  pstGroupLists = (_stGroupID != orxSTRINGID_UNDEFINED) ? orxObject_GetGroupLists(_stGroupID) : orxNULL;
+
+  /* Has grid? */
+  if((pstGroupLists != orxNULL) && (pstGroupLists->pstGrid != orxNULL))
+  {
+    /* Updates result */
+    fResult = pstGroupLists->pstGrid->fCellSize;
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Gets a group's spatial grid stats.
+ * @param[in]   _stGroupID      Concerned group ID
+ * @param[out]  _pstStats       Grid stats
+ * @param[in]   _bReset         Resets move & query counts after retrieving them
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if the group doesn't have a grid
+ */
+orxSTATUS orxFASTCALL orxObject_GetGroupIDGridStats(orxSTRINGID _stGroupID, orxOBJECT_GRID_STATS *_pstStats, orxBOOL _bReset)
 {
-  orxOBJECT *pstResult;
+  orxOBJECT_LISTS  *pstGroupLists;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
-  orxASSERT((_pstObject == orxNULL) || (orxStructure_GetID((orxSTRUCTURE *)_pstObject) < orxSTRUCTURE_ID_NUMBER));
-  orxASSERT((_pstObject == orxNULL) || (_stGroupID == orxSTRINGID_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stGroupNode)) == &(((orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID))->stList)));
-
-  /* Has group? */
-  if(_stGroupID != orxSTRINGID_UNDEFINED)
-  {
-    orxOBJECT_LISTS *pstGroupLists;
+  orxASSERT(_pstStats != orxNULL);
 
-    /* Is cached one? */
-    if(_stGroupID == sstObject.stCachedGroupID)
-    {
-      /* Gets group list */
-      pstGroupLists = sstObject.pstCachedGroupLists;
-    }
-    else
-    {
-      /* Gets group list */
-      pstGroupLists = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
-    }
+  /* Gets group lists */
+  pstGroupLists = (_stGroupID != orxSTRINGID_UNDEFINED) ? orxObject_GetGroupLists(_stGroupID) : orxNULL;
 
-    /* Valid? */
-    if(pstGroupLists != orxNULL)
-    {
-      orxLINKLIST_NODE *pstNode;
+  /* Has grid? */
+  if((pstGroupLists != orxNULL) && (pstGroupLists->pstGrid != orxNULL))
+  {
+    orxOBJECT_GRID *pstGrid;
+    orxLINKLIST    *pstList;
+    orxHANDLE       hIterator;
+    orxU64          u64Key;
 
-      /* Gets node */
-      pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(&(pstGroupLists->stList)) : orxLinkList_GetNext(&(_pstObject->stGroupNode));
+    /* Gets grid */
+    pstGrid = pstGroupLists->pstGrid;
 
-      /* Valid? */
-      if(pstNode != orxNULL)
-      {
-        /* Updates result */
-        pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGroupNode, pstNode);
-      }
-      else
-      {
-        /* Updates result */
-        pstResult = orxNULL;
-      }
+    /* Stores stats */
+    _pstStats->u32CellCount     = orxHashTable_GetCount(pstGrid->pstCellTable);
+    _pstStats->u32BoundCount    = 0;
+    _pstStats->u32UnboundCount  = orxLinkList_GetCount(&(pstGrid->stUnboundList));
+    _pstStats->u32MoveCount     = pstGrid->u32MoveCount;
+    _pstStats->u32QueryCount    = pstGrid->u32QueryCount;
 
-      /* Caches group list */
-      sstObject.pstCachedGroupLists = pstGroupLists;
-      sstObject.stCachedGroupID     = _stGroupID;
+    /* For all used cells */
+    for(hIterator = orxHashTable_GetNext(pstGrid->pstCellTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstList);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(pstGrid->pstCellTable, hIterator, &u64Key, (void **)&pstList))
+    {
+      /* Updates bound count */
+      _pstStats->u32BoundCount += orxLinkList_GetCount(pstList);
     }
-    else
+
+    /* Should reset? */
+    if(_bReset != orxFALSE)
     {
-      /* Updates result */
-      pstResult = orxNULL;
+      /* Resets counts */
+      pstGrid->u32MoveCount   =
+      pstGrid->u32QueryCount  = 0;
     }
-  }
-  else
-  {
+
     /* Updates result */
-    pstResult = (_pstObject == orxNULL) ? orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT)) : orxOBJECT(orxStructure_GetNext(_pstObject));
+    eResult = orxSTATUS_SUCCESS;
   }
 
   /* Done! */
-  return pstResult;
+  return eResult;
 }
 
-/** Gets next enabled object.
+/** Gets next enabled object that potentially intersects a box.
  * @param[in]   _pstObject      Concerned object, orxNULL to get the first one
  * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[in]   _pstBox         Box to consider, in world space (Z is ignored)
+ * @param[in,out] _pstQuery     Query used to store results and cursor
  * @return      orxOBJECT / orxNULL
  */
-orxOBJECT *orxFASTCALL orxObject_GetNextEnabled(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID)
+orxOBJECT *orxFASTCALL orxObject_GetNextEnabledInBox(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID, const orxAABOX *_pstBox, orxOBJECT_BOX_QUERY *_pstQuery)
 {
-  orxOBJECT *pstResult;
+  orxOBJECT_LISTS  *pstGroupLists;
+  orxOBJECT        *pstResult = orxNULL;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
-  orxASSERT((_pstObject == orxNULL) || (orxStructure_GetID((orxSTRUCTURE *)_pstObject) < orxSTRUCTURE_ID_NUMBER));
-  orxASSERT((_pstObject == orxNULL) || (_stGroupID == orxSTRINGID_UNDEFINED) || (orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) == &(((orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID))->stEnableList)));
+  orxASSERT(_pstBox != orxNULL);
+  orxASSERT(_pstQuery != orxNULL);
 
-  /* Has group? */
-  if(_stGroupID != orxSTRINGID_UNDEFINED)
-  {
-    orxOBJECT_LISTS *pstGroupLists;
+  /* Gets group lists */
+  pstGroupLists = (_stGroupID != orxSTRINGID_UNDEFINED) ? orxObject_GetGroupLists(_stGroupID) : orxNULL;
 
-    /* Is cached one? */
-    if(_stGroupID == sstObject.stCachedGroupID)
-    {
-      /* Gets group list */
-      pstGroupLists = sstObject.pstCachedGroupLists;
-    }
-    else
+  /* Has grid? */
+  if((pstGroupLists != orxNULL) && (pstGroupLists->pstGrid != orxNULL))
+  {
+    /* First one? */
+    if(_pstObject == orxNULL)
     {
-      /* Gets group list */
-      pstGroupLists = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
-    }
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("orxObject_GetNextEnabledInBox");
 
-    /* Valid? */
-    if(pstGroupLists != orxNULL)
-    {
-      orxLINKLIST_NODE *pstNode;
+      /* Refreshes grids */
+      orxObject_RefreshGrids();
 
-      /* Gets node */
-      pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(&(pstGroupLists->stEnableList)) : orxLinkList_GetNext(&(_pstObject->stEnableGroupNode));
+      /* Queries grid */
+      orxObject_QueryGrid(pstGroupLists->pstGrid, _pstBox, orxTRUE, _pstQuery);
 
-      /* Valid? */
-      if(pstNode != orxNULL)
-      {
-        /* Updates result */
-        pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableGroupNode, pstNode);
-      }
-      else
-      {
-        /* Updates result */
-        pstResult = orxNULL;
-      }
+      /* Restores enable group list order */
+      orxObject_SortGridResult(_pstQuery);
 
-      /* Caches group list */
-      sstObject.pstCachedGroupLists = pstGroupLists;
-      sstObject.stCachedGroupID     = _stGroupID;
+      /* Clears result index */
+      _pstQuery->u32Index = 0;
+
+      /* Profiles */
+      orxPROFILER_POP_MARKER();
     }
     else
+    {
+      /* Checks */
+      orxASSERT((_pstQuery->u32Index > 0) && (_pstQuery->apstObjectList[_pstQuery->u32Index - 1] == _pstObject));
+    }
+
+    /* Has remaining result? */
+    if(_pstQuery->u32Index < _pstQuery->u32Count)
     {
       /* Updates result */
-      pstResult = orxNULL;
+      pstResult = _pstQuery->apstObjectList[_pstQuery->u32Index++];
     }
   }
   else
   {
-    orxLINKLIST_NODE *pstNode;
+    /* Gets next enabled object */
+    pstResult = orxObject_GetNextEnabled(_pstObject, _stGroupID);
+  }
 
-    /* Gets node */
-    pstNode = (_pstObject == orxNULL) ? orxLinkList_GetFirst(&(sstObject.stEnableList)) : orxLinkList_GetNext(&(_pstObject->stEnableNode));
+  /* Done! */
+  return pstResult;
+}
 
-    /* Valid? */
-    if(pstNode != orxNULL)
-    {
-      /* Updates result */
-      pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode);
-    }
-    else
-    {
-      /* Updates result */
-      pstResult = orxNULL;
-    }
+/** Clears a box query, freeing its storage.
+ * @param[in]   _pstQuery       Concerned query
+ */
+void orxFASTCALL orxObject_ClearBoxQuery(orxOBJECT_BOX_QUERY *_pstQuery)
+{
+  /* Checks */
+  orxASSERT(_pstQuery != orxNULL);
+
+  /* Has storage? */
+  if(_pstQuery->apstObjectList != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstQuery->apstObjectList);
   }
 
+  /* Clears it */
+  orxMemory_Zero(_pstQuery, sizeof(orxOBJECT_BOX_QUERY));
+
   /* Done! */
-  return pstResult;
+  return;
 }
 
 /** Picks the first active object with size "under" the given position, within a given group. See
@@ -12156,17 +14371,33 @@ orxOBJECT *orxFASTCALL orxObject_GetNextEnabled(const orxOBJECT *_pstObject, orx
  */
 orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID _stGroupID)
 {
-  orxFLOAT    fSelectedZ;
-  orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxOBJECT_GRID *pstGrid;
+  orxFLOAT        fSelectedZ;
+  orxOBJECT      *pstResult = orxNULL, *pstObject;
+  orxU32          u32Index = 0;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvPosition != orxNULL);
 
+  /* Gets group grid */
+  pstGrid = orxObject_GetRefreshedGrid(_stGroupID);
+
+  /* Has grid? */
+  if(pstGrid != orxNULL)
+  {
+    orxAABOX stBox;
+
+    /* Queries it at position */
+    orxVector_Copy(&(stBox.vTL), _pvPosition);
+    orxVector_Copy(&(stBox.vBR), _pvPosition);
+    orxObject_QueryGrid(pstGrid, &stBox, orxFALSE, &(sstObject.stQueryResult));
+  }
+
   /* For all objects */
-  for(pstObject = orxObject_GetNext(orxNULL, _stGroupID), fSelectedZ = _pvPosition->fZ;
+  for(pstObject = orxObject_GetNextCandidate(orxNULL, _stGroupID, pstGrid, &u32Index), fSelectedZ = _pvPosition->fZ;
       pstObject != orxNULL;
-      pstObject = orxObject_GetNext(pstObject, _stGroupID))
+      pstObject = orxObject_GetNextCandidate(pstObject, _stGroupID, pstGrid, &u32Index))
   {
     /* Is enabled? */
     if(orxObject_IsEnabled(pstObject) != orxFALSE)
@@ -12215,17 +14446,32 @@ orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID
  */
 orxOBJECT *orxFASTCALL orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _stGroupID)
 {
-  orxFLOAT    fSelectedZ;
-  orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxOBJECT_GRID *pstGrid;
+  orxFLOAT        fSelectedZ;
+  orxOBJECT      *pstResult = orxNULL, *pstObject;
+  orxU32          u32Index = 0;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBox != orxNULL);
 
+  /* Gets group grid */
+  pstGrid = orxObject_GetRefreshedGrid(_stGroupID);
+
+  /* Has grid? */
+  if(pstGrid != orxNULL)
+  {
+    orxAABOX stBox;
+
+    /* Queries it */
+    orxObject_GetEnclosingBox(_pstBox, &stBox);
+    orxObject_QueryGrid(pstGrid, &stBox, orxFALSE, &(sstObject.stQueryResult));
+  }
+
   /* For all objects */
-  for(pstObject = orxObject_GetNext(orxNULL, _stGroupID), fSelectedZ = _pstBox->vPosition.fZ;
+  for(pstObject = orxObject_GetNextCandidate(orxNULL, _stGroupID, pstGrid, &u32Index), fSelectedZ = _pstBox->vPosition.fZ;
       pstObject != orxNULL;
-      pstObject = orxObject_GetNext(pstObject, _stGroupID))
+      pstObject = orxObject_GetNextCandidate(pstObject, _stGroupID, pstGrid, &u32Index))
   {
     /* Is enabled? */
     if(orxObject_IsEnabled(pstObject) != orxFALSE)
@@ -12261,3 +14507,224 @@ orxOBJECT *orxFASTCALL orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _st
   /* Done! */
   return pstResult;
 }
+
+/** Gets the enabled objects nearest to a position, within a given group. Distances are computed in 2D, to the center of the
+ * objects' bounding boxes. Groups with a grid (see orxObject_SetGroupIDCellSize()) only visit the cells around the position.
+ * @param[in]   _pvPosition     Position to consider (Z is ignored)
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[in]   _u32Number      Maximum number of objects to retrieve
+ * @param[out]  _apstObjectList Nearest objects, sorted by increasing distance
+ * @return      Number of objects retrieved
+ */
+orxU32 orxFASTCALL orxObject_GetNearestList(const orxVECTOR *_pvPosition, orxSTRINGID _stGroupID, orxU32 _u32Number, orxOBJECT **_apstObjectList)
+{
+  orxFLOAT *afDistanceList;
+  orxU32    u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvPosition != orxNULL);
+  orxASSERT((_u32Number == 0) || (_apstObjectList != orxNULL));
+
+  /* Valid? */
+  if(_u32Number > 0)
+  {
+    /* Allocates distance list */
+    afDistanceList = (orxFLOAT *)orxMemory_Allocate(_u32Number * sizeof(orxFLOAT), orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(afDistanceList != orxNULL)
+    {
+      orxOBJECT_GRID *pstGrid;
+
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("orxObject_GetNearestList");
+
+      /* Gets group grid */
+      pstGrid = orxObject_GetRefreshedGrid(_stGroupID);
+
+      /* Has grid? */
+      if(pstGrid != orxNULL)
+      {
+        orxU32    i, u32ObjectCount;
+        orxFLOAT  fExtent;
+
+        /* Gets group object count */
+        u32ObjectCount = orxLinkList_GetCount(&(orxObject_GetGroupLists(_stGroupID)->stList));
+
+        /* For all growing query boxes */
+        for(i = 0, fExtent = pstGrid->fCellSize; i < orxOBJECT_KU32_GRID_NEAREST_STEP_NUMBER; i++, fExtent *= orx2F(2.0f))
+        {
+          orxAABOX  stBox;
+          orxFLOAT  fSquareExtent;
+          orxU32    j, u32InRangeCount;
+
+          /* Queries grid */
+          orxVector_Set(&(stBox.vTL), _pvPosition->fX - fExtent, _pvPosition->fY - fExtent, orxFLOAT_0);
+          orxVector_Set(&(stBox.vBR), _pvPosition->fX + fExtent, _pvPosition->fY + fExtent, orxFLOAT_0);
+          orxObject_QueryGrid(pstGrid, &stBox, orxFALSE, &(sstObject.stQueryResult));
+
+          /* For all candidates */
+          for(j = 0, u32InRangeCount = 0, u32Result = 0, fSquareExtent = fExtent * fExtent; j < sstObject.stQueryResult.u32Count; j++)
+          {
+            orxFLOAT fSquareDistance;
+
+            /* Inserts it */
+            fSquareDistance = orxObject_InsertNearest(sstObject.stQueryResult.apstObjectList[j], _pvPosition, _u32Number, _apstObjectList, afDistanceList, &u32Result);
+
+            /* Within the box's inscribed circle? */
+            if((fSquareDistance >= orxFLOAT_0) && (fSquareDistance <= fSquareExtent))
+            {
+              /* Updates count */
+              u32InRangeCount++;
+            }
+          }
+
+          /* Enough candidates that can't be beaten by objects outside the box or whole group visited? */
+          if((u32InRangeCount >= _u32Number)
+          || (sstObject.stQueryResult.u32Count >= u32ObjectCount))
+          {
+            break;
+          }
+        }
+      }
+      else
+      {
+        orxOBJECT *pstObject;
+
+        /* For all objects */
+        for(pstObject = orxObject_GetNext(orxNULL, _stGroupID);
+            pstObject != orxNULL;
+            pstObject = orxObject_GetNext(pstObject, _stGroupID))
+        {
+          /* Inserts it */
+          orxObject_InsertNearest(pstObject, _pvPosition, _u32Number, _apstObjectList, afDistanceList, &u32Result);
+        }
+      }
+
+      /* Frees distance list */
+      orxMemory_Free(afDistanceList);
+
+      /* Profiles */
+      orxPROFILER_POP_MARKER();
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't allocate distance list for %u nearest objects.", _u32Number);
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Picks, for each box of a list, the first active object with size in contact with it, within a given group (same as calling
+ * orxObject_BoxPick() for each box). Groups with a grid (see orxObject_SetGroupIDCellSize()) are queried once per box, other
+ * groups are walked only once for the whole list.
+ * @param[in]   _astBoxList     Boxes to use for picking
+ * @param[in]   _u32Number      Number of boxes
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[out]  _apstObjectList Picked object for each box, orxNULL if none
+ * @return      Number of boxes for which an object has been picked
+ */
+orxU32 orxFASTCALL orxObject_BoxPickBatch(const orxOBOX *_astBoxList, orxU32 _u32Number, orxSTRINGID _stGroupID, orxOBJECT **_apstObjectList)
+{
+  orxU32 i, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT((_u32Number == 0) || ((_astBoxList != orxNULL) && (_apstObjectList != orxNULL)));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_BoxPickBatch");
+
+  /* Has grid? */
+  if(orxObject_GetRefreshedGrid(_stGroupID) != orxNULL)
+  {
+    /* For all boxes */
+    for(i = 0; i < _u32Number; i++)
+    {
+      /* Picks object */
+      _apstObjectList[i] = orxObject_BoxPick(&(_astBoxList[i]), _stGroupID);
+    }
+  }
+  else
+  {
+    orxFLOAT *afSelectedZList;
+
+    /* Allocates selected depth list */
+    afSelectedZList = (_u32Number > 0) ? (orxFLOAT *)orxMemory_Allocate(_u32Number * sizeof(orxFLOAT), orxMEMORY_TYPE_TEMP) : orxNULL;
+
+    /* Success? */
+    if(afSelectedZList != orxNULL)
+    {
+      orxOBJECT *pstObject;
+
+      /* For all boxes */
+      for(i = 0; i < _u32Number; i++)
+      {
+        /* Inits its selection */
+        _apstObjectList[i]  = orxNULL;
+        afSelectedZList[i]  = _astBoxList[i].vPosition.fZ;
+      }
+
+      /* For all objects */
+      for(pstObject = orxObject_GetNext(orxNULL, _stGroupID);
+          pstObject != orxNULL;
+          pstObject = orxObject_GetNext(pstObject, _stGroupID))
+      {
+        orxVECTOR vObjectPos;
+        orxOBOX   stObjectBox;
+
+        /* Is enabled and has position & bounding box? */
+        if((orxObject_IsEnabled(pstObject) != orxFALSE)
+        && (orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+        && (orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL))
+        {
+          /* For all boxes */
+          for(i = 0; i < _u32Number; i++)
+          {
+            /* No selection or above it and intersecting? */
+            if(((_apstObjectList[i] == orxNULL) || (vObjectPos.fZ <= afSelectedZList[i]))
+            && (orxOBox_ZAlignedTestIntersection(&(_astBoxList[i]), &stObjectBox) != orxFALSE))
+            {
+              /* Updates selection */
+              _apstObjectList[i]  = pstObject;
+              afSelectedZList[i]  = vObjectPos.fZ;
+            }
+          }
+        }
+      }
+
+      /* Frees selected depth list */
+      orxMemory_Free(afSelectedZList);
+    }
+    else
+    {
+      /* For all boxes */
+      for(i = 0; i < _u32Number; i++)
+      {
+        /* Picks object */
+        _apstObjectList[i] = orxObject_BoxPick(&(_astBoxList[i]), _stGroupID);
+      }
+    }
+  }
+
+  /* For all boxes */
+  for(i = 0; i < _u32Number; i++)
+  {
+    /* Has picked an object? */
+    if(_apstObjectList[i] != orxNULL)
+    {
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
@@ -3169,3 +3169,52 @@ orxU32 orxFASTCALL orxBody_BoxPick(const orxAABOX *_pstBox, orxU16 _u16SelfFlags
   /* Done! */
   return u32Result;
 }
+
+/** Issues a batch of raycasts to test for potential bodies in the way, queries are read-only and can be spread over worker threads
+ * @param[in]   _astRaycastList List of raycast queries
+ * @param[in]   _u32Number      Number of queries
+ * @param[out]  _astResultList  List of results, one per query, hUserData will be the colliding orxBODY / orxHANDLE_UNDEFINED
+ * @param[in]   _bParallel      Should queries be spread over worker threads
+ * @return Number of queries that hit a body
+ */
+orxU32 orxFASTCALL orxBody_RaycastBatch(const orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number, orxPHYSICS_RAYCAST_RESULT *_astResultList, orxBOOL _bParallel)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astRaycastList != orxNULL) || (_u32Number == 0));
+  orxASSERT((_astResultList != orxNULL) || (_u32Number == 0));
+
+  /* Issues requests (bodies are used as physics user data) */
+  u32Result = orxPhysics_RaycastBatch(_astRaycastList, _u32Number, _astResultList, _bParallel);
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Picks bodies in contact with a batch of axis aligned boxes, queries are read-only and can be spread over worker threads
+ * @param[in]   _astBoxPickList                       List of box pick queries
+ * @param[in]   _u32Number                            Number of queries
+ * @param[out]  _apstBodyList                         List of bodies to fill, query #i will use the slice [i * _u32BodyNumber, (i + 1) * _u32BodyNumber[, can be orxNULL for count only
+ * @param[in]   _u32BodyNumber                        Number of bodies per query
+ * @param[out]  _au32CountList                        List of counts, one per query. A count might be larger than _u32BodyNumber, in which case you'd need to pass a larger array to retrieve them all
+ * @param[in]   _bParallel                            Should queries be spread over worker threads
+ * @return      Total count of found bodies
+ */
+orxU32 orxFASTCALL orxBody_BoxPickBatch(const orxPHYSICS_BOX_PICK *_astBoxPickList, orxU32 _u32Number, orxBODY *_apstBodyList[], orxU32 _u32BodyNumber, orxU32 _au32CountList[], orxBOOL _bParallel)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astBoxPickList != orxNULL) || (_u32Number == 0));
+  orxASSERT((_apstBodyList != orxNULL) || (_u32BodyNumber == 0));
+  orxASSERT((_au32CountList != orxNULL) || (_u32Number == 0));
+
+  /* Issues requests */
+  u32Result = orxPhysics_BoxPickBatch(_astBoxPickList, _u32Number, (orxHANDLE *)_apstBodyList, _u32BodyNumber, _au32CountList, _bParallel);
+
+  /* Done! */
+  return u32Result;
+}
@@ -376,7 +376,10 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_GetPartDensity, orxFLOAT, const orxPHY
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_IsInsidePart, orxBOOL, const orxPHYSICS_BODY_PART *, const orxVECTOR *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_Raycast, orxHANDLE, const orxVECTOR *, const orxVECTOR *, orxU16, orxU16, orxBOOL, orxVECTOR *, orxVECTOR *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_BoxPick, orxU32, const orxAABOX *, orxU16, orxU16, orxHANDLE [], orxU32);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_RaycastBatch, orxU32, const orxPHYSICS_RAYCAST *, orxU32, orxPHYSICS_RAYCAST_RESULT *, orxBOOL);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_BoxPickBatch, orxU32, const orxPHYSICS_BOX_PICK *, orxU32, orxHANDLE [], orxU32, orxU32 [], orxBOOL);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_EnableSimulation, void, orxBOOL);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxPhysics_SetContactCallback, orxSTATUS, const orxPHYSICS_CONTACT_FUNCTION, orxU16, orxU16, void *);
 
 
 /* *** Core function info array *** */
@@ -438,6 +441,9 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, GET_JOINT_REACTION_TORQUE, orxPhysics
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, RAYCAST, orxPhysics_Raycast)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, BOX_PICK, orxPhysics_BoxPick)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, ENABLE_SIMULATION, orxPhysics_EnableSimulation)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, SET_CONTACT_CALLBACK, orxPhysics_SetContactCallback)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, RAYCAST_BATCH, orxPhysics_RaycastBatch)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(PHYSICS, BOX_PICK_BATCH, orxPhysics_BoxPickBatch)
 
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(PHYSICS)
 
@@ -727,7 +733,22 @@ orxU32 orxFASTCALL orxPhysics_BoxPick(const orxAABOX *_pstBox, orxU16 _u16SelfFl
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_BoxPick)(_pstBox, _u16SelfFlags, _u16CheckMask, _ahUserDataList, _u32Number);
 }
 
+orxU32 orxFASTCALL orxPhysics_RaycastBatch(const orxPHYSICS_RAYCAST *_astRaycastList, orxU32 _u32Number, orxPHYSICS_RAYCAST_RESULT *_astResultList, orxBOOL _bParallel)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_RaycastBatch)(_astRaycastList, _u32Number, _astResultList, _bParallel);
+}
+
+orxU32 orxFASTCALL orxPhysics_BoxPickBatch(const orxPHYSICS_BOX_PICK *_astBoxPickList, orxU32 _u32Number, orxHANDLE _ahUserDataList[], orxU32 _u32UserDataNumber, orxU32 _au32CountList[], orxBOOL _bParallel)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_BoxPickBatch)(_astBoxPickList, _u32Number, _ahUserDataList, _u32UserDataNumber, _au32CountList, _bParallel);
+}
+
 void orxFASTCALL orxPhysics_EnableSimulation(orxBOOL _bEnable)
 {
   orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_EnableSimulation)(_bEnable);
 }
+
+orxSTATUS orxFASTCALL orxPhysics_SetContactCallback(const orxPHYSICS_CONTACT_FUNCTION _pfnCallback, orxU16 _u16SelfFlags, orxU16 _u16CheckMask, void *_pContext)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxPhysics_SetContactCallback)(_pfnCallback, _u16SelfFlags, _u16CheckMask, _pContext);
+}
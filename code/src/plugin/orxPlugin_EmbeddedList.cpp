@@ -64,6 +64,20 @@
 /** Includes all plugins to embed
  */
 
+  /* Headless? */
+  #if defined(__orxDISPLAY_NULL__)
+
+/* Null display, dummy inputs & sound, Box2D & stb_image */
+#include "../plugins/Display/Null/orxDisplay.c"
+#include "../plugins/Joystick/Dummy/orxJoystick.c"
+#include "../plugins/Keyboard/Dummy/orxKeyboard.c"
+#include "../plugins/Mouse/Dummy/orxMouse.c"
+#include "../plugins/Physics/LiquidFun/orxPhysics.cpp"
+#include "../plugins/Render/Home/orxRender.c"
+#include "../plugins/Sound/Dummy/orxSoundSystem.c"
+
+  #else /* __orxDISPLAY_NULL__ */
+
 /* GLFW, Box2D, MiniAudio, stb_image, libsndfile & stb_vorbis */
 #include "../plugins/Display/GLFW/orxDisplay.c"
 #include "../plugins/Joystick/GLFW/orxJoystick.c"
@@ -73,6 +87,8 @@
 #include "../plugins/Render/Home/orxRender.c"
 #include "../plugins/Sound/MiniAudio/orxSoundSystem.c"
 
+  #endif /* __orxDISPLAY_NULL__ */
+
 #endif /* __orxANDROID__ */
 
 #endif /* __orxEMBEDDED__ */
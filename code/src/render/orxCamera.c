@@ -81,6 +81,7 @@
 #define orxCAMERA_KZ_CONFIG_FRUSTUM_HEIGHT    "FrustumHeight"
 #define orxCAMERA_KZ_CONFIG_PARENT_CAMERA     "ParentCamera"
 #define orxCAMERA_KZ_CONFIG_IGNORE_FROM_PARENT "IgnoreFromParent"
+#define orxCAMERA_KZ_CONFIG_CULLING_CELL_SIZE "CullingCellSize"
 
 #define orxCAMERA_KZ_SORT                     "sort"
 #define orxCAMERA_KZ_RAW                      "raw"
@@ -110,7 +111,8 @@ struct __orxCAMERA_t
   orxFRAME       *pstFrame;                   /**< Frame : 20 */
   orxAABOX        stFrustum;                  /**< Frustum : 44 */
   const orxSTRING zReference;                 /**< Reference : 48 */
-  orxCAMERA_GROUP astGroupList[orxCAMERA_KU32_GROUP_ID_NUMBER]; /**< Group list : 560 */
+  orxFLOAT        fCullingCellSize;           /**< Culling cell size : 52 */
+  orxCAMERA_GROUP astGroupList[orxCAMERA_KU32_GROUP_ID_NUMBER]; /**< Group list : 564 */
 };
 
 /** Static structure
@@ -1111,6 +1113,22 @@ orxCAMERA *orxFASTCALL orxCamera_CreateFromConfig(const orxSTRING _zConfigID)
         /* Updates object rotation */
         orxCamera_SetRotation(pstResult, orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxCAMERA_KZ_CONFIG_ROTATION));
 
+        /* Has culling cell size? */
+        if(orxConfig_HasValue(orxCAMERA_KZ_CONFIG_CULLING_CELL_SIZE) != orxFALSE)
+        {
+          orxFLOAT fCellSize;
+
+          /* Gets it */
+          fCellSize = orxConfig_GetFloat(orxCAMERA_KZ_CONFIG_CULLING_CELL_SIZE);
+
+          /* Valid? */
+          if(fCellSize >= orxFLOAT_0)
+          {
+            /* Applies it */
+            orxCamera_SetCullingCellSize(pstResult, fCellSize);
+          }
+        }
+
         /* Stores its reference key */
         pstResult->zReference = orxConfig_GetCurrentSection();
 
@@ -1514,6 +1532,41 @@ orxSTATUS orxFASTCALL orxCamera_SetZoom(orxCAMERA *_pstCamera, orxFLOAT _fZoom)
   return eResult;
 }
 
+/** Sets camera culling cell size: when non-null, the groups rendered by this camera will be spatially indexed with a grid of that cell size (see orxObject_SetGroupIDCellSize())
+ * @param[in]   _pstCamera      Concerned camera
+ * @param[in]   _fCellSize      Cell size, orxFLOAT_0 for none
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxCamera_SetCullingCellSize(orxCAMERA *_pstCamera, orxFLOAT _fCellSize)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstCamera.u32Flags & orxCAMERA_KU32_STATIC_FLAG_READY);
+  orxASSERT(_fCellSize >= orxFLOAT_0);
+  orxSTRUCTURE_ASSERT(_pstCamera);
+
+  /* Stores it */
+  _pstCamera->fCullingCellSize = _fCellSize;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets camera culling cell size
+ * @param[in]   _pstCamera      Concerned camera
+ * @return      Cell size / orxFLOAT_0 if none
+ */
+orxFLOAT orxFASTCALL orxCamera_GetCullingCellSize(const orxCAMERA *_pstCamera)
+{
+  /* Checks */
+  orxASSERT(sstCamera.u32Flags & orxCAMERA_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstCamera);
+
+  /* Done! */
+  return _pstCamera->fCullingCellSize;
+}
+
 /** Gets camera frustum (3D box for 2D camera)
  * @param[in]   _pstCamera      Concerned camera
  * @param[out]  _pstFrustum    Frustum box
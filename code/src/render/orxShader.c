@@ -130,6 +130,13 @@ struct __orxSHADER_t
   orxHANDLE       hData;                                  /**< Compiled shader data : 48 */
   orxBANK        *pstParamValueBank;                      /**< Parameter value bank : 52 */
   orxBANK        *pstParamBank;                           /**< Parameter bank : 56 */
+  orxSHADER_PARAM_FUNCTION pfnParamFunction;              /**< Param function : 60 */
+  void           *pParamContext;                          /**< Param function context : 64 */
+  orxSHADER_PARAM_BLOCK stParamBlock;                     /**< Param block : 80 */
+  orxS32         *as32ParamIDList;                        /**< Param block value ID list : 84 */
+  orxU32         *au32ParamSizeList;                      /**< Param block value size list : 88 */
+  orxS32         *as32TextureIDList;                      /**< Param block texture ID list : 92 */
+  orxU32          u32ParamNumber;                         /**< Param block value number : 96 */
 };
 
 /** Static structure
@@ -156,6 +163,173 @@ static orxSHADER_STATIC sstShader;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Clears a shader's param block
+ */
+static void orxFASTCALL orxShader_ClearParamBlock(orxSHADER *_pstShader)
+{
+  /* Frees all its lists */
+  if(_pstShader->stParamBlock.afValueList != orxNULL)
+  {
+    orxMemory_Free(_pstShader->stParamBlock.afValueList);
+  }
+  if(_pstShader->stParamBlock.apstTextureList != orxNULL)
+  {
+    orxMemory_Free(_pstShader->stParamBlock.apstTextureList);
+  }
+  if(_pstShader->as32ParamIDList != orxNULL)
+  {
+    orxMemory_Free(_pstShader->as32ParamIDList);
+  }
+  if(_pstShader->au32ParamSizeList != orxNULL)
+  {
+    orxMemory_Free(_pstShader->au32ParamSizeList);
+  }
+  if(_pstShader->as32TextureIDList != orxNULL)
+  {
+    orxMemory_Free(_pstShader->as32TextureIDList);
+  }
+
+  /* Clears them */
+  orxMemory_Zero(&(_pstShader->stParamBlock), sizeof(orxSHADER_PARAM_BLOCK));
+  _pstShader->as32ParamIDList   = orxNULL;
+  _pstShader->au32ParamSizeList = orxNULL;
+  _pstShader->as32TextureIDList = orxNULL;
+  _pstShader->u32ParamNumber    = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Builds a shader's param block layout (needs the parameter IDs to be computed beforehand)
+ */
+static orxSTATUS orxFASTCALL orxShader_BuildParamBlock(orxSHADER *_pstShader)
+{
+  orxSHADER_PARAM_VALUE  *pstParamValue;
+  orxU32                  u32ValueNumber = 0, u32TextureNumber = 0, u32ParamNumber = 0;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+
+  /* Clears current block */
+  orxShader_ClearParamBlock(_pstShader);
+
+  /* For all parameter values */
+  for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+      pstParamValue != orxNULL;
+      pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+  {
+    /* Depending on parameter type */
+    switch(pstParamValue->pstParam->eType)
+    {
+      case orxSHADER_PARAM_TYPE_FLOAT:
+      case orxSHADER_PARAM_TYPE_TIME:
+      {
+        /* Updates counts */
+        u32ValueNumber++;
+        u32ParamNumber++;
+
+        break;
+      }
+
+      case orxSHADER_PARAM_TYPE_VECTOR:
+      {
+        /* Updates counts */
+        u32ValueNumber += 3;
+        u32ParamNumber++;
+
+        break;
+      }
+
+      case orxSHADER_PARAM_TYPE_TEXTURE:
+      {
+        /* Updates count */
+        u32TextureNumber++;
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Has values? */
+  if(u32ParamNumber > 0)
+  {
+    /* Allocates value, ID & size lists */
+    _pstShader->stParamBlock.afValueList  = (orxFLOAT *)orxMemory_Allocate(u32ValueNumber * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN);
+    _pstShader->as32ParamIDList           = (orxS32 *)orxMemory_Allocate(u32ParamNumber * sizeof(orxS32), orxMEMORY_TYPE_MAIN);
+    _pstShader->au32ParamSizeList         = (orxU32 *)orxMemory_Allocate(u32ParamNumber * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+
+    /* Failure? */
+    if((_pstShader->stParamBlock.afValueList == orxNULL)
+    || (_pstShader->as32ParamIDList == orxNULL)
+    || (_pstShader->au32ParamSizeList == orxNULL))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Has textures? */
+  if((eResult != orxSTATUS_FAILURE) && (u32TextureNumber > 0))
+  {
+    /* Allocates texture & ID lists */
+    _pstShader->stParamBlock.apstTextureList  = (const orxTEXTURE **)orxMemory_Allocate(u32TextureNumber * sizeof(orxTEXTURE *), orxMEMORY_TYPE_MAIN);
+    _pstShader->as32TextureIDList             = (orxS32 *)orxMemory_Allocate(u32TextureNumber * sizeof(orxS32), orxMEMORY_TYPE_MAIN);
+
+    /* Failure? */
+    if((_pstShader->stParamBlock.apstTextureList == orxNULL)
+    || (_pstShader->as32TextureIDList == orxNULL))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxU32 u32ParamIndex = 0, u32TextureIndex = 0;
+
+    /* For all parameter values */
+    for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+        pstParamValue != orxNULL;
+        pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+    {
+      /* Is a texture? */
+      if(pstParamValue->pstParam->eType == orxSHADER_PARAM_TYPE_TEXTURE)
+      {
+        /* Stores its ID */
+        _pstShader->as32TextureIDList[u32TextureIndex++] = pstParamValue->s32ID;
+      }
+      else if(pstParamValue->pstParam->eType < orxSHADER_PARAM_TYPE_NUMBER)
+      {
+        /* Stores its ID & size */
+        _pstShader->as32ParamIDList[u32ParamIndex]    = pstParamValue->s32ID;
+        _pstShader->au32ParamSizeList[u32ParamIndex]  = (pstParamValue->pstParam->eType == orxSHADER_PARAM_TYPE_VECTOR) ? 3 : 1;
+        u32ParamIndex++;
+      }
+    }
+
+    /* Stores counts */
+    _pstShader->stParamBlock.u32ValueNumber   = u32ValueNumber;
+    _pstShader->stParamBlock.u32TextureNumber = u32TextureNumber;
+    _pstShader->u32ParamNumber                = u32ParamNumber;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Shader [%s]: couldn't allocate param block.", _pstShader->zReference);
+
+    /* Clears partial block */
+    orxShader_ClearParamBlock(_pstShader);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Processes config data
  */
 static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
@@ -838,6 +1012,9 @@ orxSTATUS orxFASTCALL orxShader_Delete(orxSHADER *_pstShader)
       orxBank_Delete(_pstShader->pstParamBank);
     }
 
+    /* Clears its param block */
+    orxShader_ClearParamBlock(_pstShader);
+
     /* Deletes structure */
     orxStructure_Delete(_pstShader);
   }
@@ -949,8 +1126,86 @@ orxSTATUS orxFASTCALL orxShader_Start(const orxSHADER *_pstShader, const orxSTRU
         }
       }
 
+      /* Has param function? */
+      if(_pstShader->pfnParamFunction != orxNULL)
+      {
+        orxSHADER_PARAM_BLOCK  *pstParamBlock;
+        orxU32                  u32ValueIndex = 0, u32TextureIndex = 0;
+
+        /* Gets its param block */
+        pstParamBlock = (orxSHADER_PARAM_BLOCK *)&(_pstShader->stParamBlock);
+
+        /* For all parameter values */
+        for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+            pstParamValue != orxNULL;
+            pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+        {
+          /* Depending on parameter type */
+          switch(pstParamValue->pstParam->eType)
+          {
+            case orxSHADER_PARAM_TYPE_FLOAT:
+            {
+              /* Stores default value */
+              pstParamBlock->afValueList[u32ValueIndex++] = pstParamValue->fValue;
+
+              break;
+            }
+
+            case orxSHADER_PARAM_TYPE_TEXTURE:
+            {
+              /* Stores default texture */
+              pstParamBlock->apstTextureList[u32TextureIndex++] = (pstParamValue->pstValue != orxNULL) ? pstParamValue->pstValue : pstOwnerTexture;
+
+              break;
+            }
+
+            case orxSHADER_PARAM_TYPE_VECTOR:
+            {
+              /* Stores default value */
+              pstParamBlock->afValueList[u32ValueIndex++] = pstParamValue->vValue.fX;
+              pstParamBlock->afValueList[u32ValueIndex++] = pstParamValue->vValue.fY;
+              pstParamBlock->afValueList[u32ValueIndex++] = pstParamValue->vValue.fZ;
+
+              break;
+            }
+
+            case orxSHADER_PARAM_TYPE_TIME:
+            {
+              /* Stores time */
+              pstParamBlock->afValueList[u32ValueIndex++] = fTime;
+
+              break;
+            }
+
+            default:
+            {
+              break;
+            }
+          }
+        }
+
+        /* Calls param function */
+        if(_pstShader->pfnParamFunction(_pstShader, _pstOwner, pstParamBlock, _pstShader->pParamContext) != orxSTATUS_FAILURE)
+        {
+          orxU32 i;
+
+          /* For all textures */
+          for(i = 0; i < pstParamBlock->u32TextureNumber; i++)
+          {
+            /* Sets it */
+            orxDisplay_SetShaderBitmap(_pstShader->hData, _pstShader->as32TextureIDList[i], (pstParamBlock->apstTextureList[i] != orxNULL) ? orxTexture_GetBitmap(pstParamBlock->apstTextureList[i]) : orxNULL);
+          }
+
+          /* Has values? */
+          if(_pstShader->u32ParamNumber > 0)
+          {
+            /* Sets them */
+            orxDisplay_SetShaderParamBlock(_pstShader->hData, _pstShader->u32ParamNumber, _pstShader->as32ParamIDList, _pstShader->au32ParamSizeList, pstParamBlock->afValueList);
+          }
+        }
+      }
       /* No custom param? */
-      if(!orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
+      else if(!orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_USE_CUSTOM_PARAM))
       {
         /* For all parameter values */
         for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
@@ -1726,6 +1981,21 @@ orxSTATUS orxFASTCALL orxShader_CompileCode(orxSHADER *_pstShader, const orxSTRI
         /* Gets its ID */
         pstParamValue->s32ID = orxDisplay_GetParameterID(_pstShader->hData, pstParamValue->pstParam->zName, pstParamValue->s32Index, (pstParamValue->pstParam->eType == orxSHADER_PARAM_TYPE_TEXTURE) ? orxTRUE : orxFALSE);
       }
+
+      /* Has param function? */
+      if(_pstShader->pfnParamFunction != orxNULL)
+      {
+        /* Rebuilds its param block */
+        eResult = orxShader_BuildParamBlock(_pstShader);
+
+        /* Failure? */
+        if(eResult == orxSTATUS_FAILURE)
+        {
+          /* Removes param function (parameters will be sent through events instead of writing to a missing block) */
+          _pstShader->pfnParamFunction  = orxNULL;
+          _pstShader->pParamContext     = orxNULL;
+        }
+      }
     }
     else
     {
@@ -1741,6 +2011,119 @@ orxSTATUS orxFASTCALL orxShader_CompileCode(orxSHADER *_pstShader, const orxSTRI
   return eResult;
 }
 
+/** Sets a shader's param function: when set, all the parameters are provided through a single param block per start, without sending any event
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _pfnParamFunction       Param function, orxNULL to go back to default values / events
+ * @param[in] _pContext               Context that will be transmitted to the param function
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxShader_SetParamFunction(orxSHADER *_pstShader, orxSHADER_PARAM_FUNCTION _pfnParamFunction, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+
+  /* Has function? */
+  if(_pfnParamFunction != orxNULL)
+  {
+    /* Is compiled and no block yet? */
+    if((orxStructure_TestFlags(_pstShader, orxSHADER_KU32_FLAG_COMPILED))
+    && (_pstShader->pfnParamFunction == orxNULL))
+    {
+      /* Builds its param block */
+      eResult = orxShader_BuildParamBlock(_pstShader);
+    }
+  }
+  else
+  {
+    /* Clears its param block */
+    orxShader_ClearParamBlock(_pstShader);
+  }
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Stores function & context */
+    _pstShader->pfnParamFunction  = _pfnParamFunction;
+    _pstShader->pParamContext     = _pContext;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the index of a parameter in a shader's param block (in its value list for float / vector / time parameters, in its texture list for textures)
+ * @param[in] _pstShader              Concerned Shader
+ * @param[in] _zName                  Parameter's literal name
+ * @param[in] _u32Index               Index in the parameter's array, 0 for simple variable
+ * @return Index in the param block / orxU32_UNDEFINED
+ */
+orxU32 orxFASTCALL orxShader_GetParamBlockIndex(const orxSHADER *_pstShader, const orxSTRING _zName, orxU32 _u32Index)
+{
+  orxSHADER_PARAM_VALUE  *pstParamValue;
+  orxU32                  u32ValueIndex = 0, u32TextureIndex = 0, u32Result = orxU32_UNDEFINED;
+
+  /* Checks */
+  orxASSERT(sstShader.u32Flags & orxSHADER_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstShader);
+  orxASSERT(_zName != orxNULL);
+
+  /* For all parameter values */
+  for(pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetFirst(&(_pstShader->stParamValueList));
+      pstParamValue != orxNULL;
+      pstParamValue = (orxSHADER_PARAM_VALUE *)orxLinkList_GetNext(&(pstParamValue->stNode)))
+  {
+    /* Found? */
+    if(((orxU32)orxMAX(pstParamValue->s32Index, 0) == _u32Index)
+    && (orxString_Compare(pstParamValue->pstParam->zName, _zName) == 0))
+    {
+      /* Updates result */
+      u32Result = (pstParamValue->pstParam->eType == orxSHADER_PARAM_TYPE_TEXTURE) ? u32TextureIndex : u32ValueIndex;
+
+      break;
+    }
+
+    /* Depending on parameter type */
+    switch(pstParamValue->pstParam->eType)
+    {
+      case orxSHADER_PARAM_TYPE_FLOAT:
+      case orxSHADER_PARAM_TYPE_TIME:
+      {
+        /* Updates index */
+        u32ValueIndex++;
+
+        break;
+      }
+
+      case orxSHADER_PARAM_TYPE_VECTOR:
+      {
+        /* Updates index */
+        u32ValueIndex += 3;
+
+        break;
+      }
+
+      case orxSHADER_PARAM_TYPE_TEXTURE:
+      {
+        /* Updates index */
+        u32TextureIndex++;
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Enables/disables a shader
  * @param[in]   _pstShader            Concerned Shader
  * @param[in]   _bEnable              Enable / disable
@@ -31,12 +31,32 @@
  */
 
 
+
 #include "utils/orxHashTable.h"
 #include "memory/orxBank.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
+#include "math/orxMath.h"
 #include "utils/orxString.h"
 
+#if defined(__orxX86_64__) || (defined(__orxX86__) && defined(__SSE2__))
+
+  #define __orxHASHTABLE_SSE2__
+  #include <emmintrin.h>
+
+#endif /* __orxX86_64__ || (__orxX86__ && __SSE2__) */
+
+
+/** Open addressing defines
+ */
+#define orxHASHTABLE_KU32_GROUP_SIZE            16                            /**< Number of control bytes probed at once */
+
+#define orxHASHTABLE_KU8_CONTROL_EMPTY          0x80                          /**< Empty slot */
+#define orxHASHTABLE_KU8_CONTROL_DELETED        0xFE                          /**< Deleted slot (tombstone) */
+#define orxHASHTABLE_KU8_CONTROL_MASK_HASH      0x7F                          /**< Hash bits stored in used slots */
+
+#define orxHASHTABLE_KU32_CONTROL_SHIFT_HASH    7                             /**< Shift to get the group part of a hash */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -60,7 +80,13 @@ struct __orxHASHTABLE_t
 {
   orxBANK            *pstBank;                                /**< Bank where are stored cells : 4 */
   orxU32              u32Count;                               /**< Hashtable item count : 8 */
-  orxU32              u32Size;                                /**< Hashtable size : 12 */
+  orxU32              u32Size;                                /**< Hashtable size (slot count when using open addressing) : 12 */
+  orxU32              u32Flags;                               /**< Hashtable flags : 16 */
+  orxU32              u32DeletedCount;                        /**< Deleted slot count (open addressing) : 20 */
+  orxMEMORY_TYPE      eMemType;                               /**< Memory type : 24 */
+  orxU64             *au64Key;                                /**< Slot keys (open addressing) : 28 / 32 */
+  void              **apData;                                 /**< Slot data (open addressing) : 32 / 40 */
+  orxU8              *au8Control;                             /**< Slot control bytes (open addressing) : 36 / 48 */
   orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table */
 };
 
@@ -91,6 +117,328 @@ static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable
   return((orxU32)_u64Key & (_pstHashTable->u32Size - 1));
 }
 
+/** Gets the hash of a key (open addressing).
+ * @param[in] _u64Key Key to hash.
+ * @return Hash of the key, well distributed even for sequential keys.
+ */
+static orxINLINE orxU64 orxHashTable_GetHash(orxU64 _u64Key)
+{
+  /* Mixes all the bits (MurmurHash3 finalizer) */
+  _u64Key ^= _u64Key >> 33;
+  _u64Key *= 0xFF51AFD7ED558CCDULL;
+  _u64Key ^= _u64Key >> 33;
+  _u64Key *= 0xC4CEB9FE1A85EC53ULL;
+  _u64Key ^= _u64Key >> 33;
+
+  /* Done! */
+  return _u64Key;
+}
+
+/** Gets the maximum number of used and deleted slots before a rehash is needed (open addressing).
+ * @param[in] _u32Size Slot count.
+ * @return Maximum load (7/8 of the slot count).
+ */
+static orxINLINE orxU32 orxHashTable_GetMaxLoad(orxU32 _u32Size)
+{
+  /* Done! */
+  return _u32Size - (_u32Size >> 3);
+}
+
+/** Matches a control byte value in a group (open addressing).
+ * @param[in] _au8Control Group's control bytes.
+ * @param[in] _u8Value    Value to match.
+ * @return Bitmask of the matching slots in the group.
+ */
+static orxINLINE orxU32 orxHashTable_MatchGroup(const orxU8 *_au8Control, orxU8 _u8Value)
+{
+  orxU32 u32Result;
+
+#ifdef __orxHASHTABLE_SSE2__
+
+  /* Compares all the control bytes at once */
+  u32Result = (orxU32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)_au8Control), _mm_set1_epi8((char)_u8Value)));
+
+#else /* __orxHASHTABLE_SSE2__ */
+
+  orxU32 i;
+
+  /* For all control bytes */
+  for(i = 0, u32Result = 0; i < orxHASHTABLE_KU32_GROUP_SIZE; i++)
+  {
+    /* Match? */
+    if(_au8Control[i] == _u8Value)
+    {
+      /* Updates result */
+      u32Result |= 1 << i;
+    }
+  }
+
+#endif /* __orxHASHTABLE_SSE2__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Matches empty or deleted slots in a group (open addressing).
+ * @param[in] _au8Control Group's control bytes.
+ * @return Bitmask of the free slots in the group.
+ */
+static orxINLINE orxU32 orxHashTable_MatchGroupFree(const orxU8 *_au8Control)
+{
+  orxU32 u32Result;
+
+#ifdef __orxHASHTABLE_SSE2__
+
+  /* Gathers all the high bits at once */
+  u32Result = (orxU32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)_au8Control));
+
+#else /* __orxHASHTABLE_SSE2__ */
+
+  orxU32 i;
+
+  /* For all control bytes */
+  for(i = 0, u32Result = 0; i < orxHASHTABLE_KU32_GROUP_SIZE; i++)
+  {
+    /* Free? */
+    if((_au8Control[i] & orxHASHTABLE_KU8_CONTROL_EMPTY) != 0)
+    {
+      /* Updates result */
+      u32Result |= 1 << i;
+    }
+  }
+
+#endif /* __orxHASHTABLE_SSE2__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Finds the slot of a key (open addressing).
+ * @param[in] _pstHashTable The hash table where search.
+ * @param[in] _u64Key       Key to find.
+ * @param[in] _u64Hash      Hash of the key.
+ * @return Slot index if found, orxU32_UNDEFINED otherwise.
+ */
+static orxINLINE orxU32 orxHashTable_FindSlot(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU64 _u64Hash)
+{
+  orxU32  u32GroupMask, u32Group, u32Step;
+  orxU8   u8Hash;
+  orxU32  u32Result = orxU32_UNDEFINED;
+
+  /* Gets group mask, first group & control hash */
+  u32GroupMask  = (_pstHashTable->u32Size / orxHASHTABLE_KU32_GROUP_SIZE) - 1;
+  u32Group      = (orxU32)(_u64Hash >> orxHASHTABLE_KU32_CONTROL_SHIFT_HASH) & u32GroupMask;
+  u8Hash        = (orxU8)(_u64Hash & orxHASHTABLE_KU8_CONTROL_MASK_HASH);
+
+  /* For all groups in the probe sequence */
+  for(u32Step = 0; u32Step <= u32GroupMask; u32Step++, u32Group = (u32Group + u32Step) & u32GroupMask)
+  {
+    const orxU8  *au8Control;
+    orxU32        u32Match;
+
+    /* Gets group's control bytes */
+    au8Control = _pstHashTable->au8Control + (u32Group * orxHASHTABLE_KU32_GROUP_SIZE);
+
+    /* For all slots with a matching control hash */
+    for(u32Match = orxHashTable_MatchGroup(au8Control, u8Hash); u32Match != 0; u32Match &= u32Match - 1)
+    {
+      orxU32 u32Slot;
+
+      /* Gets slot */
+      u32Slot = (u32Group * orxHASHTABLE_KU32_GROUP_SIZE) + orxMath_GetTrailingZeroCount(u32Match);
+
+      /* Found? */
+      if(_pstHashTable->au64Key[u32Slot] == _u64Key)
+      {
+        /* Updates result */
+        u32Result = u32Slot;
+
+        break;
+      }
+    }
+
+    /* Found or reached end of sequence? */
+    if((u32Result != orxU32_UNDEFINED) || (orxHashTable_MatchGroup(au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY) != 0))
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Finds a free slot for a hash (open addressing).
+ * @param[in] _pstHashTable The hash table where search.
+ * @param[in] _u64Hash      Hash of the key to insert.
+ * @return Slot index.
+ */
+static orxINLINE orxU32 orxHashTable_FindFreeSlot(const orxHASHTABLE *_pstHashTable, orxU64 _u64Hash)
+{
+  orxU32 u32GroupMask, u32Group, u32Step, u32Match;
+
+  /* Gets group mask & first group */
+  u32GroupMask  = (_pstHashTable->u32Size / orxHASHTABLE_KU32_GROUP_SIZE) - 1;
+  u32Group      = (orxU32)(_u64Hash >> orxHASHTABLE_KU32_CONTROL_SHIFT_HASH) & u32GroupMask;
+
+  /* Finds first group with a free slot (always exists as the load factor is kept below 1) */
+  for(u32Step = 0;
+      (u32Match = orxHashTable_MatchGroupFree(_pstHashTable->au8Control + (u32Group * orxHASHTABLE_KU32_GROUP_SIZE))) == 0;
+      u32Step++, u32Group = (u32Group + u32Step) & u32GroupMask)
+  {
+    /* Checks */
+    orxASSERT(u32Step <= u32GroupMask);
+  }
+
+  /* Done! */
+  return (u32Group * orxHASHTABLE_KU32_GROUP_SIZE) + orxMath_GetTrailingZeroCount(u32Match);
+}
+
+/** Rehashes all the items into new storage (open addressing).
+ * @param[in] _pstHashTable The hash table to rehash.
+ * @param[in] _u32Size      New slot count (power of two, multiple of the group size).
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_Rehash(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxU64   *au64Key;
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+  orxASSERT(_u32Size >= orxHASHTABLE_KU32_GROUP_SIZE);
+  orxASSERT(_pstHashTable->u32Count <= orxHashTable_GetMaxLoad(_u32Size));
+
+  /* Allocates keys, data & control bytes at once */
+  au64Key = (orxU64 *)orxMemory_Allocate(_u32Size * (sizeof(orxU64) + sizeof(void *) + sizeof(orxU8)), _pstHashTable->eMemType);
+
+  /* Success? */
+  if(au64Key != orxNULL)
+  {
+    orxU64   *au64OldKey;
+    void    **apOldData;
+    orxU8    *au8OldControl;
+    orxU32    u32OldSize, i;
+
+    /* Stores old storage */
+    au64OldKey    = _pstHashTable->au64Key;
+    apOldData     = _pstHashTable->apData;
+    au8OldControl = _pstHashTable->au8Control;
+    u32OldSize    = _pstHashTable->u32Size;
+
+    /* Updates storage */
+    _pstHashTable->au64Key          = au64Key;
+    _pstHashTable->apData           = (void **)(au64Key + _u32Size);
+    _pstHashTable->au8Control       = (orxU8 *)(_pstHashTable->apData + _u32Size);
+    _pstHashTable->u32Size          = _u32Size;
+    _pstHashTable->u32DeletedCount  = 0;
+
+    /* Clears control bytes */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _u32Size);
+
+    /* For all old slots */
+    for(i = 0; i < u32OldSize; i++)
+    {
+      /* Used? */
+      if((au8OldControl[i] & orxHASHTABLE_KU8_CONTROL_EMPTY) == 0)
+      {
+        orxU64 u64Hash;
+        orxU32 u32Slot;
+
+        /* Gets free slot */
+        u64Hash = orxHashTable_GetHash(au64OldKey[i]);
+        u32Slot = orxHashTable_FindFreeSlot(_pstHashTable, u64Hash);
+
+        /* Moves item */
+        _pstHashTable->au8Control[u32Slot]  = (orxU8)(u64Hash & orxHASHTABLE_KU8_CONTROL_MASK_HASH);
+        _pstHashTable->au64Key[u32Slot]     = au64OldKey[i];
+        _pstHashTable->apData[u32Slot]      = apOldData[i];
+      }
+    }
+
+    /* Had old storage? */
+    if(au64OldKey != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(au64OldKey);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Inserts a new key (open addressing), the key must not be already present.
+ * @param[in] _pstHashTable The hash table where insert.
+ * @param[in] _u64Key       Key to insert.
+ * @param[in] _u64Hash      Hash of the key.
+ * @return Slot index if success, orxU32_UNDEFINED otherwise.
+ */
+static orxU32 orxFASTCALL orxHashTable_InsertSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU64 _u64Hash)
+{
+  orxU32 u32MaxLoad, u32Result = orxU32_UNDEFINED;
+
+  /* Gets max load */
+  u32MaxLoad = orxHashTable_GetMaxLoad(_pstHashTable->u32Size);
+
+  /* Needs more room? */
+  if(_pstHashTable->u32Count + _pstHashTable->u32DeletedCount >= u32MaxLoad)
+  {
+    /* Mostly deleted slots? */
+    if(_pstHashTable->u32Count < (u32MaxLoad >> 1))
+    {
+      /* Purges them */
+      orxHashTable_Rehash(_pstHashTable, _pstHashTable->u32Size);
+    }
+    /* Expandable? */
+    else if(!orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+    {
+      /* Grows */
+      orxHashTable_Rehash(_pstHashTable, _pstHashTable->u32Size << 1);
+    }
+    /* Has deleted slots? */
+    else if((_pstHashTable->u32DeletedCount > 0) && (_pstHashTable->u32Count < u32MaxLoad))
+    {
+      /* Purges them */
+      orxHashTable_Rehash(_pstHashTable, _pstHashTable->u32Size);
+    }
+  }
+
+  /* Has room? */
+  if(_pstHashTable->u32Count + _pstHashTable->u32DeletedCount < orxHashTable_GetMaxLoad(_pstHashTable->u32Size))
+  {
+    /* Gets free slot */
+    u32Result = orxHashTable_FindFreeSlot(_pstHashTable, _u64Hash);
+
+    /* Was deleted? */
+    if(_pstHashTable->au8Control[u32Result] == orxHASHTABLE_KU8_CONTROL_DELETED)
+    {
+      /* Updates deleted count */
+      _pstHashTable->u32DeletedCount--;
+    }
+
+    /* Inits slot */
+    _pstHashTable->au8Control[u32Result]  = (orxU8)(_u64Hash & orxHASHTABLE_KU8_CONTROL_MASK_HASH);
+    _pstHashTable->au64Key[u32Result]     = _u64Key;
+    _pstHashTable->apData[u32Result]      = orxNULL;
+
+    /* Updates count */
+    _pstHashTable->u32Count++;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -112,44 +460,77 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
   orxASSERT(_u32NbKey > 0);
 
-  /* Gets Power of Two size */
-  u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
-
-  /* Allocate memory for a hash table */
-  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
-
-  /* Enough memory ? */
-  if(pstHashTable != orxNULL)
+  /* Open addressing? */
+  if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
   {
-    orxU32 u32Flags;
+    /* Gets Power of Two size that holds all the keys below max load */
+    u32Size = orxMath_GetNextPowerOfTwo(orxMAX(_u32NbKey + (_u32NbKey / 7) + 1, orxHASHTABLE_KU32_GROUP_SIZE));
 
-    /* Set flags */
-    if(_u32Flags == orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
+    /* Allocate memory for a hash table */
+    pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE), _eMemType);
+
+    /* Enough memory ? */
+    if(pstHashTable != orxNULL)
     {
-      u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
+      /* Clean values */
+      orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE));
+
+      /* Inits it */
+      pstHashTable->u32Flags  = _u32Flags;
+      pstHashTable->eMemType  = _eMemType;
+
+      /* Allocates storage */
+      if(orxHashTable_Rehash(pstHashTable, u32Size) == orxSTATUS_FAILURE)
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
-    else
+  }
+  else
+  {
+    /* Gets Power of Two size */
+    u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
+
+    /* Allocate memory for a hash table */
+    pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
+
+    /* Enough memory ? */
+    if(pstHashTable != orxNULL)
     {
-      u32Flags = orxBANK_KU32_FLAG_NONE;
-    }
+      orxU32 u32Flags;
 
-    /* Clean values */
-    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
+      /* Set flags */
+      if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+      {
+        u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
+      }
+      else
+      {
+        u32Flags = orxBANK_KU32_FLAG_NONE;
+      }
 
-    /* Allocate bank for cells */
-    pstHashTable->pstBank = orxBank_Create(u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
+      /* Clean values */
+      orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
 
-    /* Correct bank allocation ? */
-    if(pstHashTable->pstBank != orxNULL)
-    {
-      /* Stores its size */
-      pstHashTable->u32Size = u32Size;
-    }
-    else
-    {
-      /* Allocation problem, returns orxNULL */
-      orxMemory_Free(pstHashTable);
-      pstHashTable = orxNULL;
+      /* Allocate bank for cells */
+      pstHashTable->pstBank = orxBank_Create(u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
+
+      /* Correct bank allocation ? */
+      if(pstHashTable->pstBank != orxNULL)
+      {
+        /* Stores its size, flags & memory type */
+        pstHashTable->u32Size   = u32Size;
+        pstHashTable->u32Flags  = _u32Flags;
+        pstHashTable->eMemType  = _eMemType;
+      }
+      else
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
   }
 
@@ -168,8 +549,17 @@ orxSTATUS orxFASTCALL orxHashTable_Delete(orxHASHTABLE *_pstHashTable)
   /* Clear hash table (unallocate cells) */
   orxHashTable_Clear(_pstHashTable);
 
-  /* Free bank */
-  orxBank_Delete(_pstHashTable->pstBank);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Free storage */
+    orxMemory_Free(_pstHashTable->au64Key);
+  }
+  else
+  {
+    /* Free bank */
+    orxBank_Delete(_pstHashTable->pstBank);
+  }
 
   /* Unallocate memory */
   orxMemory_Free(_pstHashTable);
@@ -187,11 +577,23 @@ orxSTATUS orxFASTCALL orxHashTable_Clear(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear the memory bank */
-  orxBank_Clear(_pstHashTable->pstBank);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Clear the control bytes */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _pstHashTable->u32Size);
+
+    /* Clears deleted count */
+    _pstHashTable->u32DeletedCount = 0;
+  }
+  else
+  {
+    /* Clear the memory bank */
+    orxBank_Clear(_pstHashTable->pstBank);
 
-  /* Clear the hash */
-  orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+    /* Clear the hash */
+    orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+  }
 
   /* Clears count */
   _pstHashTable->u32Count = 0;
@@ -227,8 +629,7 @@ orxU32 orxFASTCALL orxHashTable_GetCount(const orxHASHTABLE *_pstHashTable)
  */
 void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell = orxNULL;
+  void *pResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Get");
@@ -236,32 +637,51 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU32 u32Slot;
+
+    /* Finds the corresponding slot */
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key, orxHashTable_GetHash(_u64Key));
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Updates result */
+    pResult = (u32Slot != orxU32_UNDEFINED) ? _pstHashTable->apData[u32Slot] : orxNULL;
+  }
+  else
+  {
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
+
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Updates result */
+    pResult = (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  return pResult;
 }
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
+ * With orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, the bucket is only valid until the next insertion in the same hash table.
  * @param[in] _pstHashTable   Concerned hashtable
  * @param[in] _u64Key         Key to find
  * @return The bucket associated to the given key if success, orxNULL otherwise
  */
 void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  void              **ppResult;
+  void **ppResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Retrieve");
@@ -269,49 +689,75 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU64 u64Hash;
+    orxU32 u32Slot;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding slot */
+    u64Hash = orxHashTable_GetHash(_u64Key);
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key, u64Hash);
 
-  /* Not found ? */
-  if(pstCell == orxNULL)
+    /* Not found? */
+    if(u32Slot == orxU32_UNDEFINED)
+    {
+      /* Inserts it */
+      u32Slot = orxHashTable_InsertSlot(_pstHashTable, _u64Key, u64Hash);
+    }
+
+    /* Updates result */
+    ppResult = (u32Slot != orxU32_UNDEFINED) ? &(_pstHashTable->apData[u32Slot]) : orxNULL;
+  }
+  else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Not found ? */
+    if(pstCell == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = orxNULL;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = orxNULL;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+        /* Updates count */
+        _pstHashTable->u32Count++;
 
-      /* Updates result */
-      ppResult = &(pstCell->pData);
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
+
+        /* Updates result */
+        ppResult = &(pstCell->pData);
+      }
+      else
+      {
+        /* Updates result */
+        ppResult = orxNULL;
+      }
     }
     else
     {
       /* Updates result */
-      ppResult = orxNULL;
+      ppResult = &(pstCell->pData);
     }
   }
-  else
-  {
-    /* Updates result */
-    ppResult = &(pstCell->pData);
-  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -328,48 +774,75 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Set");
 
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU64 u64Hash;
+    orxU32 u32Slot;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding slot */
+    u64Hash = orxHashTable_GetHash(_u64Key);
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key, u64Hash);
 
-  /* Found ? */
-  if(pstCell != orxNULL)
-  {
-    /* Stores data */
-    pstCell->pData = _pData;
+    /* Not found? */
+    if(u32Slot == orxU32_UNDEFINED)
+    {
+      /* Inserts it */
+      u32Slot = orxHashTable_InsertSlot(_pstHashTable, _u64Key, u64Hash);
+    }
+
+    /* Valid? */
+    if(u32Slot != orxU32_UNDEFINED)
+    {
+      /* Stores data */
+      _pstHashTable->apData[u32Slot] = _pData;
+    }
   }
   else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
+
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
 
-    /* Success? */
+    /* Found ? */
     if(pstCell != orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Stores data */
+      pstCell->pData = _pData;
+    }
+    else
+    {
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = _pData;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+        /* Updates count */
+        _pstHashTable->u32Count++;
+
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
+      }
     }
   }
 
@@ -389,9 +862,7 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  orxSTATUS           eStatus = orxSTATUS_FAILURE;
+  orxSTATUS eStatus = orxSTATUS_FAILURE;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Add");
@@ -400,37 +871,70 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU64 u64Hash;
+
+    /* Gets hash */
+    u64Hash = orxHashTable_GetHash(_u64Key);
+
+    /* Not found? */
+    if(orxHashTable_FindSlot(_pstHashTable, _u64Key, u64Hash) == orxU32_UNDEFINED)
+    {
+      orxU32 u32Slot;
+
+      /* Inserts it */
+      u32Slot = orxHashTable_InsertSlot(_pstHashTable, _u64Key, u64Hash);
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+      /* Success? */
+      if(u32Slot != orxU32_UNDEFINED)
+      {
+        /* Stores data */
+        _pstHashTable->apData[u32Slot] = _pData;
 
-  /* Not found? */
-  if(pstCell == orxNULL)
+        /* Updates result */
+        eStatus = orxSTATUS_SUCCESS;
+      }
+    }
+  }
+  else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Not found? */
+    if(pstCell == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = _pData;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
 
-      /* Updates result */
-      eStatus = orxSTATUS_SUCCESS;
+        /* Updates count */
+        _pstHashTable->u32Count++;
+
+        /* Updates result */
+        eStatus = orxSTATUS_SUCCESS;
+      }
     }
   }
 
@@ -448,8 +952,6 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32 u32Index;                        /* Hash table index */
-  orxHASHTABLE_CELL *pstCell;             /* Cell used to traverse */
   orxSTATUS eStatus = orxSTATUS_FAILURE;  /* Status to return */
 
   /* Profiles */
@@ -458,46 +960,82 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Get the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU32 u32Slot;
 
-  pstCell = _pstHashTable->apstCell[u32Index];
+    /* Finds the corresponding slot */
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key, orxHashTable_GetHash(_u64Key));
 
-  /* Is the first key is the key to remove ? */
-  if(pstCell != orxNULL)
-  {
-    if(pstCell->u64Key == _u64Key)
+    /* Found? */
+    if(u32Slot != orxU32_UNDEFINED)
     {
-      /* The first cell has to be removed */
-      _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
-      orxBank_Free(_pstHashTable->pstBank, pstCell);
+      /* Group still has an empty slot? (no probe sequence goes past this group, the slot can be emptied) */
+      if(orxHashTable_MatchGroup(_pstHashTable->au8Control + (u32Slot & ~(orxHASHTABLE_KU32_GROUP_SIZE - 1)), orxHASHTABLE_KU8_CONTROL_EMPTY) != 0)
+      {
+        /* Empties slot */
+        _pstHashTable->au8Control[u32Slot] = orxHASHTABLE_KU8_CONTROL_EMPTY;
+      }
+      else
+      {
+        /* Marks slot as deleted */
+        _pstHashTable->au8Control[u32Slot] = orxHASHTABLE_KU8_CONTROL_DELETED;
+
+        /* Updates deleted count */
+        _pstHashTable->u32DeletedCount++;
+      }
 
       /* Operation succeed */
       eStatus = orxSTATUS_SUCCESS;
     }
-    else
+  }
+  else
+  {
+    orxU32 u32Index;                        /* Hash table index */
+    orxHASHTABLE_CELL *pstCell;             /* Cell used to traverse */
+
+    /* Get the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    pstCell = _pstHashTable->apstCell[u32Index];
+
+    /* Is the first key is the key to remove ? */
+    if(pstCell != orxNULL)
     {
-      /* Traverse to find the key */
-      while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+      if(pstCell->u64Key == _u64Key)
       {
-        /* Try with next cell */
-        pstCell = pstCell->pstNext;
-      }
+        /* The first cell has to be removed */
+        _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
+        orxBank_Free(_pstHashTable->pstBank, pstCell);
 
-      /* Cell found ? (key should be on the next cell) */
-      if(pstCell->pstNext != orxNULL)
+        /* Operation succeed */
+        eStatus = orxSTATUS_SUCCESS;
+      }
+      else
       {
-        orxHASHTABLE_CELL *pstRemoveCell;
+        /* Traverse to find the key */
+        while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+        {
+          /* Try with next cell */
+          pstCell = pstCell->pstNext;
+        }
 
-        /* We found it, remove this cell */
-        pstRemoveCell = pstCell->pstNext;
-        pstCell->pstNext = pstRemoveCell->pstNext;
+        /* Cell found ? (key should be on the next cell) */
+        if(pstCell->pstNext != orxNULL)
+        {
+          orxHASHTABLE_CELL *pstRemoveCell;
 
-        /* Free cell from bank */
-        orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+          /* We found it, remove this cell */
+          pstRemoveCell = pstCell->pstNext;
+          pstCell->pstNext = pstRemoveCell->pstNext;
 
-        /* Operation succeed */
-        eStatus = orxSTATUS_SUCCESS;
+          /* Free cell from bank */
+          orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+
+          /* Operation succeed */
+          eStatus = orxSTATUS_SUCCESS;
+        }
       }
     }
   }
@@ -529,60 +1067,102 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
  */
 orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, orxHANDLE _hIterator, orxU64 *_pu64Key, void **_ppData)
 {
-  orxHASHTABLE_CELL  *pstCell;
-  orxU32              u32Index;
-  orxHANDLE           hResult;
+  orxHANDLE hResult;
 
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has iterator? */
-  if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
   {
-    /* Gets current cell */
-    pstCell = (orxHASHTABLE_CELL *)_hIterator;
+    orxU32 u32Slot;
+
+    /* Gets start slot (iterators store the next slot index) */
+    u32Slot = ((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED)) ? (orxU32)(orxUPTR)_hIterator : 0;
+
+    /* Finds next used slot */
+    for(; (u32Slot < _pstHashTable->u32Size) && ((_pstHashTable->au8Control[u32Slot] & orxHASHTABLE_KU8_CONTROL_EMPTY) != 0); u32Slot++)
+    ;
 
-    /* Gets start index */
-    u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
+    /* Found? */
+    if(u32Slot < _pstHashTable->u32Size)
+    {
+      /* Asked for key? */
+      if(_pu64Key != orxNULL)
+      {
+        /* Updates it */
+        *_pu64Key = _pstHashTable->au64Key[u32Slot];
+      }
+
+      /* Asked for data? */
+      if(_ppData != orxNULL)
+      {
+        /* Updates it */
+        *_ppData = _pstHashTable->apData[u32Slot];
+      }
 
-    /* Updates temporary result */
-    pstCell = pstCell->pstNext;
+      /* Updates result */
+      hResult = (orxHANDLE)(orxUPTR)(u32Slot + 1);
+    }
+    else
+    {
+      /* Updates result */
+      hResult = orxHANDLE_UNDEFINED;
+    }
   }
   else
   {
-    /* Starts a new search */
-    u32Index  = 0;
-    pstCell   = orxNULL;
-  }
+    orxHASHTABLE_CELL  *pstCell;
+    orxU32              u32Index;
 
-  /* Finds next head cell if needed */
-  for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
-  ;
+    /* Has iterator? */
+    if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+    {
+      /* Gets current cell */
+      pstCell = (orxHASHTABLE_CELL *)_hIterator;
 
-  /* Found? */
-  if(pstCell != orxNULL)
-  {
-    /* Asked for key? */
-    if(_pu64Key != orxNULL)
+      /* Gets start index */
+      u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
+
+      /* Updates temporary result */
+      pstCell = pstCell->pstNext;
+    }
+    else
     {
-      /* Updates it */
-      *_pu64Key = pstCell->u64Key;
+      /* Starts a new search */
+      u32Index  = 0;
+      pstCell   = orxNULL;
     }
 
-    /* Asked for data? */
-    if(_ppData != orxNULL)
+    /* Finds next head cell if needed */
+    for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
+    ;
+
+    /* Found? */
+    if(pstCell != orxNULL)
     {
-      /* Updates it */
-      *_ppData = pstCell->pData;
-    }
+      /* Asked for key? */
+      if(_pu64Key != orxNULL)
+      {
+        /* Updates it */
+        *_pu64Key = pstCell->u64Key;
+      }
 
-    /* Updates result */
-    hResult = (orxHANDLE)pstCell;
-  }
-  else
-  {
-    /* Updates result */
-    hResult = orxHANDLE_UNDEFINED;
+      /* Asked for data? */
+      if(_ppData != orxNULL)
+      {
+        /* Updates it */
+        *_ppData = pstCell->pData;
+      }
+
+      /* Updates result */
+      hResult = (orxHANDLE)pstCell;
+    }
+    else
+    {
+      /* Updates result */
+      hResult = orxHANDLE_UNDEFINED;
+    }
   }
 
   /* Done! */
@@ -600,8 +1180,18 @@ orxSTATUS orxFASTCALL orxHashTable_Optimize(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Has deleted slots? */
+    if(_pstHashTable->u32DeletedCount > 0)
+    {
+      /* Purges them (shortens probe sequences) */
+      eResult = orxHashTable_Rehash(_pstHashTable, _pstHashTable->u32Size);
+    }
+  }
   /* Has elements? */
-  if(_pstHashTable->u32Count > 0)
+  else if(_pstHashTable->u32Count > 0)
   {
     orxHASHTABLE_CELL *astWorkBuffer;
 
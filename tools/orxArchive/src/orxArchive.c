@@ -0,0 +1,700 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2022 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxArchive.c
+ *
+ * Archive tool: packs files into archives that can be used with the archive: resource storage
+ *
+ */
+
+
+#include "orx.h"
+
+#define LZ4_FREESTANDING                          1
+
+#define LZ4_memmove(dst, src, size)               orxMemory_Move((dst), (src), (orxU32)(size))
+#define LZ4_memcpy(dst, src, size)                orxMemory_Copy((dst), (src), (orxU32)(size))
+#define LZ4_memset(dst, data, size)               orxMemory_Set((dst), (data), (orxU32)(size))
+
+#include "lz4.c"
+#include "lz4hc.c"
+
+#undef LZ4_FREESTANDING
+
+
+/** Module flags
+ */
+#define orxARCHIVE_KU32_STATIC_FLAG_NONE          0x00000000  /**< No flags */
+
+#define orxARCHIVE_KU32_STATIC_FLAG_STORE         0x00000001  /**< Store (no compression) flag */
+
+#define orxARCHIVE_KU32_STATIC_MASK_ALL           0xFFFFFFFF  /**< All mask */
+
+
+/** Defines
+ */
+#define orxARCHIVE_KZ_DEFAULT_OUTPUT              "archive.orxa"
+
+#define orxARCHIVE_KU32_NAME_SIZE                 1024
+
+#define orxARCHIVE_KZ_LOG_TAG_LENGTH              "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxARCHIVE_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxARCHIVE_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxARCHIVE_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxARCHIVE_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Entry structure
+ */
+typedef struct __orxARCHIVE_ENTRY_t
+{
+  orxSTRING   zName;
+  orxSTRING   zFullName;
+  orxU64      u64NameID;
+  orxU64      u64Offset;
+  orxU64      u64Size;
+  orxU32      u32NameOffset;
+  orxU32      u32BlockCount;
+
+} orxARCHIVE_ENTRY;
+
+/** Static structure
+ */
+typedef struct __orxARCHIVE_STATIC_t
+{
+  orxARCHIVE_ENTRY *astEntryList;
+  orxSTRING         zRoot;
+  orxSTRING         zOutputFile;
+  orxU32            u32EntryCount;
+  orxU32            u32EntrySize;
+  orxU32            u32BlockSize;
+  orxU32            u32Flags;
+
+} orxARCHIVE_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxARCHIVE_STATIC sstArchive;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static void WriteU32(orxU8 *_pu8Data, orxU32 _u32Value)
+{
+  // Stores it (little endian)
+  _pu8Data[0] = (orxU8)(_u32Value);
+  _pu8Data[1] = (orxU8)(_u32Value >> 8);
+  _pu8Data[2] = (orxU8)(_u32Value >> 16);
+  _pu8Data[3] = (orxU8)(_u32Value >> 24);
+}
+
+static void WriteU64(orxU8 *_pu8Data, orxU64 _u64Value)
+{
+  // Stores it (little endian)
+  WriteU32(_pu8Data, (orxU32)_u64Value);
+  WriteU32(_pu8Data + 4, (orxU32)(_u64Value >> 32));
+}
+
+static int orxCDECL CompareEntries(const void *_pEntry1, const void *_pEntry2)
+{
+  const orxARCHIVE_ENTRY *pstEntry1, *pstEntry2;
+
+  // Gets entries
+  pstEntry1 = (const orxARCHIVE_ENTRY *)_pEntry1;
+  pstEntry2 = (const orxARCHIVE_ENTRY *)_pEntry2;
+
+  // Done!
+  return (pstEntry1->u64NameID < pstEntry2->u64NameID) ? -1 : (pstEntry1->u64NameID > pstEntry2->u64NameID) ? 1 : orxString_Compare(pstEntry1->zName, pstEntry2->zName);
+}
+
+static orxSTATUS AddEntry(const orxSTRING _zName, const orxSTRING _zFullName, orxS64 _s64Size)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Needs to grow entry list?
+  if(sstArchive.u32EntryCount == sstArchive.u32EntrySize)
+  {
+    orxARCHIVE_ENTRY *astEntryList;
+    orxU32            u32Size;
+
+    // Gets new size
+    u32Size = (sstArchive.u32EntrySize != 0) ? sstArchive.u32EntrySize << 1 : 64;
+
+    // Grows list
+    astEntryList = (orxARCHIVE_ENTRY *)orxMemory_Reallocate(sstArchive.astEntryList, u32Size * sizeof(orxARCHIVE_ENTRY), orxMEMORY_TYPE_TEMP);
+
+    // Success?
+    if(astEntryList)
+    {
+      // Stores it
+      sstArchive.astEntryList = astEntryList;
+      sstArchive.u32EntrySize = u32Size;
+    }
+    else
+    {
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxARCHIVE_ENTRY *pstEntry;
+
+    // Inits entry
+    pstEntry = &sstArchive.astEntryList[sstArchive.u32EntryCount++];
+    orxMemory_Zero(pstEntry, sizeof(orxARCHIVE_ENTRY));
+    pstEntry->zName         = orxString_Duplicate(_zName);
+    pstEntry->zFullName     = orxString_Duplicate(_zFullName);
+    pstEntry->u64NameID     = (orxU64)orxString_Hash(_zName);
+    pstEntry->u64Size       = (orxU64)_s64Size;
+    pstEntry->u32BlockCount = (orxU32)((pstEntry->u64Size + sstArchive.u32BlockSize - 1) / sstArchive.u32BlockSize);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS AddDirectory(const orxSTRING _zName)
+{
+  orxFILE_INFO  stFileInfo;
+  orxCHAR       acPattern[orxARCHIVE_KU32_NAME_SIZE];
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  // Gets search pattern
+  orxString_NPrint(acPattern, sizeof(acPattern), "%s%s%s/*", sstArchive.zRoot, (*_zName != orxCHAR_NULL) ? "/" : orxSTRING_EMPTY, _zName);
+
+  // For all files
+  if(orxFile_FindFirst(acPattern, &stFileInfo) != orxSTATUS_FAILURE)
+  {
+    do
+    {
+      // Not current/parent directory?
+      if(orxString_Compare(stFileInfo.zName, ".") && orxString_Compare(stFileInfo.zName, ".."))
+      {
+        orxCHAR acName[orxARCHIVE_KU32_NAME_SIZE];
+
+        // Gets entry name (relative to root, using forward slashes)
+        orxString_NPrint(acName, sizeof(acName), "%s%s%s", _zName, (*_zName != orxCHAR_NULL) ? "/" : orxSTRING_EMPTY, stFileInfo.zName);
+
+        // Directory?
+        if(orxFLAG_TEST(stFileInfo.u32Flags, orxFILE_KU32_FLAG_INFO_DIRECTORY))
+        {
+          // Adds its content
+          eResult = AddDirectory(acName);
+        }
+        else
+        {
+          // Adds it
+          eResult = AddEntry(acName, stFileInfo.zFullName, stFileInfo.s64Size);
+        }
+      }
+    } while((eResult != orxSTATUS_FAILURE) && (orxFile_FindNext(&stFileInfo) != orxSTATUS_FAILURE));
+
+    // Ends search
+    orxFile_FindClose(&stFileInfo);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS WriteEntry(orxFILE *_pstOutput, orxARCHIVE_ENTRY *_pstEntry, orxU8 *_pu8Buffer, orxU8 *_pu8PackedBuffer, orxU8 *_pu8BlockTable, orxU64 *_pu64PackedSize)
+{
+  orxFILE  *pstInput;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Opens input
+  pstInput = orxFile_Open(_pstEntry->zFullName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  // Success?
+  if(pstInput)
+  {
+    orxS64  s64Offset;
+    orxU32  u32TableSize, i;
+
+    // Gets offsets
+    u32TableSize        = _pstEntry->u32BlockCount * sizeof(orxU32);
+    _pstEntry->u64Offset = (orxU64)orxFile_Tell(_pstOutput);
+    s64Offset           = (orxS64)_pstEntry->u64Offset + u32TableSize;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // For all blocks
+    for(i = 0; (i < _pstEntry->u32BlockCount) && (eResult != orxSTATUS_FAILURE); i++)
+    {
+      orxU32 u32Size;
+
+      // Gets its size
+      u32Size = (orxU32)orxMIN((orxU64)sstArchive.u32BlockSize, _pstEntry->u64Size - (orxU64)i * sstArchive.u32BlockSize);
+
+      // Reads it
+      if(orxFile_Read(_pu8Buffer, sizeof(orxU8), u32Size, pstInput) == u32Size)
+      {
+        const orxU8  *pu8Block;
+        orxS32        s32PackedSize = 0;
+
+        // Compresses it
+        if(!orxFLAG_TEST(sstArchive.u32Flags, orxARCHIVE_KU32_STATIC_FLAG_STORE))
+        {
+          s32PackedSize = (orxS32)LZ4_compress_HC((const char *)_pu8Buffer, (char *)_pu8PackedBuffer, (int)u32Size, (int)(u32Size - 1), LZ4HC_CLEVEL_MAX);
+        }
+
+        // Not worth it?
+        if((s32PackedSize <= 0) || ((orxU32)s32PackedSize >= u32Size))
+        {
+          // Stores it uncompressed
+          pu8Block      = _pu8Buffer;
+          s32PackedSize = (orxS32)u32Size;
+        }
+        else
+        {
+          // Stores it compressed
+          pu8Block = _pu8PackedBuffer;
+        }
+
+        // Updates block table
+        WriteU32(_pu8BlockTable + i * sizeof(orxU32), (orxU32)s32PackedSize);
+
+        // Writes block
+        if((orxFile_Seek(_pstOutput, s64Offset, orxSEEK_OFFSET_WHENCE_START) >= 0)
+        && (orxFile_Write(pu8Block, sizeof(orxU8), s32PackedSize, _pstOutput) == s32PackedSize))
+        {
+          // Updates offset
+          s64Offset        += s32PackedSize;
+          *_pu64PackedSize += (orxU64)s32PackedSize;
+        }
+        else
+        {
+          // Updates result
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+      else
+      {
+        // Updates result
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    // Writes block table
+    if((eResult != orxSTATUS_FAILURE)
+    && ((orxFile_Seek(_pstOutput, (orxS64)_pstEntry->u64Offset, orxSEEK_OFFSET_WHENCE_START) < 0)
+     || (orxFile_Write(_pu8BlockTable, sizeof(orxU8), u32TableSize, _pstOutput) != u32TableSize)
+     || (orxFile_Seek(_pstOutput, s64Offset, orxSEEK_OFFSET_WHENCE_START) < 0)))
+    {
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+
+    // Closes input
+    orxFile_Close(pstInput);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessRootParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid root parameter?
+  if(_u32ParamCount > 1)
+  {
+    // Stores it
+    sstArchive.zRoot = orxString_Duplicate(_azParams[1]);
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxARCHIVE_LOG(ROOT, "No valid root directory found, aborting");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessOutputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Has a valid output parameter?
+  if(_u32ParamCount > 1)
+  {
+    // Stores it
+    sstArchive.zOutputFile = orxString_Duplicate(_azParams[1]);
+  }
+  else
+  {
+    // Logs message
+    orxARCHIVE_LOG(OUTPUT, "No valid output found, using default");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessBlockSizeParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid block size parameter?
+  if(_u32ParamCount > 1)
+  {
+    orxU32 u32BlockSize;
+
+    // Valid?
+    if((orxString_ToU32(_azParams[1], &u32BlockSize, orxNULL) != orxSTATUS_FAILURE) && (u32BlockSize >= 1024))
+    {
+      // Stores it
+      sstArchive.u32BlockSize = u32BlockSize;
+
+      // Updates result
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      // Logs message
+      orxARCHIVE_LOG(BLOCK, "Invalid block size [%s] (minimum: 1024), aborting", _azParams[1]);
+    }
+  }
+  else
+  {
+    // Logs message
+    orxARCHIVE_LOG(BLOCK, "No valid block size found, using default");
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessStoreParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Updates status
+  orxFLAG_SET(sstArchive.u32Flags, orxARCHIVE_KU32_STATIC_FLAG_STORE, orxARCHIVE_KU32_STATIC_FLAG_NONE);
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxARCHIVE_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxARCHIVE_DECLARE_PARAM("r", "root", "Root directory", "Directory whose content (recursively) will be packed, entry names are relative to it", ProcessRootParams)
+    orxARCHIVE_DECLARE_PARAM("o", "output", "Output file", "Archive file that will be created, to be used with an archive:<output> resource storage", ProcessOutputParams)
+    orxARCHIVE_DECLARE_PARAM("b", "blocksize", "Block size", "Uncompressed size of the blocks that are compressed independently, allowing random access, defaults to 65536", ProcessBlockSizeParams)
+    orxARCHIVE_DECLARE_PARAM("s", "store", "Store mode", "If this switch is provided, content will be stored uncompressed, allowing it to be memory mapped at runtime", ProcessStoreParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstArchive, sizeof(orxARCHIVE_STATIC));
+
+  // Inits block size
+  sstArchive.u32BlockSize = orxRESOURCE_KU32_ARCHIVE_DEFAULT_BLOCK_SIZE;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  // Has entries?
+  if(sstArchive.astEntryList)
+  {
+    orxU32 i;
+
+    // For all entries
+    for(i = 0; i < sstArchive.u32EntryCount; i++)
+    {
+      // Frees its strings
+      orxString_Delete(sstArchive.astEntryList[i].zName);
+      orxString_Delete(sstArchive.astEntryList[i].zFullName);
+    }
+
+    // Frees entry list
+    orxMemory_Free(sstArchive.astEntryList);
+  }
+
+  // Has root?
+  if(sstArchive.zRoot)
+  {
+    // Frees its string
+    orxString_Delete(sstArchive.zRoot);
+  }
+
+  // Has output file?
+  if(sstArchive.zOutputFile)
+  {
+    // Frees its string
+    orxString_Delete(sstArchive.zOutputFile);
+  }
+}
+
+static void Run()
+{
+  // Has root?
+  if(sstArchive.zRoot)
+  {
+    // Scans it
+    if((AddDirectory(orxSTRING_EMPTY) != orxSTATUS_FAILURE) && (sstArchive.u32EntryCount != 0))
+    {
+      const orxSTRING zOutputFile;
+      orxFILE        *pstOutput;
+      orxU64          u64Size = 0, u64PackedSize = 0;
+      orxU32          u32NameTableSize, u32MaxBlockCount, i;
+
+      // Sorts entries by name ID
+      qsort(sstArchive.astEntryList, sstArchive.u32EntryCount, sizeof(orxARCHIVE_ENTRY), &CompareEntries);
+
+      // For all entries
+      for(i = 0, u32NameTableSize = 0, u32MaxBlockCount = 1; i < sstArchive.u32EntryCount; i++)
+      {
+        // Stores its name offset
+        sstArchive.astEntryList[i].u32NameOffset = u32NameTableSize;
+
+        // Updates sizes
+        u32NameTableSize += orxString_GetLength(sstArchive.astEntryList[i].zName) + 1;
+        u32MaxBlockCount  = orxMAX(u32MaxBlockCount, sstArchive.astEntryList[i].u32BlockCount);
+      }
+
+      // Selects correct output file
+      zOutputFile = (sstArchive.zOutputFile) ? sstArchive.zOutputFile : orxARCHIVE_KZ_DEFAULT_OUTPUT;
+
+      // Opens it
+      pstOutput = orxFile_Open(zOutputFile, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+      // Success?
+      if(pstOutput)
+      {
+        orxU8    *pu8Index, *pu8Buffer, *pu8PackedBuffer, *pu8BlockTable;
+        orxU32    u32IndexSize;
+        orxSTATUS eResult = orxSTATUS_FAILURE;
+
+        // Allocates buffers
+        u32IndexSize    = orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE + sstArchive.u32EntryCount * orxRESOURCE_KU32_ARCHIVE_ENTRY_SIZE;
+        pu8Index        = (orxU8 *)orxMemory_Allocate(u32IndexSize, orxMEMORY_TYPE_TEMP);
+        pu8Buffer       = (orxU8 *)orxMemory_Allocate(sstArchive.u32BlockSize, orxMEMORY_TYPE_TEMP);
+        pu8PackedBuffer = (orxU8 *)orxMemory_Allocate(sstArchive.u32BlockSize, orxMEMORY_TYPE_TEMP);
+        pu8BlockTable   = (orxU8 *)orxMemory_Allocate(u32MaxBlockCount * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+
+        // Checks
+        orxASSERT(pu8Index && pu8Buffer && pu8PackedBuffer && pu8BlockTable);
+
+        // Reserves header & index
+        orxMemory_Zero(pu8Index, u32IndexSize);
+        if(orxFile_Write(pu8Index, sizeof(orxU8), u32IndexSize, pstOutput) == u32IndexSize)
+        {
+          // Updates result
+          eResult = orxSTATUS_SUCCESS;
+
+          // Writes name table
+          for(i = 0; (i < sstArchive.u32EntryCount) && (eResult != orxSTATUS_FAILURE); i++)
+          {
+            orxS64 s64Length;
+
+            // Writes name
+            s64Length = (orxS64)orxString_GetLength(sstArchive.astEntryList[i].zName) + 1;
+            eResult   = (orxFile_Write(sstArchive.astEntryList[i].zName, sizeof(orxCHAR), s64Length, pstOutput) == s64Length) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+          }
+
+          // For all entries
+          for(i = 0; (i < sstArchive.u32EntryCount) && (eResult != orxSTATUS_FAILURE); i++)
+          {
+            orxARCHIVE_ENTRY *pstEntry;
+
+            // Gets it
+            pstEntry = &sstArchive.astEntryList[i];
+
+            // Writes its content
+            eResult = WriteEntry(pstOutput, pstEntry, pu8Buffer, pu8PackedBuffer, pu8BlockTable, &u64PackedSize);
+
+            // Success?
+            if(eResult != orxSTATUS_FAILURE)
+            {
+              // Logs message
+              orxARCHIVE_LOG(ADD, "%-48.48s %10llu bytes, %u block(s)", pstEntry->zName, pstEntry->u64Size, pstEntry->u32BlockCount);
+
+              // Updates total size
+              u64Size += pstEntry->u64Size;
+            }
+            else
+            {
+              // Logs message
+              orxARCHIVE_LOG(ADD, "%-48.48s FAILURE, aborting.", pstEntry->zName);
+            }
+          }
+
+          // Success?
+          if(eResult != orxSTATUS_FAILURE)
+          {
+            // Encodes header
+            orxMemory_Copy(pu8Index, orxRESOURCE_KZ_ARCHIVE_BINARY_TAG, 4);
+            WriteU32(pu8Index + 4, sstArchive.u32EntryCount);
+            WriteU32(pu8Index + 8, sstArchive.u32BlockSize);
+            WriteU32(pu8Index + 12, u32NameTableSize);
+
+            // For all entries
+            for(i = 0; i < sstArchive.u32EntryCount; i++)
+            {
+              const orxARCHIVE_ENTRY *pstEntry;
+              orxU8                  *pu8Entry;
+
+              // Gets it
+              pstEntry = &sstArchive.astEntryList[i];
+              pu8Entry = pu8Index + orxRESOURCE_KU32_ARCHIVE_HEADER_SIZE + i * orxRESOURCE_KU32_ARCHIVE_ENTRY_SIZE;
+
+              // Encodes it
+              WriteU64(pu8Entry, pstEntry->u64NameID);
+              WriteU64(pu8Entry + 8, pstEntry->u64Offset);
+              WriteU64(pu8Entry + 16, pstEntry->u64Size);
+              WriteU32(pu8Entry + 24, pstEntry->u32NameOffset);
+              WriteU32(pu8Entry + 28, pstEntry->u32BlockCount);
+            }
+
+            // Writes header & index
+            eResult = ((orxFile_Seek(pstOutput, 0, orxSEEK_OFFSET_WHENCE_START) >= 0)
+                    && (orxFile_Write(pu8Index, sizeof(orxU8), u32IndexSize, pstOutput) == u32IndexSize)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+          }
+        }
+
+        // Frees buffers
+        orxMemory_Free(pu8Index);
+        orxMemory_Free(pu8Buffer);
+        orxMemory_Free(pu8PackedBuffer);
+        orxMemory_Free(pu8BlockTable);
+
+        // Closes output
+        orxFile_Close(pstOutput);
+
+        // Success?
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          // Logs message
+          orxARCHIVE_LOG(SAVE, "==== %-24.24s SUCCESS: %u entries, %llu -> %llu bytes", zOutputFile, sstArchive.u32EntryCount, u64Size, u64PackedSize);
+        }
+        else
+        {
+          // Deletes incomplete archive
+          orxFile_Delete(zOutputFile);
+
+          // Logs message
+          orxARCHIVE_LOG(SAVE, "==== %-24.24s FAILURE, aborting.", zOutputFile);
+        }
+      }
+      else
+      {
+        // Logs message
+        orxARCHIVE_LOG(SAVE, "==== %-24.24s FAILURE, can't open file, aborting.", zOutputFile);
+      }
+    }
+    else
+    {
+      // Logs message
+      orxARCHIVE_LOG(PROCESS, "No files found in [%s], can't process.", sstArchive.zRoot);
+    }
+  }
+  else
+  {
+    // Logs message
+    orxARCHIVE_LOG(PROCESS, "No root directory, can't process.");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}